@@ -16,6 +16,7 @@
 #ifndef ACCESSIBILITY_ELEMENT_OPERATOR_CALLBACK_PROXY_H
 #define ACCESSIBILITY_ELEMENT_OPERATOR_CALLBACK_PROXY_H
 
+#include "accessibility_element_info_parcel.h"
 #include "accessibility_ipc_interface_code.h"
 #include "iaccessibility_element_operator_callback.h"
 #include "iremote_proxy.h"
@@ -130,6 +131,28 @@ public:
     void SetRemoveAccessibilityVirtualNodeResult(const OperateVirtualNodeResult result,
         const int32_t requestId) override;
 
+    /**
+     * @brief Set the results of SearchElementInfosBatch to AA.
+     * @param results One result per query, in the order of the queries.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     */
+    void SetSearchElementInfosBatchResult(const std::vector<ElementSearchResult> &results,
+        const int32_t requestId) override;
+
+    /**
+     * @brief Set the result of SearchElementTreeDiff to AA.
+     * @param diff The nodes changed after the generation of the request.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     */
+    void SetSearchElementTreeDiffResult(const ElementTreeDiff &diff, const int32_t requestId) override;
+
+    /**
+     * @brief Set the encoding of the element infos sent to AA, LEGACY until the requester announced
+     *    that it can read a newer one.
+     * @param encoding The element info encoding agreed with the requester.
+     */
+    void SetElementInfoEncoding(const ElementInfoEncoding encoding);
+
 private:
     /**
      * @brief Write the descriptor of IPC.
@@ -158,7 +181,17 @@ private:
      */
     bool WriteElementInfosToRawData(const std::list<AccessibilityElementInfo> &infos, MessageParcel &data);
 
+    /**
+     * @brief Write serialized element infos to MessageParcel. Results larger than
+     *    ASHMEM_TRANSPORT_THRESHOLD go through a shared memory region, smaller ones as raw data.
+     * @param tmpParcel The parcel holding the serialized element infos.
+     * @param data The MessageParcel to write to.
+     * @return true: Write successfully; otherwise is false.
+     */
+    bool WriteElementInfoParcelData(MessageParcel &tmpParcel, MessageParcel &data);
+
     static inline BrokerDelegator<AccessibilityElementOperatorCallbackProxy> delegator;
+    ElementInfoEncoding encoding_ = ElementInfoEncoding::LEGACY;
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -152,6 +152,22 @@ private:
      */
     ErrCode HandleSetRemoveAccessibilityVirtualNodeResult(MessageParcel &data, MessageParcel &reply);
 
+    /**
+     * @brief Handle IPC request for function:SetSearchElementInfosBatchResult.
+     * @param data The data of process communication
+     * @param reply The response of IPC request
+     * @return NO_ERROR: successful; otherwise is failed.
+     */
+    ErrCode HandleSetSearchElementInfosBatchResult(MessageParcel &data, MessageParcel &reply);
+
+    /**
+     * @brief Handle IPC request for function:SetSearchElementTreeDiffResult.
+     * @param data The data of process communication
+     * @param reply The response of IPC request
+     * @return NO_ERROR: successful; otherwise is failed.
+     */
+    ErrCode HandleSetSearchElementTreeDiffResult(MessageParcel &data, MessageParcel &reply);
+
     using AccessibilityElementOperatorCallbackFunc =
         ErrCode (AccessibilityElementOperatorCallbackStub::*)(MessageParcel &data, MessageParcel &reply);
 };
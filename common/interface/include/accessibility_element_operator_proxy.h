@@ -226,6 +226,39 @@ public:
     virtual void RemoveAccessibilityVirtualNode(const int64_t id, const int32_t requestId,
         const sptr<IAccessibilityElementOperatorCallback> &callback) override;
 
+    /**
+     * @brief Run several searches in one transaction.
+     * @param queries The queries, executed in order against the same tree.
+     * @param requestId Matched the request and response.
+     * @param callback To transfer the results to ASAC.
+     * @param isFilter Whether the sensitive properties of the found nodes are cleared.
+     */
+    virtual void SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter = false) override;
+
+    /**
+     * @brief Create an operator which only answers the searches by accessibility id.
+     * @param grantId The id the operator is revoked with.
+     * @param grantedOperator The operator created for the grant.
+     * @return Returns RET_OK if successful, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError GrantElementOperator(const int32_t grantId, sptr<IRemoteObject> &grantedOperator) override;
+
+    /**
+     * @brief Revoke a granted operator.
+     * @param grantId The id the operator was granted with.
+     */
+    virtual void RevokeElementOperator(const int32_t grantId) override;
+
+    /**
+     * @brief Search the nodes of the window tree changed after sinceGeneration.
+     * @param sinceGeneration The generation AA already has.
+     * @param requestId Matched the request and response. It needn't cared by ACE, transfer it by callback only.
+     * @param callback  To transfer the diff to AA.
+     */
+    virtual void SearchElementTreeDiff(const uint64_t sinceGeneration, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+
 private:
     bool isFilter = false;
 
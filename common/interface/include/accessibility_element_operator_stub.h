@@ -188,6 +188,38 @@ private:
      * @return NO_ERROR: successful; otherwise is failed.
      */
     ErrCode HandleRemoveAccessibilityVirtualNode(MessageParcel &data, MessageParcel &reply);
+
+    /**
+     * @brief Handle the IPC request for the function:SearchElementInfosBatch.
+     * @param data The data of process communication
+     * @param reply The response of IPC request
+     * @return NO_ERROR: successful; otherwise is failed.
+     */
+    ErrCode HandleSearchElementInfosBatch(MessageParcel &data, MessageParcel &reply);
+
+    /**
+     * @brief Handle the IPC request for the function:GrantElementOperator.
+     * @param data The data of process communication
+     * @param reply The response of IPC request
+     * @return NO_ERROR: successful; otherwise is failed.
+     */
+    ErrCode HandleGrantElementOperator(MessageParcel &data, MessageParcel &reply);
+
+    /**
+     * @brief Handle the IPC request for the function:RevokeElementOperator.
+     * @param data The data of process communication
+     * @param reply The response of IPC request
+     * @return NO_ERROR: successful; otherwise is failed.
+     */
+    ErrCode HandleRevokeElementOperator(MessageParcel &data, MessageParcel &reply);
+
+    /**
+     * @brief Handle the IPC request for the function:SearchElementTreeDiff.
+     * @param data The data of process communication
+     * @param reply The response of IPC request
+     * @return NO_ERROR: successful; otherwise is failed.
+     */
+    ErrCode HandleSearchElementTreeDiff(MessageParcel &data, MessageParcel &reply);
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -32,6 +32,8 @@ namespace Accessibility {
         SET_RESULT_UPDATE_ACCESSIBILITY_ELEMENT_INFO,
         SET_RESULT_ADD_ACCESSIBILITY_VIRTUAL_NODE,
         SET_RESULT_REMOVE_ACCESSIBILITY_VIRTUAL_NODE,
+        SET_RESULT_SEARCH_ELEMENTINFOS_BATCH,
+        SET_RESULT_SEARCH_ELEMENT_TREE_DIFF,
 
         SEARCH_BY_ACCESSIBILITY_ID = 200,
         SEARCH_BY_TEXT,
@@ -51,6 +53,10 @@ namespace Accessibility {
         ASAC_UPDATE_ACCESSIBILITY_ELEMENT_INFO,
         ASAC_ADD_ACCESSIBILITY_VIRTUAL_NODE,
         ASAC_REMOVE_ACCESSIBILITY_VIRTUAL_NODE,
+        ASAC_SEARCH_ELEMENTINFOS_BATCH,
+        ASAC_GRANT_ELEMENT_OPERATOR,
+        ASAC_REVOKE_ELEMENT_OPERATOR,
+        ASAC_SEARCH_ELEMENT_TREE_DIFF,
 
         ON_ACCESSIBILITY_ENABLE_ABILITY_LISTS_CHANGED = 300,
         ON_ACCESSIBILITY_INSTALL_ABILITY_LISTS_CHANGED,
@@ -87,12 +93,16 @@ namespace Accessibility {
         UPDATE_ACCESSIBILITY_ELEMENT_INFO,
         ADD_ACCESSIBILITY_VIRTUAL_NODE,
         REMOVE_ACCESSIBILITY_VIRTUAL_NODE,
+        SEARCH_ELEMENTINFOS_BATCH,
+        GRANT_ELEMENT_OPERATOR,
+        SEARCH_ELEMENT_TREE_DIFF,
 
         INIT = 500,
         DISCONNECT,
         ON_ACCESSIBILITY_EVENT,
         ON_KEY_PRESS_EVENT,
         EXECUTE_DISCONNECT_CALLBACK,
+        ON_ACCESSIBILITY_EVENTS,
 
         ON_PROPERTY_CHANGED = 600,
 
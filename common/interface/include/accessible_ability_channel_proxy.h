@@ -271,6 +271,45 @@ public:
     virtual RetError RemoveAccessibilityVirtualNode(const int64_t id, const int32_t windowId,
         const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback) override;
 
+    /**
+     * @brief Run several searches on one window in one transaction.
+     * @param windowId The window id.
+     * @param treeId The tree id.
+     * @param queries The queries.
+     * @param requestId Matched the request and response.
+     * @param callback To transfer the results to ASAC.
+     * @param isFilter Whether the sensitive properties of the found nodes are cleared.
+     * @param systemApi Whether the API is called by the system.
+     * @return RetError: ERR_OK if success, otherwise error code.
+     */
+    virtual RetError SearchElementInfosBatch(const int32_t windowId, const int32_t treeId,
+        const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter = false,
+        bool systemApi = false) override;
+
+    /**
+     * @brief Get an element operator of the window which the ability calls directly.
+     * @param windowId The window id.
+     * @param treeId The tree id.
+     * @param grantedOperator The granted element operator.
+     * @return RetError: ERR_OK if success, otherwise error code.
+     */
+    virtual RetError GrantElementOperator(const int32_t windowId, const int32_t treeId,
+        sptr<IRemoteObject> &grantedOperator) override;
+
+    /**
+     * @brief Get the nodes of a window tree changed after a generation.
+     * @param windowId The window id.
+     * @param treeId The tree id.
+     * @param sinceGeneration The generation the ability already has, 0 for the whole tree.
+     * @param requestId Matched the request and response. It needn't cared by ACE, transfer it by callback only.
+     * @param callback To transfer the diff to ASAC.
+     * @return RetError: ERR_OK if success, otherwise error code.
+     */
+    virtual RetError SearchElementTreeDiff(const int32_t windowId, const int32_t treeId,
+        const uint64_t sinceGeneration, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+
 private:
     /**
      * @brief Write the descriptor of IPC.
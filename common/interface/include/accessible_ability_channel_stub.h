@@ -238,6 +238,30 @@ private:
      */
     ErrCode HandleRemoveAccessibilityVirtualNode(MessageParcel &data, MessageParcel &reply);
 
+    /**
+     * @brief Handle IPC request for function:HandleSearchElementInfosBatch.
+     * @param data The data of process communication
+     * @param reply The response of IPC request
+     * @return NO_ERROR: successful; otherwise is failed.
+     */
+    ErrCode HandleSearchElementInfosBatch(MessageParcel &data, MessageParcel &reply);
+
+    /**
+     * @brief Handle IPC request for function:GrantElementOperator.
+     * @param data The data of process communication
+     * @param reply The response of IPC request
+     * @return NO_ERROR: successful; otherwise is failed.
+     */
+    ErrCode HandleGrantElementOperator(MessageParcel &data, MessageParcel &reply);
+
+    /**
+     * @brief Handle IPC request for function:SearchElementTreeDiff.
+     * @param data The data of process communication
+     * @param reply The response of IPC request
+     * @return NO_ERROR: successful; otherwise is failed.
+     */
+    ErrCode HandleSearchElementTreeDiff(MessageParcel &data, MessageParcel &reply);
+
     using AccessibleAbilityConnectionFunc =
         ErrCode (AccessibleAbilityChannelStub::*)(MessageParcel &data, MessageParcel &reply);
 };
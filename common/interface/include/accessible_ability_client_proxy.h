@@ -46,6 +46,12 @@ public:
      */
     virtual void OnAccessibilityEvent(const AccessibilityEventInfo &eventInfo) override;
 
+    /**
+     * @brief Called when a batch of accessibility events is delivered through the proxy object.
+     * @param eventInfos The information of accessible events.
+     */
+    virtual void OnAccessibilityEvents(const std::vector<AccessibilityEventInfo> &eventInfos) override;
+
     /**
      * @brief Called when a key event occurs through the proxy object.
      * @param keyEvent Indicates the key event to send.
@@ -34,6 +34,7 @@ private:
     ErrCode HandleInit(MessageParcel &data, MessageParcel &reply);
     ErrCode HandleDisconnect(MessageParcel &data, MessageParcel &reply);
     ErrCode HandleOnAccessibilityEvent(MessageParcel &data, MessageParcel &reply);
+    ErrCode HandleOnAccessibilityEvents(MessageParcel &data, MessageParcel &reply);
     ErrCode HandleOnKeyPressEvent(MessageParcel &data, MessageParcel &reply);
 
     using AccessibleAbilityClientFunc =
@@ -216,6 +216,41 @@ public:
      */
     virtual void RemoveAccessibilityVirtualNode(const int64_t id, const int32_t requestId,
         const sptr<IAccessibilityElementOperatorCallback> &callback) = 0;
+
+    /**
+     * @brief Run several searches in one transaction and set all results by one callback.
+     * @param queries The queries, executed in order against the same tree.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     * @param callback The callback to return the results.
+     * @param isFilter Whether the sensitive properties of the found nodes are cleared.
+     */
+    virtual void SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter = false) = 0;
+
+    /**
+     * @brief Create an operator which only answers the searches by accessibility id, AAMS hands it to one
+     *        accessibility extension and revokes it when the window or the extension goes away.
+     * @param grantId The id the operator is revoked with.
+     * @param grantedOperator The operator created for the grant.
+     * @return Returns RET_OK if successful, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError GrantElementOperator(const int32_t grantId, sptr<IRemoteObject> &grantedOperator) = 0;
+
+    /**
+     * @brief Revoke a granted operator, its searches fail from then on.
+     * @param grantId The id the operator was granted with.
+     */
+    virtual void RevokeElementOperator(const int32_t grantId) = 0;
+
+    /**
+     * @brief Search the tree of the window and send the nodes changed after sinceGeneration by callback.
+     *        The operator keeps the generations, a zero or unknown generation gets the whole tree.
+     * @param sinceGeneration The generation AA already has.
+     * @param requestId Matched the request and response. It needn't cared by ACE, transfer it by callback only.
+     * @param callback  To transfer the diff to AA.
+     */
+    virtual void SearchElementTreeDiff(const uint64_t sinceGeneration, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) = 0;
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -25,6 +25,26 @@
 
 namespace OHOS {
 namespace Accessibility {
+/**
+ * @brief The result of one query of a batch search, in the order of the queries.
+ */
+struct ElementSearchResult {
+    RetError ret = RET_OK;
+    std::vector<AccessibilityElementInfo> infos {};
+    std::vector<AccessibilityElementInfo> treeInfos {}; // BY_SPECIFIC_PROPERTY only
+};
+
+/**
+ * @brief The nodes of a window tree changed after the generation AA already has, computed by the element operator.
+ */
+struct ElementTreeDiff {
+    uint64_t generation = 0;
+    bool isFullSnapshot = false; // addedNodes holds the whole tree
+    std::vector<AccessibilityElementInfo> addedNodes {};
+    std::vector<AccessibilityElementInfo> changedNodes {};
+    std::vector<int64_t> removedNodeIds {};
+};
+
 /*
 * The class supply the callback to feedback the result from UI to AA.
 */
@@ -120,6 +140,21 @@ public:
     virtual void SetRemoveAccessibilityVirtualNodeResult(const OperateVirtualNodeResult result,
         const int32_t requestId) = 0;
 
+    /**
+     * @brief Set the results of a batch search to AA.
+     * @param results One result per query, in the order of the queries.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     */
+    virtual void SetSearchElementInfosBatchResult(const std::vector<ElementSearchResult> &results,
+        const int32_t requestId) = 0;
+
+    /**
+     * @brief Set the diff of a window tree to AA.
+     * @param diff The nodes changed after the generation of the request.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     */
+    virtual void SetSearchElementTreeDiffResult(const ElementTreeDiff &diff, const int32_t requestId) = 0;
+
     /**
      * @brief Set isFilter.
      * @param enableFilter True : Perform filtering ;otherwise is false.
@@ -16,6 +16,7 @@
 #ifndef INTERFACE_ACCESSIBLE_ABILITY_CLIENT_H
 #define INTERFACE_ACCESSIBLE_ABILITY_CLIENT_H
 
+#include <vector>
 #include "accessibility_element_info.h"
 #include "accessibility_event_info.h"
 #include "iaccessible_ability_channel.h"
@@ -24,6 +25,8 @@
 
 namespace OHOS {
 namespace Accessibility {
+constexpr size_t MAX_EVENT_BATCH_SIZE = 64;
+
 class IAccessibleAbilityClient : public IRemoteBroker {
 public:
     DECLARE_INTERFACE_DESCRIPTOR(u"ohos.accessibility.IAccessibleAbilityClient");
@@ -47,6 +50,18 @@ public:
      */
     virtual void OnAccessibilityEvent(const AccessibilityEventInfo &eventInfo) = 0;
 
+    /**
+     * @brief Called when a batch of accessibility events is delivered at once.
+     *        The events are in the order in which they occurred.
+     * @param eventInfos The information of accessible events.
+     */
+    virtual void OnAccessibilityEvents(const std::vector<AccessibilityEventInfo> &eventInfos)
+    {
+        for (const auto &eventInfo : eventInfos) {
+            OnAccessibilityEvent(eventInfo);
+        }
+    }
+
     /**
      * @brief Called when a key event occurs.
      * @param keyEvent Indicates the key event to send.
@@ -298,6 +298,20 @@ public:
     static SpanInfoParcel *Unmarshalling(Parcel &parcel);
 };
 
+/**
+ * @brief Define the wire encoding of AccessibilityElementInfoParcel
+ */
+enum class ElementInfoEncoding : uint8_t {
+    LEGACY = 0, // one parcel word per field, readable by every peer
+    COMPACT_V1, // presence bitmap, packed flags, varint ids and inline nested structs
+};
+
+/**
+ * @brief The newest encoding this build can read. Requesters announce it with every element search, and
+ *    the UI side only answers in an encoding that both sides support.
+ */
+constexpr ElementInfoEncoding SUPPORTED_ELEMENT_INFO_ENCODING = ElementInfoEncoding::COMPACT_V1;
+
 /*
 * The class supply the api to set/get ui component property
 */
@@ -318,6 +332,13 @@ public:
      */
     explicit AccessibilityElementInfoParcel(const AccessibilityElementInfo &elementInfo);
 
+    /**
+     * @brief Construct
+     * @param elementInfo The object of AccessibilityElementInfo.
+     * @param encoding The encoding used by Marshalling, ReadFromParcel detects it by itself.
+     */
+    AccessibilityElementInfoParcel(const AccessibilityElementInfo &elementInfo, ElementInfoEncoding encoding);
+
     /**
      * @brief Used for IPC communication
      * @param parcel
@@ -394,6 +415,20 @@ private:
      * @sysCap Accessibility
      */
     bool MarshallingThirdPart(Parcel &parcel) const;
+
+    /**
+     * @brief Used for IPC communication with the compact encoding
+     * @param parcel
+     */
+    bool MarshallingCompact(Parcel &parcel) const;
+
+    /**
+     * @brief Used for IPC communication with the compact encoding, the version word is already read
+     * @param parcel
+     */
+    bool ReadFromParcelCompact(Parcel &parcel);
+
+    ElementInfoEncoding encoding_ = ElementInfoEncoding::LEGACY;
 };
 } // namespace Accessibility
 } // namespace OHOS
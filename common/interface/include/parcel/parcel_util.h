@@ -16,6 +16,8 @@
 #ifndef PARCEL_UTIL_H
 #define PARCEL_UTIL_H
 
+#include <vector>
+#include "accessibility_def.h"
 #include "parcel.h"
 
 namespace OHOS {
@@ -51,6 +53,50 @@ inline bool ContainerSecurityVerify(Parcel &parcel, int readContainerSize, size_
     }
     return true;
 }
+
+inline bool WriteElementSearchQueries(Parcel &parcel, const std::vector<ElementSearchQuery> &queries)
+{
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, static_cast<int32_t>(queries.size()));
+    for (auto &query : queries) {
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, static_cast<int32_t>(query.type));
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64, parcel, query.elementId);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, query.mode);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, query.text);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, query.param.propertyTarget);
+        WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, static_cast<uint32_t>(query.param.propertyType));
+    }
+    return true;
+}
+
+inline bool ReadElementSearchQueries(Parcel &parcel, std::vector<ElementSearchQuery> &queries)
+{
+    int32_t count = 0;
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, count);
+    if (!ContainerSecurityVerify(parcel, count, MAX_ELEMENT_SEARCH_QUERY_COUNT)) {
+        return false;
+    }
+    queries.clear();
+    for (int32_t i = 0; i < count; i++) {
+        ElementSearchQuery query;
+        int32_t type = 0;
+        uint32_t propertyType = 0;
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, type);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int64, parcel, query.elementId);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, query.mode);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, query.text);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(String, parcel, query.param.propertyTarget);
+        READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, propertyType);
+        if (type < static_cast<int32_t>(ElementSearchType::BY_ACCESSIBILITY_ID) ||
+            type > static_cast<int32_t>(ElementSearchType::BY_SPECIFIC_PROPERTY)) {
+            HILOG_ERROR("invalid search type %{public}d", type);
+            return false;
+        }
+        query.type = static_cast<ElementSearchType>(type);
+        query.param.propertyType = static_cast<SEARCH_TYPE>(propertyType);
+        queries.push_back(query);
+    }
+    return true;
+}
 } // namespace Accessibility
 } // namespace OHOS
 #endif // PARCEL_UTIL_H
\ No newline at end of file
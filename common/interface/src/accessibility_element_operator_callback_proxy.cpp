@@ -15,12 +15,15 @@
 
 #include "accessibility_element_operator_callback_proxy.h"
 #include "accessibility_element_info_parcel.h"
+#include "ashmem.h"
 #include "hilog_wrapper.h"
+#include <cinttypes>
 
 namespace OHOS {
 namespace Accessibility {
 
 constexpr int32_t MAX_RAWDATA_SIZE = 128 * 1024 * 1024; // RawData limit is 128M, limited by IPC
+constexpr size_t ASHMEM_TRANSPORT_THRESHOLD = 256 * 1024; // larger results are passed by shared memory
 
 AccessibilityElementOperatorCallbackProxy::AccessibilityElementOperatorCallbackProxy(
     const sptr<IRemoteObject> &impl) : IRemoteProxy<IAccessibilityElementOperatorCallback>(impl)
@@ -29,6 +32,11 @@ AccessibilityElementOperatorCallbackProxy::AccessibilityElementOperatorCallbackP
 AccessibilityElementOperatorCallbackProxy::~AccessibilityElementOperatorCallbackProxy()
 {}
 
+void AccessibilityElementOperatorCallbackProxy::SetElementInfoEncoding(const ElementInfoEncoding encoding)
+{
+    encoding_ = encoding;
+}
+
 bool AccessibilityElementOperatorCallbackProxy::WriteInterfaceToken(MessageParcel &data)
 {
     HILOG_DEBUG();
@@ -85,19 +93,13 @@ void AccessibilityElementOperatorCallbackProxy::SetSearchElementInfoByAccessibil
         // when set pracel's max capacity, it won't alloc memory immediately
         // MessageParcel will expand memory dynamiclly
         for (const auto &info : infos) {
-            AccessibilityElementInfoParcel infoParcel(info);
+            AccessibilityElementInfoParcel infoParcel(info, encoding_);
             if (!tmpParcel.WriteParcelable(&infoParcel)) {
                 HILOG_ERROR("write accessibilityElementInfoParcel failed");
                 return;
             }
         }
-        size_t tmpParcelSize = tmpParcel.GetDataSize();
-        if (!data.WriteUint32(tmpParcelSize)) {
-            HILOG_ERROR("write rawData size failed");
-            return;
-        }
-        if (!data.WriteRawData(reinterpret_cast<uint8_t *>(tmpParcel.GetData()), tmpParcelSize)) {
-            HILOG_ERROR("write rawData failed");
+        if (!WriteElementInfoParcelData(tmpParcel, data)) {
             return;
         }
     }
@@ -140,19 +142,13 @@ void AccessibilityElementOperatorCallbackProxy::SetSearchDefaultFocusByWindowIdR
         // when set pracel's max capacity, it won't allocate memory immediately
         // MessageParcel will expand memory dynamiclly
         for (const auto &info : infos) {
-            AccessibilityElementInfoParcel infoParcel(info);
+            AccessibilityElementInfoParcel infoParcel(info, encoding_);
             if (!tmpParcel.WriteParcelable(&infoParcel)) {
                 HILOG_ERROR("write accessibilityElementInfoParcel failed");
                 return;
             }
         }
-        size_t tmpParcelSize = tmpParcel.GetDataSize();
-        if (!data.WriteUint32(tmpParcelSize)) {
-            HILOG_ERROR("write rawData size failed");
-            return;
-        }
-        if (!data.WriteRawData(reinterpret_cast<uint8_t *>(tmpParcel.GetData()), tmpParcelSize)) {
-            HILOG_ERROR("write rawData failed");
+        if (!WriteElementInfoParcelData(tmpParcel, data)) {
             return;
         }
     }
@@ -445,21 +441,56 @@ bool AccessibilityElementOperatorCallbackProxy::WriteElementInfosToRawData(
     // when set pracel's max capacity, it won't alloc memory immediately
     // MessageParcel will expand memory dynamiclly
     for (const auto &info : infos) {
-        AccessibilityElementInfoParcel infoParcel(info);
+        AccessibilityElementInfoParcel infoParcel(info, encoding_);
         if (!tmpParcel.WriteParcelable(&infoParcel)) {
             HILOG_ERROR("write accessibilityElementInfoParcel failed");
             return false;
         }
     }
+    return WriteElementInfoParcelData(tmpParcel, data);
+}
+
+bool AccessibilityElementOperatorCallbackProxy::WriteElementInfoParcelData(MessageParcel &tmpParcel,
+    MessageParcel &data)
+{
     size_t tmpParcelSize = tmpParcel.GetDataSize();
     if (!data.WriteUint32(tmpParcelSize)) {
         HILOG_ERROR("write rawData size failed");
         return false;
     }
-    if (!data.WriteRawData(reinterpret_cast<uint8_t *>(tmpParcel.GetData()), tmpParcelSize)) {
-        HILOG_ERROR("write rawData failed");
+    bool useAshmem = tmpParcelSize >= ASHMEM_TRANSPORT_THRESHOLD;
+    if (!data.WriteBool(useAshmem)) {
+        HILOG_ERROR("write transport type failed");
         return false;
     }
+    if (!useAshmem) {
+        if (!data.WriteRawData(reinterpret_cast<uint8_t *>(tmpParcel.GetData()), tmpParcelSize)) {
+            HILOG_ERROR("write rawData failed");
+            return false;
+        }
+        return true;
+    }
+
+    // the infos are copied once into the region, the receiver parses them in place from a read-only mapping
+    sptr<Ashmem> ashmem = Ashmem::CreateAshmem("AccessibilityElementInfos", static_cast<int32_t>(tmpParcelSize));
+    if (ashmem == nullptr) {
+        HILOG_ERROR("create ashmem failed");
+        return false;
+    }
+    if (!ashmem->MapReadAndWriteAshmem() ||
+        !ashmem->WriteToAshmem(reinterpret_cast<void *>(tmpParcel.GetData()), static_cast<int32_t>(tmpParcelSize),
+        0)) {
+        HILOG_ERROR("write ashmem failed");
+        ashmem->CloseAshmem();
+        return false;
+    }
+    ashmem->UnmapAshmem();
+    if (!ashmem->SetProtection(PROT_READ) || !data.WriteAshmem(ashmem)) {
+        HILOG_ERROR("write ashmem to parcel failed");
+        ashmem->CloseAshmem();
+        return false;
+    }
+    ashmem->CloseAshmem();
     return true;
 }
 
@@ -552,5 +583,107 @@ void AccessibilityElementOperatorCallbackProxy::SetRemoveAccessibilityVirtualNod
         return;
     }
 }
+
+void AccessibilityElementOperatorCallbackProxy::SetSearchElementInfosBatchResult(
+    const std::vector<ElementSearchResult> &results, const int32_t requestId)
+{
+    HILOG_DEBUG("results size %{public}zu, resquestId %{public}d", results.size(), requestId);
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+    if (!WriteInterfaceToken(data)) {
+        HILOG_ERROR("connection write token failed");
+        return;
+    }
+
+    if (!data.WriteInt32(requestId)) {
+        HILOG_ERROR("connection write request id failed");
+        return;
+    }
+
+    if (!data.WriteUint32(results.size())) {
+        HILOG_ERROR("write results's size failed");
+        return;
+    }
+
+    // the infos of all results share one raw data block, each result only carries its counts
+    size_t infoCount = 0;
+    for (auto &result : results) {
+        if (!data.WriteInt32(static_cast<int32_t>(result.ret)) || !data.WriteUint32(result.infos.size()) ||
+            !data.WriteUint32(result.treeInfos.size())) {
+            HILOG_ERROR("write result failed");
+            return;
+        }
+        infoCount += result.infos.size() + result.treeInfos.size();
+    }
+
+    if (infoCount != 0) {
+        MessageParcel tmpParcel;
+        tmpParcel.SetMaxCapacity(MAX_RAWDATA_SIZE);
+        for (auto &result : results) {
+            for (auto infos : { &result.infos, &result.treeInfos }) {
+                for (const auto &info : *infos) {
+                    AccessibilityElementInfoParcel infoParcel(info, encoding_);
+                    if (!tmpParcel.WriteParcelable(&infoParcel)) {
+                        HILOG_ERROR("write accessibilityElementInfoParcel failed");
+                        return;
+                    }
+                }
+            }
+        }
+        if (!WriteElementInfoParcelData(tmpParcel, data)) {
+            return;
+        }
+    }
+
+    if (!SendTransactCmd(AccessibilityInterfaceCode::SET_RESULT_SEARCH_ELEMENTINFOS_BATCH, data, reply, option)) {
+        HILOG_ERROR("setSearchElementInfosBatchResult failed");
+        return;
+    }
+}
+
+void AccessibilityElementOperatorCallbackProxy::SetSearchElementTreeDiffResult(const ElementTreeDiff &diff,
+    const int32_t requestId)
+{
+    HILOG_DEBUG("generation %{public}" PRIu64 ", added %{public}zu, changed %{public}zu, removed %{public}zu, "
+        "requestId %{public}d", diff.generation, diff.addedNodes.size(), diff.changedNodes.size(),
+        diff.removedNodeIds.size(), requestId);
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+    if (!WriteInterfaceToken(data)) {
+        HILOG_ERROR("connection write token failed");
+        return;
+    }
+
+    if (!data.WriteInt32(requestId) || !data.WriteUint64(diff.generation) || !data.WriteBool(diff.isFullSnapshot) ||
+        !data.WriteInt64Vector(diff.removedNodeIds) || !data.WriteUint32(diff.addedNodes.size()) ||
+        !data.WriteUint32(diff.changedNodes.size())) {
+        HILOG_ERROR("write diff failed");
+        return;
+    }
+
+    if (!diff.addedNodes.empty() || !diff.changedNodes.empty()) {
+        MessageParcel tmpParcel;
+        tmpParcel.SetMaxCapacity(MAX_RAWDATA_SIZE);
+        for (auto infos : { &diff.addedNodes, &diff.changedNodes }) {
+            for (const auto &info : *infos) {
+                AccessibilityElementInfoParcel infoParcel(info, encoding_);
+                if (!tmpParcel.WriteParcelable(&infoParcel)) {
+                    HILOG_ERROR("write accessibilityElementInfoParcel failed");
+                    return;
+                }
+            }
+        }
+        if (!WriteElementInfoParcelData(tmpParcel, data)) {
+            return;
+        }
+    }
+
+    if (!SendTransactCmd(AccessibilityInterfaceCode::SET_RESULT_SEARCH_ELEMENT_TREE_DIFF, data, reply, option)) {
+        HILOG_ERROR("setSearchElementTreeDiffResult failed");
+        return;
+    }
+}
 } // namespace Accessibility
 } // namespace OHOS
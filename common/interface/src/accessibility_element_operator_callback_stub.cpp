@@ -16,8 +16,10 @@
 #include "accessibility_element_operator_callback_stub.h"
 #include "accessibility_element_info_parcel.h"
 #include "accessibility_ipc_interface_code.h"
+#include "ashmem.h"
 #include "hilog_wrapper.h"
 #include "parcel_util.h"
+#include <memory>
 #include <securec.h>
 
 #define SWITCH_BEGIN(code) switch (code) {
@@ -54,7 +56,11 @@
     SWITCH_CASE(AccessibilityInterfaceCode::SET_RESULT_ADD_ACCESSIBILITY_VIRTUAL_NODE,                      \
         HandleSetAddAccessibilityVirtualNodeResult)                                                         \
     SWITCH_CASE(AccessibilityInterfaceCode::SET_RESULT_REMOVE_ACCESSIBILITY_VIRTUAL_NODE,                   \
-        HandleSetRemoveAccessibilityVirtualNodeResult)
+        HandleSetRemoveAccessibilityVirtualNodeResult)                                                      \
+    SWITCH_CASE(AccessibilityInterfaceCode::SET_RESULT_SEARCH_ELEMENTINFOS_BATCH,                           \
+        HandleSetSearchElementInfosBatchResult)                                                             \
+    SWITCH_CASE(AccessibilityInterfaceCode::SET_RESULT_SEARCH_ELEMENT_TREE_DIFF,                            \
+        HandleSetSearchElementTreeDiffResult)
 
 namespace OHOS {
 namespace Accessibility {
@@ -82,6 +88,66 @@ static bool GetData(size_t size, const void *data, void *&buffer)
     return true;
 }
 
+// parses element infos in place from a read-only shared memory mapping, which is released by its Ashmem
+class MappedDataAllocator : public Allocator {
+public:
+    void *Realloc(void *data, size_t newSize) override
+    {
+        return nullptr;
+    }
+
+    void *Alloc(size_t size) override
+    {
+        return nullptr;
+    }
+
+    void Dealloc(void *data) override
+    {
+    }
+};
+
+static std::unique_ptr<MessageParcel> ReadElementInfoParcelData(MessageParcel &data, sptr<Ashmem> &ashmem)
+{
+    size_t rawDataSize = data.ReadUint32();
+    bool useAshmem = data.ReadBool();
+    if (!useAshmem) {
+        auto tmpParcel = std::make_unique<MessageParcel>();
+        void *buffer = nullptr;
+        // memory alloced in GetData will be released when tmpParcel destruct
+        if (!GetData(rawDataSize, data.ReadRawData(rawDataSize), buffer)) {
+            HILOG_ERROR("get data failed!");
+            return nullptr;
+        }
+        if (!tmpParcel->ParseFrom(reinterpret_cast<uintptr_t>(buffer), rawDataSize)) {
+            HILOG_ERROR("parse data from buffer failed!");
+            free(buffer);
+            return nullptr;
+        }
+        return tmpParcel;
+    }
+
+    ashmem = data.ReadAshmem();
+    if (ashmem == nullptr || rawDataSize == 0 || rawDataSize > MAX_RAWDATA_SIZE ||
+        static_cast<size_t>(ashmem->GetAshmemSize()) < rawDataSize || !ashmem->MapReadOnlyAshmem()) {
+        HILOG_ERROR("map ashmem failed!");
+        return nullptr;
+    }
+    const void *mapped = ashmem->ReadFromAshmem(static_cast<int32_t>(rawDataSize), 0);
+    Allocator *allocator = new (std::nothrow) MappedDataAllocator();
+    if (mapped == nullptr || allocator == nullptr) {
+        HILOG_ERROR("read ashmem failed!");
+        delete allocator;
+        return nullptr;
+    }
+    // tmpParcel takes the ownership of allocator
+    auto tmpParcel = std::make_unique<MessageParcel>(allocator);
+    if (!tmpParcel->ParseFrom(reinterpret_cast<uintptr_t>(mapped), rawDataSize)) {
+        HILOG_ERROR("parse data from ashmem failed!");
+        return nullptr;
+    }
+    return tmpParcel;
+}
+
 AccessibilityElementOperatorCallbackStub::AccessibilityElementOperatorCallbackStub()
 {
 }
@@ -122,18 +188,9 @@ ErrCode AccessibilityElementOperatorCallbackStub::HandleSetSearchElementInfoByAc
     int32_t requestId = data.ReadInt32();
     uint32_t infoSize = data.ReadUint32();
     if (infoSize != 0) {
-        size_t rawDataSize = data.ReadUint32();
-        MessageParcel tmpParcel;
-        void *buffer = nullptr;
-        // memory alloced in GetData will be released when tmpParcel destruct
-        if (!GetData(rawDataSize, data.ReadRawData(rawDataSize), buffer)) {
-            reply.WriteInt32(RET_ERR_FAILED);
-            return TRANSACTION_ERR;
-        }
-
-        if (!tmpParcel.ParseFrom(reinterpret_cast<uintptr_t>(buffer), rawDataSize)) {
-            free(buffer);
-            buffer = nullptr;
+        sptr<Ashmem> ashmem = nullptr;
+        std::unique_ptr<MessageParcel> tmpParcel = ReadElementInfoParcelData(data, ashmem);
+        if (tmpParcel == nullptr) {
             reply.WriteInt32(RET_ERR_FAILED);
             return TRANSACTION_ERR;
         }
@@ -145,7 +202,7 @@ ErrCode AccessibilityElementOperatorCallbackStub::HandleSetSearchElementInfoByAc
 
         for (size_t i = 0; i < infoSize; i++) {
             sptr<AccessibilityElementInfoParcel> info =
-                tmpParcel.ReadStrongParcelable<AccessibilityElementInfoParcel>();
+                tmpParcel->ReadStrongParcelable<AccessibilityElementInfoParcel>();
             if (info == nullptr) {
                 reply.WriteInt32(RET_ERR_FAILED);
                 return TRANSACTION_ERR;
@@ -166,20 +223,9 @@ ErrCode AccessibilityElementOperatorCallbackStub::HandleSetSearchDefaultFocusByW
     int32_t requestId = data.ReadInt32();
     uint32_t infoSize = data.ReadUint32();
     if (infoSize != 0) {
-        size_t rawDataSize = data.ReadUint32();
-        MessageParcel tmpParcel;
-        void *buffer = nullptr;
-        // memory alloced in GetData will be released when tmpParcel destruct
-        if (!GetData(rawDataSize, data.ReadRawData(rawDataSize), buffer)) {
-            HILOG_ERROR("get data failed!");
-            reply.WriteInt32(RET_ERR_FAILED);
-            return TRANSACTION_ERR;
-        }
-        
-        if (!tmpParcel.ParseFrom(reinterpret_cast<uintptr_t>(buffer), rawDataSize)) {
-            HILOG_ERROR("parse data from buffer failed!");
-            free(buffer);
-            buffer = nullptr;
+        sptr<Ashmem> ashmem = nullptr;
+        std::unique_ptr<MessageParcel> tmpParcel = ReadElementInfoParcelData(data, ashmem);
+        if (tmpParcel == nullptr) {
             reply.WriteInt32(RET_ERR_FAILED);
             return TRANSACTION_ERR;
         }
@@ -192,7 +238,7 @@ ErrCode AccessibilityElementOperatorCallbackStub::HandleSetSearchDefaultFocusByW
  
         for (size_t i = 0; i < infoSize; i++) {
             sptr<AccessibilityElementInfoParcel> info =
-                tmpParcel.ReadStrongParcelable<AccessibilityElementInfoParcel>();
+                tmpParcel->ReadStrongParcelable<AccessibilityElementInfoParcel>();
             if (info == nullptr) {
                 HILOG_ERROR("info is nullptr!");
                 reply.WriteInt32(RET_ERR_FAILED);
@@ -301,17 +347,9 @@ ErrCode AccessibilityElementOperatorCallbackStub::ReadAccessibilityElementInfoLi
         HILOG_INFO("infoSize is 0, no element info to read");
         return NO_ERROR;
     }
-    size_t rawDataSize = data.ReadUint32();
-    MessageParcel tmpParcel;
-    void *buffer = nullptr;
-    // memory alloced in GetData will be released when tmpParcel destruct
-    if (!GetData(rawDataSize, data.ReadRawData(rawDataSize), buffer)) {
-        reply.WriteInt32(RET_ERR_FAILED);
-        return TRANSACTION_ERR;
-    }
-    if (!tmpParcel.ParseFrom(reinterpret_cast<uintptr_t>(buffer), rawDataSize)) {
-        free(buffer);
-        buffer = nullptr;
+    sptr<Ashmem> ashmem = nullptr;
+    std::unique_ptr<MessageParcel> tmpParcel = ReadElementInfoParcelData(data, ashmem);
+    if (tmpParcel == nullptr) {
         reply.WriteInt32(RET_ERR_FAILED);
         return TRANSACTION_ERR;
     }
@@ -321,7 +359,7 @@ ErrCode AccessibilityElementOperatorCallbackStub::ReadAccessibilityElementInfoLi
     }
     for (int32_t i = 0; i < infoSize; i++) {
         sptr<AccessibilityElementInfoParcel> info =
-                tmpParcel.ReadStrongParcelable<AccessibilityElementInfoParcel>();
+                tmpParcel->ReadStrongParcelable<AccessibilityElementInfoParcel>();
         if (info == nullptr) {
             reply.WriteInt32(RET_ERR_FAILED);
             return TRANSACTION_ERR;
@@ -409,5 +447,98 @@ ErrCode AccessibilityElementOperatorCallbackStub::HandleSetRemoveAccessibilityVi
     SetRemoveAccessibilityVirtualNodeResult(result, requestId);
     return NO_ERROR;
 }
+
+ErrCode AccessibilityElementOperatorCallbackStub::HandleSetSearchElementInfosBatchResult(
+    MessageParcel &data, MessageParcel &reply)
+{
+    HILOG_DEBUG();
+    int32_t requestId = data.ReadInt32();
+    uint32_t resultSize = data.ReadUint32();
+    if (resultSize > MAX_ELEMENT_SEARCH_QUERY_COUNT) {
+        HILOG_ERROR("The resultSize is abnormal");
+        return TRANSACTION_ERR;
+    }
+    std::vector<ElementSearchResult> results(resultSize);
+    uint64_t infoCount = 0;
+    for (auto &result : results) {
+        result.ret = static_cast<RetError>(data.ReadInt32());
+        uint32_t infoSize = data.ReadUint32();
+        uint32_t treeInfoSize = data.ReadUint32();
+        infoCount += static_cast<uint64_t>(infoSize) + treeInfoSize;
+        if (infoCount > static_cast<uint64_t>(MAX_ALLOW_SIZE)) {
+            HILOG_ERROR("The infoSize is abnormal");
+            return TRANSACTION_ERR;
+        }
+        result.infos.resize(infoSize);
+        result.treeInfos.resize(treeInfoSize);
+    }
+
+    if (infoCount != 0) {
+        sptr<Ashmem> ashmem = nullptr;
+        std::unique_ptr<MessageParcel> tmpParcel = ReadElementInfoParcelData(data, ashmem);
+        if (tmpParcel == nullptr) {
+            return TRANSACTION_ERR;
+        }
+        for (auto &result : results) {
+            for (auto infos : { &result.infos, &result.treeInfos }) {
+                for (auto &info : *infos) {
+                    sptr<AccessibilityElementInfoParcel> infoParcel =
+                        tmpParcel->ReadStrongParcelable<AccessibilityElementInfoParcel>();
+                    if (infoParcel == nullptr) {
+                        HILOG_ERROR("info is nullptr!");
+                        return TRANSACTION_ERR;
+                    }
+                    info = *infoParcel;
+                }
+            }
+        }
+    }
+    SetSearchElementInfosBatchResult(results, requestId);
+    return NO_ERROR;
+}
+
+ErrCode AccessibilityElementOperatorCallbackStub::HandleSetSearchElementTreeDiffResult(
+    MessageParcel &data, MessageParcel &reply)
+{
+    HILOG_DEBUG();
+    int32_t requestId = data.ReadInt32();
+    ElementTreeDiff diff;
+    diff.generation = data.ReadUint64();
+    diff.isFullSnapshot = data.ReadBool();
+    if (!data.ReadInt64Vector(&diff.removedNodeIds)) {
+        HILOG_ERROR("read removed node ids failed");
+        return TRANSACTION_ERR;
+    }
+    uint32_t addedSize = data.ReadUint32();
+    uint32_t changedSize = data.ReadUint32();
+    uint64_t infoCount = static_cast<uint64_t>(addedSize) + changedSize;
+    if (infoCount > static_cast<uint64_t>(MAX_ALLOW_SIZE)) {
+        HILOG_ERROR("The infoSize is abnormal");
+        return TRANSACTION_ERR;
+    }
+    diff.addedNodes.resize(addedSize);
+    diff.changedNodes.resize(changedSize);
+
+    if (infoCount != 0) {
+        sptr<Ashmem> ashmem = nullptr;
+        std::unique_ptr<MessageParcel> tmpParcel = ReadElementInfoParcelData(data, ashmem);
+        if (tmpParcel == nullptr) {
+            return TRANSACTION_ERR;
+        }
+        for (auto infos : { &diff.addedNodes, &diff.changedNodes }) {
+            for (auto &info : *infos) {
+                sptr<AccessibilityElementInfoParcel> infoParcel =
+                    tmpParcel->ReadStrongParcelable<AccessibilityElementInfoParcel>();
+                if (infoParcel == nullptr) {
+                    HILOG_ERROR("info is nullptr!");
+                    return TRANSACTION_ERR;
+                }
+                info = *infoParcel;
+            }
+        }
+    }
+    SetSearchElementTreeDiffResult(diff, requestId);
+    return NO_ERROR;
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include "accessibility_element_info_parcel.h"
 #include "accessibility_virtual_node_parcel.h"
 #include "hilog_wrapper.h"
+#include "parcel_util.h"
 #include <cinttypes>
 
 namespace OHOS {
@@ -99,12 +100,21 @@ RetError AccessibilityElementOperatorProxy::SearchElementInfoByAccessibilityId(c
         return RET_ERR_FAILED;
     }
 
+    if (!data.WriteInt32(static_cast<int32_t>(SUPPORTED_ELEMENT_INFO_ENCODING))) {
+        HILOG_ERROR("connection write parcelable element info encoding failed");
+        return RET_ERR_FAILED;
+    }
+
     if (!SendTransactCmd(AccessibilityInterfaceCode::SEARCH_BY_ACCESSIBILITY_ID,
         data, reply, option)) {
         HILOG_ERROR("search element info by accessibility id failed");
         return RET_ERR_FAILED;
     }
-    return RET_OK;
+    // operators built before the result was replied leave the reply empty
+    if (reply.GetReadableBytes() < sizeof(int32_t)) {
+        return RET_OK;
+    }
+    return static_cast<RetError>(reply.ReadInt32());
 }
 
 void AccessibilityElementOperatorProxy::SearchDefaultFocusedByWindowId(const int32_t windowId,
@@ -150,6 +160,11 @@ void AccessibilityElementOperatorProxy::SearchDefaultFocusedByWindowId(const int
         return;
     }
  
+    if (!data.WriteInt32(static_cast<int32_t>(SUPPORTED_ELEMENT_INFO_ENCODING))) {
+        HILOG_ERROR("connection write parcelable element info encoding failed");
+        return;
+    }
+ 
     if (!SendTransactCmd(AccessibilityInterfaceCode::SEARCH_BY_WINDOW_ID,
         data, reply, option)) {
         HILOG_ERROR("search element info by accessibility id failed");
@@ -536,6 +551,11 @@ void AccessibilityElementOperatorProxy::SearchElementInfoBySpecificProperty(cons
         return;
     }
 
+    if (!data.WriteInt32(static_cast<int32_t>(SUPPORTED_ELEMENT_INFO_ENCODING))) {
+        HILOG_ERROR("connection write parcelable element info encoding failed");
+        return;
+    }
+
     if (!SendTransactCmd(AccessibilityInterfaceCode::SEARCH_BY_SPECIFIC_PROPERTY,
         data, reply, option)) {
         HILOG_ERROR("search element info by specific property failed");
@@ -593,6 +613,11 @@ void AccessibilityElementOperatorProxy::FocusMoveSearchWithCondition(const Acces
         return;
     }
 
+    if (!data.WriteInt32(static_cast<int32_t>(SUPPORTED_ELEMENT_INFO_ENCODING))) {
+        HILOG_ERROR("connection write parcelable element info encoding failed");
+        return;
+    }
+
     if (!SendTransactCmd(AccessibilityInterfaceCode::ASAC_FOCUS_MOVE_SEARCH_WITH_CONDITION,
         data, reply, option)) {
         HILOG_ERROR("search element info by specific property failed");
@@ -729,6 +754,157 @@ void AccessibilityElementOperatorProxy::RemoveAccessibilityVirtualNode(const int
     }
 }
 
+void AccessibilityElementOperatorProxy::SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter)
+{
+    HILOG_DEBUG("query count[%{public}zu], requestId[%{public}d]", queries.size(), requestId);
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC | MessageOption::TF_ASYNC_WAKEUP_LATER);
+
+    if (!WriteInterfaceToken(data)) {
+        HILOG_ERROR("connection write token failed");
+        return;
+    }
+
+    if (!WriteElementSearchQueries(data, queries)) {
+        HILOG_ERROR("connection write queries failed");
+        return;
+    }
+
+    if (!data.WriteInt32(requestId)) {
+        HILOG_ERROR("connection write parcelable request id failed");
+        return;
+    }
+
+    if (callback == nullptr) {
+        HILOG_ERROR("callback is nullptr");
+        return;
+    }
+
+    if (!data.WriteRemoteObject(callback->AsObject())) {
+        HILOG_ERROR("connection write parcelable callback failed");
+        return;
+    }
+
+    if (!data.WriteBool(isFilter)) {
+        HILOG_ERROR("connection write parcelable isFilter failed");
+        return;
+    }
+
+    if (!data.WriteInt32(static_cast<int32_t>(SUPPORTED_ELEMENT_INFO_ENCODING))) {
+        HILOG_ERROR("connection write parcelable element info encoding failed");
+        return;
+    }
+
+    if (!SendTransactCmd(AccessibilityInterfaceCode::ASAC_SEARCH_ELEMENTINFOS_BATCH, data, reply, option)) {
+        HILOG_ERROR("search element infos batch failed");
+        return;
+    }
+}
+
+RetError AccessibilityElementOperatorProxy::GrantElementOperator(const int32_t grantId,
+    sptr<IRemoteObject> &grantedOperator)
+{
+    HILOG_DEBUG("grantId[%{public}d]", grantId);
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_SYNC);
+
+    if (!WriteInterfaceToken(data)) {
+        HILOG_ERROR("connection write token failed");
+        return RET_ERR_FAILED;
+    }
+
+    if (!data.WriteInt32(grantId)) {
+        HILOG_ERROR("connection write parcelable grant id failed");
+        return RET_ERR_FAILED;
+    }
+
+    if (!SendTransactCmd(AccessibilityInterfaceCode::ASAC_GRANT_ELEMENT_OPERATOR, data, reply, option)) {
+        HILOG_ERROR("grant element operator failed");
+        return RET_ERR_IPC_FAILED;
+    }
+    RetError ret = static_cast<RetError>(reply.ReadInt32());
+    if (ret != RET_OK) {
+        HILOG_ERROR("grant element operator failed: %{public}d", ret);
+        return ret;
+    }
+    grantedOperator = reply.ReadRemoteObject();
+    if (grantedOperator == nullptr) {
+        HILOG_ERROR("granted operator is nullptr");
+        return RET_ERR_NULLPTR;
+    }
+    return RET_OK;
+}
+
+void AccessibilityElementOperatorProxy::RevokeElementOperator(const int32_t grantId)
+{
+    HILOG_DEBUG("grantId[%{public}d]", grantId);
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+
+    if (!WriteInterfaceToken(data)) {
+        HILOG_ERROR("connection write token failed");
+        return;
+    }
+
+    if (!data.WriteInt32(grantId)) {
+        HILOG_ERROR("connection write parcelable grant id failed");
+        return;
+    }
+
+    if (!SendTransactCmd(AccessibilityInterfaceCode::ASAC_REVOKE_ELEMENT_OPERATOR, data, reply, option)) {
+        HILOG_ERROR("revoke element operator failed");
+        return;
+    }
+}
+
+void AccessibilityElementOperatorProxy::SearchElementTreeDiff(const uint64_t sinceGeneration,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_DEBUG("sinceGeneration[%{public}" PRIu64 "], requestId[%{public}d]", sinceGeneration, requestId);
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC | MessageOption::TF_ASYNC_WAKEUP_LATER);
+
+    if (!WriteInterfaceToken(data)) {
+        HILOG_ERROR("connection write token failed");
+        return;
+    }
+
+    if (!data.WriteUint64(sinceGeneration)) {
+        HILOG_ERROR("connection write parcelable generation failed");
+        return;
+    }
+
+    if (!data.WriteInt32(requestId)) {
+        HILOG_ERROR("connection write parcelable request id failed");
+        return;
+    }
+
+    if (callback == nullptr) {
+        HILOG_ERROR("callback is nullptr");
+        return;
+    }
+
+    if (!data.WriteRemoteObject(callback->AsObject())) {
+        HILOG_ERROR("connection write parcelable callback failed");
+        return;
+    }
+
+    if (!data.WriteInt32(static_cast<int32_t>(SUPPORTED_ELEMENT_INFO_ENCODING))) {
+        HILOG_ERROR("connection write parcelable element info encoding failed");
+        return;
+    }
+
+    if (!SendTransactCmd(AccessibilityInterfaceCode::ASAC_SEARCH_ELEMENT_TREE_DIFF, data, reply, option)) {
+        HILOG_ERROR("search element tree diff failed");
+        return;
+    }
+}
+
 bool AccessibilityElementOperatorProxy::WriteAccessibilityVirtualNode(MessageParcel &data,
     const AccessibilityVirtualNode& accessibilityVirtualNode)
 {
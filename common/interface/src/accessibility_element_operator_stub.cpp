@@ -18,6 +18,7 @@
 #include "accessibility_element_info_parcel.h"
 #include "accessibility_virtual_node_parcel.h"
 #include "hilog_wrapper.h"
+#include "parcel_util.h"
 #include "accessibility_constants.h"
 #include <cinttypes>
 
@@ -57,11 +58,40 @@
         HandleAddAccessibilityVirtualNode)                                                                        \
     SWITCH_CASE(AccessibilityInterfaceCode::ASAC_REMOVE_ACCESSIBILITY_VIRTUAL_NODE,                               \
         HandleRemoveAccessibilityVirtualNode)                                                                     \
+    SWITCH_CASE(AccessibilityInterfaceCode::ASAC_SEARCH_ELEMENTINFOS_BATCH, HandleSearchElementInfosBatch)        \
+    SWITCH_CASE(AccessibilityInterfaceCode::ASAC_GRANT_ELEMENT_OPERATOR, HandleGrantElementOperator)              \
+    SWITCH_CASE(AccessibilityInterfaceCode::ASAC_REVOKE_ELEMENT_OPERATOR, HandleRevokeElementOperator)            \
+    SWITCH_CASE(AccessibilityInterfaceCode::ASAC_SEARCH_ELEMENT_TREE_DIFF, HandleSearchElementTreeDiff)           \
 
 namespace OHOS {
 namespace Accessibility {
 constexpr int32_t ERR_CODE_DEFAULT = -1000;
 
+namespace {
+    // The encoding announced by the requester is the last field of a search request, requesters built before
+    // the compact encoding do not send it and keep getting LEGACY results.
+    void ReadElementInfoEncoding(MessageParcel &data, const sptr<IRemoteObject> &remote,
+        const sptr<IAccessibilityElementOperatorCallback> &callback)
+    {
+        if (data.GetReadableBytes() < sizeof(int32_t)) {
+            return;
+        }
+        int32_t encoding = data.ReadInt32();
+        if (!remote->IsProxyObject() || encoding <= static_cast<int32_t>(ElementInfoEncoding::LEGACY)) {
+            return;
+        }
+        // iface_cast returns the broker registered for the interface, only a callback proxy has the encoding
+        if (remote->GetInterfaceDescriptor() != AccessibilityElementOperatorCallbackProxy::GetDescriptor()) {
+            HILOG_WARN("callback is not an element operator callback proxy, keep the legacy encoding");
+            return;
+        }
+        ElementInfoEncoding agreed = encoding < static_cast<int32_t>(SUPPORTED_ELEMENT_INFO_ENCODING) ?
+            static_cast<ElementInfoEncoding>(encoding) : SUPPORTED_ELEMENT_INFO_ENCODING;
+        static_cast<AccessibilityElementOperatorCallbackProxy *>(callback.GetRefPtr())->SetElementInfoEncoding(
+            agreed);
+    }
+} // namespace
+
 AccessibilityElementOperatorStub::AccessibilityElementOperatorStub()
 {
 }
@@ -113,7 +143,12 @@ ErrCode AccessibilityElementOperatorStub::HandleSearchElementInfoByAccessibility
     }
     int32_t mode = data.ReadInt32();
     bool isFilter = data.ReadBool();
-    SearchElementInfoByAccessibilityId(elementId, requestId, callback, mode, isFilter);
+    ReadElementInfoEncoding(data, remote, callback);
+    RetError ret = SearchElementInfoByAccessibilityId(elementId, requestId, callback, mode, isFilter);
+    // requesters built before the result was replied do not read it, a revoked granted operator reports it here
+    if (!reply.WriteInt32(ret)) {
+        HILOG_ERROR("write search result failed");
+    }
     return NO_ERROR;
 }
 
@@ -137,6 +172,7 @@ ErrCode AccessibilityElementOperatorStub::HandleSearchDefaultFocusedByWindowId(M
     }
     int32_t mode = data.ReadInt32();
     bool isFilter = data.ReadBool();
+    ReadElementInfoEncoding(data, remote, callback);
     SearchDefaultFocusedByWindowId(windowId, requestId, callback, mode, isFilter);
     return NO_ERROR;
 }
@@ -337,6 +373,7 @@ ErrCode AccessibilityElementOperatorStub::HandleSearchElementInfoBySpecificPrope
         HILOG_ERROR("callback is nullptr");
         return ERR_INVALID_VALUE;
     }
+    ReadElementInfoEncoding(data, remote, callback);
 
     SearchElementInfoBySpecificProperty(elementId, param, requestId, callback);
     return NO_ERROR;
@@ -367,6 +404,7 @@ ErrCode AccessibilityElementOperatorStub::HandleFocusMoveSearchWithCondition(Mes
         HILOG_ERROR("callback is nullptr");
         return ERR_INVALID_VALUE;
     }
+    ReadElementInfoEncoding(data, remote, callback);
     FocusMoveSearchWithCondition(*info, param, requestId, callback);
     return NO_ERROR;
 }
@@ -498,5 +536,82 @@ ErrCode AccessibilityElementOperatorStub::HandleRemoveAccessibilityVirtualNode(M
     RemoveAccessibilityVirtualNode(id, requestId, callback);
     return NO_ERROR;
 }
+
+ErrCode AccessibilityElementOperatorStub::HandleSearchElementInfosBatch(MessageParcel &data, MessageParcel &reply)
+{
+    HILOG_DEBUG();
+    std::vector<ElementSearchQuery> queries;
+    if (!ReadElementSearchQueries(data, queries)) {
+        HILOG_ERROR("read queries failed.");
+        return ERR_INVALID_VALUE;
+    }
+    int32_t requestId = data.ReadInt32();
+
+    sptr<IRemoteObject> remote = data.ReadRemoteObject();
+    if (remote == nullptr) {
+        HILOG_ERROR("remote is nullptr.");
+        return ERR_INVALID_VALUE;
+    }
+    sptr<IAccessibilityElementOperatorCallback> callback =
+        iface_cast<IAccessibilityElementOperatorCallback>(remote);
+    if (callback == nullptr) {
+        HILOG_ERROR("callback is nullptr.");
+        return ERR_INVALID_VALUE;
+    }
+    bool isFilter = data.ReadBool();
+    ReadElementInfoEncoding(data, remote, callback);
+    SearchElementInfosBatch(queries, requestId, callback, isFilter);
+    return NO_ERROR;
+}
+
+ErrCode AccessibilityElementOperatorStub::HandleGrantElementOperator(MessageParcel &data, MessageParcel &reply)
+{
+    HILOG_DEBUG();
+    int32_t grantId = data.ReadInt32();
+    sptr<IRemoteObject> grantedOperator = nullptr;
+    RetError ret = GrantElementOperator(grantId, grantedOperator);
+    if (ret == RET_OK && grantedOperator == nullptr) {
+        ret = RET_ERR_NULLPTR;
+    }
+    if (!reply.WriteInt32(ret)) {
+        HILOG_ERROR("write grant result failed");
+        return ERR_INVALID_VALUE;
+    }
+    if (ret == RET_OK && !reply.WriteRemoteObject(grantedOperator)) {
+        HILOG_ERROR("write granted operator failed");
+        return ERR_INVALID_VALUE;
+    }
+    return NO_ERROR;
+}
+
+ErrCode AccessibilityElementOperatorStub::HandleRevokeElementOperator(MessageParcel &data, MessageParcel &reply)
+{
+    HILOG_DEBUG();
+    int32_t grantId = data.ReadInt32();
+    RevokeElementOperator(grantId);
+    return NO_ERROR;
+}
+
+ErrCode AccessibilityElementOperatorStub::HandleSearchElementTreeDiff(MessageParcel &data, MessageParcel &reply)
+{
+    HILOG_DEBUG();
+    uint64_t sinceGeneration = data.ReadUint64();
+    int32_t requestId = data.ReadInt32();
+
+    sptr<IRemoteObject> remote = data.ReadRemoteObject();
+    if (remote == nullptr) {
+        HILOG_ERROR("remote is nullptr.");
+        return ERR_INVALID_VALUE;
+    }
+    sptr<IAccessibilityElementOperatorCallback> callback =
+        iface_cast<IAccessibilityElementOperatorCallback>(remote);
+    if (callback == nullptr) {
+        HILOG_ERROR("callback is nullptr.");
+        return ERR_INVALID_VALUE;
+    }
+    ReadElementInfoEncoding(data, remote, callback);
+    SearchElementTreeDiff(sinceGeneration, requestId, callback);
+    return NO_ERROR;
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -23,6 +23,7 @@
 #include "accessibility_virtual_node_parcel.h"
 #include "accessibility_window_info_parcel.h"
 #include "hilog_wrapper.h"
+#include "parcel_util.h"
 #include "accessibility_constants.h"
 
 namespace OHOS {
@@ -1052,5 +1053,142 @@ RetError AccessibleAbilityChannelProxy::RemoveAccessibilityVirtualNode(const int
     }
     return static_cast<RetError>(reply.ReadInt32());
 }
+
+RetError AccessibleAbilityChannelProxy::SearchElementInfosBatch(const int32_t windowId, const int32_t treeId,
+    const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+    const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter, bool systemApi)
+{
+    HILOG_DEBUG("windowId[%{public}d], treeId[%{public}d], query count[%{public}zu]", windowId, treeId,
+        queries.size());
+    if (callback == nullptr) {
+        HILOG_ERROR("callback is nullptr.");
+        return RET_ERR_INVALID_PARAM;
+    }
+    if (queries.empty() || queries.size() > MAX_ELEMENT_SEARCH_QUERY_COUNT) {
+        HILOG_ERROR("invalid query count %{public}zu", queries.size());
+        return RET_ERR_INVALID_PARAM;
+    }
+
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    if (!WriteInterfaceToken(data)) {
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteInt32(windowId)) {
+        HILOG_ERROR("windowId write error: %{public}d", windowId);
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteInt32(treeId)) {
+        HILOG_ERROR("treeId write error: %{public}d", treeId);
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!WriteElementSearchQueries(data, queries)) {
+        HILOG_ERROR("queries write error");
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteInt32(requestId)) {
+        HILOG_ERROR("requestId write error: %{public}d", requestId);
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteRemoteObject(callback->AsObject())) {
+        HILOG_ERROR("callback write error");
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteBool(isFilter)) {
+        HILOG_ERROR("isFilter write error");
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteBool(systemApi)) {
+        HILOG_ERROR("systemApi write error");
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!SendTransactCmd(AccessibilityInterfaceCode::SEARCH_ELEMENTINFOS_BATCH, data, reply, option)) {
+        HILOG_ERROR("fail to search element infos batch");
+        return RET_ERR_IPC_FAILED;
+    }
+    return static_cast<RetError>(reply.ReadInt32());
+}
+
+RetError AccessibleAbilityChannelProxy::GrantElementOperator(const int32_t windowId, const int32_t treeId,
+    sptr<IRemoteObject> &grantedOperator)
+{
+    HILOG_DEBUG("windowId[%{public}d], treeId[%{public}d]", windowId, treeId);
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    if (!WriteInterfaceToken(data)) {
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteInt32(windowId)) {
+        HILOG_ERROR("windowId write error: %{public}d", windowId);
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteInt32(treeId)) {
+        HILOG_ERROR("treeId write error: %{public}d", treeId);
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!SendTransactCmd(AccessibilityInterfaceCode::GRANT_ELEMENT_OPERATOR, data, reply, option)) {
+        HILOG_ERROR("fail to grant element operator");
+        return RET_ERR_IPC_FAILED;
+    }
+    RetError result = static_cast<RetError>(reply.ReadInt32());
+    if (result != RET_OK) {
+        return result;
+    }
+    grantedOperator = reply.ReadRemoteObject();
+    if (grantedOperator == nullptr) {
+        HILOG_ERROR("granted operator is nullptr");
+        return RET_ERR_NULLPTR;
+    }
+    return RET_OK;
+}
+
+RetError AccessibleAbilityChannelProxy::SearchElementTreeDiff(const int32_t windowId, const int32_t treeId,
+    const uint64_t sinceGeneration, const int32_t requestId,
+    const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_DEBUG("windowId[%{public}d], treeId[%{public}d], sinceGeneration[%{public}" PRIu64 "]", windowId, treeId,
+        sinceGeneration);
+    if (callback == nullptr) {
+        HILOG_ERROR("callback is nullptr.");
+        return RET_ERR_INVALID_PARAM;
+    }
+
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+
+    if (!WriteInterfaceToken(data)) {
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteInt32(windowId)) {
+        HILOG_ERROR("windowId write error: %{public}d", windowId);
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteInt32(treeId)) {
+        HILOG_ERROR("treeId write error: %{public}d", treeId);
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteUint64(sinceGeneration)) {
+        HILOG_ERROR("sinceGeneration write error");
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteInt32(requestId)) {
+        HILOG_ERROR("requestId write error: %{public}d", requestId);
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!data.WriteRemoteObject(callback->AsObject())) {
+        HILOG_ERROR("callback write error");
+        return RET_ERR_IPC_FAILED;
+    }
+    if (!SendTransactCmd(AccessibilityInterfaceCode::SEARCH_ELEMENT_TREE_DIFF, data, reply, option)) {
+        HILOG_ERROR("fail to search element tree diff");
+        return RET_ERR_IPC_FAILED;
+    }
+    return static_cast<RetError>(reply.ReadInt32());
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
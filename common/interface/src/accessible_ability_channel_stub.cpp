@@ -72,7 +72,11 @@
     SWITCH_CASE(AccessibilityInterfaceCode::UPDATE_ACCESSIBILITY_ELEMENT_INFO,                                        \
         HandleUpdateCustomAccessibilityProperty)                                                                      \
     SWITCH_CASE(AccessibilityInterfaceCode::ADD_ACCESSIBILITY_VIRTUAL_NODE, HandleAddAccessibilityVirtualNode)        \
-    SWITCH_CASE(AccessibilityInterfaceCode::REMOVE_ACCESSIBILITY_VIRTUAL_NODE, HandleRemoveAccessibilityVirtualNode)
+    SWITCH_CASE(AccessibilityInterfaceCode::REMOVE_ACCESSIBILITY_VIRTUAL_NODE,                                        \
+        HandleRemoveAccessibilityVirtualNode)                                                                         \
+    SWITCH_CASE(AccessibilityInterfaceCode::SEARCH_ELEMENTINFOS_BATCH, HandleSearchElementInfosBatch)                 \
+    SWITCH_CASE(AccessibilityInterfaceCode::GRANT_ELEMENT_OPERATOR, HandleGrantElementOperator)                       \
+    SWITCH_CASE(AccessibilityInterfaceCode::SEARCH_ELEMENT_TREE_DIFF, HandleSearchElementTreeDiff)
 
 namespace OHOS {
 namespace Accessibility {
@@ -819,5 +823,103 @@ ErrCode AccessibleAbilityChannelStub::HandleRemoveAccessibilityVirtualNode(Messa
     reply.WriteInt32(result);
     return NO_ERROR;
 }
+
+ErrCode AccessibleAbilityChannelStub::HandleSearchElementInfosBatch(MessageParcel &data, MessageParcel &reply)
+{
+    HILOG_DEBUG();
+    int32_t windowId = data.ReadInt32();
+    int32_t treeId = data.ReadInt32();
+    std::vector<ElementSearchQuery> queries;
+    if (!ReadElementSearchQueries(data, queries)) {
+        HILOG_ERROR("read queries failed.");
+        return ERR_INVALID_VALUE;
+    }
+    int32_t requestId = data.ReadInt32();
+    sptr<IRemoteObject> remote = data.ReadRemoteObject();
+    if (remote == nullptr) {
+        HILOG_ERROR("remote is nullptr.");
+        return ERR_INVALID_VALUE;
+    }
+    sptr<IAccessibilityElementOperatorCallback> callback =
+        iface_cast<IAccessibilityElementOperatorCallback>(remote);
+    if (callback == nullptr) {
+        HILOG_ERROR("callback is nullptr.");
+        return ERR_INVALID_VALUE;
+    }
+
+    for (auto &query : queries) {
+        if (query.type != ElementSearchType::BY_ACCESSIBILITY_ID) {
+            continue;
+        }
+        if (query.mode == PREFETCH_RECURSIVE_CHILDREN &&
+            !Permission::CheckCallingPermission(OHOS_PERMISSION_QUERY_ACCESSIBILITY_ELEMENT) &&
+            !Permission::CheckCallingPermission(OHOS_PERMISSION_ACCESSIBILITY_EXTENSION_ABILITY) &&
+            !Permission::IsStartByHdcd()) {
+            HILOG_ERROR("no get element permission");
+            reply.WriteInt32(RET_ERR_NO_CONNECTION);
+            return NO_ERROR;
+        }
+        if (query.mode == GET_SOURCE_MODE) {
+            query.mode = PREFETCH_RECURSIVE_CHILDREN;
+        }
+    }
+    bool isFilter = data.ReadBool();
+    bool systemApi = data.ReadBool();
+    RetError result = SearchElementInfosBatch(windowId, treeId, queries, requestId, callback, isFilter, systemApi);
+    HILOG_DEBUG("SearchElementInfosBatch ret = %{public}d", result);
+    reply.WriteInt32(result);
+    return NO_ERROR;
+}
+
+ErrCode AccessibleAbilityChannelStub::HandleGrantElementOperator(MessageParcel &data, MessageParcel &reply)
+{
+    HILOG_DEBUG();
+    int32_t windowId = data.ReadInt32();
+    int32_t treeId = data.ReadInt32();
+    sptr<IRemoteObject> grantedOperator = nullptr;
+    RetError result = GrantElementOperator(windowId, treeId, grantedOperator);
+    if (result == RET_OK && grantedOperator == nullptr) {
+        result = RET_ERR_NULLPTR;
+    }
+    HILOG_DEBUG("GrantElementOperator ret = %{public}d", result);
+    reply.WriteInt32(result);
+    if (result == RET_OK && !reply.WriteRemoteObject(grantedOperator)) {
+        HILOG_ERROR("write granted operator failed");
+        return ERR_INVALID_VALUE;
+    }
+    return NO_ERROR;
+}
+
+ErrCode AccessibleAbilityChannelStub::HandleSearchElementTreeDiff(MessageParcel &data, MessageParcel &reply)
+{
+    HILOG_DEBUG();
+    int32_t windowId = data.ReadInt32();
+    int32_t treeId = data.ReadInt32();
+    uint64_t sinceGeneration = data.ReadUint64();
+    int32_t requestId = data.ReadInt32();
+    sptr<IRemoteObject> remote = data.ReadRemoteObject();
+    if (remote == nullptr) {
+        HILOG_ERROR("remote is nullptr.");
+        return ERR_INVALID_VALUE;
+    }
+    sptr<IAccessibilityElementOperatorCallback> callback =
+        iface_cast<IAccessibilityElementOperatorCallback>(remote);
+    if (callback == nullptr) {
+        HILOG_ERROR("callback is nullptr.");
+        return ERR_INVALID_VALUE;
+    }
+    // the diff walks the whole tree like a recursive search
+    if (!Permission::CheckCallingPermission(OHOS_PERMISSION_QUERY_ACCESSIBILITY_ELEMENT) &&
+        !Permission::CheckCallingPermission(OHOS_PERMISSION_ACCESSIBILITY_EXTENSION_ABILITY) &&
+        !Permission::IsStartByHdcd()) {
+        HILOG_ERROR("no get element permission");
+        reply.WriteInt32(RET_ERR_NO_CONNECTION);
+        return NO_ERROR;
+    }
+    RetError result = SearchElementTreeDiff(windowId, treeId, sinceGeneration, requestId, callback);
+    HILOG_DEBUG("SearchElementTreeDiff ret = %{public}d", result);
+    reply.WriteInt32(result);
+    return NO_ERROR;
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -131,6 +131,38 @@ void AccessibleAbilityClientProxy::OnAccessibilityEvent(const AccessibilityEvent
     }
 }
 
+void AccessibleAbilityClientProxy::OnAccessibilityEvents(const std::vector<AccessibilityEventInfo> &eventInfos)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+
+    HILOG_DEBUG("event size is %{public}zu", eventInfos.size());
+
+    if (eventInfos.empty() || eventInfos.size() > MAX_EVENT_BATCH_SIZE) {
+        HILOG_ERROR("invalid event size %{public}zu", eventInfos.size());
+        return;
+    }
+    if (!WriteInterfaceToken(data)) {
+        return;
+    }
+    if (!data.WriteInt32(static_cast<int32_t>(eventInfos.size()))) {
+        HILOG_ERROR("fail, event size write int32 error");
+        return;
+    }
+    for (const auto &eventInfo : eventInfos) {
+        AccessibilityEventInfoParcel eventInfoParcel(eventInfo);
+        if (!data.WriteParcelable(&eventInfoParcel)) {
+            HILOG_ERROR("fail, eventInfo write parcelable error");
+            return;
+        }
+    }
+    if (!SendTransactCmd(AccessibilityInterfaceCode::ON_ACCESSIBILITY_EVENTS, data, reply, option)) {
+        HILOG_ERROR("OnAccessibilityEvents fail");
+        return;
+    }
+}
+
 void AccessibleAbilityClientProxy::OnKeyPressEvent(const MMI::KeyEvent &keyEvent, const int32_t sequence)
 {
     MessageParcel data;
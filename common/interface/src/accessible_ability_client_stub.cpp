@@ -38,6 +38,7 @@
     SWITCH_CASE(AccessibilityInterfaceCode::INIT, HandleInit)                                   \
     SWITCH_CASE(AccessibilityInterfaceCode::DISCONNECT, HandleDisconnect)                       \
     SWITCH_CASE(AccessibilityInterfaceCode::ON_ACCESSIBILITY_EVENT, HandleOnAccessibilityEvent) \
+    SWITCH_CASE(AccessibilityInterfaceCode::ON_ACCESSIBILITY_EVENTS, HandleOnAccessibilityEvents) \
     SWITCH_CASE(AccessibilityInterfaceCode::ON_KEY_PRESS_EVENT, HandleOnKeyPressEvent)
 
 namespace OHOS {
@@ -116,6 +117,30 @@ ErrCode AccessibleAbilityClientStub::HandleOnAccessibilityEvent(MessageParcel &d
     return NO_ERROR;
 }
 
+ErrCode AccessibleAbilityClientStub::HandleOnAccessibilityEvents(MessageParcel &data, MessageParcel &reply)
+{
+    HILOG_DEBUG();
+    int32_t eventSize = data.ReadInt32();
+    if (eventSize <= 0 || static_cast<size_t>(eventSize) > MAX_EVENT_BATCH_SIZE) {
+        HILOG_ERROR("invalid event size %{public}d", eventSize);
+        return ERR_INVALID_VALUE;
+    }
+
+    std::vector<AccessibilityEventInfo> eventInfos;
+    eventInfos.reserve(eventSize);
+    for (int32_t i = 0; i < eventSize; i++) {
+        sptr<AccessibilityEventInfoParcel> eventInfo = data.ReadStrongParcelable<AccessibilityEventInfoParcel>();
+        if (eventInfo == nullptr) {
+            HILOG_ERROR("ReadStrongParcelable<AccessibilityEventInfo> failed");
+            return ERR_INVALID_VALUE;
+        }
+        eventInfos.push_back(*eventInfo);
+    }
+
+    OnAccessibilityEvents(eventInfos);
+    return NO_ERROR;
+}
+
 ErrCode AccessibleAbilityClientStub::HandleOnKeyPressEvent(MessageParcel &data, MessageParcel &reply)
 {
     HILOG_DEBUG();
@@ -14,20 +14,417 @@
  */
 
 #include "accessibility_element_info_parcel.h"
+#include <map>
+#include <securec.h>
+#include <vector>
 #include "hilog_wrapper.h"
 #include "parcel_util.h"
 
 namespace OHOS {
 namespace Accessibility {
+namespace {
+    // The legacy encoding starts with pageId_, the compact one with this word. It is far below any page id
+    // handed out by arkui, so a reader can tell both encodings apart without a separate version field.
+    constexpr int32_t COMPACT_V1_MAGIC = static_cast<int32_t>(0x80C0A701);
+    constexpr uint32_t VARINT_PAYLOAD_BITS = 7;
+    constexpr uint8_t VARINT_PAYLOAD_MASK = 0x7F;
+    constexpr uint8_t VARINT_CONTINUE_BIT = 0x80;
+    constexpr uint32_t MAX_VARINT_BYTES = 10;
+    constexpr uint32_t MAX_COMPACT_BODY_SIZE = 32 * 1024 * 1024;
+    constexpr uint32_t PARCEL_WORD_SIZE = 4;
+
+    // the body is sent with an explicitly padded length so that the bytes consumed by the reader never
+    // depend on the implicit padding of Parcel::WriteBuffer/ReadBuffer
+    uint32_t AlignToParcelWord(uint32_t size)
+    {
+        return (size + PARCEL_WORD_SIZE - 1) & ~(PARCEL_WORD_SIZE - 1);
+    }
+
+    // presence bits of the optional fields, an absent string is empty and an absent struct is default
+    enum CompactPresence : uint32_t {
+        HAS_BUNDLE_NAME = 0,
+        HAS_COMPONENT_TYPE,
+        HAS_TEXT,
+        HAS_HINT_TEXT,
+        HAS_ACCESSIBILITY_TEXT,
+        HAS_STATE_DESCRIPTION,
+        HAS_CONTENT_DESCRIPTION,
+        HAS_RESOURCE_NAME,
+        HAS_TEXT_TYPE,
+        HAS_ERROR,
+        HAS_INSPECTOR_KEY,
+        HAS_PAGE_PATH,
+        HAS_ACCESSIBILITY_LEVEL,
+        HAS_BACKGROUND_COLOR,
+        HAS_BACKGROUND_IMAGE,
+        HAS_BLUR,
+        HAS_HIT_TEST_BEHAVIOR,
+        HAS_CUSTOM_COMPONENT_TYPE,
+        HAS_ORIGINAL_TEXT,
+        HAS_CHILD_NODE_IDS,
+        HAS_OPERATIONS,
+        HAS_RANGE_INFO,
+        HAS_GRID,
+        HAS_GRID_ITEM,
+        HAS_EXTRA_ELEMENT_INFO,
+        HAS_SPAN_LIST,
+        HAS_CUSTOM_ACTIONS,
+    };
+
+    class CompactWriter {
+    public:
+        void WriteVarint(uint64_t value)
+        {
+            while (value > VARINT_PAYLOAD_MASK) {
+                buffer_.push_back(static_cast<uint8_t>(value & VARINT_PAYLOAD_MASK) | VARINT_CONTINUE_BIT);
+                value >>= VARINT_PAYLOAD_BITS;
+            }
+            buffer_.push_back(static_cast<uint8_t>(value));
+        }
+
+        void WriteSvarint(int64_t value)
+        {
+            // zigzag keeps the common -1 as small as 1
+            WriteVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+        }
+
+        template<typename T>
+        void WriteFixed(T value)
+        {
+            const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+            buffer_.insert(buffer_.end(), bytes, bytes + sizeof(T));
+        }
+
+        void WriteString(const std::string &value)
+        {
+            WriteVarint(value.size());
+            buffer_.insert(buffer_.end(), value.begin(), value.end());
+        }
+
+        void PadToParcelWord()
+        {
+            buffer_.resize(AlignToParcelWord(static_cast<uint32_t>(buffer_.size())), 0);
+        }
+
+        const std::vector<uint8_t> &GetBuffer() const
+        {
+            return buffer_;
+        }
+
+    private:
+        std::vector<uint8_t> buffer_ {};
+    };
+
+    class CompactReader {
+    public:
+        CompactReader(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+
+        bool ReadVarint(uint64_t &value)
+        {
+            value = 0;
+            for (uint32_t i = 0; i < MAX_VARINT_BYTES; i++) {
+                if (pos_ >= size_) {
+                    return false;
+                }
+                uint8_t byte = data_[pos_++];
+                value |= static_cast<uint64_t>(byte & VARINT_PAYLOAD_MASK) << (i * VARINT_PAYLOAD_BITS);
+                if ((byte & VARINT_CONTINUE_BIT) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template<typename T>
+        bool ReadSvarint(T &value)
+        {
+            uint64_t raw = 0;
+            if (!ReadVarint(raw)) {
+                return false;
+            }
+            value = static_cast<T>(static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1));
+            return true;
+        }
+
+        template<typename T>
+        bool ReadFixed(T &value)
+        {
+            if (size_ - pos_ < sizeof(T)) {
+                return false;
+            }
+            if (memcpy_s(&value, sizeof(T), data_ + pos_, sizeof(T)) != EOK) {
+                return false;
+            }
+            pos_ += sizeof(T);
+            return true;
+        }
+
+        bool ReadString(std::string &value)
+        {
+            uint64_t length = 0;
+            if (!ReadVarint(length) || length > size_ - pos_) {
+                return false;
+            }
+            value.assign(reinterpret_cast<const char *>(data_ + pos_), static_cast<size_t>(length));
+            pos_ += static_cast<size_t>(length);
+            return true;
+        }
+
+        bool ReadCount(uint32_t &count)
+        {
+            uint64_t value = 0;
+            // every entry takes at least one byte, so a count beyond the remaining bytes is corrupted
+            if (!ReadVarint(value) || value > static_cast<uint64_t>(MAX_ALLOW_SIZE) || value > size_ - pos_) {
+                return false;
+            }
+            count = static_cast<uint32_t>(value);
+            return true;
+        }
+
+        bool IsEnd() const
+        {
+            return pos_ == size_;
+        }
+
+    private:
+        const uint8_t *data_ = nullptr;
+        size_t size_ = 0;
+        size_t pos_ = 0;
+    };
+
+    inline uint64_t Bit(uint32_t index)
+    {
+        return static_cast<uint64_t>(1) << index;
+    }
+
+    void WriteOptionalString(CompactWriter &writer, uint64_t presence, uint32_t index, const std::string &value)
+    {
+        if (presence & Bit(index)) {
+            writer.WriteString(value);
+        }
+    }
+
+    bool ReadOptionalString(CompactReader &reader, uint64_t presence, uint32_t index, std::string &value)
+    {
+        if (presence & Bit(index)) {
+            return reader.ReadString(value);
+        }
+        value.clear();
+        return true;
+    }
+
+    void WriteRect(CompactWriter &writer, const Rect &rect)
+    {
+        writer.WriteSvarint(rect.GetLeftTopXScreenPostion());
+        writer.WriteSvarint(rect.GetLeftTopYScreenPostion());
+        writer.WriteSvarint(rect.GetRightBottomXScreenPostion());
+        writer.WriteSvarint(rect.GetRightBottomYScreenPostion());
+    }
+
+    bool ReadRect(CompactReader &reader, Rect &rect)
+    {
+        int32_t leftTopX = 0;
+        int32_t leftTopY = 0;
+        int32_t rightBottomX = 0;
+        int32_t rightBottomY = 0;
+        if (!reader.ReadSvarint(leftTopX) || !reader.ReadSvarint(leftTopY) ||
+            !reader.ReadSvarint(rightBottomX) || !reader.ReadSvarint(rightBottomY)) {
+            return false;
+        }
+        rect = Rect(leftTopX, leftTopY, rightBottomX, rightBottomY);
+        return true;
+    }
+
+    bool IsDefaultRangeInfo(const RangeInfo &rangeInfo)
+    {
+        RangeInfo defaultInfo;
+        return rangeInfo.GetMin() == defaultInfo.GetMin() && rangeInfo.GetMax() == defaultInfo.GetMax() &&
+            rangeInfo.GetCurrent() == defaultInfo.GetCurrent();
+    }
+
+    bool IsDefaultGrid(const GridInfo &grid)
+    {
+        GridInfo defaultInfo;
+        return grid.GetRowCount() == defaultInfo.GetRowCount() &&
+            grid.GetColumnCount() == defaultInfo.GetColumnCount() &&
+            grid.GetSelectionMode() == defaultInfo.GetSelectionMode();
+    }
+
+    bool IsDefaultGridItem(const GridItemInfo &gridItem)
+    {
+        GridItemInfo defaultInfo;
+        return gridItem.GetRowIndex() == defaultInfo.GetRowIndex() &&
+            gridItem.GetRowSpan() == defaultInfo.GetRowSpan() &&
+            gridItem.GetColumnIndex() == defaultInfo.GetColumnIndex() &&
+            gridItem.GetColumnSpan() == defaultInfo.GetColumnSpan() &&
+            gridItem.IsHeading() == defaultInfo.IsHeading() && gridItem.IsSelected() == defaultInfo.IsSelected();
+    }
+
+    bool ReadChildNodeIds(CompactReader &reader, std::vector<int64_t> &childNodeIds)
+    {
+        uint32_t count = 0;
+        if (!reader.ReadCount(count)) {
+            return false;
+        }
+        childNodeIds.clear();
+        childNodeIds.reserve(count);
+        int64_t previous = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            int64_t delta = 0;
+            if (!reader.ReadSvarint(delta)) {
+                return false;
+            }
+            previous = static_cast<int64_t>(static_cast<uint64_t>(previous) + static_cast<uint64_t>(delta));
+            childNodeIds.push_back(previous);
+        }
+        return true;
+    }
+
+    bool ReadOperations(CompactReader &reader, std::vector<AccessibleAction> &operations)
+    {
+        uint32_t count = 0;
+        if (!reader.ReadCount(count)) {
+            return false;
+        }
+        operations.clear();
+        operations.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            uint64_t actionType = 0;
+            std::string description;
+            if (!reader.ReadVarint(actionType) || !reader.ReadString(description)) {
+                return false;
+            }
+            operations.emplace_back(static_cast<ActionType>(actionType), description);
+        }
+        return true;
+    }
+
+    bool ReadRangeInfo(CompactReader &reader, RangeInfo &rangeInfo)
+    {
+        double min = 0;
+        double max = 0;
+        double current = 0;
+        if (!reader.ReadFixed(min) || !reader.ReadFixed(max) || !reader.ReadFixed(current)) {
+            return false;
+        }
+        rangeInfo = RangeInfo(min, max, current);
+        return true;
+    }
+
+    bool ReadGrid(CompactReader &reader, GridInfo &grid)
+    {
+        int32_t rowCount = 0;
+        int32_t columnCount = 0;
+        int32_t selectionMode = 0;
+        if (!reader.ReadSvarint(rowCount) || !reader.ReadSvarint(columnCount) || !reader.ReadSvarint(selectionMode)) {
+            return false;
+        }
+        grid = GridInfo(rowCount, columnCount, selectionMode);
+        return true;
+    }
+
+    bool ReadGridItem(CompactReader &reader, GridItemInfo &gridItem)
+    {
+        int32_t rowIndex = 0;
+        int32_t rowSpan = 0;
+        int32_t columnIndex = 0;
+        int32_t columnSpan = 0;
+        uint64_t itemFlags = 0;
+        if (!reader.ReadSvarint(rowIndex) || !reader.ReadSvarint(rowSpan) || !reader.ReadSvarint(columnIndex) ||
+            !reader.ReadSvarint(columnSpan) || !reader.ReadVarint(itemFlags)) {
+            return false;
+        }
+        gridItem = GridItemInfo(rowIndex, rowSpan, columnIndex, columnSpan, (itemFlags & Bit(0)) != 0,
+            (itemFlags & Bit(1)) != 0);
+        return true;
+    }
+
+    bool ReadExtraElementInfo(CompactReader &reader, ExtraElementInfo &extraElementInfo)
+    {
+        std::map<std::string, std::string> valueStr;
+        std::map<std::string, int32_t> valueInt;
+        uint32_t count = 0;
+        if (!reader.ReadCount(count)) {
+            return false;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            std::string key;
+            std::string value;
+            if (!reader.ReadString(key) || !reader.ReadString(value)) {
+                return false;
+            }
+            valueStr[key] = value;
+        }
+        if (!reader.ReadCount(count)) {
+            return false;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            std::string key;
+            int32_t value = 0;
+            if (!reader.ReadString(key) || !reader.ReadSvarint(value)) {
+                return false;
+            }
+            valueInt[key] = value;
+        }
+        extraElementInfo = ExtraElementInfo(valueStr, valueInt);
+        return true;
+    }
+
+    bool ReadSpanList(CompactReader &reader, std::vector<SpanInfo> &spanList)
+    {
+        uint32_t count = 0;
+        if (!reader.ReadCount(count)) {
+            return false;
+        }
+        spanList.clear();
+        spanList.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            int32_t spanId = 0;
+            std::string spanText;
+            std::string accessibilityText;
+            std::string accessibilityDescription;
+            std::string accessibilityLevel;
+            if (!reader.ReadSvarint(spanId) || !reader.ReadString(spanText) || !reader.ReadString(accessibilityText) ||
+                !reader.ReadString(accessibilityDescription) || !reader.ReadString(accessibilityLevel)) {
+                return false;
+            }
+            spanList.emplace_back(spanId, spanText, accessibilityText, accessibilityDescription, accessibilityLevel);
+        }
+        return true;
+    }
+
+    bool ReadCustomActions(CompactReader &reader, std::vector<std::string> &customActions)
+    {
+        uint32_t count = 0;
+        if (!reader.ReadCount(count)) {
+            return false;
+        }
+        customActions.clear();
+        customActions.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            std::string customAction;
+            if (!reader.ReadString(customAction)) {
+                return false;
+            }
+            customActions.push_back(customAction);
+        }
+        return true;
+    }
+} // namespace
+
 /* AccessibilityElementInfoParcel       Parcel struct                 */
 AccessibilityElementInfoParcel::AccessibilityElementInfoParcel(const AccessibilityElementInfo &elementInfo)
     : AccessibilityElementInfo(elementInfo)
 {
 }
 
+AccessibilityElementInfoParcel::AccessibilityElementInfoParcel(const AccessibilityElementInfo &elementInfo,
+    ElementInfoEncoding encoding) : AccessibilityElementInfo(elementInfo), encoding_(encoding)
+{
+}
+
 bool AccessibilityElementInfoParcel::ReadFromParcelFirstPart(Parcel &parcel)
 {
-    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, pageId_);
     int32_t textMoveStep = STEP_CHARACTER;
     READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, textMoveStep);
     textMoveStep_ = static_cast<TextMoveUnit>(textMoveStep);
@@ -199,6 +596,14 @@ bool AccessibilityElementInfoParcel::ReadFromParcelFourthPart(Parcel &parcel)
 
 bool AccessibilityElementInfoParcel::ReadFromParcel(Parcel &parcel)
 {
+    int32_t firstWord = 0;
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, firstWord);
+    if (firstWord == COMPACT_V1_MAGIC) {
+        encoding_ = ElementInfoEncoding::COMPACT_V1;
+        return ReadFromParcelCompact(parcel);
+    }
+    encoding_ = ElementInfoEncoding::LEGACY;
+    pageId_ = firstWord;
     if (!ReadFromParcelFirstPart(parcel)) {
         return false;
     }
@@ -333,6 +738,9 @@ bool AccessibilityElementInfoParcel::MarshallingThirdPart(Parcel &parcel) const
 
 bool AccessibilityElementInfoParcel::Marshalling(Parcel &parcel) const
 {
+    if (encoding_ == ElementInfoEncoding::COMPACT_V1) {
+        return MarshallingCompact(parcel);
+    }
     if (!MarshallingFirstPart(parcel)) {
         return false;
     }
@@ -345,6 +753,208 @@ bool AccessibilityElementInfoParcel::Marshalling(Parcel &parcel) const
     return true;
 }
 
+bool AccessibilityElementInfoParcel::MarshallingCompact(Parcel &parcel) const
+{
+    const std::string *strings[] = { &bundleName_, &componentType_, &text_, &hintText_, &accessibilityText_,
+        &accessibilityStateDescription_, &contentDescription_, &resourceName_, &textType_, &error_, &inspectorKey_,
+        &pagePath_, &accessibilityLevel_, &backgroundColor_, &backgroundImage_, &blur_, &hitTestBehavior_,
+        &customComponentType_, &originalText_ };
+    uint64_t presence = 0;
+    for (uint32_t i = 0; i < sizeof(strings) / sizeof(strings[0]); i++) {
+        presence |= strings[i]->empty() ? 0 : Bit(HAS_BUNDLE_NAME + i);
+    }
+    presence |= childNodeIds_.empty() ? 0 : Bit(HAS_CHILD_NODE_IDS);
+    presence |= operations_.empty() ? 0 : Bit(HAS_OPERATIONS);
+    presence |= IsDefaultRangeInfo(rangeInfo_) ? 0 : Bit(HAS_RANGE_INFO);
+    presence |= IsDefaultGrid(grid_) ? 0 : Bit(HAS_GRID);
+    presence |= IsDefaultGridItem(gridItem_) ? 0 : Bit(HAS_GRID_ITEM);
+    presence |= (extraElementInfo_.GetExtraElementInfoValueStr().empty() &&
+        extraElementInfo_.GetExtraElementInfoValueInt().empty()) ? 0 : Bit(HAS_EXTRA_ELEMENT_INFO);
+    presence |= spanList_.empty() ? 0 : Bit(HAS_SPAN_LIST);
+    presence |= customActions_.empty() ? 0 : Bit(HAS_CUSTOM_ACTIONS);
+
+    const bool flags[] = { checkable_, checked_, focusable_, focused_, visible_, accessibilityFocused_, selected_,
+        clickable_, longClickable_, enable_, isPassword_, scrollable_, editable_, popupSupported_, multiLine_,
+        deletable_, hint_, isEssential_, contentInvalid_, validElement_, accessibilityGroup_, isActive_,
+        accessibilityVisible_, clip_, accessibilityScrollable_ };
+    uint64_t packedFlags = 0;
+    for (uint32_t i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) {
+        packedFlags |= flags[i] ? Bit(i) : 0;
+    }
+
+    CompactWriter writer;
+    writer.WriteVarint(presence);
+    writer.WriteVarint(packedFlags);
+    const int64_t scalars[] = { pageId_, static_cast<int64_t>(textMoveStep_), itemCounts_, windowId_, elementId_,
+        parentId_, belongTreeId_, childTreeId_, childWindowId_, parentWindowId_, childCount_, textLengthLimit_,
+        navDestinationId_, currentIndex_, beginIndex_, endIndex_, liveRegion_, labeled_, beginSelected_,
+        endSelected_, inputType_, zIndex_, mainWindowId_, innerWindowId_, accessibilityNextFocusId_,
+        accessibilityPreviousFocusId_, uniqueId_, static_cast<int64_t>(sourceType_) };
+    for (int64_t scalar : scalars) {
+        writer.WriteSvarint(scalar);
+    }
+    writer.WriteVarint(virtualSupportAction_);
+    writer.WriteFixed(offset_);
+    writer.WriteFixed(opacity_);
+    WriteRect(writer, bounds_);
+    for (uint32_t i = 0; i < sizeof(strings) / sizeof(strings[0]); i++) {
+        WriteOptionalString(writer, presence, HAS_BUNDLE_NAME + i, *strings[i]);
+    }
+
+    if (presence & Bit(HAS_CHILD_NODE_IDS)) {
+        // children are mostly numbered close to each other, so the deltas stay short
+        writer.WriteVarint(childNodeIds_.size());
+        int64_t previous = 0;
+        for (int64_t childId : childNodeIds_) {
+            writer.WriteSvarint(static_cast<int64_t>(static_cast<uint64_t>(childId) - static_cast<uint64_t>(previous)));
+            previous = childId;
+        }
+    }
+    if (presence & Bit(HAS_OPERATIONS)) {
+        writer.WriteVarint(operations_.size());
+        for (auto &operation : operations_) {
+            writer.WriteVarint(static_cast<uint64_t>(operation.GetActionType()));
+            writer.WriteString(operation.GetDescriptionInfo());
+        }
+    }
+    if (presence & Bit(HAS_RANGE_INFO)) {
+        writer.WriteFixed(rangeInfo_.GetMin());
+        writer.WriteFixed(rangeInfo_.GetMax());
+        writer.WriteFixed(rangeInfo_.GetCurrent());
+    }
+    if (presence & Bit(HAS_GRID)) {
+        writer.WriteSvarint(grid_.GetRowCount());
+        writer.WriteSvarint(grid_.GetColumnCount());
+        writer.WriteSvarint(grid_.GetSelectionMode());
+    }
+    if (presence & Bit(HAS_GRID_ITEM)) {
+        writer.WriteSvarint(gridItem_.GetRowIndex());
+        writer.WriteSvarint(gridItem_.GetRowSpan());
+        writer.WriteSvarint(gridItem_.GetColumnIndex());
+        writer.WriteSvarint(gridItem_.GetColumnSpan());
+        writer.WriteVarint((gridItem_.IsHeading() ? Bit(0) : 0) | (gridItem_.IsSelected() ? Bit(1) : 0));
+    }
+    if (presence & Bit(HAS_EXTRA_ELEMENT_INFO)) {
+        auto &valueStr = extraElementInfo_.GetExtraElementInfoValueStr();
+        writer.WriteVarint(valueStr.size());
+        for (auto &item : valueStr) {
+            writer.WriteString(item.first);
+            writer.WriteString(item.second);
+        }
+        auto &valueInt = extraElementInfo_.GetExtraElementInfoValueInt();
+        writer.WriteVarint(valueInt.size());
+        for (auto &item : valueInt) {
+            writer.WriteString(item.first);
+            writer.WriteSvarint(item.second);
+        }
+    }
+    if (presence & Bit(HAS_SPAN_LIST)) {
+        writer.WriteVarint(spanList_.size());
+        for (auto &span : spanList_) {
+            writer.WriteSvarint(span.GetSpanId());
+            writer.WriteString(span.GetSpanText());
+            writer.WriteString(span.GetAccessibilityText());
+            writer.WriteString(span.GetAccessibilityDescription());
+            writer.WriteString(span.GetAccessibilityLevel());
+        }
+    }
+    if (presence & Bit(HAS_CUSTOM_ACTIONS)) {
+        writer.WriteVarint(customActions_.size());
+        for (auto &customAction : customActions_) {
+            writer.WriteString(customAction);
+        }
+    }
+
+    size_t bodySize = writer.GetBuffer().size();
+    if (bodySize > MAX_COMPACT_BODY_SIZE) {
+        HILOG_ERROR("compact element info is too large: %{public}zu", bodySize);
+        return false;
+    }
+    writer.PadToParcelWord();
+    const std::vector<uint8_t> &body = writer.GetBuffer();
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Int32, parcel, COMPACT_V1_MAGIC);
+    WRITE_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, static_cast<uint32_t>(bodySize));
+    return parcel.WriteBuffer(body.data(), body.size());
+}
+
+bool AccessibilityElementInfoParcel::ReadFromParcelCompact(Parcel &parcel)
+{
+    uint32_t bodySize = 0;
+    READ_PARCEL_AND_RETURN_FALSE_IF_FAIL(Uint32, parcel, bodySize);
+    if (bodySize > MAX_COMPACT_BODY_SIZE || AlignToParcelWord(bodySize) > parcel.GetReadableBytes()) {
+        HILOG_ERROR("invalid compact element info size: %{public}u", bodySize);
+        return false;
+    }
+    const uint8_t *body = parcel.ReadBuffer(AlignToParcelWord(bodySize));
+    if (body == nullptr) {
+        return false;
+    }
+    CompactReader reader(body, bodySize);
+    uint64_t presence = 0;
+    uint64_t packedFlags = 0;
+    if (!reader.ReadVarint(presence) || !reader.ReadVarint(packedFlags)) {
+        return false;
+    }
+
+    bool *flags[] = { &checkable_, &checked_, &focusable_, &focused_, &visible_, &accessibilityFocused_, &selected_,
+        &clickable_, &longClickable_, &enable_, &isPassword_, &scrollable_, &editable_, &popupSupported_,
+        &multiLine_, &deletable_, &hint_, &isEssential_, &contentInvalid_, &validElement_, &accessibilityGroup_,
+        &isActive_, &accessibilityVisible_, &clip_, &accessibilityScrollable_ };
+    for (uint32_t i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) {
+        *flags[i] = (packedFlags & Bit(i)) != 0;
+    }
+
+    int32_t textMoveStep = STEP_CHARACTER;
+    int32_t sourceType = AccessibilitySourceType::DEFAULT_NODE;
+    bool scalarResult = reader.ReadSvarint(pageId_) && reader.ReadSvarint(textMoveStep) &&
+        reader.ReadSvarint(itemCounts_) && reader.ReadSvarint(windowId_) && reader.ReadSvarint(elementId_) &&
+        reader.ReadSvarint(parentId_) && reader.ReadSvarint(belongTreeId_) && reader.ReadSvarint(childTreeId_) &&
+        reader.ReadSvarint(childWindowId_) && reader.ReadSvarint(parentWindowId_) &&
+        reader.ReadSvarint(childCount_) && reader.ReadSvarint(textLengthLimit_) &&
+        reader.ReadSvarint(navDestinationId_) && reader.ReadSvarint(currentIndex_) &&
+        reader.ReadSvarint(beginIndex_) && reader.ReadSvarint(endIndex_) && reader.ReadSvarint(liveRegion_) &&
+        reader.ReadSvarint(labeled_) && reader.ReadSvarint(beginSelected_) && reader.ReadSvarint(endSelected_) &&
+        reader.ReadSvarint(inputType_) && reader.ReadSvarint(zIndex_) && reader.ReadSvarint(mainWindowId_) &&
+        reader.ReadSvarint(innerWindowId_) && reader.ReadSvarint(accessibilityNextFocusId_) &&
+        reader.ReadSvarint(accessibilityPreviousFocusId_) && reader.ReadSvarint(uniqueId_) &&
+        reader.ReadSvarint(sourceType) && reader.ReadVarint(virtualSupportAction_) &&
+        reader.ReadFixed(offset_) && reader.ReadFixed(opacity_) && ReadRect(reader, bounds_);
+    if (!scalarResult) {
+        HILOG_ERROR("read compact scalars failed");
+        return false;
+    }
+    textMoveStep_ = static_cast<TextMoveUnit>(textMoveStep);
+    sourceType_ = static_cast<AccessibilitySourceType>(sourceType);
+
+    std::string *strings[] = { &bundleName_, &componentType_, &text_, &hintText_, &accessibilityText_,
+        &accessibilityStateDescription_, &contentDescription_, &resourceName_, &textType_, &error_, &inspectorKey_,
+        &pagePath_, &accessibilityLevel_, &backgroundColor_, &backgroundImage_, &blur_, &hitTestBehavior_,
+        &customComponentType_, &originalText_ };
+    for (uint32_t i = 0; i < sizeof(strings) / sizeof(strings[0]); i++) {
+        if (!ReadOptionalString(reader, presence, HAS_BUNDLE_NAME + i, *strings[i])) {
+            HILOG_ERROR("read compact string %{public}u failed", i);
+            return false;
+        }
+    }
+    bool containerResult = (!(presence & Bit(HAS_CHILD_NODE_IDS)) || ReadChildNodeIds(reader, childNodeIds_)) &&
+        (!(presence & Bit(HAS_OPERATIONS)) || ReadOperations(reader, operations_)) &&
+        (!(presence & Bit(HAS_RANGE_INFO)) || ReadRangeInfo(reader, rangeInfo_)) &&
+        (!(presence & Bit(HAS_GRID)) || ReadGrid(reader, grid_)) &&
+        (!(presence & Bit(HAS_GRID_ITEM)) || ReadGridItem(reader, gridItem_)) &&
+        (!(presence & Bit(HAS_EXTRA_ELEMENT_INFO)) || ReadExtraElementInfo(reader, extraElementInfo_)) &&
+        (!(presence & Bit(HAS_SPAN_LIST)) || ReadSpanList(reader, spanList_)) &&
+        (!(presence & Bit(HAS_CUSTOM_ACTIONS)) || ReadCustomActions(reader, customActions_));
+    if (!containerResult) {
+        HILOG_ERROR("read compact containers failed");
+        return false;
+    }
+    if (!reader.IsEnd()) {
+        HILOG_ERROR("compact element info has trailing bytes");
+        return false;
+    }
+    return true;
+}
+
 AccessibilityElementInfoParcel *AccessibilityElementInfoParcel::Unmarshalling(Parcel& parcel)
 {
     AccessibilityElementInfoParcel *accessibilityInfo = new(std::nothrow) AccessibilityElementInfoParcel();
@@ -53,6 +53,9 @@ public:
         const int32_t requestId) override {}
     void SetRemoveAccessibilityVirtualNodeResult(const OperateVirtualNodeResult result,
         const int32_t requestId) override {}
+    void SetSearchElementInfosBatchResult(const std::vector<ElementSearchResult> &results,
+        const int32_t requestId) override {}
+    void SetSearchElementTreeDiffResult(const ElementTreeDiff &diff, const int32_t requestId) override {}
 };
 
 template<class T>
@@ -68,6 +68,13 @@ public:
         const sptr<IAccessibilityElementOperatorCallback> &callback) override {}
     void RemoveAccessibilityVirtualNode(const int64_t id, const int32_t requestId,
         const sptr<IAccessibilityElementOperatorCallback> &callback) override {}
+    void SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter) override {}
+    RetError GrantElementOperator(const int32_t grantId,
+        sptr<IRemoteObject> &grantedOperator) override { return RET_ERR_FAILED; }
+    void RevokeElementOperator(const int32_t grantId) override {}
+    void SearchElementTreeDiff(const uint64_t sinceGeneration, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override {}
 };
 
 template<class T>
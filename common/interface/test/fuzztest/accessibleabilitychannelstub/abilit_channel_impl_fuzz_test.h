@@ -148,6 +148,22 @@ public:
     {
         return RET_OK;
     }
+    RetError SearchElementInfosBatch(const int32_t windowId, const int32_t treeId,
+        const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter, bool systemApi) override
+    {
+        return RET_OK;
+    }
+    RetError GrantElementOperator(const int32_t windowId, const int32_t treeId,
+        sptr<IRemoteObject> &grantedOperator) override
+    {
+        return RET_OK;
+    }
+    RetError SearchElementTreeDiff(const int32_t windowId, const int32_t treeId, const uint64_t sinceGeneration,
+        const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback) override
+    {
+        return RET_OK;
+    }
 };
 
 template<class T>
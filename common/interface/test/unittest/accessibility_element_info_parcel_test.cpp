@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 #include "accessibility_element_info_parcel.h"
 
@@ -21,6 +22,93 @@ using namespace testing::ext;
 
 namespace OHOS {
 namespace Accessibility {
+namespace {
+    constexpr int32_t SYNTHETIC_TREE_NODE_COUNT = 5000;
+    constexpr int32_t SYNTHETIC_TREE_FANOUT = 4;
+    constexpr int32_t SYNTHETIC_WINDOW_ID = 2;
+    constexpr int32_t SYNTHETIC_PAGE_ID = 7;
+    constexpr int32_t SYNTHETIC_NODE_SIZE = 40;
+
+    AccessibilityElementInfo CreateSyntheticNode(int32_t index)
+    {
+        AccessibilityElementInfo info;
+        info.SetAccessibilityId(index);
+        info.SetParent(index == 0 ? -1 : (index - 1) / SYNTHETIC_TREE_FANOUT);
+        for (int32_t child = index * SYNTHETIC_TREE_FANOUT + 1;
+            child <= index * SYNTHETIC_TREE_FANOUT + SYNTHETIC_TREE_FANOUT && child < SYNTHETIC_TREE_NODE_COUNT;
+            child++) {
+            info.AddChild(child);
+        }
+        info.SetWindowId(SYNTHETIC_WINDOW_ID);
+        info.SetPageId(SYNTHETIC_PAGE_ID);
+        info.SetBundleName("com.example.synthetic");
+        info.SetComponentType(index % 2 == 0 ? "Column" : "Text");
+        info.SetContent("item " + std::to_string(index));
+        info.SetInspectorKey("key_" + std::to_string(index));
+        Rect bounds(index % SYNTHETIC_NODE_SIZE, index, index % SYNTHETIC_NODE_SIZE + SYNTHETIC_NODE_SIZE,
+            index + SYNTHETIC_NODE_SIZE);
+        info.SetRectInScreen(bounds);
+        AccessibleAction click(ACCESSIBILITY_ACTION_CLICK, "click");
+        info.AddAction(click);
+        info.SetVisible(true);
+        info.SetEnabled(true);
+        info.SetClickable(index % 2 != 0);
+        return info;
+    }
+
+    void ExpectSameElementInfo(const AccessibilityElementInfo &expect, const AccessibilityElementInfo &actual)
+    {
+        EXPECT_EQ(expect.GetAccessibilityId(), actual.GetAccessibilityId());
+        EXPECT_EQ(expect.GetParentNodeId(), actual.GetParentNodeId());
+        EXPECT_EQ(expect.GetChildIds(), actual.GetChildIds());
+        EXPECT_EQ(expect.GetWindowId(), actual.GetWindowId());
+        EXPECT_EQ(expect.GetPageId(), actual.GetPageId());
+        EXPECT_EQ(expect.GetBundleName(), actual.GetBundleName());
+        EXPECT_EQ(expect.GetComponentType(), actual.GetComponentType());
+        EXPECT_EQ(expect.GetContent(), actual.GetContent());
+        EXPECT_EQ(expect.GetInspectorKey(), actual.GetInspectorKey());
+        EXPECT_EQ(expect.GetAccessibilityLevel(), actual.GetAccessibilityLevel());
+        EXPECT_EQ(expect.GetRectInScreen().GetLeftTopXScreenPostion(),
+            actual.GetRectInScreen().GetLeftTopXScreenPostion());
+        EXPECT_EQ(expect.GetRectInScreen().GetRightBottomYScreenPostion(),
+            actual.GetRectInScreen().GetRightBottomYScreenPostion());
+        ASSERT_EQ(expect.GetActionList().size(), actual.GetActionList().size());
+        for (size_t i = 0; i < expect.GetActionList().size(); i++) {
+            EXPECT_EQ(expect.GetActionList()[i].GetActionType(), actual.GetActionList()[i].GetActionType());
+            EXPECT_EQ(expect.GetActionList()[i].GetDescriptionInfo(), actual.GetActionList()[i].GetDescriptionInfo());
+        }
+        EXPECT_EQ(expect.GetRange().GetMax(), actual.GetRange().GetMax());
+        EXPECT_EQ(expect.GetGrid().GetColumnCount(), actual.GetGrid().GetColumnCount());
+        EXPECT_EQ(expect.GetExtraElement().GetExtraElementInfoValueStr(),
+            actual.GetExtraElement().GetExtraElementInfoValueStr());
+        EXPECT_EQ(expect.GetExtraElement().GetExtraElementInfoValueInt(),
+            actual.GetExtraElement().GetExtraElementInfoValueInt());
+        EXPECT_EQ(expect.GetSpanList().size(), actual.GetSpanList().size());
+        EXPECT_EQ(expect.IsVisible(), actual.IsVisible());
+        EXPECT_EQ(expect.IsEnabled(), actual.IsEnabled());
+        EXPECT_EQ(expect.IsClickable(), actual.IsClickable());
+        EXPECT_EQ(expect.IsCheckable(), actual.IsCheckable());
+    }
+
+    size_t EncodeSyntheticTree(const std::vector<AccessibilityElementInfo> &infos, ElementInfoEncoding encoding,
+        Parcel &parcel)
+    {
+        for (auto &info : infos) {
+            AccessibilityElementInfoParcel infoParcel(info, encoding);
+            if (!parcel.WriteParcelable(&infoParcel)) {
+                return 0;
+            }
+        }
+        return parcel.GetDataSize();
+    }
+
+    int64_t ElapsedMicroseconds(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+            .count();
+    }
+} // namespace
+
 class AccessibilityElementInfoParcelTest : public ::testing::Test {
 public:
     AccessibilityElementInfoParcelTest()
@@ -398,5 +486,133 @@ HWTEST_F(AccessibilityElementInfoParcelTest, Span_Info_Unmarshalling__001, TestS
     }
     GTEST_LOG_(INFO) << "Span_Info_Unmarshalling__001 end";
 }
+/**
+ * @tc.number: Element_Info_Compact_RoundTrip_001
+ * @tc.name: Element_Info_Compact_RoundTrip
+ * @tc.desc: Test the compact encoding keeps every populated field
+ */
+HWTEST_F(AccessibilityElementInfoParcelTest, Element_Info_Compact_RoundTrip_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Element_Info_Compact_RoundTrip_001 start";
+    AccessibilityElementInfo info = CreateSyntheticNode(1);
+    RangeInfo rangeInfo(0.5, 99.5, 10.25);
+    info.SetRange(rangeInfo);
+    info.SetGrid(GridInfo(3, 4, 1));
+    ExtraElementInfo extraElementInfo;
+    extraElementInfo.SetExtraElementInfo("CheckboxGroupSelectedStatus", "1");
+    extraElementInfo.SetExtraElementInfo("hasRegisteredHover", 1);
+    info.SetExtraElement(extraElementInfo);
+    info.AddSpan(SpanInfo(1, "span", "spanText", "spanDescription", "yes"));
+    info.SetAccessibilityLevel("no");
+
+    for (auto encoding : { ElementInfoEncoding::LEGACY, ElementInfoEncoding::COMPACT_V1 }) {
+        Parcel parcel;
+        AccessibilityElementInfoParcel infoParcel(info, encoding);
+        EXPECT_TRUE(infoParcel.Marshalling(parcel));
+        sptr<AccessibilityElementInfoParcel> result = AccessibilityElementInfoParcel::Unmarshalling(parcel);
+        ASSERT_TRUE(result != nullptr);
+        ExpectSameElementInfo(info, *result);
+    }
+
+    // an empty level must not come back as the default "auto"
+    info.SetAccessibilityLevel("");
+    Parcel parcel;
+    AccessibilityElementInfoParcel infoParcel(info, ElementInfoEncoding::COMPACT_V1);
+    EXPECT_TRUE(infoParcel.Marshalling(parcel));
+    sptr<AccessibilityElementInfoParcel> result = AccessibilityElementInfoParcel::Unmarshalling(parcel);
+    ASSERT_TRUE(result != nullptr);
+    EXPECT_EQ(result->GetAccessibilityLevel(), "");
+    GTEST_LOG_(INFO) << "Element_Info_Compact_RoundTrip_001 end";
+}
+
+/**
+ * @tc.number: Element_Info_Compact_RoundTrip_002
+ * @tc.name: Element_Info_Compact_RoundTrip
+ * @tc.desc: Test compact bodies of every length modulo the parcel word are followed by readable data
+ */
+HWTEST_F(AccessibilityElementInfoParcelTest, Element_Info_Compact_RoundTrip_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Element_Info_Compact_RoundTrip_002 start";
+    constexpr int32_t textCount = 8;
+    constexpr int32_t sentinel = 0x5A5A5A5A;
+    Parcel parcel;
+    for (int32_t i = 0; i < textCount; i++) {
+        AccessibilityElementInfo info;
+        info.SetAccessibilityId(i);
+        info.SetContent(std::string(i, 'a'));
+        AccessibilityElementInfoParcel infoParcel(info, ElementInfoEncoding::COMPACT_V1);
+        EXPECT_TRUE(parcel.WriteParcelable(&infoParcel));
+    }
+    EXPECT_TRUE(parcel.WriteInt32(sentinel));
+
+    for (int32_t i = 0; i < textCount; i++) {
+        sptr<AccessibilityElementInfoParcel> result = parcel.ReadParcelable<AccessibilityElementInfoParcel>();
+        ASSERT_TRUE(result != nullptr);
+        EXPECT_EQ(result->GetAccessibilityId(), i);
+        EXPECT_EQ(result->GetContent(), std::string(i, 'a'));
+    }
+    EXPECT_EQ(parcel.ReadInt32(), sentinel);
+    EXPECT_EQ(parcel.GetReadableBytes(), 0u);
+    GTEST_LOG_(INFO) << "Element_Info_Compact_RoundTrip_002 end";
+}
+
+/**
+ * @tc.number: Element_Info_Compact_Unmarshalling_001
+ * @tc.name: Element_Info_Compact_Unmarshalling
+ * @tc.desc: Test a truncated compact body is rejected
+ */
+HWTEST_F(AccessibilityElementInfoParcelTest, Element_Info_Compact_Unmarshalling_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Element_Info_Compact_Unmarshalling_001 start";
+    Parcel parcel;
+    parcel.WriteInt32(static_cast<int32_t>(0x80C0A701));
+    parcel.WriteUint32(1024);
+    sptr<AccessibilityElementInfoParcel> result = AccessibilityElementInfoParcel::Unmarshalling(parcel);
+    EXPECT_TRUE(result == nullptr);
+    GTEST_LOG_(INFO) << "Element_Info_Compact_Unmarshalling_001 end";
+}
+
+/**
+ * @tc.number: Element_Info_Compact_Size_001
+ * @tc.name: Element_Info_Compact_Size
+ * @tc.desc: Compare size and time of both encodings on a synthetic 5000 node tree
+ */
+HWTEST_F(AccessibilityElementInfoParcelTest, Element_Info_Compact_Size_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "Element_Info_Compact_Size_001 start";
+    std::vector<AccessibilityElementInfo> infos;
+    for (int32_t index = 0; index < SYNTHETIC_TREE_NODE_COUNT; index++) {
+        infos.push_back(CreateSyntheticNode(index));
+    }
+
+    Parcel legacyParcel;
+    auto start = std::chrono::steady_clock::now();
+    size_t legacySize = EncodeSyntheticTree(infos, ElementInfoEncoding::LEGACY, legacyParcel);
+    int64_t legacyEncodeTime = ElapsedMicroseconds(start);
+    Parcel compactParcel;
+    start = std::chrono::steady_clock::now();
+    size_t compactSize = EncodeSyntheticTree(infos, ElementInfoEncoding::COMPACT_V1, compactParcel);
+    int64_t compactEncodeTime = ElapsedMicroseconds(start);
+    ASSERT_NE(legacySize, 0);
+    ASSERT_NE(compactSize, 0);
+    EXPECT_LT(compactSize, legacySize);
+
+    std::vector<int64_t> decodeTimes;
+    for (Parcel *parcel : { &legacyParcel, &compactParcel }) {
+        start = std::chrono::steady_clock::now();
+        for (auto &info : infos) {
+            sptr<AccessibilityElementInfoParcel> result =
+                parcel->ReadStrongParcelable<AccessibilityElementInfoParcel>();
+            ASSERT_TRUE(result != nullptr);
+            ExpectSameElementInfo(info, *result);
+        }
+        decodeTimes.push_back(ElapsedMicroseconds(start));
+    }
+    GTEST_LOG_(INFO) << "legacy: " << legacySize << " bytes, encode " << legacyEncodeTime << " us, decode " <<
+        decodeTimes[0] << " us";
+    GTEST_LOG_(INFO) << "compact: " << compactSize << " bytes, encode " << compactEncodeTime << " us, decode " <<
+        decodeTimes[1] << " us";
+    GTEST_LOG_(INFO) << "Element_Info_Compact_Size_001 end";
+}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_ELEMENT_CACHE_H
+#define ACCESSIBILITY_ELEMENT_CACHE_H
+
+#include <list>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "accessibility_element_info.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * @brief Element infos prefetched from ace, kept for several windows at once.
+ *        Windows are evicted in LRU order when the window count or the byte budget is exceeded.
+ */
+class AccessibilityElementCache {
+public:
+    using ElementPtr = std::shared_ptr<const AccessibilityElementInfo>;
+
+    enum class InvalidateScope : uint8_t {
+        NODE_AND_ANCESTORS = 0,
+        SUBTREE_AND_ANCESTORS,
+    };
+
+    struct WindowStats {
+        uint64_t hitCount = 0;
+        uint64_t missCount = 0;
+        uint64_t evictCount = 0; // nodes dropped by invalidation or by a newer search result
+    };
+
+    static constexpr size_t DEFAULT_MAX_WINDOW_COUNT = 5;
+    static constexpr size_t DEFAULT_MAX_BYTE_SIZE = 4 * 1024 * 1024;
+
+    explicit AccessibilityElementCache(size_t maxWindowCount = DEFAULT_MAX_WINDOW_COUNT,
+        size_t maxByteSize = DEFAULT_MAX_BYTE_SIZE) : maxWindowCount_(maxWindowCount), maxByteSize_(maxByteSize) {}
+    ~AccessibilityElementCache() = default;
+
+    /**
+     * @brief Find a cached element and mark its window as the most recently used one.
+     * @param windowId The window id.
+     * @param elementId The element id.
+     * @return The shared node, nullptr if it is not cached.
+     */
+    ElementPtr Find(const int32_t windowId, const int64_t elementId);
+
+    /**
+     * @brief Cache the element infos of one search result, the nodes already cached for the window are replaced.
+     * @param windowId The window id.
+     * @param elementInfos The element infos.
+     */
+    void Insert(const int32_t windowId, const std::vector<AccessibilityElementInfo> &elementInfos);
+
+    /**
+     * @brief Drop a changed element together with the nodes whose cached info depends on it.
+     * @param windowId The window id.
+     * @param elementId The changed element.
+     * @param scope Whether the subtree of the element is dropped as well.
+     * @return false if the window is cached but the element is not, the caller has to drop the window.
+     */
+    bool InvalidateElement(const int32_t windowId, const int64_t elementId, const InvalidateScope scope);
+
+    void InvalidateWindow(const int32_t windowId);
+    void Clear();
+    size_t GetWindowCount();
+    size_t GetByteSize();
+    std::map<int32_t, WindowStats> GetStats();
+
+private:
+    struct WindowEntry {
+        std::unordered_map<int64_t, ElementPtr> nodes {};
+        size_t byteSize = 0;
+        std::list<int32_t>::iterator lruIter {};
+    };
+
+    static size_t EstimateByteSize(const AccessibilityElementInfo &elementInfo);
+    void EraseWindow(std::unordered_map<int32_t, WindowEntry>::iterator iter, const bool dropStats);
+    void EraseNode(WindowEntry &entry, const int64_t elementId);
+    void EvictIfNeeded(const int32_t keepWindowId);
+
+    size_t maxWindowCount_ = DEFAULT_MAX_WINDOW_COUNT;
+    size_t maxByteSize_ = DEFAULT_MAX_BYTE_SIZE;
+    size_t byteSize_ = 0;
+    std::list<int32_t> lruWindows_ {}; // the front is the most recently used window
+    std::unordered_map<int32_t, WindowEntry> windows_ {};
+    std::map<int32_t, WindowStats> stats_ {}; // of the cached windows only, dropped with the window
+    ffrt::mutex mutex_;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_ELEMENT_CACHE_H
@@ -19,6 +19,7 @@
 #include "accessibility_element_operator_callback_stub.h"
 #include "ffrt_inner.h"
 #include <atomic>
+#include <functional>
 
 namespace OHOS {
 namespace Accessibility {
@@ -130,13 +131,31 @@ public:
     virtual void SetRemoveAccessibilityVirtualNodeResult(const OperateVirtualNodeResult result,
         const int32_t requestId) override;
 
+    /**
+     * @brief Save the results of a batch search in ACE side.
+     * @param results One result per query, in the order of the queries.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     */
+    virtual void SetSearchElementInfosBatchResult(const std::vector<ElementSearchResult> &results,
+        const int32_t requestId) override;
+
+    /**
+     * @brief Save the nodes changed after a generation in ACE side.
+     * @param diff The diff computed by the element operator of the window.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     */
+    virtual void SetSearchElementTreeDiffResult(const ElementTreeDiff &diff, const int32_t requestId) override;
+
 private:
     ffrt::promise<void> promise_;
     std::atomic<bool> promiseSet_ {false};
+    std::function<void()> completedCallback_ = nullptr; // set before the request is sent
     bool executeActionResult_ = false;
     AccessibilityElementInfo accessibilityInfoResult_ = {};
     std::vector<AccessibilityElementInfo> elementInfosResult_;
     std::vector<AccessibilityElementInfo> treeInfosResult_;
+    std::vector<ElementSearchResult> batchResults_;
+    ElementTreeDiff treeDiffResult_ {};
     int32_t CursorPosition_ = 0;
 
     FocusMoveResultType focusMoveResult_ = FocusMoveResultType::NOT_SUPPORT;
@@ -17,12 +17,27 @@
 #define ACCESSIBLE_ABILITY_CHANNEL_CLIENT_H
 
 #include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <utility>
+#include "ffrt.h"
+#include "iaccessibility_element_operator.h"
 #include "iaccessible_ability_channel.h"
 
 namespace OHOS {
 namespace Accessibility {
-class AccessibleAbilityChannelClient {
+class AccessibilityElementOperatorCallbackImpl;
+
+class AccessibleAbilityChannelClient : public std::enable_shared_from_this<AccessibleAbilityChannelClient> {
 public:
+    // the results are handed over by value, a reply arriving after the timeout can not touch them any more
+    using ElementInfosCallback = std::function<void(RetError ret, std::vector<AccessibilityElementInfo> infos)>;
+    using ElementInfoCallback = std::function<void(RetError ret, AccessibilityElementInfo info)>;
+    using ExecuteActionCallback = std::function<void(RetError ret)>;
+    using CursorPositionCallback = std::function<void(RetError ret, int32_t position)>;
+    using ElementSearchResultsCallback = std::function<void(RetError ret, std::vector<ElementSearchResult> results)>;
+
     /**
      * @brief The constructor of AccessibleAbilityChannelClient.
      * @param channelId The id of channel.
@@ -272,8 +287,138 @@ public:
     RetError RemoveAccessibilityVirtualNode(const int64_t id, const int32_t windowId,
         OperateVirtualNodeResult &result);
 
+    /**
+     * @brief Run several searches in one window with a single round trip to ace.
+     * @param accessibilityWindowId The window id that the components belong to.
+     * @param treeId The tree id of the components.
+     * @param queries The searches, at most MAX_ELEMENT_SEARCH_QUERY_COUNT.
+     * @param results The results in the order of the queries.
+     * @return Return RET_OK if the batch is answered, otherwise refer to the RetError for the failure.
+     */
+    RetError SearchElementInfosBatch(int32_t accessibilityWindowId, int32_t treeId,
+        const std::vector<ElementSearchQuery> &queries, std::vector<ElementSearchResult> &results,
+        bool isFilter = false, bool systemApi = false);
+
+    /**
+     * @brief Get the nodes of a window tree changed after a generation, computed by the element operator of the
+     *        window so only the changed nodes are sent.
+     * @param accessibilityWindowId The window id that the components belong to.
+     * @param treeId The tree id of the components.
+     * @param sinceGeneration The generation the ability already has, 0 for the whole tree.
+     * @param diff The diff from the element operator.
+     * @return Return RET_OK if the diff is answered, otherwise refer to the RetError for the failure.
+     */
+    RetError SearchElementTreeDiff(int32_t accessibilityWindowId, int32_t treeId, uint64_t sinceGeneration,
+        ElementTreeDiff &diff);
+
+    /**
+     * The asynchronous variants below return as soon as the request is sent. The callback runs once on an ffrt
+     * task, with RET_ERR_TIME_OUT if ace does not answer in time, and is not called if the request can not be sent.
+     * Several requests may be in flight at the same time, the results are matched by request id.
+     */
+
+    /**
+     * @brief Find the node information by accessibility ID without blocking.
+     * @param accessibilityWindowId The window id that the component belongs to.
+     * @param elementId: The unique id of the component ID.
+     * @param mode The prefetch mode, refer to SearchElementInfosByAccessibilityId.
+     * @param treeId The tree id of the component.
+     * @param callback Receives the components information matched conditions searched.
+     * @return Return RET_OK if the request is sent, otherwise refer to the RetError for the failure.
+     */
+    RetError SearchElementInfosByAccessibilityIdAsync(int32_t accessibilityWindowId, int64_t elementId, int32_t mode,
+        int32_t treeId, const ElementInfosCallback &callback, bool isFilter = false, bool systemApi = false);
+
+    /**
+     * @brief Find the node information filtered by text without blocking.
+     * @param accessibilityWindowId The window id that the component belongs to.
+     * @param elementId: The unique id of the component ID.
+     * @param text The filter text.
+     * @param callback Receives the components information matched conditions searched.
+     * @return Return RET_OK if the request is sent, otherwise refer to the RetError for the failure.
+     */
+    RetError SearchElementInfosByTextAsync(int32_t accessibilityWindowId, int64_t elementId,
+        const std::string &text, const ElementInfosCallback &callback, bool systemApi = false);
+
+    /**
+     * @brief Run several searches in one window without blocking.
+     * @param accessibilityWindowId The window id that the components belong to.
+     * @param treeId The tree id of the components.
+     * @param queries The searches, at most MAX_ELEMENT_SEARCH_QUERY_COUNT.
+     * @param callback Receives the results in the order of the queries.
+     * @return Return RET_OK if the request is sent, otherwise refer to the RetError for the failure.
+     */
+    RetError SearchElementInfosBatchAsync(int32_t accessibilityWindowId, int32_t treeId,
+        const std::vector<ElementSearchQuery> &queries, const ElementSearchResultsCallback &callback,
+        bool isFilter = false, bool systemApi = false);
+
+    /**
+     * @brief Find the focus element information without blocking.
+     * @param accessibilityWindowId The window id that the component belongs to.
+     * @param elementId: The unique id of the component ID.
+     * @param focusType The type of focus.
+     * @param callback Receives the components information matched conditions searched.
+     * @return Return RET_OK if the request is sent, otherwise refer to the RetError for the failure.
+     */
+    RetError FindFocusedElementInfoAsync(int32_t accessibilityWindowId, int64_t elementId,
+        int32_t focusType, const ElementInfoCallback &callback, bool systemApi = false);
+
+    /**
+     * @brief Find the node information by focus move direction without blocking.
+     * @param accessibilityWindowId The window id that the component belongs to.
+     * @param elementId: The unique id of the component ID.
+     * @param direction The direction of focus move direction.
+     * @param callback Receives the components information matched conditions searched.
+     * @return Return RET_OK if the request is sent, otherwise refer to the RetError for the failure.
+     */
+    RetError FocusMoveSearchAsync(int32_t accessibilityWindowId, int64_t elementId, int32_t direction,
+        const ElementInfoCallback &callback, bool systemApi = false);
+
+    /**
+     * @brief Execute the action on the component without blocking.
+     * @param accessibilityWindowId The window id that the component belongs to.
+     * @param elementId: The unique id of the component ID.
+     * @param action The action triggered on component.
+     * @param actionArguments The parameter for action type.
+     * @param rect The bounds of the component.
+     * @param callback Receives RET_OK if the action is executed successfully.
+     * @return Return RET_OK if the request is sent, otherwise refer to the RetError for the failure.
+     */
+    RetError ExecuteActionAsync(int32_t accessibilityWindowId, int64_t elementId, int32_t action,
+        const std::map<std::string, std::string> &actionArguments, const Rect &rect,
+        const ExecuteActionCallback &callback);
+
+    /**
+     * @brief Get the cursor position without blocking.
+     * @param accessibilityWindowId The window id that the component belongs to.
+     * @param elementId: The unique id of the component ID.
+     * @param callback Receives the position of the cursor.
+     * @return Return RET_OK if the request is sent, otherwise refer to the RetError for the failure.
+     */
+    RetError GetCursorPositionAsync(int32_t accessibilityWindowId, int64_t elementId,
+        const CursorPositionCallback &callback);
+
+    /**
+     * @brief Get the count of the requests waiting for ace.
+     * @return The count of the pending requests.
+     */
+    size_t GetPendingRequestCount();
+
 private:
+    struct PendingRequestTable {
+        ffrt::mutex mutex;
+        std::map<int32_t, std::function<void(RetError)>> requests; // requestId -> completion
+    };
+
     int32_t GenerateRequestId();
+    RetError AddPendingRequest(const sptr<AccessibilityElementOperatorCallbackImpl> &elementOperator,
+        std::function<void(RetError)> onCompleted, int32_t &requestId);
+    void RemovePendingRequest(const int32_t requestId);
+    static void CompletePendingRequest(const std::shared_ptr<PendingRequestTable> &table, const int32_t requestId,
+        const RetError result);
+    sptr<IAccessibilityElementOperator> GetGrantedElementOperator(const int32_t windowId, const int32_t treeId);
+    void DropGrantedElementOperator(const int32_t windowId, const int32_t treeId,
+        const sptr<IAccessibilityElementOperator> &grantedOperator);
 
     /**
      * @brief Validate and process element infos with main window ID setting
@@ -295,6 +440,11 @@ private:
     int64_t accessibilityFocusedElementId_ = INVALID_WINDOW_ID;
     sptr<IAccessibleAbilityChannel> proxy_ = nullptr;
     std::atomic<int> requestId_ = 0;
+    // shared with the completions, a late answer or timeout must not touch a destroyed client
+    std::shared_ptr<PendingRequestTable> pendingRequests_ = std::make_shared<PendingRequestTable>();
+    ffrt::mutex grantsMutex_;
+    // (windowId, treeId) -> operator granted by AAMS, nullptr if the window is searched through AAMS
+    std::map<std::pair<int32_t, int32_t>, sptr<IAccessibilityElementOperator>> grantedOperators_;
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -19,6 +19,8 @@
 #include <atomic>
 #include <deque>
 #include <memory>
+#include <set>
+#include "accessibility_element_cache.h"
 #include "accessible_ability_channel_client.h"
 #include "accessible_ability_client.h"
 #include "accessible_ability_client_stub.h"
@@ -28,7 +30,6 @@
 #include "refbase.h"
 #include "system_ability_load_callback_stub.h"
 #include "system_ability_status_change_stub.h"
-#include "safe_map.h"
 
 namespace OHOS {
 namespace Accessibility {
@@ -429,8 +430,11 @@ public:
     bool LoadAccessibilityService();
     void LoadSystemAbilitySuccess(const sptr<IRemoteObject> &remoteObject);
     void LoadSystemAbilityFail();
-    RetError GetChildrenWork(const int32_t windowId, std::vector<int64_t> childIds,
-        std::vector<AccessibilityElementInfo> &children, bool systemApi = false);
+    RetError GetChildrenWork(const int32_t windowId, std::vector<int64_t> childIds, const int64_t crossSubtreeChildId,
+        std::vector<AccessibilityElementCache::ElementPtr> &children, bool systemApi = false);
+    RetError GetChildrenFromAce(const int32_t windowId, const std::vector<ElementSearchQuery> &queries,
+        const std::map<int32_t, std::vector<size_t>> &treeQueries, const std::vector<size_t> &querySlots,
+        std::vector<AccessibilityElementCache::ElementPtr> &children, bool systemApi);
     RetError SearchElementInfoRecursiveBySpecificProperty(const int32_t windowId, const int64_t elementId,
         std::vector<AccessibilityElementInfo> &elementInfos, int32_t treeId, uint64_t parentIndex = 0,
         const SpecificPropertyParam& param = {});
@@ -441,6 +445,37 @@ public:
     RetError RemoveAccessibilityVirtualNode(const int64_t id, const int32_t windowId,
         OperateVirtualNodeResult &result) override;
 
+    /**
+     * @brief Start diffing the tree of a window, so GetTreeDiff only returns what changed.
+     * @param windowId The target window id.
+     * @return Return RET_OK if subscribes successfully, otherwise refer to the RetError for the failure.
+     */
+    RetError SubscribeTreeDiff(const int32_t windowId) override;
+
+    /**
+     * @brief Stop diffing the tree of a window.
+     * @param windowId The target window id.
+     * @return Return RET_OK if unsubscribes successfully, otherwise refer to the RetError for the failure.
+     */
+    RetError UnsubscribeTreeDiff(const int32_t windowId) override;
+
+    /**
+     * @brief Get the nodes added, changed and removed after a generation. The element operator of the window
+     *        keeps the generations and sends only the changed nodes, a stale generation gets a full snapshot.
+     * @param windowId The target window id.
+     * @param sinceGeneration The generation of the last diff the caller applied, 0 for a full snapshot.
+     * @param diff The nodes changed and the new generation.
+     * @return Return RET_OK if gets the diff successfully, otherwise refer to the RetError for the failure.
+     */
+    RetError GetTreeDiff(const int32_t windowId, const uint64_t sinceGeneration,
+        AccessibilityTreeDiff &diff) override;
+
+    /**
+     * @brief Get the hit, miss and evict counters of the element cache for debugging.
+     * @param stats The counters of each cached window, dropped together with the window.
+     */
+    void GetElementCacheStats(std::map<int32_t, AccessibilityElementCache::WindowStats> &stats);
+
 private:
     class AccessibleAbilityDeathRecipient final : public IRemoteObject::DeathRecipient {
     public:
@@ -471,14 +506,33 @@ private:
         void OnLoadSystemAbilityFail(int32_t systemAbilityId) override;
     };
 
-    bool GetCacheElementInfo(const int32_t windowId,
-        const int64_t elementId, AccessibilityElementInfo &elementInfo);
+    AccessibilityElementCache::ElementPtr GetCacheElementInfo(const int32_t windowId, const int64_t elementId);
     void SetCacheElementInfo(const int32_t windowId,
         const std::vector<OHOS::Accessibility::AccessibilityElementInfo> &elementInfos);
+    void InvalidateCacheByEvent(const AccessibilityEventInfo &eventInfo);
     RetError SearchElementInfoByElementId(const int32_t windowId, const int64_t elementId,
         const uint32_t mode, AccessibilityElementInfo &info, int32_t treeId, bool systemApi = false);
     RetError SearchElementInfoFromAce(const int32_t windowId, const int64_t elementId,
         const uint32_t mode, AccessibilityElementInfo &info, bool systemApi = false);
+    RetError SearchElementInfosBatchFromAce(const int32_t windowId, const int32_t treeId,
+        const std::vector<ElementSearchQuery> &queries, std::vector<ElementSearchResult> &results,
+        bool isFilter = false, bool systemApi = false);
+
+    // the root search of one child window or tree, sent without waiting so that siblings are in flight together
+    struct SubtreeSearch {
+        uint64_t parentIndex = 0;
+        int32_t windowId = 0;
+        int32_t treeId = 0;
+        bool sent = false;
+        std::vector<AccessibilityElementInfo> infos {};
+        ffrt::promise<RetError> promise;
+    };
+    void AppendSubtreeElementInfos(std::vector<AccessibilityElementInfo> &vecElementInfos, uint32_t mode,
+        std::vector<AccessibilityElementInfo> &elementInfos, int32_t treeId, bool isFilter, uint64_t parentIndex,
+        bool systemApi);
+    void SendSubtreeSearch(const std::shared_ptr<SubtreeSearch> &search, uint32_t mode, bool isFilter,
+        bool systemApi);
+    RetError WaitSubtreeSearch(const std::shared_ptr<SubtreeSearch> &search);
     bool InitAccessibilityServiceProxy();
     static void OnParameterChanged(const char *key, const char *value, void *context);
     bool CheckServiceProxy(); // should be used in mutex
@@ -492,8 +546,9 @@ private:
     std::shared_ptr<AccessibleAbilityListener> listener_ = nullptr;
     std::shared_ptr<AccessibleAbilityChannelClient> channelClient_ = nullptr;
     uint32_t cacheMode_ = 0;
-    int32_t cacheWindowId_ = -1;
-    SafeMap<int64_t, AccessibilityElementInfo> cacheElementInfos_;
+    AccessibilityElementCache elementCache_;
+    ffrt::mutex treeDiffMutex_;
+    std::set<int32_t> treeDiffWindows_ {};
     std::atomic<bool> isConnected_ = false;
 
     ffrt::condition_variable proxyConVar_;
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_element_cache.h"
+
+#include <cinttypes>
+#include <deque>
+#include <set>
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+AccessibilityElementCache::ElementPtr AccessibilityElementCache::Find(const int32_t windowId,
+    const int64_t elementId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto windowIter = windows_.find(windowId);
+    if (windowIter == windows_.end()) {
+        HILOG_DEBUG("window %{public}d is not cached", windowId);
+        return nullptr;
+    }
+    WindowStats &stats = stats_[windowId];
+    auto nodeIter = windowIter->second.nodes.find(elementId);
+    if (nodeIter == windowIter->second.nodes.end()) {
+        stats.missCount++;
+        return nullptr;
+    }
+    stats.hitCount++;
+    lruWindows_.splice(lruWindows_.begin(), lruWindows_, windowIter->second.lruIter);
+    return nodeIter->second;
+}
+
+void AccessibilityElementCache::Insert(const int32_t windowId,
+    const std::vector<AccessibilityElementInfo> &elementInfos)
+{
+    HILOG_DEBUG("windowId[%{public}d], elementInfos size[%{public}zu]", windowId, elementInfos.size());
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto windowIter = windows_.find(windowId);
+    if (windowIter != windows_.end()) {
+        EraseWindow(windowIter, false);
+    }
+    lruWindows_.push_front(windowId);
+    WindowEntry &entry = windows_[windowId];
+    entry.lruIter = lruWindows_.begin();
+    for (auto &elementInfo : elementInfos) {
+        size_t byteSize = EstimateByteSize(elementInfo);
+        if (entry.byteSize + byteSize > maxByteSize_) {
+            HILOG_WARN("window %{public}d exceeds the cache budget, %{public}zu nodes cached", windowId,
+                entry.nodes.size());
+            break;
+        }
+        auto result = entry.nodes.emplace(elementInfo.GetAccessibilityId(),
+            std::make_shared<const AccessibilityElementInfo>(elementInfo));
+        if (result.second) {
+            entry.byteSize += byteSize;
+        }
+    }
+    byteSize_ += entry.byteSize;
+    EvictIfNeeded(windowId);
+}
+
+bool AccessibilityElementCache::InvalidateElement(const int32_t windowId, const int64_t elementId,
+    const InvalidateScope scope)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto windowIter = windows_.find(windowId);
+    if (windowIter == windows_.end()) {
+        return true;
+    }
+    WindowEntry &entry = windowIter->second;
+    auto nodeIter = entry.nodes.find(elementId);
+    if (nodeIter == entry.nodes.end()) {
+        return false;
+    }
+    std::set<int64_t> elementIds;
+    // an ancestor caches the child list and the bounds covering the changed node
+    ElementPtr node = nodeIter->second;
+    for (size_t depth = 0; node != nullptr && depth < entry.nodes.size(); depth++) {
+        elementIds.insert(node->GetAccessibilityId());
+        auto parentIter = entry.nodes.find(node->GetParentNodeId());
+        node = (parentIter == entry.nodes.end()) ? nullptr : parentIter->second;
+    }
+    if (scope == InvalidateScope::SUBTREE_AND_ANCESTORS) {
+        std::deque<int64_t> pending(nodeIter->second->GetChildIds().begin(), nodeIter->second->GetChildIds().end());
+        while (!pending.empty()) {
+            int64_t childId = pending.front();
+            pending.pop_front();
+            auto childIter = entry.nodes.find(childId);
+            if (childIter == entry.nodes.end() || !elementIds.insert(childId).second) {
+                continue;
+            }
+            pending.insert(pending.end(), childIter->second->GetChildIds().begin(),
+                childIter->second->GetChildIds().end());
+        }
+    }
+    for (int64_t id : elementIds) {
+        EraseNode(entry, id);
+    }
+    stats_[windowId].evictCount += elementIds.size();
+    HILOG_DEBUG("windowId[%{public}d], elementId[%{public}" PRId64 "], evicted[%{public}zu]", windowId, elementId,
+        elementIds.size());
+    return true;
+}
+
+void AccessibilityElementCache::InvalidateWindow(const int32_t windowId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto windowIter = windows_.find(windowId);
+    if (windowIter != windows_.end()) {
+        HILOG_DEBUG("windowId[%{public}d]", windowId);
+        EraseWindow(windowIter, true);
+    }
+}
+
+void AccessibilityElementCache::Clear()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    windows_.clear();
+    lruWindows_.clear();
+    stats_.clear();
+    byteSize_ = 0;
+}
+
+size_t AccessibilityElementCache::GetWindowCount()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return windows_.size();
+}
+
+size_t AccessibilityElementCache::GetByteSize()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return byteSize_;
+}
+
+std::map<int32_t, AccessibilityElementCache::WindowStats> AccessibilityElementCache::GetStats()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return stats_;
+}
+
+size_t AccessibilityElementCache::EstimateByteSize(const AccessibilityElementInfo &elementInfo)
+{
+    size_t byteSize = sizeof(AccessibilityElementInfo) + elementInfo.GetBundleName().size() +
+        elementInfo.GetComponentType().size() + elementInfo.GetContent().size() + elementInfo.GetHint().size() +
+        elementInfo.GetDescriptionInfo().size() + elementInfo.GetAccessibilityText().size() +
+        elementInfo.GetInspectorKey().size() + elementInfo.GetChildIds().size() * sizeof(int64_t);
+    for (auto &action : elementInfo.GetActionList()) {
+        byteSize += sizeof(AccessibleAction) + action.GetDescriptionInfo().size();
+    }
+    return byteSize;
+}
+
+void AccessibilityElementCache::EraseNode(WindowEntry &entry, const int64_t elementId)
+{
+    auto nodeIter = entry.nodes.find(elementId);
+    if (nodeIter == entry.nodes.end()) {
+        return;
+    }
+    size_t byteSize = EstimateByteSize(*nodeIter->second);
+    entry.byteSize -= byteSize;
+    byteSize_ -= byteSize;
+    entry.nodes.erase(nodeIter);
+}
+
+void AccessibilityElementCache::EraseWindow(std::unordered_map<int32_t, WindowEntry>::iterator iter,
+    const bool dropStats)
+{
+    if (dropStats) {
+        stats_.erase(iter->first);
+    } else {
+        stats_[iter->first].evictCount += iter->second.nodes.size();
+    }
+    byteSize_ -= iter->second.byteSize;
+    lruWindows_.erase(iter->second.lruIter);
+    windows_.erase(iter);
+}
+
+void AccessibilityElementCache::EvictIfNeeded(const int32_t keepWindowId)
+{
+    while (windows_.size() > maxWindowCount_ || byteSize_ > maxByteSize_) {
+        int32_t windowId = lruWindows_.back();
+        if (windowId == keepWindowId) {
+            break;
+        }
+        HILOG_DEBUG("evict window %{public}d", windowId);
+        EraseWindow(windows_.find(windowId), true);
+    }
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -24,6 +24,9 @@ namespace Accessibility {
     bool expected = false;
     if (promiseSet_.compare_exchange_strong(expected, true)) {
         promise_.set_value();
+        if (completedCallback_ != nullptr) {
+            completedCallback_();
+        }
     }
 }
 void AccessibilityElementOperatorCallbackImpl::SetFindFocusedElementInfoResult(const AccessibilityElementInfo &info,
@@ -129,5 +132,22 @@ void AccessibilityElementOperatorCallbackImpl::SetRemoveAccessibilityVirtualNode
     SetPromiseValue();
 }
 // LCOV_EXCL_STOP
+
+void AccessibilityElementOperatorCallbackImpl::SetSearchElementInfosBatchResult(
+    const std::vector<ElementSearchResult> &results, const int32_t requestId)
+{
+    HILOG_DEBUG("Response[resultSize:%{public}zu] [requestId:%{public}d]", results.size(), requestId);
+    batchResults_ = results;
+    SetPromiseValue();
+}
+
+void AccessibilityElementOperatorCallbackImpl::SetSearchElementTreeDiffResult(const ElementTreeDiff &diff,
+    const int32_t requestId)
+{
+    HILOG_DEBUG("Response[added:%{public}zu, changed:%{public}zu, removed:%{public}zu] [requestId:%{public}d]",
+        diff.addedNodes.size(), diff.changedNodes.size(), diff.removedNodeIds.size(), requestId);
+    treeDiffResult_ = diff;
+    SetPromiseValue();
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -26,7 +26,40 @@ namespace OHOS {
 namespace Accessibility {
 namespace {
     constexpr uint32_t TIME_OUT_OPERATOR = 5000;
+    constexpr uint64_t US_PER_MS = 1000;
     constexpr int32_t REQUEST_ID_MAX = 0x0000FFFF;
+    constexpr size_t MAX_PENDING_REQUEST_COUNT = 64;
+    constexpr uint32_t BLOCKING_WAIT_MARGIN = 1000;
+    constexpr size_t MAX_GRANTED_OPERATOR_COUNT = 32;
+
+    RetError CheckElementInfos(const std::vector<AccessibilityElementInfo> &infos)
+    {
+        for (auto &info : infos) {
+            if (info.GetAccessibilityId() == AccessibilityElementInfo::UNDEFINED_ACCESSIBILITY_ID) {
+                HILOG_ERROR("The elementInfo from ace is wrong");
+                return RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
+            }
+        }
+        return RET_OK;
+    }
+
+    RetError WaitForResult(ffrt::future<RetError> &future)
+    {
+        // the request completes itself after TIME_OUT_OPERATOR, the margin only covers a stalled task queue
+        ffrt::future_status wait = future.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR + BLOCKING_WAIT_MARGIN));
+        if (wait != ffrt::future_status::ready) {
+            HILOG_ERROR("Failed to wait the completion of the request");
+            return RET_ERR_TIME_OUT;
+        }
+        return future.get();
+    }
+
+    bool IsGrantedMode(const int32_t mode)
+    {
+        // the subtree walks and the source lookup are timed and checked by AAMS
+        return mode != PREFETCH_RECURSIVE_CHILDREN && mode != PREFETCH_RECURSIVE_CHILDREN_REDUCED &&
+            mode != GET_SOURCE_MODE;
+    }
 } // namespace
 
 int32_t AccessibleAbilityChannelClient::GenerateRequestId()
@@ -37,6 +70,100 @@ int32_t AccessibleAbilityChannelClient::GenerateRequestId()
     return requestId;
 }
 
+RetError AccessibleAbilityChannelClient::AddPendingRequest(
+    const sptr<AccessibilityElementOperatorCallbackImpl> &elementOperator, std::function<void(RetError)> onCompleted,
+    int32_t &requestId)
+{
+    std::shared_ptr<PendingRequestTable> table = pendingRequests_;
+    {
+        std::lock_guard<ffrt::mutex> lock(table->mutex);
+        if (table->requests.size() >= MAX_PENDING_REQUEST_COUNT) {
+            HILOG_ERROR("too many pending requests [channelId:%{public}d]", channelId_);
+            return RET_ERR_FAILED;
+        }
+        do {
+            requestId = GenerateRequestId();
+        } while (table->requests.count(requestId) != 0);
+        table->requests.emplace(requestId, std::move(onCompleted));
+    }
+    int32_t id = requestId;
+    elementOperator->completedCallback_ = [table, id]() { CompletePendingRequest(table, id, RET_OK); };
+    ffrt::submit([table, id]() { CompletePendingRequest(table, id, RET_ERR_TIME_OUT); }, {}, {},
+        ffrt::task_attr().delay(TIME_OUT_OPERATOR * US_PER_MS));
+    return RET_OK;
+}
+
+void AccessibleAbilityChannelClient::RemovePendingRequest(const int32_t requestId)
+{
+    std::lock_guard<ffrt::mutex> lock(pendingRequests_->mutex);
+    pendingRequests_->requests.erase(requestId);
+}
+
+void AccessibleAbilityChannelClient::CompletePendingRequest(const std::shared_ptr<PendingRequestTable> &table,
+    const int32_t requestId, const RetError result)
+{
+    std::function<void(RetError)> onCompleted = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(table->mutex);
+        auto iter = table->requests.find(requestId);
+        if (iter == table->requests.end()) {
+            return;
+        }
+        onCompleted = std::move(iter->second);
+        table->requests.erase(iter);
+    }
+    if (result == RET_ERR_TIME_OUT) {
+        HILOG_ERROR("Failed to wait result [requestId:%{public}d]", requestId);
+    }
+    ffrt::submit([onCompleted, result]() { onCompleted(result); });
+}
+
+sptr<IAccessibilityElementOperator> AccessibleAbilityChannelClient::GetGrantedElementOperator(
+    const int32_t windowId, const int32_t treeId)
+{
+    std::pair<int32_t, int32_t> key(windowId, treeId);
+    {
+        std::lock_guard<ffrt::mutex> lock(grantsMutex_);
+        auto iter = grantedOperators_.find(key);
+        if (iter != grantedOperators_.end()) {
+            return iter->second;
+        }
+    }
+    sptr<IRemoteObject> remote = nullptr;
+    RetError ret = proxy_->GrantElementOperator(windowId, treeId, remote);
+    sptr<IAccessibilityElementOperator> grantedOperator = nullptr;
+    if (ret == RET_OK && remote != nullptr) {
+        grantedOperator = iface_cast<IAccessibilityElementOperator>(remote);
+    }
+    if (grantedOperator == nullptr) {
+        // the window is searched through AAMS until the grant is dropped with the others
+        HILOG_DEBUG("windowId[%{public}d] treeId[%{public}d] is not granted: %{public}d", windowId, treeId, ret);
+    }
+    std::lock_guard<ffrt::mutex> lock(grantsMutex_);
+    if (grantedOperators_.size() >= MAX_GRANTED_OPERATOR_COUNT) {
+        grantedOperators_.clear();
+    }
+    grantedOperators_[key] = grantedOperator;
+    return grantedOperator;
+}
+
+void AccessibleAbilityChannelClient::DropGrantedElementOperator(const int32_t windowId, const int32_t treeId,
+    const sptr<IAccessibilityElementOperator> &grantedOperator)
+{
+    std::lock_guard<ffrt::mutex> lock(grantsMutex_);
+    auto iter = grantedOperators_.find(std::make_pair(windowId, treeId));
+    // a newer grant taken by another request stays
+    if (iter != grantedOperators_.end() && iter->second == grantedOperator) {
+        grantedOperators_.erase(iter);
+    }
+}
+
+size_t AccessibleAbilityChannelClient::GetPendingRequestCount()
+{
+    std::lock_guard<ffrt::mutex> lock(pendingRequests_->mutex);
+    return pendingRequests_->requests.size();
+}
+
 sptr<IRemoteObject> AccessibleAbilityChannelClient::GetRemote()
 {
     if (proxy_ == nullptr) {
@@ -63,20 +190,39 @@ RetError AccessibleAbilityChannelClient::FindFocusedElementInfo(int32_t accessib
 #ifdef OHOS_BUILD_ENABLE_HITRACE
     HITRACE_METER_NAME(HITRACE_TAG_ACCESSIBILITY_MANAGER, "FindFocusedElement");
 #endif // OHOS_BUILD_ENABLE_HITRACE
+    auto promise = std::make_shared<ffrt::promise<RetError>>();
+    ffrt::future<RetError> future = promise->get_future();
+    auto result = std::make_shared<AccessibilityElementInfo>();
+    RetError ret = FindFocusedElementInfoAsync(accessibilityWindowId, elementId, focusType,
+        [promise, result](RetError ret, AccessibilityElementInfo info) {
+            *result = std::move(info);
+            promise->set_value(ret);
+        }, systemApi);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    ret = WaitForResult(future);
+    if (ret == RET_OK) {
+        elementInfo = *result;
+    }
+    return ret;
+}
+
+RetError AccessibleAbilityChannelClient::FindFocusedElementInfoAsync(int32_t accessibilityWindowId,
+    int64_t elementId, int32_t focusType, const ElementInfoCallback &callback, bool systemApi)
+{
     if (proxy_ == nullptr) {
         HILOG_ERROR("FindFocusedElementInfo Failed to connect to aams [channelId:%{public}d]",
             channelId_);
         return RET_ERR_SAMGR;
     }
 
-    int32_t requestId = GenerateRequestId();
     sptr<AccessibilityElementOperatorCallbackImpl> elementOperator =
         new(std::nothrow) AccessibilityElementOperatorCallbackImpl();
     if (elementOperator == nullptr) {
         HILOG_ERROR("FindFocusedElementInfo Failed to create elementOperator.");
         return RET_ERR_NULLPTR;
     }
-    ffrt::future<void> promiseFuture = elementOperator->promise_.get_future();
 
     int32_t windowId = accessibilityWindowId;
     if (accessibilityWindowId == ANY_WINDOW_ID && focusType == FOCUS_TYPE_ACCESSIBILITY &&
@@ -86,30 +232,32 @@ RetError AccessibleAbilityChannelClient::FindFocusedElementInfo(int32_t accessib
         HILOG_INFO("Convert into accessibility focused window id[%{public}d]", windowId);
     }
 
-    RetError ret = proxy_->FindFocusedElementInfo(windowId,
-        elementId, focusType, requestId, elementOperator, systemApi);
+    int32_t requestId = 0;
+    RetError ret = AddPendingRequest(elementOperator, [elementOperator, windowId, callback](RetError result) {
+        if (result != RET_OK) {
+            callback(result, AccessibilityElementInfo());
+            return;
+        }
+        AccessibilityElementInfo info = std::move(elementOperator->accessibilityInfoResult_);
+        if (info.GetAccessibilityId() == AccessibilityElementInfo::UNDEFINED_ACCESSIBILITY_ID) {
+            HILOG_ERROR("FindFocusedElementInfo The elementInfo from ace is wrong");
+            result = RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
+        } else {
+            info.SetMainWindowId((windowId > 0) ? windowId : info.GetWindowId());
+        }
+        callback(result, std::move(info));
+    }, requestId);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    ret = proxy_->FindFocusedElementInfo(windowId, elementId, focusType, requestId, elementOperator, systemApi);
     if (ret != RET_OK) {
         HILOG_ERROR("FindFocusedElementInfo failed. ret[%{public}d]", ret);
+        RemovePendingRequest(requestId);
         return ret;
     }
     HILOG_DEBUG("channelId:%{public}d, windowId:%{public}d, elementId:%{public}" PRId64 ", focusType:%{public}d",
         channelId_, windowId, elementId, focusType);
-
-    ffrt::future_status wait = promiseFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("FindFocusedElementInfo Failed to wait result");
-        return RET_ERR_TIME_OUT;
-    }
-
-    if (elementOperator->accessibilityInfoResult_.GetAccessibilityId() ==
-        AccessibilityElementInfo::UNDEFINED_ACCESSIBILITY_ID) {
-        HILOG_ERROR("FindFocusedElementInfo The elementInfo from ace is wrong");
-        return RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
-    }
-    HILOG_INFO("Get result successfully from ace.");
-
-    elementInfo = elementOperator->accessibilityInfoResult_;
-    elementInfo.SetMainWindowId((windowId > 0) ? windowId : elementInfo.GetWindowId());
     return RET_OK;
 }
 
@@ -131,35 +279,54 @@ RetError AccessibleAbilityChannelClient::GetCursorPosition(
 #ifdef OHOS_BUILD_ENABLE_HITRACE
     HITRACE_METER_NAME(HITRACE_TAG_ACCESSIBILITY_MANAGER, "GetCursorPosition");
 #endif // OHOS_BUILD_ENABLE_HITRACE
+    auto promise = std::make_shared<ffrt::promise<RetError>>();
+    ffrt::future<RetError> future = promise->get_future();
+    auto result = std::make_shared<int32_t>(0);
+    RetError ret = GetCursorPositionAsync(accessibilityWindowId, elementId,
+        [promise, result](RetError ret, int32_t cursorPosition) {
+            *result = cursorPosition;
+            promise->set_value(ret);
+        });
+    if (ret != RET_OK) {
+        return ret;
+    }
+    ret = WaitForResult(future);
+    if (ret == RET_OK) {
+        position = *result;
+        HILOG_INFO("position%{public}d", position);
+    }
+    return ret;
+}
+
+RetError AccessibleAbilityChannelClient::GetCursorPositionAsync(int32_t accessibilityWindowId, int64_t elementId,
+    const CursorPositionCallback &callback)
+{
     if (proxy_ == nullptr) {
         HILOG_ERROR("GetCursorPosition Failed to connect to aams [channelId:%{public}d]",
             channelId_);
         return RET_ERR_SAMGR;
     }
 
-    int32_t requestId = GenerateRequestId();
     sptr<AccessibilityElementOperatorCallbackImpl> elementOperator =
         new(std::nothrow) AccessibilityElementOperatorCallbackImpl();
     if (elementOperator == nullptr) {
         HILOG_ERROR("GetCursorPosition Failed to create elementOperator.");
         return RET_ERR_NULLPTR;
     }
-    ffrt::future<void> promiseFuture = elementOperator->promise_.get_future();
 
-    RetError ret = proxy_->GetCursorPosition(accessibilityWindowId, elementId, requestId, elementOperator);
+    int32_t requestId = 0;
+    RetError ret = AddPendingRequest(elementOperator, [elementOperator, callback](RetError result) {
+        callback(result, (result == RET_OK) ? elementOperator->CursorPosition_ : 0);
+    }, requestId);
     if (ret != RET_OK) {
-        HILOG_ERROR("ExecuteAction failed. ret[%{public}d]", ret);
         return ret;
     }
-
-    ffrt::future_status wait = promiseFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("GetCursorPosition Failed to wait result");
-        return RET_ERR_TIME_OUT;
+    ret = proxy_->GetCursorPosition(accessibilityWindowId, elementId, requestId, elementOperator);
+    if (ret != RET_OK) {
+        HILOG_ERROR("GetCursorPosition failed. ret[%{public}d]", ret);
+        RemovePendingRequest(requestId);
+        return ret;
     }
-
-    position = elementOperator->CursorPosition_;
-    HILOG_INFO("position%{public}d", position);
     return RET_OK;
 }
 
@@ -179,45 +346,71 @@ RetError AccessibleAbilityChannelClient::ExecuteAction(int32_t accessibilityWind
             ActionType::ACCESSIBILITY_ACTION_CLEAR_ACCESSIBILITY_FOCUS, actionArguments, rect);
     }
 
-    int32_t requestId = GenerateRequestId();
+    auto promise = std::make_shared<ffrt::promise<RetError>>();
+    ffrt::future<RetError> future = promise->get_future();
+    RetError ret = ExecuteActionAsync(accessibilityWindowId, elementId, action, actionArguments, rect,
+        [promise](RetError ret) { promise->set_value(ret); });
+    if (ret != RET_OK) {
+        return ret;
+    }
+    return WaitForResult(future);
+}
+
+RetError AccessibleAbilityChannelClient::ExecuteActionAsync(int32_t accessibilityWindowId, int64_t elementId,
+    int32_t action, const std::map<std::string, std::string> &actionArguments, const Rect &rect,
+    const ExecuteActionCallback &callback)
+{
+    if (proxy_ == nullptr) {
+        HILOG_ERROR("ExecuteAction Failed to connect to aams [channelId:%{public}d]", channelId_);
+        return RET_ERR_SAMGR;
+    }
+
     sptr<AccessibilityElementOperatorCallbackImpl> elementOperator =
         new(std::nothrow) AccessibilityElementOperatorCallbackImpl();
     if (elementOperator == nullptr) {
         HILOG_ERROR("ExecuteAction Failed to create elementOperator.");
         return RET_ERR_NULLPTR;
     }
-    ffrt::future<void> promiseFuture = elementOperator->promise_.get_future();
 
-    RetError ret = proxy_->ExecuteAction(accessibilityWindowId,
+    std::weak_ptr<AccessibleAbilityChannelClient> weakClient = weak_from_this();
+    int32_t requestId = 0;
+    RetError ret = AddPendingRequest(elementOperator,
+        [elementOperator, weakClient, accessibilityWindowId, elementId, action, callback](RetError result) {
+        if (result != RET_OK) {
+            HILOG_ERROR("execute action: %{public}d failed to wait result", action);
+            callback(result);
+            return;
+        }
+        HILOG_INFO("action:[%{public}d], executeActionResult_[%{public}d], elementId:%{public}" PRId64 "",
+            action, elementOperator->executeActionResult_, elementId);
+        std::shared_ptr<AccessibleAbilityChannelClient> client = weakClient.lock();
+        if (elementOperator->executeActionResult_ && client != nullptr) {
+            switch (action) {
+                case ActionType::ACCESSIBILITY_ACTION_ACCESSIBILITY_FOCUS:
+                    client->accessibilityFocusedWindowId_ = accessibilityWindowId;
+                    client->accessibilityFocusedElementId_ = elementId;
+                    break;
+                case ActionType::ACCESSIBILITY_ACTION_CLEAR_ACCESSIBILITY_FOCUS:
+                    client->accessibilityFocusedWindowId_ = INVALID_WINDOW_ID;
+                    client->accessibilityFocusedElementId_ = INVALID_WINDOW_ID;
+                    break;
+                default:
+                    break;
+            }
+        }
+        callback(elementOperator->executeActionResult_ ? RET_OK : RET_ERR_PERFORM_ACTION_FAILED_BY_ACE);
+    }, requestId);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    ret = proxy_->ExecuteAction(accessibilityWindowId,
         elementId, action, actionArguments, requestId, elementOperator, rect);
     if (ret != RET_OK) {
         HILOG_ERROR("ExecuteAction failed. action[%{public}d], ret[%{public}d]", action, ret);
+        RemovePendingRequest(requestId);
         return ret;
     }
-
-    ffrt::future_status wait = promiseFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("execute action: %{public}d failed to wait result", action);
-        return RET_ERR_TIME_OUT;
-    }
-    HILOG_INFO("action:[%{public}d], executeActionResult_[%{public}d], elementId:%{public}" PRId64 "",
-        action, elementOperator->executeActionResult_, elementId);
-
-    if (elementOperator->executeActionResult_) {
-        switch (action) {
-            case ActionType::ACCESSIBILITY_ACTION_ACCESSIBILITY_FOCUS:
-                accessibilityFocusedWindowId_ = accessibilityWindowId;
-                accessibilityFocusedElementId_ = elementId;
-                break;
-            case ActionType::ACCESSIBILITY_ACTION_CLEAR_ACCESSIBILITY_FOCUS:
-                accessibilityFocusedWindowId_ = INVALID_WINDOW_ID;
-                accessibilityFocusedElementId_ = INVALID_WINDOW_ID;
-                break;
-            default:
-                break;
-        }
-    }
-    return elementOperator->executeActionResult_ ? RET_OK : RET_ERR_PERFORM_ACTION_FAILED_BY_ACE;
+    return RET_OK;
 }
 
 RetError AccessibleAbilityChannelClient::EnableScreenCurtain(bool isEnable)
@@ -254,12 +447,36 @@ RetError AccessibleAbilityChannelClient::SearchElementInfosByAccessibilityId(int
     int64_t elementId, int32_t mode, std::vector<AccessibilityElementInfo> &elementInfos, int32_t treeId,
     bool isFilter, bool systemApi)
 {
-    int32_t requestId = GenerateRequestId();
-    HILOG_DEBUG("channelId:%{public}d, elementId:%{public}" PRId64 ", windowId:%{public}d, requestId:%{public}d",
-        channelId_, elementId, accessibilityWindowId, requestId);
 #ifdef OHOS_BUILD_ENABLE_HITRACE
     HITRACE_METER_NAME(HITRACE_TAG_ACCESSIBILITY_MANAGER, "SearchElementById");
 #endif // OHOS_BUILD_ENABLE_HITRACE
+    auto promise = std::make_shared<ffrt::promise<RetError>>();
+    ffrt::future<RetError> future = promise->get_future();
+    auto result = std::make_shared<std::vector<AccessibilityElementInfo>>();
+    RetError ret = SearchElementInfosByAccessibilityIdAsync(accessibilityWindowId, elementId, mode, treeId,
+        [promise, result](RetError ret, std::vector<AccessibilityElementInfo> infos) {
+            *result = std::move(infos);
+            promise->set_value(ret);
+        }, isFilter, systemApi);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    ret = WaitForResult(future);
+    if (ret == RET_OK) {
+        HILOG_DEBUG("Get result successfully from ace. size[%{public}zu]", result->size());
+        elementInfos = std::move(*result);
+    }
+    return ret;
+}
+
+RetError AccessibleAbilityChannelClient::SearchElementInfosByAccessibilityIdAsync(int32_t accessibilityWindowId,
+    int64_t elementId, int32_t mode, int32_t treeId, const ElementInfosCallback &callback, bool isFilter,
+    bool systemApi)
+{
+    if (proxy_ == nullptr) {
+        HILOG_ERROR("SearchElementInfosByAccessibilityId Failed to connect to aams [channelId:%{public}d]", channelId_);
+        return RET_ERR_SAMGR;
+    }
 
     sptr<AccessibilityElementOperatorCallbackImpl> elementOperator =
         new(std::nothrow) AccessibilityElementOperatorCallbackImpl();
@@ -267,39 +484,47 @@ RetError AccessibleAbilityChannelClient::SearchElementInfosByAccessibilityId(int
         HILOG_ERROR("SearchElementInfosByAccessibilityId Failed to create elementOperator.");
         return RET_ERR_NULLPTR;
     }
-    ffrt::future<void> promiseFuture = elementOperator->promise_.get_future();
+
+    int32_t requestId = 0;
+    RetError ret = AddPendingRequest(elementOperator, [elementOperator, callback](RetError result) {
+        if (result != RET_OK) {
+            callback(result, {});
+            return;
+        }
+        std::vector<AccessibilityElementInfo> infos = std::move(elementOperator->elementInfosResult_);
+        result = CheckElementInfos(infos);
+        callback(result, std::move(infos));
+    }, requestId);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    HILOG_DEBUG("channelId:%{public}d, elementId:%{public}" PRId64 ", windowId:%{public}d, requestId:%{public}d",
+        channelId_, elementId, accessibilityWindowId, requestId);
+    if (!systemApi && IsGrantedMode(mode)) {
+        sptr<IAccessibilityElementOperator> grantedOperator = GetGrantedElementOperator(accessibilityWindowId, treeId);
+        if (grantedOperator != nullptr) {
+            ret = grantedOperator->SearchElementInfoByAccessibilityId(elementId, requestId, elementOperator, mode,
+                isFilter);
+            if (ret == RET_OK) {
+                return RET_OK;
+            }
+            // revoked or gone, the request is sent again through AAMS which knows the current window
+            HILOG_WARN("granted search failed: %{public}d, windowId[%{public}d]", ret, accessibilityWindowId);
+            DropGrantedElementOperator(accessibilityWindowId, treeId, grantedOperator);
+        }
+    }
     ElementBasicInfo elementBasicInfo {};
     elementBasicInfo.windowId = accessibilityWindowId;
     elementBasicInfo.treeId = treeId;
     elementBasicInfo.elementId = elementId;
-
-    if (proxy_ == nullptr) {
-        HILOG_ERROR("SearchElementInfosByAccessibilityId Failed to connect to aams [channelId:%{public}d]", channelId_);
-        return RET_ERR_SAMGR;
-    }
-
-    RetError ret = proxy_->SearchElementInfoByAccessibilityId(elementBasicInfo, requestId,
+    ret = proxy_->SearchElementInfoByAccessibilityId(elementBasicInfo, requestId,
         elementOperator, mode, isFilter, systemApi);
     if (ret != RET_OK) {
         HILOG_ERROR("searchElement failed. ret: %{public}d. elementId: %{public}" PRId64 ", requestId :[%{public}d]",
             ret, elementId, requestId);
+        RemovePendingRequest(requestId);
         return ret;
     }
-
-    ffrt::future_status wait = promiseFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("SearchElementInfosByAccessibilityId Failed to wait result");
-        return RET_ERR_TIME_OUT;
-    }
-
-    for (auto &info : elementOperator->elementInfosResult_) {
-        if (info.GetAccessibilityId() == AccessibilityElementInfo::UNDEFINED_ACCESSIBILITY_ID) {
-            HILOG_ERROR("SearchElementInfosByAccessibilityId The elementInfo from ace is wrong");
-            return RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
-        }
-    }
-    HILOG_DEBUG("Get result successfully from ace. size[%{public}zu]", elementOperator->elementInfosResult_.size());
-    elementInfos = elementOperator->elementInfosResult_;
     return RET_OK;
 }
 
@@ -402,84 +627,259 @@ RetError AccessibleAbilityChannelClient::SearchElementInfosByText(int32_t access
 #ifdef OHOS_BUILD_ENABLE_HITRACE
     HITRACE_METER_NAME(HITRACE_TAG_ACCESSIBILITY_MANAGER, "SearchElementByText");
 #endif // OHOS_BUILD_ENABLE_HITRACE
+    auto promise = std::make_shared<ffrt::promise<RetError>>();
+    ffrt::future<RetError> future = promise->get_future();
+    auto result = std::make_shared<std::vector<AccessibilityElementInfo>>();
+    RetError ret = SearchElementInfosByTextAsync(accessibilityWindowId, elementId, text,
+        [promise, result](RetError ret, std::vector<AccessibilityElementInfo> infos) {
+            *result = std::move(infos);
+            promise->set_value(ret);
+        }, systemApi);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    ret = WaitForResult(future);
+    if (ret == RET_OK) {
+        HILOG_INFO("Get result successfully from ace. size[%{public}zu]", result->size());
+        elementInfos = std::move(*result);
+    }
+    return ret;
+}
+
+RetError AccessibleAbilityChannelClient::SearchElementInfosByTextAsync(int32_t accessibilityWindowId,
+    int64_t elementId, const std::string &text, const ElementInfosCallback &callback, bool systemApi)
+{
     if (proxy_ == nullptr) {
         HILOG_ERROR("SearchElementInfosByText Failed to connect to aams [channelId:%{public}d]",
             channelId_);
         return RET_ERR_SAMGR;
     }
 
-    int32_t requestId = GenerateRequestId();
     sptr<AccessibilityElementOperatorCallbackImpl> elementOperator =
         new(std::nothrow) AccessibilityElementOperatorCallbackImpl();
     if (elementOperator == nullptr) {
         HILOG_ERROR("SearchElementInfosByText Failed to create elementOperator.");
         return RET_ERR_NULLPTR;
     }
-    ffrt::future<void> promiseFuture = elementOperator->promise_.get_future();
 
-    RetError ret = proxy_->SearchElementInfosByText(accessibilityWindowId,
+    int32_t requestId = 0;
+    RetError ret = AddPendingRequest(elementOperator, [elementOperator, callback](RetError result) {
+        if (result != RET_OK) {
+            callback(result, {});
+            return;
+        }
+        std::vector<AccessibilityElementInfo> infos = std::move(elementOperator->elementInfosResult_);
+        result = CheckElementInfos(infos);
+        callback(result, std::move(infos));
+    }, requestId);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    ret = proxy_->SearchElementInfosByText(accessibilityWindowId,
         elementId, text, requestId, elementOperator, systemApi);
     if (ret != RET_OK) {
         HILOG_ERROR("SearchElementInfosByText failed. ret[%{public}d]", ret);
+        RemovePendingRequest(requestId);
         return ret;
     }
+    return RET_OK;
+}
 
-    ffrt::future_status wait = promiseFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("SearchElementInfosByText Failed to wait result");
-        return RET_ERR_TIME_OUT;
+RetError AccessibleAbilityChannelClient::SearchElementInfosBatch(int32_t accessibilityWindowId, int32_t treeId,
+    const std::vector<ElementSearchQuery> &queries, std::vector<ElementSearchResult> &results, bool isFilter,
+    bool systemApi)
+{
+    HILOG_DEBUG("[channelId:%{public}d] queries size[%{public}zu]", channelId_, queries.size());
+#ifdef OHOS_BUILD_ENABLE_HITRACE
+    HITRACE_METER_NAME(HITRACE_TAG_ACCESSIBILITY_MANAGER, "SearchElementInfosBatch");
+#endif // OHOS_BUILD_ENABLE_HITRACE
+    auto promise = std::make_shared<ffrt::promise<RetError>>();
+    ffrt::future<RetError> future = promise->get_future();
+    auto result = std::make_shared<std::vector<ElementSearchResult>>();
+    RetError ret = SearchElementInfosBatchAsync(accessibilityWindowId, treeId, queries,
+        [promise, result](RetError ret, std::vector<ElementSearchResult> batchResults) {
+            *result = std::move(batchResults);
+            promise->set_value(ret);
+        }, isFilter, systemApi);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    ret = WaitForResult(future);
+    if (ret == RET_OK) {
+        HILOG_INFO("Get result successfully from ace. size[%{public}zu]", result->size());
+        results = std::move(*result);
     }
+    return ret;
+}
 
-    for (auto &info : elementOperator->elementInfosResult_) {
-        if (info.GetAccessibilityId() == AccessibilityElementInfo::UNDEFINED_ACCESSIBILITY_ID) {
-            HILOG_ERROR("SearchElementInfosByText The elementInfo from ace is wrong");
-            return RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
+RetError AccessibleAbilityChannelClient::SearchElementInfosBatchAsync(int32_t accessibilityWindowId,
+    int32_t treeId, const std::vector<ElementSearchQuery> &queries, const ElementSearchResultsCallback &callback,
+    bool isFilter, bool systemApi)
+{
+    if (proxy_ == nullptr) {
+        HILOG_ERROR("SearchElementInfosBatch Failed to connect to aams [channelId:%{public}d]", channelId_);
+        return RET_ERR_SAMGR;
+    }
+    if (queries.empty() || queries.size() > MAX_ELEMENT_SEARCH_QUERY_COUNT) {
+        HILOG_ERROR("SearchElementInfosBatch invalid queries size[%{public}zu]", queries.size());
+        return RET_ERR_INVALID_PARAM;
+    }
+
+    sptr<AccessibilityElementOperatorCallbackImpl> elementOperator =
+        new(std::nothrow) AccessibilityElementOperatorCallbackImpl();
+    if (elementOperator == nullptr) {
+        HILOG_ERROR("SearchElementInfosBatch Failed to create elementOperator.");
+        return RET_ERR_NULLPTR;
+    }
+
+    int32_t requestId = 0;
+    size_t queryCount = queries.size();
+    RetError ret = AddPendingRequest(elementOperator, [elementOperator, callback, queryCount](RetError result) {
+        if (result != RET_OK) {
+            callback(result, {});
+            return;
         }
+        std::vector<ElementSearchResult> batchResults = std::move(elementOperator->batchResults_);
+        if (batchResults.size() != queryCount) {
+            HILOG_ERROR("The batch result size[%{public}zu] from ace is wrong", batchResults.size());
+            result = RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
+        }
+        for (size_t i = 0; result == RET_OK && i < batchResults.size(); i++) {
+            if (batchResults[i].ret == RET_OK) {
+                batchResults[i].ret = CheckElementInfos(batchResults[i].infos);
+            }
+        }
+        callback(result, std::move(batchResults));
+    }, requestId);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    ret = proxy_->SearchElementInfosBatch(accessibilityWindowId, treeId, queries, requestId, elementOperator,
+        isFilter, systemApi);
+    if (ret != RET_OK) {
+        HILOG_ERROR("SearchElementInfosBatch failed. ret[%{public}d]", ret);
+        RemovePendingRequest(requestId);
+        return ret;
     }
-    HILOG_INFO("Get result successfully from ace. size[%{public}zu]", elementOperator->elementInfosResult_.size());
-    elementInfos = elementOperator->elementInfosResult_;
     return RET_OK;
 }
 
+RetError AccessibleAbilityChannelClient::SearchElementTreeDiff(int32_t accessibilityWindowId, int32_t treeId,
+    uint64_t sinceGeneration, ElementTreeDiff &diff)
+{
+    HILOG_DEBUG("[channelId:%{public}d] sinceGeneration[%{public}" PRIu64 "]", channelId_, sinceGeneration);
+#ifdef OHOS_BUILD_ENABLE_HITRACE
+    HITRACE_METER_NAME(HITRACE_TAG_ACCESSIBILITY_MANAGER, "SearchElementTreeDiff");
+#endif // OHOS_BUILD_ENABLE_HITRACE
+    if (proxy_ == nullptr) {
+        HILOG_ERROR("SearchElementTreeDiff Failed to connect to aams [channelId:%{public}d]", channelId_);
+        return RET_ERR_SAMGR;
+    }
+
+    sptr<AccessibilityElementOperatorCallbackImpl> elementOperator =
+        new(std::nothrow) AccessibilityElementOperatorCallbackImpl();
+    if (elementOperator == nullptr) {
+        HILOG_ERROR("SearchElementTreeDiff Failed to create elementOperator.");
+        return RET_ERR_NULLPTR;
+    }
+
+    auto promise = std::make_shared<ffrt::promise<RetError>>();
+    ffrt::future<RetError> future = promise->get_future();
+    auto result = std::make_shared<ElementTreeDiff>();
+    int32_t requestId = 0;
+    RetError ret = AddPendingRequest(elementOperator, [elementOperator, promise, result](RetError ret) {
+        if (ret == RET_OK) {
+            *result = std::move(elementOperator->treeDiffResult_);
+            // every tree the operator has seen has a generation, 0 means the operator could not search the tree
+            if (result->generation == 0) {
+                HILOG_ERROR("The tree diff from ace is empty");
+                ret = RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
+            }
+        }
+        if (ret == RET_OK) {
+            ret = CheckElementInfos(result->addedNodes);
+        }
+        if (ret == RET_OK) {
+            ret = CheckElementInfos(result->changedNodes);
+        }
+        promise->set_value(ret);
+    }, requestId);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    ret = proxy_->SearchElementTreeDiff(accessibilityWindowId, treeId, sinceGeneration, requestId, elementOperator);
+    if (ret != RET_OK) {
+        HILOG_ERROR("SearchElementTreeDiff failed. ret[%{public}d]", ret);
+        RemovePendingRequest(requestId);
+        return ret;
+    }
+    ret = WaitForResult(future);
+    if (ret == RET_OK) {
+        diff = std::move(*result);
+    }
+    return ret;
+}
+
 RetError AccessibleAbilityChannelClient::FocusMoveSearch(int32_t accessibilityWindowId,
     int64_t elementId, int32_t direction, AccessibilityElementInfo &elementInfo, bool systemApi)
 {
     HILOG_DEBUG("[channelId:%{public}d]", channelId_);
+    auto promise = std::make_shared<ffrt::promise<RetError>>();
+    ffrt::future<RetError> future = promise->get_future();
+    auto result = std::make_shared<AccessibilityElementInfo>();
+    RetError ret = FocusMoveSearchAsync(accessibilityWindowId, elementId, direction,
+        [promise, result](RetError ret, AccessibilityElementInfo info) {
+            *result = std::move(info);
+            promise->set_value(ret);
+        }, systemApi);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    ret = WaitForResult(future);
+    if (ret == RET_OK) {
+        HILOG_INFO("Get result successfully from ace");
+        elementInfo = *result;
+    }
+    return ret;
+}
+
+RetError AccessibleAbilityChannelClient::FocusMoveSearchAsync(int32_t accessibilityWindowId, int64_t elementId,
+    int32_t direction, const ElementInfoCallback &callback, bool systemApi)
+{
     if (proxy_ == nullptr) {
         HILOG_ERROR("FocusMoveSearch Failed to connect to aams [channelId:%{public}d]", channelId_);
         return RET_ERR_SAMGR;
     }
 
-    int32_t requestId = GenerateRequestId();
     sptr<AccessibilityElementOperatorCallbackImpl> elementOperator =
         new(std::nothrow) AccessibilityElementOperatorCallbackImpl();
     if (elementOperator == nullptr) {
         HILOG_ERROR("FocusMoveSearch Failed to create elementOperator.");
         return RET_ERR_NULLPTR;
     }
-    ffrt::future<void> promiseFuture = elementOperator->promise_.get_future();
 
-    RetError ret =
-        proxy_->FocusMoveSearch(accessibilityWindowId, elementId, direction, requestId, elementOperator, systemApi);
+    int32_t requestId = 0;
+    RetError ret = AddPendingRequest(elementOperator, [elementOperator, callback](RetError result) {
+        if (result != RET_OK) {
+            callback(result, AccessibilityElementInfo());
+            return;
+        }
+        AccessibilityElementInfo info = std::move(elementOperator->accessibilityInfoResult_);
+        if (info.GetAccessibilityId() == AccessibilityElementInfo::UNDEFINED_ACCESSIBILITY_ID) {
+            HILOG_ERROR("FocusMoveSearch The elementInfo from ace is wrong");
+            result = RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
+        }
+        callback(result, std::move(info));
+    }, requestId);
     if (ret != RET_OK) {
-        HILOG_ERROR("FocusMoveSearch failed. ret[%{public}d]", ret);
         return ret;
     }
-
-    ffrt::future_status wait = promiseFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (wait != ffrt::future_status::ready) {
-        HILOG_ERROR("FocusMoveSearch Failed to wait result");
-        return RET_ERR_TIME_OUT;
-    }
-
-    if (elementOperator->accessibilityInfoResult_.GetAccessibilityId() ==
-        AccessibilityElementInfo::UNDEFINED_ACCESSIBILITY_ID) {
-        HILOG_ERROR("FocusMoveSearch The elementInfo from ace is wrong");
-        return RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
+    ret = proxy_->FocusMoveSearch(accessibilityWindowId, elementId, direction, requestId, elementOperator, systemApi);
+    if (ret != RET_OK) {
+        HILOG_ERROR("FocusMoveSearch failed. ret[%{public}d]", ret);
+        RemovePendingRequest(requestId);
+        return ret;
     }
-
-    HILOG_INFO("Get result successfully from ace");
-    elementInfo = elementOperator->accessibilityInfoResult_;
     return RET_OK;
 }
 
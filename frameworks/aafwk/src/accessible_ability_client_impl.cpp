@@ -15,6 +15,7 @@
 
 #include "accessible_ability_client_impl.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cinttypes>
 #include <thread>
@@ -49,7 +50,7 @@ namespace {
     constexpr int32_t SCENE_BOARD_WINDOW_ID = 1; // default scene board window id 1
     constexpr int32_t INVALID_SCENE_BOARD_INNER_WINDOW_ID = -1; // invalid scene board window id -1
     constexpr int64_t INVALID_SCENE_BOARD_ELEMENT_ID = -1; // invalid scene board element id -1
-    constexpr int32_t MAX_CACHE_WINDOW_SIZE = 5;
+    constexpr int32_t SUBTREE_SEARCH_WAIT_TIME = 6000; // ms, the channel answers every request within 5s
 } // namespace
 
 sptr<AccessibleAbilityClient> AccessibleAbilityClient::GetInstance()
@@ -335,6 +336,11 @@ void AccessibleAbilityClientImpl::Disconnect(const int32_t channelId)
     std::shared_ptr<AccessibleAbilityListener> listener = nullptr;
     {
         isConnected_ = false;
+        elementCache_.Clear();
+        {
+            std::lock_guard<ffrt::mutex> lock(treeDiffMutex_);
+            treeDiffWindows_.clear();
+        }
         std::unique_lock<ffrt::shared_mutex> wLock(rwChannelLock_);
         listener = listener_;
         if (callbackList_.empty()) {
@@ -364,6 +370,7 @@ void AccessibleAbilityClientImpl::Disconnect(const int32_t channelId)
 void AccessibleAbilityClientImpl::OnAccessibilityEvent(const AccessibilityEventInfo &eventInfo)
 {
     HILOG_DEBUG();
+    InvalidateCacheByEvent(eventInfo);
     std::shared_ptr<AccessibleAbilityListener> listener = nullptr;
     {
         std::shared_lock<ffrt::shared_mutex> rLock(rwChannelLock_);
@@ -521,8 +528,10 @@ RetError AccessibleAbilityClientImpl::GetRoot(AccessibilityElementInfo &elementI
         return ret;
     }
     HILOG_DEBUG("activeWindow[%{public}d]", activeWindow);
-    if (GetCacheElementInfo(activeWindow, ROOT_NONE_ID, elementInfo)) {
+    AccessibilityElementCache::ElementPtr cachedInfo = GetCacheElementInfo(activeWindow, ROOT_NONE_ID);
+    if (cachedInfo != nullptr) {
         HILOG_DEBUG("get element info from cache");
+        elementInfo = *cachedInfo;
         elementInfo.SetMainWindowId(activeWindow);
         return RET_OK;
     }
@@ -778,8 +787,10 @@ RetError AccessibleAbilityClientImpl::GetChildElementInfo(const int32_t index, c
         HILOG_ERROR("childId[%{public}" PRId64 "] is invalid", childId);
         return RET_ERR_INVALID_PARAM;
     }
-    if (GetCacheElementInfo(windowId, childId, child)) {
+    AccessibilityElementCache::ElementPtr cachedInfo = GetCacheElementInfo(windowId, childId);
+    if (cachedInfo != nullptr) {
         HILOG_DEBUG("get element info from cache");
+        child = *cachedInfo;
         child.SetMainWindowId(parent.GetMainWindowId());
         return RET_OK;
     }
@@ -839,7 +850,13 @@ RetError AccessibleAbilityClientImpl::GetChildren(const AccessibilityElementInfo
             return ret;
         }
     }
-    ret = GetChildrenWork(windowId, childIds, children, systemApi);
+    std::vector<AccessibilityElementCache::ElementPtr> childInfos {};
+    int64_t crossSubtreeChildId = children.empty() ? -1 : children.front().GetAccessibilityId();
+    ret = GetChildrenWork(windowId, childIds, crossSubtreeChildId, childInfos, systemApi);
+    children.reserve(children.size() + childInfos.size());
+    for (auto &childInfo : childInfos) {
+        children.emplace_back(*childInfo);
+    }
     for (auto &elementInfo : children) {
         elementInfo.SetMainWindowId(parent.GetMainWindowId());
     }
@@ -847,14 +864,12 @@ RetError AccessibleAbilityClientImpl::GetChildren(const AccessibilityElementInfo
 }
 
 RetError AccessibleAbilityClientImpl::GetChildrenWork(const int32_t windowId, std::vector<int64_t> childIds,
-    std::vector<AccessibilityElementInfo> &children, bool systemApi)
+    const int64_t crossSubtreeChildId, std::vector<AccessibilityElementCache::ElementPtr> &children, bool systemApi)
 {
-    // at this moment, children has at most one child element from GetChildren Cross-subtree
-    // filter the element id already in children
-    int64_t crossSubtreeChildId = -1;
-    if (children.size() > 0) {
-        crossSubtreeChildId = children.front().GetAccessibilityId();
-    }
+    // the cross-subtree child was already found by GetChildren, the cached nodes are shared, not copied
+    std::vector<ElementSearchQuery> queries {};
+    std::vector<size_t> querySlots {};
+    std::map<int32_t, std::vector<size_t>> treeQueries {};
     for (auto &childId : childIds) {
         HILOG_DEBUG("childId[%{public}" PRId64 "]", childId);
         if (childId == -1) {
@@ -864,13 +879,68 @@ RetError AccessibleAbilityClientImpl::GetChildrenWork(const int32_t windowId, st
         if (childId == crossSubtreeChildId) {
             continue;
         }
-        AccessibilityElementInfo child;
-        if (GetCacheElementInfo(windowId, childId, child)) {
+        AccessibilityElementCache::ElementPtr cachedChild = elementCache_.Find(windowId, childId);
+        if (cachedChild != nullptr) {
             HILOG_DEBUG("get element info from cache");
-            children.emplace_back(child);
+            children.emplace_back(std::move(cachedChild));
             continue;
         }
-        RetError ret = SearchElementInfoFromAce(windowId, childId, cacheMode_, child, systemApi);
+        ElementSearchQuery query;
+        query.elementId = childId;
+        query.mode = static_cast<int32_t>(cacheMode_);
+        treeQueries[static_cast<uint64_t>(childId) >> ELEMENT_MOVE_BIT].push_back(queries.size());
+        queries.push_back(query);
+        querySlots.push_back(children.size());
+        children.emplace_back(nullptr);
+    }
+    RetError ret = GetChildrenFromAce(windowId, queries, treeQueries, querySlots, children, systemApi);
+    children.erase(std::remove(children.begin(), children.end(), nullptr), children.end());
+    return ret;
+}
+
+RetError AccessibleAbilityClientImpl::GetChildrenFromAce(const int32_t windowId,
+    const std::vector<ElementSearchQuery> &queries, const std::map<int32_t, std::vector<size_t>> &treeQueries,
+    const std::vector<size_t> &querySlots, std::vector<AccessibilityElementCache::ElementPtr> &children,
+    bool systemApi)
+{
+    // the uncached children of one tree are fetched in one round trip instead of one per child
+    std::vector<ElementSearchResult> results(queries.size());
+    for (auto &[treeId, indexes] : treeQueries) {
+        std::vector<ElementSearchQuery> treeBatch {};
+        treeBatch.reserve(indexes.size());
+        for (size_t index : indexes) {
+            treeBatch.push_back(queries[index]);
+        }
+        std::vector<ElementSearchResult> treeResults {};
+        RetError ret = SearchElementInfosBatchFromAce(windowId, treeId, treeBatch, treeResults, false, systemApi);
+        if (ret == RET_ERR_NO_PERMISSION) {
+            return ret;
+        }
+        for (size_t i = 0; i < indexes.size(); i++) {
+            results[indexes[i]] = (ret == RET_OK) ? std::move(treeResults[i]) : ElementSearchResult { ret };
+        }
+    }
+
+    std::vector<AccessibilityElementInfo> fetchedInfos {};
+    for (size_t i = 0; i < queries.size(); i++) {
+        if (results[i].ret != RET_OK || results[i].infos.empty()) {
+            continue;
+        }
+        children[querySlots[i]] = std::make_shared<const AccessibilityElementInfo>(results[i].infos.front());
+        fetchedInfos.insert(fetchedInfos.end(), std::make_move_iterator(results[i].infos.begin()),
+            std::make_move_iterator(results[i].infos.end()));
+    }
+    if (!fetchedInfos.empty()) {
+        SetCacheElementInfo(windowId, fetchedInfos);
+    }
+
+    for (size_t i = 0; i < queries.size(); i++) {
+        if (children[querySlots[i]] != nullptr) {
+            continue;
+        }
+        // a failed or empty answer takes the single search, which falls back to the whole window
+        AccessibilityElementInfo child;
+        RetError ret = SearchElementInfoFromAce(windowId, queries[i].elementId, cacheMode_, child, systemApi);
         if (ret == RET_ERR_NO_PERMISSION) {
             return ret;
         }
@@ -878,7 +948,7 @@ RetError AccessibleAbilityClientImpl::GetChildrenWork(const int32_t windowId, st
             HILOG_ERROR("Get element info from ace failed");
             continue;
         }
-        children.emplace_back(child);
+        children[querySlots[i]] = std::make_shared<const AccessibilityElementInfo>(std::move(child));
     }
     return RET_OK;
 }
@@ -944,7 +1014,6 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoRecursiveByContent(const
         return RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
     }
     std::vector<AccessibilityElementInfo> vecElementInfos = {};
-    std::vector<AccessibilityElementInfo> vecTextElementInfos = {};
     std::shared_lock<ffrt::shared_mutex> rLock(rwChannelLock_);
     if (!channelClient_) {
         HILOG_ERROR("The channel is invalid.");
@@ -961,22 +1030,41 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoRecursiveByContent(const
         return RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
     }
     HILOG_DEBUG("vecElementInfos Search ok");
-    for (auto info : vecElementInfos) {
+    // the text searches under the roots of this tree go out in one round trip
+    std::vector<ElementSearchQuery> textQueries {};
+    for (auto &info : vecElementInfos) {
+        if (info.GetParentNodeId() == ROOT_PARENT_ELEMENT_ID) {
+            ElementSearchQuery query;
+            query.type = ElementSearchType::BY_TEXT;
+            query.elementId = info.GetAccessibilityId();
+            query.text = text;
+            textQueries.push_back(query);
+        }
+    }
+    std::vector<ElementSearchResult> textResults {};
+    if (!textQueries.empty()) {
+        ret = SearchElementInfosBatchFromAce(windowId, treeId, textQueries, textResults, false, systemApi);
+        if (ret != RET_OK) {
+            HILOG_ERROR("SearchElementInfosByText WindowId %{public}d} ret:%{public}d text:%{public}s",
+                windowId, ret, text.c_str());
+            return ret;
+        }
+    }
+    size_t textIndex = 0;
+    for (auto &info : vecElementInfos) {
         HILOG_DEBUG("search element info success. windowId %{public}d}",
             info.GetChildWindowId());
         if (info.GetParentNodeId() == ROOT_PARENT_ELEMENT_ID) {
-            ret = channelClient_->SearchElementInfosByText(windowId, info.GetAccessibilityId(),
-                text, vecTextElementInfos, systemApi);
-            if (ret != RET_OK) {
+            ElementSearchResult &textResult = textResults[textIndex++];
+            if (textResult.ret != RET_OK) {
                 HILOG_ERROR("SearchElementInfosByText WindowId %{public}d} ret:%{public}d text:%{public}s",
-                    windowId, ret, text.c_str());
-                return ret;
-            }
-            if (!vecTextElementInfos.empty()) {
-                elementInfos.insert(elementInfos.end(), vecTextElementInfos.begin(), vecTextElementInfos.end());
+                    windowId, textResult.ret, text.c_str());
+                return textResult.ret;
             }
+            elementInfos.insert(elementInfos.end(), std::make_move_iterator(textResult.infos.begin()),
+                std::make_move_iterator(textResult.infos.end()));
             HILOG_DEBUG("SearchByText get result size:%{public}zu windowId %{public}d elementId %{public}" PRId64 "",
-                vecTextElementInfos.size(), windowId, info.GetAccessibilityId());
+                textResult.infos.size(), windowId, info.GetAccessibilityId());
         }
         if (info.GetChildWindowId() > 0 && info.GetChildWindowId() != info.GetWindowId()) {
             ret = SearchElementInfoRecursiveByContent(info.GetChildWindowId(),
@@ -1004,8 +1092,10 @@ RetError AccessibleAbilityClientImpl::GetSource(const AccessibilityEventInfo &ev
     int32_t windowId = eventInfo.GetWindowId();
     int64_t elementId = eventInfo.GetAccessibilityId();
     HILOG_DEBUG("windowId[%{public}d], elementId[%{public}" PRId64 "]", windowId, elementId);
-    if (GetCacheElementInfo(windowId, elementId, elementInfo)) {
+    AccessibilityElementCache::ElementPtr cachedInfo = GetCacheElementInfo(windowId, elementId);
+    if (cachedInfo != nullptr) {
         HILOG_DEBUG("get element info from cache");
+        elementInfo = *cachedInfo;
         elementInfo.SetMainWindowId(windowId);
         return RET_OK;
     }
@@ -1041,8 +1131,10 @@ RetError AccessibleAbilityClientImpl::GetParentElementInfo(const AccessibilityEl
         return RET_OK;
     }
 
-    if (GetCacheElementInfo(windowId, parentElementId, parent)) {
+    AccessibilityElementCache::ElementPtr cachedInfo = GetCacheElementInfo(windowId, parentElementId);
+    if (cachedInfo != nullptr) {
         HILOG_DEBUG("get element info from cache");
+        parent = *cachedInfo;
         parent.SetMainWindowId(child.GetMainWindowId());
         return RET_OK;
     }
@@ -1106,8 +1198,10 @@ RetError AccessibleAbilityClientImpl::GetByElementId(const int64_t elementId, co
     wid = windowId > 0 ? windowId : wid;
     HILOG_DEBUG("window:[%{public}d],treeId:%{public}d,elementId:%{public}" PRId64 "",
         wid, treeId, elementId);
-    if (GetCacheElementInfo(wid, elementId, targetElementInfo)) {
+    AccessibilityElementCache::ElementPtr cachedInfo = GetCacheElementInfo(wid, elementId);
+    if (cachedInfo != nullptr) {
         HILOG_DEBUG("get element info from cache");
+        targetElementInfo = *cachedInfo;
         targetElementInfo.SetMainWindowId(wid);
         return RET_OK;
     }
@@ -1299,13 +1393,15 @@ void AccessibleAbilityClientImpl::ResetAAClient(const wptr<IRemoteObject> &remot
     }
 
     isConnected_ = false;
+    elementCache_.Clear();
+    std::lock_guard<ffrt::mutex> lock(treeDiffMutex_);
+    treeDiffWindows_.clear();
 }
 
 RetError AccessibleAbilityClientImpl::SetCacheMode(const int32_t cacheMode)
 {
     HILOG_DEBUG("set cache mode: [%{public}d]", cacheMode);
-    cacheWindowId_ = -1;
-    cacheElementInfos_.Clear();
+    elementCache_.Clear();
     if (cacheMode < 0) {
         cacheMode_ = 0;
     } else {
@@ -1315,30 +1411,64 @@ RetError AccessibleAbilityClientImpl::SetCacheMode(const int32_t cacheMode)
     return RET_OK;
 }
 
-bool AccessibleAbilityClientImpl::GetCacheElementInfo(const int32_t windowId,
-    const int64_t elementId, AccessibilityElementInfo &elementInfo)
+AccessibilityElementCache::ElementPtr AccessibleAbilityClientImpl::GetCacheElementInfo(const int32_t windowId,
+    const int64_t elementId)
 {
     HILOG_DEBUG();
-    if (cacheWindowId_ == -1 || cacheWindowId_ != windowId) {
-        HILOG_DEBUG("cacheWindowId[%{public}d], windowId[%{public}d]", cacheWindowId_, windowId);
-        return false;
-    }
-
-    bool ret = cacheElementInfos_.Find(elementId, elementInfo);
-    return ret;
+    return elementCache_.Find(windowId, elementId);
 }
 
 void AccessibleAbilityClientImpl::SetCacheElementInfo(const int32_t windowId,
     const std::vector<OHOS::Accessibility::AccessibilityElementInfo> &elementInfos)
 {
-    HILOG_DEBUG("windowId[%{public}d], elementInfos size[%{public}zu]", windowId, elementInfos.size());
-    cacheElementInfos_.Clear();
-    cacheWindowId_ = windowId;
-    for (auto &elementInfo : elementInfos) {
-        cacheElementInfos_.EnsureInsert(elementInfo.GetAccessibilityId(), elementInfo);
+    elementCache_.Insert(windowId, elementInfos);
+}
+
+void AccessibleAbilityClientImpl::InvalidateCacheByEvent(const AccessibilityEventInfo &eventInfo)
+{
+    int32_t windowId = eventInfo.GetWindowId();
+    int64_t elementId = eventInfo.GetAccessibilityId();
+    AccessibilityElementCache::InvalidateScope scope = AccessibilityElementCache::InvalidateScope::NODE_AND_ANCESTORS;
+    switch (eventInfo.GetEventType()) {
+        case TYPE_WINDOW_UPDATE:
+            if (eventInfo.GetWindowChangeTypes() & (WINDOW_UPDATE_ADDED | WINDOW_UPDATE_REMOVED)) {
+                elementCache_.InvalidateWindow(windowId);
+            }
+            return;
+        case TYPE_PAGE_STATE_UPDATE:
+        case TYPE_PAGE_OPEN:
+        case TYPE_PAGE_CLOSE:
+            elementCache_.InvalidateWindow(windowId);
+            return;
+        case TYPE_VIEW_TEXT_UPDATE_EVENT:
+            break;
+        case TYPE_VIEW_SCROLLED_EVENT:
+            // the bounds of every node below the scrolled one moved
+            scope = AccessibilityElementCache::InvalidateScope::SUBTREE_AND_ANCESTORS;
+            break;
+        case TYPE_PAGE_CONTENT_UPDATE:
+        case TYPE_ELEMENT_INFO_CHANGE: {
+            uint32_t changeTypes = static_cast<uint32_t>(eventInfo.GetWindowContentChangeTypes());
+            if (changeTypes == CONTENT_CHANGE_TYPE_INVALID || (changeTypes & CONTENT_CHANGE_TYPE_SUBTREE)) {
+                scope = AccessibilityElementCache::InvalidateScope::SUBTREE_AND_ANCESTORS;
+            }
+            break;
+        }
+        default:
+            return;
+    }
+    if (elementId == ROOT_NONE_ID || !elementCache_.InvalidateElement(windowId, elementId, scope)) {
+        // the source is unknown, nothing tells which cached nodes are still valid
+        elementCache_.InvalidateWindow(windowId);
     }
 }
 
+void AccessibleAbilityClientImpl::GetElementCacheStats(
+    std::map<int32_t, AccessibilityElementCache::WindowStats> &stats)
+{
+    stats = elementCache_.GetStats();
+}
+
 RetError AccessibleAbilityClientImpl::SearchElementInfoByElementId(const int32_t windowId, const int64_t elementId,
     const uint32_t mode, AccessibilityElementInfo &info, int32_t treeId, bool systemApi)
 {
@@ -1349,13 +1479,19 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoByElementId(const int32_t
     }
 
     HILOG_INFO("windowId %{public}d}, elementId %{public}" PRId64 "", windowId, elementId);
-    std::vector<AccessibilityElementInfo> elementInfos {};
-    RetError ret = channelClient->SearchElementInfosByAccessibilityId(
-        windowId, elementId, static_cast<int32_t>(mode), elementInfos, treeId, false, systemApi);
+    ElementSearchQuery query;
+    query.elementId = elementId;
+    query.mode = static_cast<int32_t>(mode);
+    std::vector<ElementSearchResult> results {};
+    RetError ret = SearchElementInfosBatchFromAce(windowId, treeId, { query }, results, false, systemApi);
+    if (ret == RET_OK) {
+        ret = results.front().ret;
+    }
     if (ret != RET_OK) {
         HILOG_ERROR("SearchElementInfosByAccessibilityId failed. windowId[%{public}d] ", windowId);
         return ret;
     }
+    std::vector<AccessibilityElementInfo> &elementInfos = results.front().infos;
     if (elementInfos.empty()) {
         HILOG_ERROR("elementInfos from ace is empty");
         return RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
@@ -1407,14 +1543,44 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoFromAce(const int32_t win
     HILOG_DEBUG("SetCacheElementInfo windowId:%{public}d, element [elementSize:%{public}zu]", windowId,
         elementInfos.size());
     SetCacheElementInfo(windowId, elementInfos);
-    if (!GetCacheElementInfo(windowId, elementId, info)) {
+    AccessibilityElementCache::ElementPtr cachedInfo = GetCacheElementInfo(windowId, elementId);
+    if (cachedInfo == nullptr) {
         return RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
     }
+    info = *cachedInfo;
     HILOG_DEBUG("elementId:%{public}" PRId64 ", windowId:%{public}d, treeId:%{public}d",
         info.GetAccessibilityId(), info.GetWindowId(), info.GetBelongTreeId());
     return RET_OK;
 }
 
+RetError AccessibleAbilityClientImpl::SearchElementInfosBatchFromAce(const int32_t windowId, const int32_t treeId,
+    const std::vector<ElementSearchQuery> &queries, std::vector<ElementSearchResult> &results, bool isFilter,
+    bool systemApi)
+{
+    std::shared_ptr<AccessibleAbilityChannelClient> channelClient = channelClient_;
+    if (channelClient == nullptr) {
+        HILOG_ERROR("The channel is invalid.");
+        return RET_ERR_NO_CONNECTION;
+    }
+    results.clear();
+    results.reserve(queries.size());
+    for (size_t begin = 0; begin < queries.size(); begin += MAX_ELEMENT_SEARCH_QUERY_COUNT) {
+        size_t end = std::min(queries.size(), begin + MAX_ELEMENT_SEARCH_QUERY_COUNT);
+        std::vector<ElementSearchQuery> batch(queries.begin() + begin, queries.begin() + end);
+        std::vector<ElementSearchResult> batchResults {};
+        RetError ret = channelClient->SearchElementInfosBatch(windowId, treeId, batch, batchResults, isFilter,
+            systemApi);
+        if (ret != RET_OK || batchResults.size() != batch.size()) {
+            HILOG_ERROR("search batch failed. windowId[%{public}d] treeId[%{public}d] ret[%{public}d]",
+                windowId, treeId, ret);
+            return ret != RET_OK ? ret : RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
+        }
+        results.insert(results.end(), std::make_move_iterator(batchResults.begin()),
+            std::make_move_iterator(batchResults.end()));
+    }
+    return RET_OK;
+}
+
 RetError AccessibleAbilityClientImpl::SearchElementInfoByInspectorKey(const std::string &inspectorKey,
     AccessibilityElementInfo &elementInfo)
 {
@@ -1571,6 +1737,14 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoRecursiveByWinid(const in
         return RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
     }
     HILOG_DEBUG("SearchElementInfoRecursiveByWinid : vecElementInfos Search ok");
+    AppendSubtreeElementInfos(vecElementInfos, mode, elementInfos, treeId, isFilter, parentIndex, systemApi);
+    return RET_OK;
+}
+
+void AccessibleAbilityClientImpl::AppendSubtreeElementInfos(std::vector<AccessibilityElementInfo> &vecElementInfos,
+    uint32_t mode, std::vector<AccessibilityElementInfo> &elementInfos, int32_t treeId, bool isFilter,
+    uint64_t parentIndex, bool systemApi)
+{
     SortElementInfosIfNecessary(vecElementInfos);
     uint64_t elementInfosCountAdded = 0;
     uint64_t elementInfosCount = elementInfos.size();
@@ -1584,23 +1758,76 @@ RetError AccessibleAbilityClientImpl::SearchElementInfoRecursiveByWinid(const in
         elementInfos.push_back(info);
         elementInfosCountAdded++;
     }
+
+    // each child window or tree is its own target, which one batch can not span, so their roots are requested
+    // together and then appended in order
+    std::vector<std::shared_ptr<SubtreeSearch>> searches {};
     for (uint64_t i = elementInfosCount; i < elementInfosCount + elementInfosCountAdded; i++) {
         HILOG_DEBUG("SearchElementInfoRecursiveByWinid :search element info success. windowId %{public}d}",
             elementInfos[i].GetChildWindowId());
+        auto search = std::make_shared<SubtreeSearch>();
+        search->parentIndex = i;
         if ((elementInfos[i].GetChildWindowId() > 0) &&
             (elementInfos[i].GetChildWindowId() != elementInfos[i].GetWindowId())) {
-            ret = SearchElementInfoRecursiveByWinid(elementInfos[i].GetChildWindowId(),
-                ROOT_NONE_ID, mode, elementInfos, elementInfos[i].GetChildTreeId(), isFilter, i, systemApi);
-            HILOG_INFO("ChildWindowId %{public}d}. ret:%{public}d, GetChildTreeId %{public}d",
-                elementInfos[i].GetChildWindowId(), ret, elementInfos[i].GetChildTreeId());
+            search->windowId = elementInfos[i].GetChildWindowId();
         } else if (elementInfos[i].GetChildTreeId() > 0 && elementInfos[i].GetChildTreeId() != treeId) {
-            ret = SearchElementInfoRecursiveByWinid(elementInfos[i].GetWindowId(),
-                ROOT_NONE_ID, mode, elementInfos, elementInfos[i].GetChildTreeId(), isFilter, i, systemApi);
-            HILOG_INFO("windowId %{public}d}.treeId:%{public}d. ret:%{public}d",
-                elementInfos[i].GetWindowId(), elementInfos[i].GetChildTreeId(), ret);
+            search->windowId = elementInfos[i].GetWindowId();
+        } else {
+            continue;
         }
+        search->treeId = elementInfos[i].GetChildTreeId();
+        searches.push_back(search);
+    }
+    for (auto &search : searches) {
+        SendSubtreeSearch(search, mode, isFilter, systemApi);
+    }
+    for (auto &search : searches) {
+        RetError ret = WaitSubtreeSearch(search);
+        if (ret == RET_OK) {
+            AppendSubtreeElementInfos(search->infos, mode, elementInfos, search->treeId, isFilter,
+                search->parentIndex, systemApi);
+        } else if (!search->sent) {
+            ret = SearchElementInfoRecursiveByWinid(search->windowId, ROOT_NONE_ID, mode, elementInfos,
+                search->treeId, isFilter, search->parentIndex, systemApi);
+        }
+        HILOG_INFO("windowId %{public}d}.treeId:%{public}d. ret:%{public}d", search->windowId, search->treeId, ret);
     }
-    return RET_OK;
+}
+
+void AccessibleAbilityClientImpl::SendSubtreeSearch(const std::shared_ptr<SubtreeSearch> &search, uint32_t mode,
+    bool isFilter, bool systemApi)
+{
+    std::shared_ptr<AccessibleAbilityChannelClient> channelClient = channelClient_;
+    if (channelClient == nullptr) {
+        HILOG_ERROR("The channel is invalid.");
+        return;
+    }
+    RetError ret = channelClient->SearchElementInfosByAccessibilityIdAsync(search->windowId, ROOT_NONE_ID,
+        static_cast<int32_t>(mode), search->treeId,
+        [search](RetError ret, std::vector<AccessibilityElementInfo> infos) {
+            search->infos = std::move(infos);
+            search->promise.set_value(ret);
+        }, isFilter, systemApi);
+    // a request that can not be sent, for example while too many are pending, is searched on its own later
+    search->sent = (ret == RET_OK);
+}
+
+RetError AccessibleAbilityClientImpl::WaitSubtreeSearch(const std::shared_ptr<SubtreeSearch> &search)
+{
+    if (!search->sent) {
+        return RET_ERR_FAILED;
+    }
+    ffrt::future<RetError> future = search->promise.get_future();
+    if (future.wait_for(std::chrono::milliseconds(SUBTREE_SEARCH_WAIT_TIME)) != ffrt::future_status::ready) {
+        HILOG_ERROR("Failed to wait the subtree of window %{public}d", search->windowId);
+        return RET_ERR_TIME_OUT;
+    }
+    RetError ret = future.get();
+    if (ret == RET_OK && search->infos.empty()) {
+        HILOG_ERROR("elementInfos from ace is empty");
+        return RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE;
+    }
+    return ret;
 }
 
 RetError AccessibleAbilityClientImpl::SearchElementInfoByAccessibilityId(const int32_t windowId,
@@ -2023,5 +2250,73 @@ RetError AccessibleAbilityClientImpl::RemoveAccessibilityVirtualNode(const int64
     return channelClient_->RemoveAccessibilityVirtualNode(id, windowId, result);
 }
 // LCOV_EXCL_STOP
+
+RetError AccessibleAbilityClientImpl::SubscribeTreeDiff(const int32_t windowId)
+{
+    HILOG_INFO("windowId[%{public}d]", windowId);
+    if (windowId <= 0) {
+        HILOG_ERROR("invalid param.");
+        return RET_ERR_INVALID_PARAM;
+    }
+    if (!isConnected_) {
+        HILOG_ERROR("connection is broken");
+        return RET_ERR_NO_CONNECTION;
+    }
+    std::lock_guard<ffrt::mutex> lock(treeDiffMutex_);
+    treeDiffWindows_.insert(windowId);
+    return RET_OK;
+}
+
+RetError AccessibleAbilityClientImpl::UnsubscribeTreeDiff(const int32_t windowId)
+{
+    HILOG_INFO("windowId[%{public}d]", windowId);
+    std::lock_guard<ffrt::mutex> lock(treeDiffMutex_);
+    if (treeDiffWindows_.erase(windowId) == 0) {
+        HILOG_ERROR("window %{public}d is not subscribed", windowId);
+        return RET_ERR_INVALID_PARAM;
+    }
+    return RET_OK;
+}
+
+RetError AccessibleAbilityClientImpl::GetTreeDiff(const int32_t windowId, const uint64_t sinceGeneration,
+    AccessibilityTreeDiff &diff)
+{
+#ifdef OHOS_BUILD_ENABLE_HITRACE
+    HITRACE_METER_NAME(HITRACE_TAG_ACCESSIBILITY_MANAGER, "GetTreeDiff");
+#endif // OHOS_BUILD_ENABLE_HITRACE
+    if (windowId <= 0) {
+        HILOG_ERROR("invalid param.");
+        return RET_ERR_INVALID_PARAM;
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(treeDiffMutex_);
+        if (treeDiffWindows_.find(windowId) == treeDiffWindows_.end()) {
+            HILOG_ERROR("window %{public}d is not subscribed", windowId);
+            return RET_ERR_INVALID_PARAM;
+        }
+    }
+    std::shared_lock<ffrt::shared_mutex> rLock(rwChannelLock_);
+    if (!isConnected_ || !channelClient_) {
+        HILOG_ERROR("connection is broken");
+        return RET_ERR_NO_CONNECTION;
+    }
+    // the element operator of the window keeps the last tree and its generations, only the delta is sent here
+    ElementTreeDiff treeDiff;
+    RetError ret = channelClient_->SearchElementTreeDiff(windowId, ROOT_TREE_ID, sinceGeneration, treeDiff);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    diff = AccessibilityTreeDiff();
+    diff.windowId = windowId;
+    diff.generation = treeDiff.generation;
+    diff.isFullSnapshot = treeDiff.isFullSnapshot;
+    diff.addedNodes = std::move(treeDiff.addedNodes);
+    diff.changedNodes = std::move(treeDiff.changedNodes);
+    diff.removedNodeIds = std::move(treeDiff.removedNodeIds);
+    HILOG_DEBUG("windowId: %{public}d, generation: %{public}" PRIu64 ", full: %{public}d, added: %{public}zu, "
+        "changed: %{public}zu, removed: %{public}zu", windowId, diff.generation, diff.isFullSnapshot,
+        diff.addedNodes.size(), diff.changedNodes.size(), diff.removedNodeIds.size());
+    return RET_OK;
+}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
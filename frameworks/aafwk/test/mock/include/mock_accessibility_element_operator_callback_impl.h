@@ -43,6 +43,9 @@ public:
         const int32_t requestId));
     MOCK_METHOD2(SetRemoveAccessibilityVirtualNodeResult, void(const OperateVirtualNodeResult result,
         const int32_t requestId));
+    MOCK_METHOD2(SetSearchElementInfosBatchResult, void(const std::vector<ElementSearchResult> &results,
+        const int32_t requestId));
+    MOCK_METHOD2(SetSearchElementTreeDiffResult, void(const ElementTreeDiff &diff, const int32_t requestId));
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -76,6 +76,14 @@ public:
         const sptr<IAccessibilityElementOperatorCallback> &callback));
     MOCK_METHOD4(RemoveAccessibilityVirtualNode, RetError(const int64_t id, const int32_t windowId,
         const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback));
+    MOCK_METHOD7(SearchElementInfosBatch, RetError(const int32_t windowId, const int32_t treeId,
+        const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter, bool systemApi));
+    MOCK_METHOD3(GrantElementOperator, RetError(const int32_t windowId, const int32_t treeId,
+        sptr<IRemoteObject> &grantedOperator));
+    MOCK_METHOD5(SearchElementTreeDiff, RetError(const int32_t windowId, const int32_t treeId,
+        const uint64_t sinceGeneration, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback));
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -409,5 +409,30 @@ RetError AccessibleAbilityClientImpl::RemoveAccessibilityVirtualNode(const int64
     HILOG_DEBUG();
     return RET_OK;
 }
+
+RetError AccessibleAbilityClientImpl::SubscribeTreeDiff(const int32_t windowId)
+{
+    HILOG_DEBUG();
+    return RET_OK;
+}
+
+RetError AccessibleAbilityClientImpl::UnsubscribeTreeDiff(const int32_t windowId)
+{
+    HILOG_DEBUG();
+    return RET_OK;
+}
+
+RetError AccessibleAbilityClientImpl::GetTreeDiff(const int32_t windowId, const uint64_t sinceGeneration,
+    AccessibilityTreeDiff &diff)
+{
+    HILOG_DEBUG();
+    return RET_OK;
+}
+
+void AccessibleAbilityClientImpl::GetElementCacheStats(
+    std::map<int32_t, AccessibilityElementCache::WindowStats> &stats)
+{
+    HILOG_DEBUG();
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
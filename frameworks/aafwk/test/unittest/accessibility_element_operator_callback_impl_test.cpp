@@ -13,9 +13,13 @@
  * limitations under the License.
  */
 
+#include <list>
 #include <memory>
 #include <gtest/gtest.h>
+#include "accessibility_element_operator_callback_proxy.h"
+#define private public
 #include "accessibility_element_operator_callback_impl.h"
+#undef private
 
 using namespace testing;
 using namespace testing::ext;
@@ -24,6 +28,33 @@ namespace OHOS {
 namespace Accessibility {
 namespace {
     constexpr int32_t SEQUENCE_NUM = 1;
+    constexpr size_t ASHMEM_TRANSPORT_THRESHOLD = 256 * 1024;
+    constexpr size_t SMALL_CONTENT_SIZE = 16;
+    constexpr size_t LARGE_CONTENT_SIZE = 1024;
+    constexpr size_t SMALL_INFO_COUNT = 3;
+    constexpr size_t LARGE_INFO_COUNT = 512;
+
+    std::vector<AccessibilityElementInfo> CreateElementInfos(size_t count, size_t contentSize)
+    {
+        std::vector<AccessibilityElementInfo> infos;
+        for (size_t index = 0; index < count; index++) {
+            AccessibilityElementInfo info;
+            info.SetAccessibilityId(static_cast<int64_t>(index));
+            info.SetContent(std::string(contentSize, static_cast<char>('a' + index % 26)));
+            infos.push_back(info);
+        }
+        return infos;
+    }
+
+    void ExpectSameElementInfos(const std::vector<AccessibilityElementInfo> &expected,
+        const std::vector<AccessibilityElementInfo> &actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t index = 0; index < expected.size(); index++) {
+            EXPECT_EQ(expected[index].GetAccessibilityId(), actual[index].GetAccessibilityId());
+            EXPECT_EQ(expected[index].GetContent(), actual[index].GetContent());
+        }
+    }
 } // namespace
 
 class AccessibilityElementOperatorCallbackImplTest : public ::testing::Test {
@@ -178,5 +209,70 @@ HWTEST_F(AccessibilityElementOperatorCallbackImplTest, SetExecuteActionResult_00
     }
     GTEST_LOG_(INFO) << "SetExecuteActionResult_001 end";
 }
+
+/**
+ * @tc.number: ElementInfoParcelData_001
+ * @tc.name: SetSearchElementInfoByAccessibilityIdResult
+ * @tc.desc: Test element infos below the shared memory threshold are passed as raw data through the proxy.
+ */
+HWTEST_F(AccessibilityElementOperatorCallbackImplTest, ElementInfoParcelData_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ElementInfoParcelData_001 start";
+    sptr<AccessibilityElementOperatorCallbackImpl> stub = new AccessibilityElementOperatorCallbackImpl();
+    sptr<AccessibilityElementOperatorCallbackProxy> proxy = new AccessibilityElementOperatorCallbackProxy(stub);
+    std::vector<AccessibilityElementInfo> infos = CreateElementInfos(SMALL_INFO_COUNT, SMALL_CONTENT_SIZE);
+    EXPECT_LT(SMALL_INFO_COUNT * SMALL_CONTENT_SIZE, ASHMEM_TRANSPORT_THRESHOLD);
+    proxy->SetSearchElementInfoByAccessibilityIdResult(infos, SEQUENCE_NUM);
+    ExpectSameElementInfos(infos, stub->elementInfosResult_);
+    GTEST_LOG_(INFO) << "ElementInfoParcelData_001 end";
+}
+
+/**
+ * @tc.number: ElementInfoParcelData_002
+ * @tc.name: SetSearchElementInfoByAccessibilityIdResult
+ * @tc.desc: Test element infos above the shared memory threshold are passed through ashmem by the proxy.
+ */
+HWTEST_F(AccessibilityElementOperatorCallbackImplTest, ElementInfoParcelData_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ElementInfoParcelData_002 start";
+    sptr<AccessibilityElementOperatorCallbackImpl> stub = new AccessibilityElementOperatorCallbackImpl();
+    sptr<AccessibilityElementOperatorCallbackProxy> proxy = new AccessibilityElementOperatorCallbackProxy(stub);
+    std::vector<AccessibilityElementInfo> infos = CreateElementInfos(LARGE_INFO_COUNT, LARGE_CONTENT_SIZE);
+    EXPECT_GT(LARGE_INFO_COUNT * LARGE_CONTENT_SIZE, ASHMEM_TRANSPORT_THRESHOLD);
+    proxy->SetSearchElementInfoByAccessibilityIdResult(infos, SEQUENCE_NUM);
+    ExpectSameElementInfos(infos, stub->elementInfosResult_);
+
+    std::vector<AccessibilityElementInfo> defaultFocusInfos =
+        CreateElementInfos(LARGE_INFO_COUNT / 2, LARGE_CONTENT_SIZE * 2);
+    proxy->SetSearchDefaultFocusByWindowIdResult(defaultFocusInfos, SEQUENCE_NUM);
+    ExpectSameElementInfos(defaultFocusInfos, stub->elementInfosResult_);
+    GTEST_LOG_(INFO) << "ElementInfoParcelData_002 end";
+}
+
+/**
+ * @tc.number: ElementInfoParcelData_003
+ * @tc.name: SetSearchElementInfoBySpecificPropertyResult
+ * @tc.desc: Test one parcel carrying an ashmem payload and a raw data payload in both orders.
+ */
+HWTEST_F(AccessibilityElementOperatorCallbackImplTest, ElementInfoParcelData_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ElementInfoParcelData_003 start";
+    sptr<AccessibilityElementOperatorCallbackImpl> stub = new AccessibilityElementOperatorCallbackImpl();
+    sptr<AccessibilityElementOperatorCallbackProxy> proxy = new AccessibilityElementOperatorCallbackProxy(stub);
+    std::vector<AccessibilityElementInfo> infos = CreateElementInfos(LARGE_INFO_COUNT, LARGE_CONTENT_SIZE);
+    std::vector<AccessibilityElementInfo> treeInfos = CreateElementInfos(SMALL_INFO_COUNT, SMALL_CONTENT_SIZE);
+    proxy->SetSearchElementInfoBySpecificPropertyResult(
+        std::list<AccessibilityElementInfo>(infos.begin(), infos.end()),
+        std::list<AccessibilityElementInfo>(treeInfos.begin(), treeInfos.end()), SEQUENCE_NUM);
+    ExpectSameElementInfos(infos, stub->elementInfosResult_);
+    ExpectSameElementInfos(treeInfos, stub->treeInfosResult_);
+
+    proxy->SetSearchElementInfoBySpecificPropertyResult(
+        std::list<AccessibilityElementInfo>(treeInfos.begin(), treeInfos.end()),
+        std::list<AccessibilityElementInfo>(infos.begin(), infos.end()), SEQUENCE_NUM);
+    ExpectSameElementInfos(treeInfos, stub->elementInfosResult_);
+    ExpectSameElementInfos(infos, stub->treeInfosResult_);
+    GTEST_LOG_(INFO) << "ElementInfoParcelData_003 end";
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -14,7 +14,12 @@
  */
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
 #include "accessible_ability_channel_client.h"
+#include "mock_accessibility_element_operator_stub.h"
 #include "mock_accessible_ability_channel_proxy.h"
 #include "mock_accessible_ability_channel_stub.h"
 
@@ -483,5 +488,307 @@ HWTEST_F(AccessibleAbilityChannelClientTest, SearchElementInfosByAccessibilityId
         ELEMENT_ID, MODE, infos, TREE_ID), RET_ERR_TIME_OUT);
     GTEST_LOG_(INFO) << "SearchElementInfosByAccessibilityId_003 end";
 }
+
+/**
+ * @tc.number: SearchElementInfosByAccessibilityIdAsync_001
+ * @tc.name: SearchElementInfosByAccessibilityIdAsync
+ * @tc.desc: Test several requests are in flight at once and each result reaches its own request
+ */
+HWTEST_F(AccessibleAbilityChannelClientTest, SearchElementInfosByAccessibilityIdAsync_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SearchElementInfosByAccessibilityIdAsync_001 start";
+    constexpr int64_t requestCount = 3;
+    constexpr int64_t waitTime = 1; // s
+    struct SentRequest {
+        int64_t elementId = 0;
+        int32_t requestId = 0;
+        sptr<IAccessibilityElementOperatorCallback> callback = nullptr;
+    };
+    std::vector<SentRequest> sentRequests;
+    EXPECT_CALL(*stub_, SearchElementInfoByAccessibilityId(_, _, _, _, _, _)).Times(requestCount)
+        .WillRepeatedly(Invoke([&sentRequests](const ElementBasicInfo elementBasicInfo, const int32_t requestId,
+            const sptr<IAccessibilityElementOperatorCallback> &callback, const int32_t mode, bool isFilter,
+            bool systemApi) {
+            sentRequests.push_back({ elementBasicInfo.elementId, requestId, callback });
+            return RET_OK;
+        }));
+    struct Results {
+        std::mutex mutex;
+        std::map<int64_t, int64_t> elementIds; // requested -> received
+        std::promise<void> done;
+    };
+    auto results = std::make_shared<Results>();
+    for (int64_t elementId = 1; elementId <= requestCount; elementId++) {
+        EXPECT_EQ(instance_->SearchElementInfosByAccessibilityIdAsync(ACCESSIBILITY_WINDOW_ID, elementId, MODE,
+            TREE_ID, [results, elementId](RetError ret, const std::vector<AccessibilityElementInfo> &infos) {
+                std::lock_guard<std::mutex> lock(results->mutex);
+                results->elementIds[elementId] = (ret == RET_OK && infos.size() == 1) ?
+                    infos[0].GetAccessibilityId() : AccessibilityElementInfo::UNDEFINED_ACCESSIBILITY_ID;
+                if (results->elementIds.size() == requestCount) {
+                    results->done.set_value();
+                }
+            }), RET_OK);
+    }
+    EXPECT_EQ(instance_->GetPendingRequestCount(), requestCount);
+
+    // answer in the reverse order
+    for (auto iter = sentRequests.rbegin(); iter != sentRequests.rend(); ++iter) {
+        AccessibilityElementInfo info;
+        info.SetAccessibilityId(iter->elementId);
+        iter->callback->SetSearchElementInfoByAccessibilityIdResult({ info }, iter->requestId);
+    }
+    ASSERT_EQ(results->done.get_future().wait_for(std::chrono::seconds(waitTime)), std::future_status::ready);
+    for (int64_t elementId = 1; elementId <= requestCount; elementId++) {
+        EXPECT_EQ(results->elementIds[elementId], elementId);
+    }
+    EXPECT_EQ(instance_->GetPendingRequestCount(), 0);
+    GTEST_LOG_(INFO) << "SearchElementInfosByAccessibilityIdAsync_001 end";
+}
+
+/**
+ * @tc.number: SearchElementInfosByAccessibilityIdAsync_002
+ * @tc.name: SearchElementInfosByAccessibilityIdAsync
+ * @tc.desc: Test the callback owns its result, a second reply for the request does not reach it
+ */
+HWTEST_F(AccessibleAbilityChannelClientTest, SearchElementInfosByAccessibilityIdAsync_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SearchElementInfosByAccessibilityIdAsync_002 start";
+    constexpr int64_t waitTime = 1; // s
+    constexpr int64_t lateReplyWaitTime = 100; // ms
+    int32_t sentRequestId = 0;
+    sptr<IAccessibilityElementOperatorCallback> sentCallback = nullptr;
+    EXPECT_CALL(*stub_, SearchElementInfoByAccessibilityId(_, _, _, _, _, _)).Times(1)
+        .WillOnce(Invoke([&sentRequestId, &sentCallback](const ElementBasicInfo elementBasicInfo,
+            const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback, const int32_t mode,
+            bool isFilter, bool systemApi) {
+            sentRequestId = requestId;
+            sentCallback = callback;
+            return RET_OK;
+        }));
+    struct Results {
+        std::mutex mutex;
+        int32_t callCount = 0;
+        std::vector<AccessibilityElementInfo> infos;
+        std::promise<void> done;
+    };
+    auto results = std::make_shared<Results>();
+    EXPECT_EQ(instance_->SearchElementInfosByAccessibilityIdAsync(ACCESSIBILITY_WINDOW_ID, ELEMENT_ID, MODE,
+        TREE_ID, [results](RetError ret, std::vector<AccessibilityElementInfo> infos) {
+            std::lock_guard<std::mutex> lock(results->mutex);
+            results->infos = std::move(infos);
+            if (++results->callCount == 1) {
+                results->done.set_value();
+            }
+        }), RET_OK);
+    ASSERT_TRUE(sentCallback != nullptr);
+
+    AccessibilityElementInfo info;
+    info.SetAccessibilityId(ELEMENT_ID);
+    sentCallback->SetSearchElementInfoByAccessibilityIdResult({ info }, sentRequestId);
+    ASSERT_EQ(results->done.get_future().wait_for(std::chrono::seconds(waitTime)), std::future_status::ready);
+    // a late reply only writes the operator callback, the result already handed out stays as it was
+    info.SetAccessibilityId(ELEMENT_ID + 1);
+    sentCallback->SetSearchElementInfoByAccessibilityIdResult({ info, info }, sentRequestId);
+    std::this_thread::sleep_for(std::chrono::milliseconds(lateReplyWaitTime));
+    std::lock_guard<std::mutex> lock(results->mutex);
+    EXPECT_EQ(results->callCount, 1);
+    ASSERT_EQ(results->infos.size(), 1);
+    EXPECT_EQ(results->infos[0].GetAccessibilityId(), ELEMENT_ID);
+    GTEST_LOG_(INFO) << "SearchElementInfosByAccessibilityIdAsync_002 end";
+}
+
+/**
+ * @tc.number: SearchElementInfosByAccessibilityIdAsync_003
+ * @tc.name: SearchElementInfosByAccessibilityIdAsync
+ * @tc.desc: Test the search goes to the granted operator of the window and the grant is reused
+ */
+HWTEST_F(AccessibleAbilityChannelClientTest, SearchElementInfosByAccessibilityIdAsync_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SearchElementInfosByAccessibilityIdAsync_003 start";
+    sptr<MockAccessibilityElementOperatorStub> grantedOperator = new MockAccessibilityElementOperatorStub();
+    ASSERT_TRUE(grantedOperator);
+    EXPECT_CALL(*stub_, GrantElementOperator(ACCESSIBILITY_WINDOW_ID, TREE_ID, _)).Times(1)
+        .WillOnce(Invoke([grantedOperator](const int32_t windowId, const int32_t treeId,
+            sptr<IRemoteObject> &remote) {
+            remote = grantedOperator->AsObject();
+            return RET_OK;
+        }));
+    EXPECT_CALL(*grantedOperator, SearchElementInfoByAccessibilityId(_, _, _, MODE, _)).Times(2)
+        .WillRepeatedly(Return(RET_OK));
+    EXPECT_CALL(*stub_, SearchElementInfoByAccessibilityId(_, _, _, _, _, _)).Times(0);
+    for (int64_t elementId = 1; elementId <= 2; elementId++) {
+        EXPECT_EQ(instance_->SearchElementInfosByAccessibilityIdAsync(ACCESSIBILITY_WINDOW_ID, elementId, MODE,
+            TREE_ID, [](RetError ret, const std::vector<AccessibilityElementInfo> &infos) {}), RET_OK);
+    }
+    GTEST_LOG_(INFO) << "SearchElementInfosByAccessibilityIdAsync_003 end";
+}
+
+/**
+ * @tc.number: SearchElementInfosByAccessibilityIdAsync_004
+ * @tc.name: SearchElementInfosByAccessibilityIdAsync
+ * @tc.desc: Test a revoked grant is dropped and the search is sent through AAMS
+ */
+HWTEST_F(AccessibleAbilityChannelClientTest, SearchElementInfosByAccessibilityIdAsync_004, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SearchElementInfosByAccessibilityIdAsync_004 start";
+    sptr<MockAccessibilityElementOperatorStub> grantedOperator = new MockAccessibilityElementOperatorStub();
+    ASSERT_TRUE(grantedOperator);
+    EXPECT_CALL(*stub_, GrantElementOperator(ACCESSIBILITY_WINDOW_ID, TREE_ID, _)).Times(2)
+        .WillOnce(Invoke([grantedOperator](const int32_t windowId, const int32_t treeId,
+            sptr<IRemoteObject> &remote) {
+            remote = grantedOperator->AsObject();
+            return RET_OK;
+        }))
+        .WillOnce(Return(RET_ERR_NO_WINDOW_CONNECTION));
+    EXPECT_CALL(*grantedOperator, SearchElementInfoByAccessibilityId(_, _, _, _, _)).Times(1)
+        .WillOnce(Return(RET_ERR_NO_WINDOW_CONNECTION));
+    EXPECT_CALL(*stub_, SearchElementInfoByAccessibilityId(_, _, _, _, _, _)).Times(3)
+        .WillRepeatedly(Return(RET_OK));
+    for (int64_t elementId = 1; elementId <= 2; elementId++) {
+        EXPECT_EQ(instance_->SearchElementInfosByAccessibilityIdAsync(ACCESSIBILITY_WINDOW_ID, elementId, MODE,
+            TREE_ID, [](RetError ret, const std::vector<AccessibilityElementInfo> &infos) {}), RET_OK);
+    }
+    // the refused grant is kept, the window is searched through AAMS
+    EXPECT_EQ(instance_->SearchElementInfosByAccessibilityIdAsync(ACCESSIBILITY_WINDOW_ID, ELEMENT_ID, MODE,
+        TREE_ID, [](RetError ret, const std::vector<AccessibilityElementInfo> &infos) {}), RET_OK);
+    GTEST_LOG_(INFO) << "SearchElementInfosByAccessibilityIdAsync_004 end";
+}
+
+/**
+ * @tc.number: ExecuteActionAsync_001
+ * @tc.name: ExecuteActionAsync
+ * @tc.desc: Test a request which can not be sent is not left pending
+ */
+HWTEST_F(AccessibleAbilityChannelClientTest, ExecuteActionAsync_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ExecuteActionAsync_001 start";
+    EXPECT_CALL(*stub_, ExecuteAction(_, _, _, _, _, _, _)).Times(1).WillOnce(Return(RET_ERR_FAILED));
+    bool called = false;
+    std::map<std::string, std::string> actionArguments;
+    Rect rect;
+    EXPECT_EQ(instance_->ExecuteActionAsync(ACCESSIBILITY_WINDOW_ID, ELEMENT_ID,
+        ActionType::ACCESSIBILITY_ACTION_CLICK, actionArguments, rect, [&called](RetError ret) { called = true; }),
+        RET_ERR_FAILED);
+    EXPECT_EQ(instance_->GetPendingRequestCount(), 0);
+    EXPECT_FALSE(called);
+    GTEST_LOG_(INFO) << "ExecuteActionAsync_001 end";
+}
+
+/**
+ * @tc.number: SearchElementInfosBatch_001
+ * @tc.name: SearchElementInfosBatch
+ * @tc.desc: Test a batch is sent in one transaction and the results keep the order of the queries
+ */
+HWTEST_F(AccessibleAbilityChannelClientTest, SearchElementInfosBatch_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SearchElementInfosBatch_001 start";
+    constexpr int64_t queryCount = 50;
+    EXPECT_CALL(*stub_, SearchElementInfosBatch(_, _, _, _, _, _, _)).Times(1)
+        .WillOnce(Invoke([](const int32_t windowId, const int32_t treeId,
+            const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+            const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter, bool systemApi) {
+            std::vector<ElementSearchResult> results(queries.size());
+            for (size_t i = 0; i < queries.size(); i++) {
+                AccessibilityElementInfo info;
+                info.SetAccessibilityId(queries[i].elementId);
+                results[i].infos.push_back(info);
+            }
+            callback->SetSearchElementInfosBatchResult(results, requestId);
+            return RET_OK;
+        }));
+
+    std::vector<ElementSearchQuery> queries(queryCount);
+    for (int64_t i = 0; i < queryCount; i++) {
+        queries[i].elementId = i + 1;
+        queries[i].mode = MODE;
+    }
+    std::vector<ElementSearchResult> results;
+    EXPECT_EQ(instance_->SearchElementInfosBatch(ACCESSIBILITY_WINDOW_ID, TREE_ID, queries, results), RET_OK);
+
+    ASSERT_EQ(results.size(), static_cast<size_t>(queryCount));
+    for (int64_t i = 0; i < queryCount; i++) {
+        EXPECT_EQ(results[i].ret, RET_OK);
+        ASSERT_EQ(results[i].infos.size(), 1);
+        EXPECT_EQ(results[i].infos[0].GetAccessibilityId(), i + 1);
+    }
+    EXPECT_EQ(instance_->GetPendingRequestCount(), 0);
+    GTEST_LOG_(INFO) << "SearchElementInfosBatch_001 end";
+}
+
+/**
+ * @tc.number: SearchElementInfosBatch_002
+ * @tc.name: SearchElementInfosBatch
+ * @tc.desc: Test an empty or oversized batch is rejected without a transaction
+ */
+HWTEST_F(AccessibleAbilityChannelClientTest, SearchElementInfosBatch_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SearchElementInfosBatch_002 start";
+    EXPECT_CALL(*stub_, SearchElementInfosBatch(_, _, _, _, _, _, _)).Times(0);
+    std::vector<ElementSearchResult> results;
+    std::vector<ElementSearchQuery> queries;
+    EXPECT_EQ(instance_->SearchElementInfosBatch(ACCESSIBILITY_WINDOW_ID, TREE_ID, queries, results),
+        RET_ERR_INVALID_PARAM);
+    queries.resize(MAX_ELEMENT_SEARCH_QUERY_COUNT + 1);
+    EXPECT_EQ(instance_->SearchElementInfosBatch(ACCESSIBILITY_WINDOW_ID, TREE_ID, queries, results),
+        RET_ERR_INVALID_PARAM);
+    EXPECT_EQ(instance_->GetPendingRequestCount(), 0);
+    GTEST_LOG_(INFO) << "SearchElementInfosBatch_002 end";
+}
+
+/**
+ * @tc.number: SearchElementTreeDiff_001
+ * @tc.name: SearchElementTreeDiff
+ * @tc.desc: Test the diff computed by the element operator is returned as it is
+ */
+HWTEST_F(AccessibleAbilityChannelClientTest, SearchElementTreeDiff_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SearchElementTreeDiff_001 start";
+    constexpr uint64_t sinceGeneration = 3;
+    EXPECT_CALL(*stub_, SearchElementTreeDiff(ACCESSIBILITY_WINDOW_ID, TREE_ID, sinceGeneration, _, _)).Times(1)
+        .WillOnce(Invoke([](const int32_t windowId, const int32_t treeId, const uint64_t generation,
+            const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback) {
+            ElementTreeDiff diff;
+            diff.generation = generation + 1;
+            AccessibilityElementInfo info;
+            info.SetAccessibilityId(ELEMENT_ID);
+            diff.changedNodes.push_back(info);
+            diff.removedNodeIds.push_back(ELEMENT_ID + 1);
+            callback->SetSearchElementTreeDiffResult(diff, requestId);
+            return RET_OK;
+        }));
+
+    ElementTreeDiff diff;
+    EXPECT_EQ(instance_->SearchElementTreeDiff(ACCESSIBILITY_WINDOW_ID, TREE_ID, sinceGeneration, diff), RET_OK);
+    EXPECT_EQ(diff.generation, sinceGeneration + 1);
+    EXPECT_FALSE(diff.isFullSnapshot);
+    EXPECT_TRUE(diff.addedNodes.empty());
+    ASSERT_EQ(diff.changedNodes.size(), 1);
+    EXPECT_EQ(diff.changedNodes[0].GetAccessibilityId(), ELEMENT_ID);
+    ASSERT_EQ(diff.removedNodeIds.size(), 1);
+    EXPECT_EQ(diff.removedNodeIds[0], ELEMENT_ID + 1);
+    EXPECT_EQ(instance_->GetPendingRequestCount(), 0);
+    GTEST_LOG_(INFO) << "SearchElementTreeDiff_001 end";
+}
+
+/**
+ * @tc.number: SearchElementTreeDiff_002
+ * @tc.name: SearchElementTreeDiff
+ * @tc.desc: Test a diff without a generation means the element operator could not search the tree
+ */
+HWTEST_F(AccessibleAbilityChannelClientTest, SearchElementTreeDiff_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SearchElementTreeDiff_002 start";
+    EXPECT_CALL(*stub_, SearchElementTreeDiff(_, _, _, _, _)).Times(1)
+        .WillOnce(Invoke([](const int32_t windowId, const int32_t treeId, const uint64_t sinceGeneration,
+            const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback) {
+            callback->SetSearchElementTreeDiffResult(ElementTreeDiff(), requestId);
+            return RET_OK;
+        }));
+    ElementTreeDiff diff;
+    EXPECT_EQ(instance_->SearchElementTreeDiff(ACCESSIBILITY_WINDOW_ID, TREE_ID, 0, diff),
+        RET_ERR_INVALID_ELEMENT_INFO_FROM_ACE);
+    EXPECT_EQ(instance_->GetPendingRequestCount(), 0);
+    GTEST_LOG_(INFO) << "SearchElementTreeDiff_002 end";
+}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <chrono>
 #include "accessibility_ut_helper.h"
 #include "accessible_ability_client_impl.h"
 #include "accessible_ability_manager_service.h"
@@ -915,6 +916,79 @@ HWTEST_F(AccessibleAbilityClientImplTest, GetChildren_003, TestSize.Level1)
     GTEST_LOG_(INFO) << "GetChildren_003 end";
 }
 
+/**
+ * @tc.number: GetChildren_004
+ * @tc.name: GetChildren
+ * @tc.desc: Test the uncached children of a 50-child list are fetched in one round trip, the round trips and the
+ *           elapsed time are compared with the per-child searches taken when the batch fails
+ */
+HWTEST_F(AccessibleAbilityClientImplTest, GetChildren_004, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GetChildren_004 start";
+    constexpr int64_t childCount = 50;
+    int32_t singleCount = 0;
+    int32_t batchCount = 0;
+    EXPECT_CALL(*stub_, SearchElementInfoByAccessibilityId(_, _, _, _, _, _)).Times(childCount)
+        .WillRepeatedly(Invoke([&singleCount](const ElementBasicInfo elementBasicInfo, const int32_t requestId,
+            const sptr<IAccessibilityElementOperatorCallback> &callback, const int32_t mode, bool isFilter,
+            bool systemApi) {
+            singleCount++;
+            AccessibilityElementInfo info;
+            info.SetAccessibilityId(elementBasicInfo.elementId);
+            callback->SetSearchElementInfoByAccessibilityIdResult({ info }, requestId);
+            return RET_OK;
+        }));
+    EXPECT_CALL(*stub_, SearchElementInfosBatch(_, _, _, _, _, _, _)).Times(2)
+        .WillOnce(Invoke([&batchCount](const int32_t windowId, const int32_t treeId,
+            const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+            const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter, bool systemApi) {
+            batchCount++;
+            return RET_ERR_FAILED;
+        }))
+        .WillOnce(Invoke([&batchCount](const int32_t windowId, const int32_t treeId,
+            const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+            const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter, bool systemApi) {
+            batchCount++;
+            std::vector<ElementSearchResult> results(queries.size());
+            for (size_t i = 0; i < queries.size(); i++) {
+                AccessibilityElementInfo info;
+                info.SetAccessibilityId(queries[i].elementId);
+                results[i].infos.push_back(info);
+            }
+            callback->SetSearchElementInfosBatchResult(results, requestId);
+            return RET_OK;
+        }));
+    Connect();
+
+    // each pass uses its own window so that nothing is found in the cache
+    std::chrono::steady_clock::duration elapsed[2];
+    int32_t roundTrips[2];
+    for (int32_t pass = 0; pass < 2; pass++) {
+        AccessibilityElementInfo parent;
+        parent.SetWindowId(WINDOW_ID + pass);
+        for (int64_t childId = ELEMENT_ID; childId < ELEMENT_ID + childCount; childId++) {
+            parent.AddChild(childId);
+        }
+        std::vector<AccessibilityElementInfo> children;
+        int32_t before = singleCount + batchCount;
+        auto begin = std::chrono::steady_clock::now();
+        EXPECT_EQ(instance_->GetChildren(parent, children), RET_OK);
+        elapsed[pass] = std::chrono::steady_clock::now() - begin;
+        roundTrips[pass] = singleCount + batchCount - before;
+        ASSERT_EQ(children.size(), static_cast<size_t>(childCount));
+        for (int64_t i = 0; i < childCount; i++) {
+            EXPECT_EQ(children[i].GetAccessibilityId(), ELEMENT_ID + i);
+        }
+    }
+    EXPECT_EQ(roundTrips[0], childCount + 1);
+    EXPECT_EQ(roundTrips[1], 1);
+    GTEST_LOG_(INFO) << "per child: " << roundTrips[0] << " round trips " <<
+        std::chrono::duration_cast<std::chrono::microseconds>(elapsed[0]).count() << "us, batch: " <<
+        roundTrips[1] << " round trip " <<
+        std::chrono::duration_cast<std::chrono::microseconds>(elapsed[1]).count() << "us";
+    GTEST_LOG_(INFO) << "GetChildren_004 end";
+}
+
 /**
  * @tc.number: SetTargetBundleName_001
  * @tc.name: SetTargetBundleName
@@ -1060,5 +1134,156 @@ HWTEST_F(AccessibleAbilityClientImplTest, SetParentId_001, TestSize.Level1)
     EXPECT_EQ(1, param.parentId);
     GTEST_LOG_(INFO) << "SetParentId_001 end";
 }
+/**
+ * @tc.number: GetTreeDiff_001
+ * @tc.name: GetTreeDiff
+ * @tc.desc: Test function SubscribeTreeDiff, GetTreeDiff and UnsubscribeTreeDiff
+ */
+HWTEST_F(AccessibleAbilityClientImplTest, GetTreeDiff_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GetTreeDiff_001 start";
+    AccessibilityTreeDiff diff;
+    EXPECT_EQ(instance_->SubscribeTreeDiff(WINDOW_ID), RET_ERR_NO_CONNECTION);
+    EXPECT_EQ(instance_->GetTreeDiff(WINDOW_ID, 0, diff), RET_ERR_NO_CONNECTION);
+    Connect();
+    EXPECT_EQ(instance_->SubscribeTreeDiff(INVALID_ID), RET_ERR_INVALID_PARAM);
+    EXPECT_EQ(instance_->GetTreeDiff(WINDOW_ID, 0, diff), RET_ERR_INVALID_PARAM);
+    EXPECT_EQ(instance_->SubscribeTreeDiff(WINDOW_ID), RET_OK);
+    EXPECT_EQ(instance_->GetTreeDiff(WINDOW_ID, 0, diff), RET_ERR_TIME_OUT);
+    EXPECT_EQ(instance_->UnsubscribeTreeDiff(WINDOW_ID), RET_OK);
+    EXPECT_EQ(instance_->UnsubscribeTreeDiff(WINDOW_ID), RET_ERR_INVALID_PARAM);
+    GTEST_LOG_(INFO) << "GetTreeDiff_001 end";
+}
+
+/**
+ * @tc.number: ElementCache_001
+ * @tc.name: ElementCache
+ * @tc.desc: Test the element cache keeps several windows and evicts the least recently used one
+ */
+HWTEST_F(AccessibleAbilityClientImplTest, ElementCache_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ElementCache_001 start";
+    constexpr size_t maxWindowCount = 2;
+    AccessibilityElementCache cache(maxWindowCount);
+    AccessibilityElementInfo info;
+    info.SetAccessibilityId(ELEMENT_ID);
+    for (int32_t windowId = 1; windowId <= static_cast<int32_t>(maxWindowCount); windowId++) {
+        info.SetWindowId(windowId);
+        cache.Insert(windowId, { info });
+    }
+    // window 1 becomes the most recently used one, so window 2 is evicted by window 3
+    AccessibilityElementCache::ElementPtr cachedInfo = cache.Find(1, ELEMENT_ID);
+    ASSERT_TRUE(cachedInfo != nullptr);
+    EXPECT_EQ(cachedInfo->GetWindowId(), 1);
+    cache.Insert(3, { info });
+    EXPECT_EQ(cache.GetWindowCount(), maxWindowCount);
+    EXPECT_TRUE(cache.Find(1, ELEMENT_ID) != nullptr);
+    EXPECT_TRUE(cache.Find(2, ELEMENT_ID) == nullptr);
+    EXPECT_TRUE(cache.Find(3, ELEMENT_ID) != nullptr);
+    // the counters of an evicted window go with it
+    EXPECT_EQ(cache.GetStats().count(2), 0);
+
+    // a node handed out stays valid after its window is dropped
+    cache.InvalidateWindow(1);
+    EXPECT_TRUE(cache.Find(1, ELEMENT_ID) == nullptr);
+    EXPECT_EQ(cachedInfo->GetAccessibilityId(), ELEMENT_ID);
+    cache.Clear();
+    EXPECT_EQ(cache.GetWindowCount(), 0);
+    EXPECT_EQ(cache.GetByteSize(), 0);
+    GTEST_LOG_(INFO) << "ElementCache_001 end";
+}
+
+/**
+ * @tc.number: ElementCache_002
+ * @tc.name: ElementCache
+ * @tc.desc: Test the element cache keeps the byte budget
+ */
+HWTEST_F(AccessibleAbilityClientImplTest, ElementCache_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ElementCache_002 start";
+    constexpr size_t maxWindowCount = 5;
+    constexpr int64_t nodeCount = 10;
+    AccessibilityElementCache cache(maxWindowCount, sizeof(AccessibilityElementInfo) * nodeCount);
+    std::vector<AccessibilityElementInfo> infos;
+    for (int64_t elementId = 0; elementId < nodeCount * 2; elementId++) {
+        AccessibilityElementInfo info;
+        info.SetAccessibilityId(elementId);
+        infos.push_back(info);
+    }
+    cache.Insert(WINDOW_ID, infos);
+    EXPECT_LE(cache.GetByteSize(), sizeof(AccessibilityElementInfo) * nodeCount);
+    EXPECT_TRUE(cache.Find(WINDOW_ID, 0) != nullptr);
+    EXPECT_TRUE(cache.Find(WINDOW_ID, nodeCount * 2 - 1) == nullptr);
+    GTEST_LOG_(INFO) << "ElementCache_002 end";
+}
+
+/**
+ * @tc.number: ElementCache_003
+ * @tc.name: ElementCache
+ * @tc.desc: Test the element cache evicts the changed node with its ancestors or subtree and counts it
+ */
+HWTEST_F(AccessibleAbilityClientImplTest, ElementCache_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ElementCache_003 start";
+    // 0 -> { 1 -> { 3 }, 2 }
+    auto createNode = [](int64_t elementId, int64_t parentId, const std::vector<int64_t> &children) {
+        AccessibilityElementInfo info;
+        info.SetAccessibilityId(elementId);
+        info.SetParent(parentId);
+        for (auto child : children) {
+            info.AddChild(child);
+        }
+        return info;
+    };
+    std::vector<AccessibilityElementInfo> infos = { createNode(0, -1, { 1, 2 }), createNode(1, 0, { 3 }),
+        createNode(2, 0, {}), createNode(3, 1, {}) };
+    AccessibilityElementCache cache;
+    cache.Insert(WINDOW_ID, infos);
+    EXPECT_TRUE(cache.InvalidateElement(WINDOW_ID, 1,
+        AccessibilityElementCache::InvalidateScope::NODE_AND_ANCESTORS));
+    EXPECT_TRUE(cache.Find(WINDOW_ID, 0) == nullptr);
+    EXPECT_TRUE(cache.Find(WINDOW_ID, 1) == nullptr);
+    EXPECT_TRUE(cache.Find(WINDOW_ID, 2) != nullptr);
+    EXPECT_TRUE(cache.Find(WINDOW_ID, 3) != nullptr);
+
+    cache.Insert(WINDOW_ID, infos);
+    EXPECT_TRUE(cache.InvalidateElement(WINDOW_ID, 1,
+        AccessibilityElementCache::InvalidateScope::SUBTREE_AND_ANCESTORS));
+    EXPECT_TRUE(cache.Find(WINDOW_ID, 2) != nullptr);
+    EXPECT_TRUE(cache.Find(WINDOW_ID, 3) == nullptr);
+    // the element is not cached any more, the caller drops the window
+    EXPECT_FALSE(cache.InvalidateElement(WINDOW_ID, 1,
+        AccessibilityElementCache::InvalidateScope::NODE_AND_ANCESTORS));
+
+    std::map<int32_t, AccessibilityElementCache::WindowStats> stats = cache.GetStats();
+    ASSERT_EQ(stats.count(WINDOW_ID), 1);
+    EXPECT_EQ(stats[WINDOW_ID].hitCount, 3);
+    EXPECT_EQ(stats[WINDOW_ID].missCount, 3);
+    // two nodes by the first invalidation, two survivors when the window is replaced, three by the second one
+    EXPECT_EQ(stats[WINDOW_ID].evictCount, 7);
+    cache.InvalidateWindow(WINDOW_ID);
+    EXPECT_TRUE(cache.GetStats().empty());
+    GTEST_LOG_(INFO) << "ElementCache_003 end";
+}
+
+/**
+ * @tc.number: GetElementCacheStats_001
+ * @tc.name: GetElementCacheStats
+ * @tc.desc: Test the element cache counters are reset when the cache mode changes
+ */
+HWTEST_F(AccessibleAbilityClientImplTest, GetElementCacheStats_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GetElementCacheStats_001 start";
+    AccessibilityEventInfo eventInfo;
+    eventInfo.SetWindowId(WINDOW_ID);
+    eventInfo.SetEventType(EventType::TYPE_WINDOW_UPDATE);
+    eventInfo.SetWindowChangeTypes(WINDOW_UPDATE_ADDED);
+    instance_->OnAccessibilityEvent(eventInfo);
+    std::map<int32_t, AccessibilityElementCache::WindowStats> stats;
+    instance_->SetCacheMode(0);
+    instance_->GetElementCacheStats(stats);
+    EXPECT_TRUE(stats.empty());
+    GTEST_LOG_(INFO) << "GetElementCacheStats_001 end";
+}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -16,16 +16,20 @@
 #ifndef ACCESSIBILITY_ELEMENT_OPERATOR_IMPL_H
 #define ACCESSIBILITY_ELEMENT_OPERATOR_IMPL_H
 
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include "accessibility_element_operator_callback.h"
 #include "accessibility_element_operator_stub.h"
 #include "accessibility_element_operator.h"
+#include "accessibility_tree_diff_tracker.h"
 #include "nocopyable.h"
 #include "ffrt.h"
 
 namespace OHOS {
 namespace Accessibility {
+class AccessibilityGrantedElementOperator;
+
 /*
 * The class define the interface for UI to implement.
 * It is triggered by ABMS when AA to request the accessibility information.
@@ -281,17 +285,165 @@ public:
         const sptr<IAccessibilityElementOperatorCallback> &callback) override;
     void SetRemoveAccessibilityVirtualNodeResult(const OperateVirtualNodeResult result, const int32_t requestId);
 
+    /**
+     * @brief Send the queries of a batch to ACE back to back and reply once all of them are answered.
+     * @param queries The queries, executed in order.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     * @param callback The callback to return the results.
+     * @param isFilter Whether the sensitive properties of the found nodes are cleared.
+     */
+    virtual void SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter = false) override;
+
+    /**
+     * @brief Record the result of one query of a batch search, the batch replies with its last result.
+     * @param queryId The request id the query was sent to ACE with.
+     * @param infos The element infos found.
+     * @param treeInfos The tree infos, set by the specific property search only.
+     * @param requestId The request id of the batch, set when this was its last pending query.
+     * @return false if queryId does not belong to a batch search.
+     */
+    static bool SetBatchQueryResult(const int32_t queryId, const std::list<AccessibilityElementInfo> &infos,
+        const std::list<AccessibilityElementInfo> &treeInfos, int32_t &requestId);
+
+    /**
+     * @brief Create the operator AAMS hands to an accessibility extension for the searches by accessibility id.
+     * @param grantId The id the operator is revoked with.
+     * @param grantedOperator The operator created.
+     * @return Returns RET_OK if successful, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError GrantElementOperator(const int32_t grantId, sptr<IRemoteObject> &grantedOperator) override;
+
+    /**
+     * @brief Revoke a granted operator, its searches fail from then on.
+     * @param grantId The id the operator was granted with.
+     */
+    virtual void RevokeElementOperator(const int32_t grantId) override;
+
+    /**
+     * @brief Search the whole tree in the ui and send only the nodes changed after sinceGeneration to AA.
+     * @param sinceGeneration The generation AA already has, 0 for the whole tree.
+     * @param requestId The request id from AA, it is used to match with request and response.
+     * @param callback The callback to return the diff.
+     * @sysCap Accessibility
+     */
+    virtual void SearchElementTreeDiff(const uint64_t sinceGeneration, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+
+    /**
+     * @brief Pass the tree searched for a tree diff to the operator which sent the search.
+     * @param queryId The request id of the result.
+     * @param infos The nodes of the tree.
+     * @param requestId The request id from AA, set when the diff is sent.
+     * @return false if queryId is not a search of a tree diff.
+     */
+    static bool SetTreeDiffQueryResult(const int32_t queryId, const std::list<AccessibilityElementInfo> &infos,
+        int32_t &requestId);
+
 private:
+    struct BatchSearch {
+        int32_t requestId = -1;
+        sptr<IAccessibilityElementOperatorCallback> callback = nullptr;
+        std::vector<ElementSearchResult> results {};
+        size_t pendingCount = 0;
+    };
+
+    struct BatchQuery {
+        std::shared_ptr<BatchSearch> batch = nullptr;
+        size_t index = 0;
+    };
+
+    struct TreeDiffQuery {
+        wptr<AccessibilityElementOperatorImpl> elementOperator;
+        uint64_t sinceGeneration = 0;
+        int32_t requestId = -1;
+        sptr<IAccessibilityElementOperatorCallback> callback = nullptr;
+    };
+
     int32_t AddRequest(int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback);
+    static std::shared_ptr<BatchSearch> CompleteBatchQuery(const int32_t queryId, const RetError ret,
+        const std::list<AccessibilityElementInfo> &infos, const std::list<AccessibilityElementInfo> &treeInfos);
+    static void ExpireBatchQueries(const std::weak_ptr<BatchSearch> &weakBatch, const std::vector<int32_t> &queryIds);
+    static void ExpireBatchQueriesLater(const std::shared_ptr<BatchSearch> &batch,
+        const std::vector<int32_t> &queryIds);
+    static void ExpireTreeDiffQueryLater(const int32_t queryId, const int32_t requestId);
 
     static ffrt::mutex requestsMutex_;
     int32_t windowId_ = 0;
     AccessibilityElementOperatorCallback &operatorCallback_;
     std::shared_ptr<AccessibilityElementOperator> operator_ = nullptr;
     static std::unordered_map<int32_t, sptr<IAccessibilityElementOperatorCallback>> requests_;
+    static std::unordered_map<int32_t, BatchQuery> batchQueries_; // queryId -> the batch it belongs to
+    static int32_t batchQueryId_;
+    static std::unordered_map<int32_t, TreeDiffQuery> treeDiffQueries_; // queryId -> the diff it searches for
+    static int32_t treeDiffQueryId_;
+    AccessibilityTreeDiffTracker treeDiffTracker_;
+    ffrt::mutex grantsMutex_;
+    std::unordered_map<int32_t, sptr<AccessibilityGrantedElementOperator>> grants_; // grantId -> the operator
     DISALLOW_COPY_AND_MOVE(AccessibilityElementOperatorImpl);
 };
 
+/*
+* The operator of a window handed to one accessibility extension by AAMS. It forwards the searches by accessibility
+* id to the operator of the window until it is revoked, everything else is refused.
+*/
+class AccessibilityGrantedElementOperator : public AccessibilityElementOperatorStub {
+public:
+    explicit AccessibilityGrantedElementOperator(const wptr<AccessibilityElementOperatorImpl> &grantor);
+    ~AccessibilityGrantedElementOperator() = default;
+
+    void Revoke();
+
+    virtual RetError SearchElementInfoByAccessibilityId(const int64_t elementId, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback, const int32_t mode,
+        bool isFilter = false) override;
+    virtual void SearchDefaultFocusedByWindowId(const int32_t windowId, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback, const int32_t mode,
+        bool isFilter = false) override;
+    virtual void SearchElementInfosByText(const int64_t elementId, const std::string &text,
+        const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+    virtual void FindFocusedElementInfo(const int64_t elementId, const int32_t focusType, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+    virtual void FocusMoveSearch(const int64_t elementId, const int32_t direction, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+    virtual void ExecuteAction(const int64_t elementId, const int32_t action,
+        const std::map<std::string, std::string> &actionArguments,
+        int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+    virtual void GetCursorPosition(const int64_t elementId, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+    virtual void ClearFocus() override;
+    virtual void OutsideTouch() override;
+    virtual void SetChildTreeIdAndWinId(const int64_t elementId, const int32_t childTreeId,
+        const int32_t childWindowId) override;
+    virtual void SetBelongTreeId(const int32_t treeId) override;
+    virtual void SetParentWindowId(const int32_t parentWindowId) override;
+    virtual void SearchElementInfoBySpecificProperty(const int64_t elementId,
+        const SpecificPropertyParam& param, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+    virtual void FocusMoveSearchWithCondition(const AccessibilityElementInfo &info,
+        const AccessibilityFocusMoveParam &param,
+        const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+    virtual void UpdateCustomAccessibilityProperty(const int64_t elementId,
+        const AccessibilityVirtualNode& accessibilityVirtualNode, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+    virtual void AddAccessibilityVirtualNode(const int64_t rootId,
+        const std::vector<AccessibilityVirtualNode> &nodes, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+    virtual void RemoveAccessibilityVirtualNode(const int64_t id, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+    virtual void SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter = false) override;
+    virtual RetError GrantElementOperator(const int32_t grantId, sptr<IRemoteObject> &grantedOperator) override;
+    virtual void RevokeElementOperator(const int32_t grantId) override;
+    virtual void SearchElementTreeDiff(const uint64_t sinceGeneration, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+
+private:
+    wptr<AccessibilityElementOperatorImpl> grantor_;
+    std::atomic<bool> revoked_ = false;
+    DISALLOW_COPY_AND_MOVE(AccessibilityGrantedElementOperator);
+};
+
 template<class T>
 std::vector<T> TranslateListToVector(const std::list<T> &originList)
 {
@@ -429,6 +429,24 @@ private:
 
     void Init();
 
+    /**
+     * @brief Pass the result of a query sent by a batch search to its batch.
+     * @param infos The element infos found.
+     * @param treeInfos The tree infos, set by the specific property search only.
+     * @param requestId The request id of the result.
+     * @return false if requestId is not a query of a batch search.
+     */
+    bool SetBatchQueryResult(const std::list<AccessibilityElementInfo> &infos,
+        const std::list<AccessibilityElementInfo> &treeInfos, const int32_t requestId);
+
+    /**
+     * @brief Pass the tree searched for a tree diff to the element operator which computes the diff.
+     * @param infos The nodes of the tree.
+     * @param requestId The request id of the result.
+     * @return false if requestId is not a search of a tree diff.
+     */
+    bool SetTreeDiffQueryResult(const std::list<AccessibilityElementInfo> &infos, const int32_t requestId);
+
     /**
      * @brief Notify the state is changed.
      * @param stateType The state type and value.
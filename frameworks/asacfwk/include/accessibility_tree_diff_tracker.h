@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_TREE_DIFF_TRACKER_H
+#define ACCESSIBILITY_TREE_DIFF_TRACKER_H
+
+#include <map>
+#include <vector>
+#include "accessibility_element_info.h"
+#include "ffrt.h"
+#include "iaccessibility_element_operator_callback.h"
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * @brief Keeps the last tree of a window seen by the element operator with a generation per node,
+ *        so the operator sends the changed nodes to the ability instead of the whole tree.
+ */
+class AccessibilityTreeDiffTracker {
+public:
+    /**
+     * @brief Merge the whole tree of the window and advance the generation if anything changed.
+     * @param elementInfos The nodes of the tree.
+     */
+    void ApplyTree(const std::vector<AccessibilityElementInfo> &elementInfos);
+
+    /**
+     * @brief Collect the nodes changed after sinceGeneration.
+     * @param sinceGeneration The generation the ability has, 0 or a dropped generation gets a full snapshot.
+     * @param diff The result.
+     */
+    void GetDiff(const uint64_t sinceGeneration, ElementTreeDiff &diff);
+
+private:
+    struct NodeRecord {
+        AccessibilityElementInfo info {};
+        size_t fingerprint = 0;
+        uint64_t addedGeneration = 0;
+        uint64_t changedGeneration = 0;
+    };
+
+    static size_t GetFingerprint(const AccessibilityElementInfo &info);
+    void PruneRemovedNodes();
+
+    std::map<int64_t, NodeRecord> nodes_ {};
+    std::map<int64_t, uint64_t> removedNodes_ {}; // elementId -> generation it was removed in
+    uint64_t generation_ = 0;
+    uint64_t oldestGeneration_ = 0; // diffs from an older generation are not available any more
+    ffrt::mutex mutex_;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_TREE_DIFF_TRACKER_H
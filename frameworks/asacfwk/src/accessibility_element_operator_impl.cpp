@@ -14,14 +14,32 @@
  */
 
 #include "accessibility_element_operator_impl.h"
+#include "accessibility_constants.h"
 #include "accessibility_element_operator.h"
 #include "accessibility_system_ability_client.h"
 #include "hilog_wrapper.h"
 #include <cinttypes>
 namespace OHOS {
 namespace Accessibility {
+namespace {
+    // the queries of a batch are sent to ACE with negative ids, the ids from AA are never negative
+    constexpr int32_t BATCH_QUERY_ID_MAX = -1;
+    constexpr int32_t BATCH_QUERY_ID_MIN = -0x0000FFFF;
+    constexpr uint32_t BATCH_QUERY_TIME_OUT = 5000; // ms, AA stops waiting for the batch after the same time
+    constexpr uint64_t US_PER_MS = 1000;
+    // the tree searches of the diffs take the ids below the batch queries
+    constexpr int32_t TREE_DIFF_QUERY_ID_MAX = -0x00010000;
+    constexpr int32_t TREE_DIFF_QUERY_ID_MIN = -0x0001FFFF;
+} // namespace
+
 std::unordered_map<int32_t,
     sptr<IAccessibilityElementOperatorCallback>> AccessibilityElementOperatorImpl::requests_ = {};
+std::unordered_map<int32_t, AccessibilityElementOperatorImpl::BatchQuery>
+    AccessibilityElementOperatorImpl::batchQueries_ = {};
+int32_t AccessibilityElementOperatorImpl::batchQueryId_ = BATCH_QUERY_ID_MAX;
+std::unordered_map<int32_t, AccessibilityElementOperatorImpl::TreeDiffQuery>
+    AccessibilityElementOperatorImpl::treeDiffQueries_ = {};
+int32_t AccessibilityElementOperatorImpl::treeDiffQueryId_ = TREE_DIFF_QUERY_ID_MAX;
 ffrt::mutex AccessibilityElementOperatorImpl::requestsMutex_;
 
 AccessibilityElementOperatorImpl::AccessibilityElementOperatorImpl(int32_t windowId,
@@ -35,6 +53,11 @@ AccessibilityElementOperatorImpl::AccessibilityElementOperatorImpl(int32_t windo
 AccessibilityElementOperatorImpl::~AccessibilityElementOperatorImpl()
 {
     HILOG_DEBUG();
+    std::lock_guard<ffrt::mutex> lock(grantsMutex_);
+    for (auto &[grantId, granted] : grants_) {
+        granted->Revoke();
+    }
+    grants_.clear();
 }
 
 RetError AccessibilityElementOperatorImpl::SearchElementInfoByAccessibilityId(const int64_t elementId,
@@ -525,5 +548,411 @@ void AccessibilityElementOperatorImpl::SetRemoveAccessibilityVirtualNodeResult(c
         HILOG_DEBUG("Can't find the callback [requestId:%{public}d]", requestId);
     }
 }
+
+void AccessibilityElementOperatorImpl::SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter)
+{
+    HILOG_DEBUG("requestId[%{public}d], query count[%{public}zu]", requestId, queries.size());
+    if (callback == nullptr) {
+        HILOG_ERROR("callback is nullptr");
+        return;
+    }
+    callback->SetIsFilter(isFilter);
+    auto batch = std::make_shared<BatchSearch>();
+    batch->requestId = requestId;
+    batch->callback = callback;
+    batch->results.resize(queries.size());
+    batch->pendingCount = queries.size();
+    std::vector<int32_t> queryIds;
+    {
+        std::lock_guard<ffrt::mutex> lock(requestsMutex_);
+        for (size_t index = 0; index < queries.size(); index++) {
+            // an id still in use after a whole round belongs to a query ACE never answered
+            batchQueryId_ = (batchQueryId_ <= BATCH_QUERY_ID_MIN) ? BATCH_QUERY_ID_MAX : batchQueryId_ - 1;
+            batchQueries_[batchQueryId_] = { batch, index };
+            queryIds.push_back(batchQueryId_);
+        }
+    }
+    if (queries.empty()) {
+        callback->SetSearchElementInfosBatchResult(batch->results, requestId);
+        return;
+    }
+
+    // a ui supporting batches runs all queries in one ui thread task against one tree. Otherwise the queries are
+    // sent one by one, each is one ui thread task and a frame may change the tree between two of them.
+    if (operator_ != nullptr && operator_->SearchElementInfosBatch(queries, queryIds, operatorCallback_)) {
+        ExpireBatchQueriesLater(batch, queryIds);
+        return;
+    }
+    for (size_t index = 0; index < queries.size(); index++) {
+        const ElementSearchQuery &query = queries[index];
+        RetError ret = RET_OK;
+        if (operator_ == nullptr) {
+            ret = RET_ERR_NULLPTR;
+        } else if (query.type == ElementSearchType::BY_ACCESSIBILITY_ID) {
+            ret = operator_->SearchElementInfoByAccessibilityId(query.elementId, queryIds[index], operatorCallback_,
+                query.mode);
+        } else if (query.type == ElementSearchType::BY_TEXT) {
+            operator_->SearchElementInfosByText(query.elementId, query.text, queryIds[index], operatorCallback_);
+        } else if (query.type == ElementSearchType::BY_SPECIFIC_PROPERTY) {
+            operator_->SearchElementInfoBySpecificProperty(query.elementId, query.param, queryIds[index],
+                operatorCallback_);
+        } else {
+            ret = RET_ERR_INVALID_PARAM;
+        }
+        if (ret == RET_OK) {
+            continue;
+        }
+        HILOG_ERROR("query %{public}zu of requestId[%{public}d] failed, ret %{public}d", index, requestId, ret);
+        std::shared_ptr<BatchSearch> completed = CompleteBatchQuery(queryIds[index], ret, {}, {});
+        if (completed != nullptr) {
+            completed->callback->SetSearchElementInfosBatchResult(completed->results, completed->requestId);
+        }
+    }
+
+    ExpireBatchQueriesLater(batch, queryIds);
+}
+
+void AccessibilityElementOperatorImpl::ExpireBatchQueriesLater(const std::shared_ptr<BatchSearch> &batch,
+    const std::vector<int32_t> &queryIds)
+{
+    // the queries ACE never answers are dropped once AA has given up on the batch
+    std::weak_ptr<BatchSearch> weakBatch = batch;
+    ffrt::submit([weakBatch, queryIds]() { ExpireBatchQueries(weakBatch, queryIds); }, {}, {},
+        ffrt::task_attr().delay(BATCH_QUERY_TIME_OUT * US_PER_MS));
+}
+
+void AccessibilityElementOperatorImpl::ExpireBatchQueries(const std::weak_ptr<BatchSearch> &weakBatch,
+    const std::vector<int32_t> &queryIds)
+{
+    std::shared_ptr<BatchSearch> batch = weakBatch.lock();
+    if (batch == nullptr) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(requestsMutex_);
+    size_t expiredCount = 0;
+    for (int32_t queryId : queryIds) {
+        // the id may already be reused by a later batch
+        auto iter = batchQueries_.find(queryId);
+        if (iter == batchQueries_.end() || iter->second.batch != batch) {
+            continue;
+        }
+        batchQueries_.erase(iter);
+        expiredCount++;
+    }
+    if (expiredCount != 0) {
+        HILOG_WARN("requestId[%{public}d] expired %{public}zu unanswered queries", batch->requestId, expiredCount);
+    }
+}
+
+bool AccessibilityElementOperatorImpl::SetBatchQueryResult(const int32_t queryId,
+    const std::list<AccessibilityElementInfo> &infos, const std::list<AccessibilityElementInfo> &treeInfos,
+    int32_t &requestId)
+{
+    if (queryId > BATCH_QUERY_ID_MAX || queryId < BATCH_QUERY_ID_MIN) {
+        return false;
+    }
+    std::shared_ptr<BatchSearch> completed = CompleteBatchQuery(queryId, RET_OK, infos, treeInfos);
+    if (completed != nullptr) {
+        requestId = completed->requestId;
+        completed->callback->SetSearchElementInfosBatchResult(completed->results, completed->requestId);
+    }
+    return true;
+}
+
+std::shared_ptr<AccessibilityElementOperatorImpl::BatchSearch> AccessibilityElementOperatorImpl::CompleteBatchQuery(
+    const int32_t queryId, const RetError ret, const std::list<AccessibilityElementInfo> &infos,
+    const std::list<AccessibilityElementInfo> &treeInfos)
+{
+    std::lock_guard<ffrt::mutex> lock(requestsMutex_);
+    auto iter = batchQueries_.find(queryId);
+    if (iter == batchQueries_.end()) {
+        HILOG_DEBUG("Can't find the batch [queryId:%{public}d]", queryId);
+        return nullptr;
+    }
+    std::shared_ptr<BatchSearch> batch = iter->second.batch;
+    ElementSearchResult &result = batch->results[iter->second.index];
+    batchQueries_.erase(iter);
+    result.ret = ret;
+    result.infos.assign(infos.begin(), infos.end());
+    result.treeInfos.assign(treeInfos.begin(), treeInfos.end());
+    if (batch->callback->GetFilter()) {
+        SetFiltering(result.infos);
+    }
+    if (--batch->pendingCount != 0) {
+        return nullptr;
+    }
+    return batch;
+}
+
+RetError AccessibilityElementOperatorImpl::GrantElementOperator(const int32_t grantId,
+    sptr<IRemoteObject> &grantedOperator)
+{
+    HILOG_INFO("windowId[%{public}d] grant[%{public}d]", windowId_, grantId);
+    sptr<AccessibilityGrantedElementOperator> granted =
+        new(std::nothrow) AccessibilityGrantedElementOperator(wptr<AccessibilityElementOperatorImpl>(this));
+    if (granted == nullptr) {
+        HILOG_ERROR("create granted operator failed");
+        return RET_ERR_NULLPTR;
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(grantsMutex_);
+        auto iter = grants_.find(grantId);
+        if (iter != grants_.end()) {
+            iter->second->Revoke();
+        }
+        grants_[grantId] = granted;
+    }
+    grantedOperator = granted->AsObject();
+    return RET_OK;
+}
+
+void AccessibilityElementOperatorImpl::RevokeElementOperator(const int32_t grantId)
+{
+    HILOG_INFO("windowId[%{public}d] grant[%{public}d]", windowId_, grantId);
+    std::lock_guard<ffrt::mutex> lock(grantsMutex_);
+    auto iter = grants_.find(grantId);
+    if (iter == grants_.end()) {
+        return;
+    }
+    iter->second->Revoke();
+    grants_.erase(iter);
+}
+
+void AccessibilityElementOperatorImpl::SearchElementTreeDiff(const uint64_t sinceGeneration,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_DEBUG("requestId[%{public}d], sinceGeneration[%{public}" PRIu64 "]", requestId, sinceGeneration);
+    if (callback == nullptr) {
+        HILOG_ERROR("callback is nullptr");
+        return;
+    }
+    int32_t queryId = TREE_DIFF_QUERY_ID_MAX;
+    {
+        std::lock_guard<ffrt::mutex> lock(requestsMutex_);
+        treeDiffQueryId_ = (treeDiffQueryId_ <= TREE_DIFF_QUERY_ID_MIN) ? TREE_DIFF_QUERY_ID_MAX :
+            treeDiffQueryId_ - 1;
+        queryId = treeDiffQueryId_;
+        treeDiffQueries_[queryId] = { wptr<AccessibilityElementOperatorImpl>(this), sinceGeneration, requestId,
+            callback };
+    }
+
+    // the whole tree is searched inside this process, only the diff against the last tree crosses to AA
+    RetError ret = RET_ERR_NULLPTR;
+    if (operator_ != nullptr) {
+        ret = operator_->SearchElementInfoByAccessibilityId(ROOT_NODE_ID, queryId, operatorCallback_,
+            PREFETCH_RECURSIVE_CHILDREN);
+    }
+    if (ret == RET_OK) {
+        ExpireTreeDiffQueryLater(queryId, requestId);
+        return;
+    }
+    HILOG_ERROR("search tree of requestId[%{public}d] failed, ret %{public}d", requestId, ret);
+    {
+        std::lock_guard<ffrt::mutex> lock(requestsMutex_);
+        treeDiffQueries_.erase(queryId);
+    }
+    callback->SetSearchElementTreeDiffResult(ElementTreeDiff(), requestId);
+}
+
+void AccessibilityElementOperatorImpl::ExpireTreeDiffQueryLater(const int32_t queryId, const int32_t requestId)
+{
+    // a search ACE never answers is dropped once AA has given up on the diff
+    ffrt::submit([queryId, requestId]() {
+        std::lock_guard<ffrt::mutex> lock(requestsMutex_);
+        auto iter = treeDiffQueries_.find(queryId);
+        // the id may already be reused by a later diff
+        if (iter != treeDiffQueries_.end() && iter->second.requestId == requestId) {
+            HILOG_WARN("requestId[%{public}d] expired the unanswered tree search", requestId);
+            treeDiffQueries_.erase(iter);
+        }
+        }, {}, {}, ffrt::task_attr().delay(BATCH_QUERY_TIME_OUT * US_PER_MS));
+}
+
+bool AccessibilityElementOperatorImpl::SetTreeDiffQueryResult(const int32_t queryId,
+    const std::list<AccessibilityElementInfo> &infos, int32_t &requestId)
+{
+    if (queryId > TREE_DIFF_QUERY_ID_MAX || queryId < TREE_DIFF_QUERY_ID_MIN) {
+        return false;
+    }
+    TreeDiffQuery query;
+    {
+        std::lock_guard<ffrt::mutex> lock(requestsMutex_);
+        auto iter = treeDiffQueries_.find(queryId);
+        if (iter == treeDiffQueries_.end()) {
+            HILOG_DEBUG("Can't find the tree diff [queryId:%{public}d]", queryId);
+            return true;
+        }
+        query = iter->second;
+        treeDiffQueries_.erase(iter);
+    }
+    ElementTreeDiff diff;
+    sptr<AccessibilityElementOperatorImpl> elementOperator = query.elementOperator.promote();
+    if (elementOperator != nullptr) {
+        elementOperator->treeDiffTracker_.ApplyTree(TranslateListToVector(infos));
+        elementOperator->treeDiffTracker_.GetDiff(query.sinceGeneration, diff);
+    }
+    HILOG_DEBUG("requestId[%{public}d] generation[%{public}" PRIu64 "] full[%{public}d] added[%{public}zu] "
+        "changed[%{public}zu] removed[%{public}zu]", query.requestId, diff.generation, diff.isFullSnapshot,
+        diff.addedNodes.size(), diff.changedNodes.size(), diff.removedNodeIds.size());
+    requestId = query.requestId;
+    query.callback->SetSearchElementTreeDiffResult(diff, query.requestId);
+    return true;
+}
+
+AccessibilityGrantedElementOperator::AccessibilityGrantedElementOperator(
+    const wptr<AccessibilityElementOperatorImpl> &grantor) : grantor_(grantor)
+{
+    HILOG_DEBUG();
+}
+
+void AccessibilityGrantedElementOperator::Revoke()
+{
+    revoked_.store(true);
+}
+
+RetError AccessibilityGrantedElementOperator::SearchElementInfoByAccessibilityId(const int64_t elementId,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback, const int32_t mode,
+    bool isFilter)
+{
+    if (revoked_.load()) {
+        HILOG_WARN("the operator is revoked, requestId[%{public}d]", requestId);
+        return RET_ERR_NO_WINDOW_CONNECTION;
+    }
+    // the subtree walks and the source lookup stay with AAMS, which times them apart and checks the caller
+    if (mode == PREFETCH_RECURSIVE_CHILDREN || mode == PREFETCH_RECURSIVE_CHILDREN_REDUCED ||
+        mode == GET_SOURCE_MODE) {
+        HILOG_WARN("mode[%{public}d] is not granted", mode);
+        return RET_ERR_NO_PERMISSION;
+    }
+    sptr<AccessibilityElementOperatorImpl> grantor = grantor_.promote();
+    if (grantor == nullptr || callback == nullptr) {
+        HILOG_ERROR("grantor exist: %{public}d, callback exist: %{public}d", grantor != nullptr, callback != nullptr);
+        return RET_ERR_NULLPTR;
+    }
+    return grantor->SearchElementInfoByAccessibilityId(elementId, requestId, callback, mode, isFilter);
+}
+
+void AccessibilityGrantedElementOperator::SearchDefaultFocusedByWindowId(const int32_t windowId,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback, const int32_t mode,
+    bool isFilter)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
+
+void AccessibilityGrantedElementOperator::SearchElementInfosByText(const int64_t elementId,
+    const std::string &text, const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
+
+void AccessibilityGrantedElementOperator::FindFocusedElementInfo(const int64_t elementId,
+    const int32_t focusType, const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
+
+void AccessibilityGrantedElementOperator::FocusMoveSearch(const int64_t elementId,
+    const int32_t direction, const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
+
+void AccessibilityGrantedElementOperator::ExecuteAction(const int64_t elementId,
+    const int32_t action, const std::map<std::string, std::string> &actionArguments,
+    int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
+
+void AccessibilityGrantedElementOperator::GetCursorPosition(const int64_t elementId,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
+
+void AccessibilityGrantedElementOperator::ClearFocus()
+{
+    HILOG_WARN("not granted");
+}
+
+void AccessibilityGrantedElementOperator::OutsideTouch()
+{
+    HILOG_WARN("not granted");
+}
+
+void AccessibilityGrantedElementOperator::SetChildTreeIdAndWinId(const int64_t elementId,
+    const int32_t childTreeId, const int32_t childWindowId)
+{
+    HILOG_WARN("not granted");
+}
+
+void AccessibilityGrantedElementOperator::SetBelongTreeId(const int32_t treeId)
+{
+    HILOG_WARN("not granted");
+}
+
+void AccessibilityGrantedElementOperator::SetParentWindowId(const int32_t parentWindowId)
+{
+    HILOG_WARN("not granted");
+}
+
+void AccessibilityGrantedElementOperator::SearchElementInfoBySpecificProperty(const int64_t elementId,
+    const SpecificPropertyParam& param, const int32_t requestId,
+    const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
+
+void AccessibilityGrantedElementOperator::FocusMoveSearchWithCondition(const AccessibilityElementInfo &info,
+    const AccessibilityFocusMoveParam &param, const int32_t requestId,
+    const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
+
+void AccessibilityGrantedElementOperator::UpdateCustomAccessibilityProperty(const int64_t elementId,
+    const AccessibilityVirtualNode& accessibilityVirtualNode, const int32_t requestId,
+    const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
+
+void AccessibilityGrantedElementOperator::AddAccessibilityVirtualNode(const int64_t rootId,
+    const std::vector<AccessibilityVirtualNode> &nodes, const int32_t requestId,
+    const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
+
+void AccessibilityGrantedElementOperator::RemoveAccessibilityVirtualNode(const int64_t id,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
+
+void AccessibilityGrantedElementOperator::SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
+
+RetError AccessibilityGrantedElementOperator::GrantElementOperator(const int32_t grantId,
+    sptr<IRemoteObject> &grantedOperator)
+{
+    HILOG_WARN("not granted, grant[%{public}d]", grantId);
+    return RET_ERR_NO_PERMISSION;
+}
+
+void AccessibilityGrantedElementOperator::RevokeElementOperator(const int32_t grantId)
+{
+    HILOG_WARN("not granted, grant[%{public}d]", grantId);
+}
+
+void AccessibilityGrantedElementOperator::SearchElementTreeDiff(const uint64_t sinceGeneration,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_WARN("not granted, requestId[%{public}d]", requestId);
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
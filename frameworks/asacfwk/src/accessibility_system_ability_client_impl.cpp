@@ -890,6 +890,9 @@ void AccessibilitySystemAbilityClientImpl::SetSearchElementInfoByAccessibilityId
     const std::list<AccessibilityElementInfo> &infos, const int32_t requestId)
 {
     HILOG_DEBUG("search element requestId[%{public}d]", requestId);
+    if (SetBatchQueryResult(infos, {}, requestId) || SetTreeDiffQueryResult(infos, requestId)) {
+        return;
+    }
     if (requestId < 0) {
         HILOG_ERROR("requestId is invalid");
         return;
@@ -954,6 +957,9 @@ void AccessibilitySystemAbilityClientImpl::SetSearchElementInfoByTextResult(
     const std::list<AccessibilityElementInfo> &infos, const int32_t requestId)
 {
     HILOG_DEBUG("requestId[%{public}d]", requestId);
+    if (SetBatchQueryResult(infos, {}, requestId)) {
+        return;
+    }
     if (requestId < 0) {
         return;
     }
@@ -1181,6 +1187,9 @@ void AccessibilitySystemAbilityClientImpl::SetSearchElementInfoBySpecificPropert
     const int32_t requestId)
 {
     HILOG_DEBUG("search element requestId[%{public}d]", requestId);
+    if (SetBatchQueryResult(infos, treeInfos, requestId)) {
+        return;
+    }
     if (requestId < 0) {
         HILOG_ERROR("requestId is invalid");
         return;
@@ -1209,6 +1218,48 @@ void AccessibilitySystemAbilityClientImpl::SetSearchElementInfoBySpecificPropert
     }
 }
 
+bool AccessibilitySystemAbilityClientImpl::SetBatchQueryResult(const std::list<AccessibilityElementInfo> &infos,
+    const std::list<AccessibilityElementInfo> &treeInfos, const int32_t requestId)
+{
+    int32_t batchRequestId = -1;
+    if (!AccessibilityElementOperatorImpl::SetBatchQueryResult(requestId, infos, treeInfos, batchRequestId)) {
+        return false;
+    }
+    if (batchRequestId < 0) {
+        return true;
+    }
+    sptr<IAccessibleAbilityManagerService> serviceProxy;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        serviceProxy = serviceProxy_;
+    }
+    if (serviceProxy != nullptr) {
+        serviceProxy->RemoveRequestId(batchRequestId);
+    }
+    return true;
+}
+
+bool AccessibilitySystemAbilityClientImpl::SetTreeDiffQueryResult(const std::list<AccessibilityElementInfo> &infos,
+    const int32_t requestId)
+{
+    int32_t diffRequestId = -1;
+    if (!AccessibilityElementOperatorImpl::SetTreeDiffQueryResult(requestId, infos, diffRequestId)) {
+        return false;
+    }
+    if (diffRequestId < 0) {
+        return true;
+    }
+    sptr<IAccessibleAbilityManagerService> serviceProxy;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        serviceProxy = serviceProxy_;
+    }
+    if (serviceProxy != nullptr) {
+        serviceProxy->RemoveRequestId(diffRequestId);
+    }
+    return true;
+}
+
 RetError AccessibilitySystemAbilityClientImpl::SearchNeedEvents(std::vector<uint32_t> &needEvents)
 {
     HILOG_DEBUG();
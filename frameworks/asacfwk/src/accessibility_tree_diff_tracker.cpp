@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_tree_diff_tracker.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <functional>
+#include <limits>
+#include <set>
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr size_t MAX_REMOVED_NODE_COUNT = 4096;
+    constexpr size_t HASH_COMBINE_SEED = 0x9e3779b9;
+    constexpr uint32_t HASH_COMBINE_LEFT_SHIFT = 6;
+    constexpr uint32_t HASH_COMBINE_RIGHT_SHIFT = 2;
+
+    template<typename T>
+    void HashCombine(size_t &seed, const T &value)
+    {
+        seed ^= std::hash<T>()(value) + HASH_COMBINE_SEED + (seed << HASH_COMBINE_LEFT_SHIFT) +
+            (seed >> HASH_COMBINE_RIGHT_SHIFT);
+    }
+} // namespace
+
+void AccessibilityTreeDiffTracker::ApplyTree(const std::vector<AccessibilityElementInfo> &elementInfos)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    uint64_t nextGeneration = generation_ + 1;
+    bool changed = false;
+    std::set<int64_t> newIds;
+    for (auto &info : elementInfos) {
+        int64_t elementId = info.GetAccessibilityId();
+        newIds.insert(elementId);
+        size_t fingerprint = GetFingerprint(info);
+        auto nodeIter = nodes_.find(elementId);
+        if (nodeIter == nodes_.end()) {
+            nodes_.emplace(elementId, NodeRecord { info, fingerprint, nextGeneration, nextGeneration });
+            removedNodes_.erase(elementId);
+            changed = true;
+        } else if (nodeIter->second.fingerprint != fingerprint) {
+            nodeIter->second.info = info;
+            nodeIter->second.fingerprint = fingerprint;
+            nodeIter->second.changedGeneration = nextGeneration;
+            changed = true;
+        }
+    }
+    for (auto nodeIter = nodes_.begin(); nodeIter != nodes_.end();) {
+        if (newIds.find(nodeIter->first) != newIds.end()) {
+            ++nodeIter;
+            continue;
+        }
+        removedNodes_[nodeIter->first] = nextGeneration;
+        nodeIter = nodes_.erase(nodeIter);
+        changed = true;
+    }
+    // the first tree is generation 1 even if it is empty, 0 stays the generation of an ability knowing nothing
+    if (changed || generation_ == 0) {
+        generation_ = nextGeneration;
+        PruneRemovedNodes();
+    }
+    HILOG_DEBUG("fetched[%{public}zu] generation[%{public}" PRIu64 "]", elementInfos.size(), generation_);
+}
+
+void AccessibilityTreeDiffTracker::GetDiff(const uint64_t sinceGeneration, ElementTreeDiff &diff)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    diff = ElementTreeDiff();
+    diff.generation = generation_;
+    if (sinceGeneration == 0 || sinceGeneration < oldestGeneration_ || sinceGeneration > generation_) {
+        diff.isFullSnapshot = true;
+        for (auto &node : nodes_) {
+            diff.addedNodes.push_back(node.second.info);
+        }
+        return;
+    }
+    for (auto &node : nodes_) {
+        if (node.second.addedGeneration > sinceGeneration) {
+            diff.addedNodes.push_back(node.second.info);
+        } else if (node.second.changedGeneration > sinceGeneration) {
+            diff.changedNodes.push_back(node.second.info);
+        }
+    }
+    for (auto &removed : removedNodes_) {
+        if (removed.second > sinceGeneration) {
+            diff.removedNodeIds.push_back(removed.first);
+        }
+    }
+}
+
+size_t AccessibilityTreeDiffTracker::GetFingerprint(const AccessibilityElementInfo &info)
+{
+    // the properties a screen reader reads, a change of any other one is not worth a delta entry
+    size_t seed = 0;
+    HashCombine(seed, info.GetParentNodeId());
+    for (int64_t childId : info.GetChildIds()) {
+        HashCombine(seed, childId);
+    }
+    HashCombine(seed, info.GetComponentType());
+    HashCombine(seed, info.GetContent());
+    HashCombine(seed, info.GetHint());
+    HashCombine(seed, info.GetDescriptionInfo());
+    HashCombine(seed, info.GetAccessibilityText());
+    HashCombine(seed, info.GetError());
+    const Rect &bounds = info.GetRectInScreen();
+    HashCombine(seed, bounds.GetLeftTopXScreenPostion());
+    HashCombine(seed, bounds.GetLeftTopYScreenPostion());
+    HashCombine(seed, bounds.GetRightBottomXScreenPostion());
+    HashCombine(seed, bounds.GetRightBottomYScreenPostion());
+    for (auto &action : info.GetActionList()) {
+        HashCombine(seed, static_cast<int32_t>(action.GetActionType()));
+    }
+    const bool flags[] = { info.IsCheckable(), info.IsChecked(), info.IsFocusable(), info.IsFocused(),
+        info.IsVisible(), info.HasAccessibilityFocus(), info.IsSelected(), info.IsClickable(),
+        info.IsLongClickable(), info.IsEnabled(), info.IsScrollable(), info.IsEditable() };
+    for (bool flag : flags) {
+        HashCombine(seed, flag);
+    }
+    HashCombine(seed, info.GetSelectedBegin());
+    HashCombine(seed, info.GetSelectedEnd());
+    HashCombine(seed, info.GetCurrentIndex());
+    HashCombine(seed, info.GetBeginIndex());
+    HashCombine(seed, info.GetEndIndex());
+    HashCombine(seed, info.GetRange().GetCurrent());
+    return seed;
+}
+
+void AccessibilityTreeDiffTracker::PruneRemovedNodes()
+{
+    while (removedNodes_.size() > MAX_REMOVED_NODE_COUNT) {
+        uint64_t oldestGeneration = std::numeric_limits<uint64_t>::max();
+        for (auto &removed : removedNodes_) {
+            oldestGeneration = std::min(oldestGeneration, removed.second);
+        }
+        for (auto iter = removedNodes_.begin(); iter != removedNodes_.end();) {
+            iter = (iter->second == oldestGeneration) ? removedNodes_.erase(iter) : std::next(iter);
+        }
+        // abilities older than this generation would miss the removals, they get a full snapshot instead
+        oldestGeneration_ = std::max(oldestGeneration_, oldestGeneration);
+    }
+}
+} // namespace Accessibility
+} // namespace OHOS
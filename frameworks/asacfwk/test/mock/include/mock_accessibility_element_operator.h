@@ -59,6 +59,8 @@ public:
         AccessibilityElementOperatorCallback &callback));
     MOCK_METHOD3(RemoveAccessibilityVirtualNode, void(const int64_t id, const int32_t requestId,
         AccessibilityElementOperatorCallback &callback));
+    MOCK_METHOD3(SearchElementInfosBatch, bool(const std::vector<ElementSearchQuery> &queries,
+        const std::vector<int32_t> &requestIds, AccessibilityElementOperatorCallback &callback));
 };
 } // namespace Accessibility
 } // namespace OHOS
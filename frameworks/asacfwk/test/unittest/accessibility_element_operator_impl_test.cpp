@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include "accessibility_constants.h"
 #include "accessibility_element_operator_callback_impl.h"
 #include "accessibility_system_ability_client_impl.h"
 #include "mock_accessibility_element_operator.h"
@@ -36,6 +37,22 @@ namespace {
     constexpr int32_t ACTION = 1;
     constexpr int32_t REQUEST_ID_MASK_BIT = 16;
     constexpr int32_t WINDOW_ID = 10;
+    constexpr int32_t BATCH_QUERY_COUNT = 2;
+    constexpr int32_t GRANT_ID = 1;
+    constexpr size_t TREE_NODE_COUNT = 3;
+
+    AccessibilityElementInfo CreateTreeNode(int64_t elementId, int64_t parentId, const std::vector<int64_t> &children,
+        const std::string &text)
+    {
+        AccessibilityElementInfo info;
+        info.SetAccessibilityId(elementId);
+        info.SetParent(parentId);
+        for (int64_t child : children) {
+            info.AddChild(child);
+        }
+        info.SetContent(text);
+        return info;
+    }
 } // namespace
 
 class AccessibilityElementOperatorImplUnitTest : public ::testing::Test {
@@ -823,5 +840,158 @@ HWTEST_F(AccessibilityElementOperatorImplUnitTest, SearchElementInfoBySpecificPr
     GTEST_LOG_(INFO) << "SearchElementInfoBySpecificProperty_004 end";
 }
 
+/**
+ * @tc.number: SearchElementInfosBatch_001
+ * @tc.name: SearchElementInfosBatch
+ * @tc.desc: Test a batch is handed to the ui in one call when the ui runs batches in one task
+ */
+HWTEST_F(AccessibilityElementOperatorImplUnitTest, SearchElementInfosBatch_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SearchElementInfosBatch_001 start";
+    ASSERT_TRUE(mockStub_ != nullptr);
+    std::vector<ElementSearchQuery> queries(BATCH_QUERY_COUNT);
+    sptr<MockAccessibilityElementOperatorCallbackImpl> elementOperator
+        = new(std::nothrow) MockAccessibilityElementOperatorCallbackImpl();
+    EXPECT_CALL(*operation_, SearchElementInfosBatch(_, _, _)).Times(1).WillOnce(Return(true));
+    EXPECT_CALL(*operation_, SearchElementInfoByAccessibilityId(_, _, _, _)).Times(0);
+    mockStub_->SearchElementInfosBatch(queries, REQUEST_ID, elementOperator, false);
+    GTEST_LOG_(INFO) << "SearchElementInfosBatch_001 end";
+}
+
+/**
+ * @tc.number: SearchElementInfosBatch_002
+ * @tc.name: SearchElementInfosBatch
+ * @tc.desc: Test the queries of a batch are sent one by one when the ui does not run batches
+ */
+HWTEST_F(AccessibilityElementOperatorImplUnitTest, SearchElementInfosBatch_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SearchElementInfosBatch_002 start";
+    ASSERT_TRUE(mockStub_ != nullptr);
+    std::vector<ElementSearchQuery> queries(BATCH_QUERY_COUNT);
+    sptr<MockAccessibilityElementOperatorCallbackImpl> elementOperator
+        = new(std::nothrow) MockAccessibilityElementOperatorCallbackImpl();
+    EXPECT_CALL(*operation_, SearchElementInfosBatch(_, _, _)).Times(1).WillOnce(Return(false));
+    EXPECT_CALL(*operation_, SearchElementInfoByAccessibilityId(_, _, _, _)).Times(BATCH_QUERY_COUNT);
+    mockStub_->SearchElementInfosBatch(queries, REQUEST_ID, elementOperator, false);
+    GTEST_LOG_(INFO) << "SearchElementInfosBatch_002 end";
+}
+
+/**
+ * @tc.number: GrantElementOperator_001
+ * @tc.name: GrantElementOperator
+ * @tc.desc: Test the granted operator forwards the node searches and refuses the subtree walks
+ */
+HWTEST_F(AccessibilityElementOperatorImplUnitTest, GrantElementOperator_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GrantElementOperator_001 start";
+    ASSERT_TRUE(mockStub_ != nullptr);
+    sptr<IRemoteObject> remote = nullptr;
+    EXPECT_EQ(mockStub_->GrantElementOperator(GRANT_ID, remote), RET_OK);
+    sptr<IAccessibilityElementOperator> grantedOperator = iface_cast<IAccessibilityElementOperator>(remote);
+    ASSERT_TRUE(grantedOperator != nullptr);
+    sptr<MockAccessibilityElementOperatorCallbackImpl> elementOperator
+        = new(std::nothrow) MockAccessibilityElementOperatorCallbackImpl();
+    EXPECT_CALL(*operation_, SearchElementInfoByAccessibilityId(_, _, _, _)).Times(1);
+    EXPECT_EQ(grantedOperator->SearchElementInfoByAccessibilityId(ELEMENT_ID, REQUEST_ID, elementOperator, MODE),
+        RET_OK);
+    EXPECT_EQ(grantedOperator->SearchElementInfoByAccessibilityId(ELEMENT_ID, REQUEST_ID_2, elementOperator,
+        PREFETCH_RECURSIVE_CHILDREN), RET_ERR_NO_PERMISSION);
+    GTEST_LOG_(INFO) << "GrantElementOperator_001 end";
+}
+
+/**
+ * @tc.number: RevokeElementOperator_001
+ * @tc.name: RevokeElementOperator
+ * @tc.desc: Test a revoked operator does not reach the ui any more
+ */
+HWTEST_F(AccessibilityElementOperatorImplUnitTest, RevokeElementOperator_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RevokeElementOperator_001 start";
+    ASSERT_TRUE(mockStub_ != nullptr);
+    sptr<IRemoteObject> remote = nullptr;
+    EXPECT_EQ(mockStub_->GrantElementOperator(GRANT_ID, remote), RET_OK);
+    sptr<IAccessibilityElementOperator> grantedOperator = iface_cast<IAccessibilityElementOperator>(remote);
+    ASSERT_TRUE(grantedOperator != nullptr);
+    mockStub_->RevokeElementOperator(GRANT_ID);
+    sptr<MockAccessibilityElementOperatorCallbackImpl> elementOperator
+        = new(std::nothrow) MockAccessibilityElementOperatorCallbackImpl();
+    EXPECT_CALL(*operation_, SearchElementInfoByAccessibilityId(_, _, _, _)).Times(0);
+    EXPECT_EQ(grantedOperator->SearchElementInfoByAccessibilityId(ELEMENT_ID, REQUEST_ID, elementOperator, MODE),
+        RET_ERR_NO_WINDOW_CONNECTION);
+    GTEST_LOG_(INFO) << "RevokeElementOperator_001 end";
+}
+
+/**
+ * @tc.number: SearchElementTreeDiff_001
+ * @tc.name: SearchElementTreeDiff
+ * @tc.desc: Test the operator sends the whole tree first and then only the nodes changed since that generation
+ */
+HWTEST_F(AccessibilityElementOperatorImplUnitTest, SearchElementTreeDiff_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SearchElementTreeDiff_001 start";
+    ASSERT_TRUE(mockStub_ != nullptr);
+    sptr<MockAccessibilityElementOperatorCallbackImpl> elementOperator
+        = new(std::nothrow) MockAccessibilityElementOperatorCallbackImpl();
+    int32_t queryId = 0;
+    ElementTreeDiff diff;
+    EXPECT_CALL(*operation_, SearchElementInfoByAccessibilityId(ROOT_NODE_ID, _, _, PREFETCH_RECURSIVE_CHILDREN))
+        .Times(2).WillRepeatedly(DoAll(SaveArg<1>(&queryId), Return(RET_OK)));
+    EXPECT_CALL(*elementOperator, SetSearchElementTreeDiffResult(_, REQUEST_ID)).Times(2)
+        .WillRepeatedly(SaveArg<0>(&diff));
+
+    // the ui answers the tree search inside the process, the diff is what AA gets
+    mockStub_->SearchElementTreeDiff(0, REQUEST_ID, elementOperator);
+    EXPECT_LT(queryId, 0);
+    int32_t requestId = -1;
+    EXPECT_TRUE(AccessibilityElementOperatorImpl::SetTreeDiffQueryResult(queryId, { CreateTreeNode(0, -1, { 1, 2 },
+        "root"), CreateTreeNode(1, 0, {}, "a"), CreateTreeNode(2, 0, {}, "b") }, requestId));
+    EXPECT_EQ(requestId, REQUEST_ID);
+    EXPECT_TRUE(diff.isFullSnapshot);
+    EXPECT_EQ(diff.addedNodes.size(), TREE_NODE_COUNT);
+    uint64_t generation = diff.generation;
+    EXPECT_GT(generation, 0);
+
+    // node 2 is replaced by node 3 and node 1 changes its text
+    mockStub_->SearchElementTreeDiff(generation, REQUEST_ID, elementOperator);
+    asac_->SetSearchElementInfoByAccessibilityIdResult({ CreateTreeNode(0, -1, { 1, 3 }, "root"),
+        CreateTreeNode(1, 0, {}, "c"), CreateTreeNode(3, 0, {}, "d") }, queryId);
+    EXPECT_FALSE(diff.isFullSnapshot);
+    EXPECT_GT(diff.generation, generation);
+    ASSERT_EQ(diff.addedNodes.size(), 1);
+    EXPECT_EQ(diff.addedNodes[0].GetAccessibilityId(), 3);
+    ASSERT_EQ(diff.changedNodes.size(), 2);
+    EXPECT_EQ(diff.changedNodes[0].GetAccessibilityId(), 0);
+    EXPECT_EQ(diff.changedNodes[1].GetAccessibilityId(), 1);
+    ASSERT_EQ(diff.removedNodeIds.size(), 1);
+    EXPECT_EQ(diff.removedNodeIds[0], 2);
+    GTEST_LOG_(INFO) << "SearchElementTreeDiff_001 end";
+}
+
+/**
+ * @tc.number: SearchElementTreeDiff_002
+ * @tc.name: SearchElementTreeDiff
+ * @tc.desc: Test a tree diff without a ui operator is answered with no generation
+ */
+HWTEST_F(AccessibilityElementOperatorImplUnitTest, SearchElementTreeDiff_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SearchElementTreeDiff_002 start";
+    ASSERT_TRUE(mockStubNullPtr_ != nullptr);
+    sptr<MockAccessibilityElementOperatorCallbackImpl> elementOperator
+        = new(std::nothrow) MockAccessibilityElementOperatorCallbackImpl();
+    ElementTreeDiff diff;
+    diff.generation = 1;
+    EXPECT_CALL(*elementOperator, SetSearchElementTreeDiffResult(_, REQUEST_ID)).Times(1)
+        .WillOnce(SaveArg<0>(&diff));
+    mockStubNullPtr_->SearchElementTreeDiff(0, REQUEST_ID, elementOperator);
+    EXPECT_EQ(diff.generation, 0);
+    EXPECT_TRUE(diff.addedNodes.empty());
+
+    // the ids from AA are never taken for a tree search
+    int32_t requestId = -1;
+    EXPECT_FALSE(AccessibilityElementOperatorImpl::SetTreeDiffQueryResult(REQUEST_ID, {}, requestId));
+    EXPECT_EQ(requestId, -1);
+    GTEST_LOG_(INFO) << "SearchElementTreeDiff_002 end";
+}
+
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -202,6 +202,18 @@ struct AniDisconnectCallback : public  DisconnectCallback {
     }
 };
 
+/**
+ * @brief The nodes of a window tree which changed after a generation the client already has.
+ */
+struct AccessibilityTreeDiff {
+    int32_t windowId = -1;
+    uint64_t generation = 0; // pass it back to get the next diff
+    bool isFullSnapshot = false; // addedNodes holds the whole tree, the client drops what it had
+    std::vector<AccessibilityElementInfo> addedNodes {};
+    std::vector<AccessibilityElementInfo> changedNodes {};
+    std::vector<int64_t> removedNodeIds {};
+};
+
 class AccessibleAbilityClient : public virtual RefBase {
 public:
     /**
@@ -555,6 +567,30 @@ public:
      */
     virtual RetError RemoveAccessibilityVirtualNode(const int64_t id, const int32_t windowId,
         OperateVirtualNodeResult &result) = 0;
+
+    /**
+     * @brief Start tracking the tree of a window, so GetTreeDiff only returns what changed.
+     * @param windowId The target window id.
+     * @return Return RET_OK if subscribes successfully, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError SubscribeTreeDiff(const int32_t windowId) = 0;
+
+    /**
+     * @brief Stop tracking the tree of a window.
+     * @param windowId The target window id.
+     * @return Return RET_OK if unsubscribes successfully, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError UnsubscribeTreeDiff(const int32_t windowId) = 0;
+
+    /**
+     * @brief Get the nodes added, changed and removed after a generation of a subscribed window.
+     * @param windowId The target window id.
+     * @param sinceGeneration The generation of the last diff the caller applied, 0 for a full snapshot.
+     * @param diff The nodes changed and the new generation.
+     * @return Return RET_OK if gets the diff successfully, otherwise refer to the RetError for the failure.
+     */
+    virtual RetError GetTreeDiff(const int32_t windowId, const uint64_t sinceGeneration,
+        AccessibilityTreeDiff &diff) = 0;
 };
 } // namespace Accessibility
 } // namespace OHOS
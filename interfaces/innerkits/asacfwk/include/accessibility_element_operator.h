@@ -211,6 +211,23 @@ public:
      */
     virtual void RemoveAccessibilityVirtualNode(const int64_t elementId, const int32_t requestId,
         AccessibilityElementOperatorCallback &callback) = 0;
+
+    /**
+     * @brief Run all queries of a batch in one ui thread task against one tree, no frame is laid out between them.
+     * @param queries The queries of the batch.
+     * @param requestIds The request id of each query, the result of a query is returned by the callback of its
+     *                   search type with its request id.
+     * @param callback To transfer the results to ASAC and it defined by ASAC.
+     * @return false if the ui does not run a batch in one task, ASAC then sends the queries one by one.
+     */
+    virtual bool SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries,
+        const std::vector<int32_t> &requestIds, AccessibilityElementOperatorCallback &callback)
+    {
+        (void)queries;
+        (void)requestIds;
+        (void)callback;
+        return false;
+    }
 };
 } // namespace Accessibility
 } // namespace OHOS
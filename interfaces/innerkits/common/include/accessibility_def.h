@@ -416,6 +416,25 @@ struct SpecificPropertyParam {
     SEARCH_TYPE propertyType;
 };
 
+enum class ElementSearchType : int32_t {
+    BY_ACCESSIBILITY_ID = 0,
+    BY_TEXT,
+    BY_SPECIFIC_PROPERTY,
+};
+
+constexpr size_t MAX_ELEMENT_SEARCH_QUERY_COUNT = 128;
+
+/**
+ * @brief One query of a batch search, all queries of a batch target the same window and tree.
+ */
+struct ElementSearchQuery {
+    ElementSearchType type = ElementSearchType::BY_ACCESSIBILITY_ID;
+    int64_t elementId = -1;
+    int32_t mode = 0; // prefetch mode of BY_ACCESSIBILITY_ID
+    std::string text = ""; // BY_TEXT
+    SpecificPropertyParam param = { "", SEARCH_TYPE::CUSTOMID }; // BY_SPECIFIC_PROPERTY
+};
+
 const std::map<std::string, EventType> EvtTypeTable = {
     {"accessibilityFocus", EventType::TYPE_VIEW_ACCESSIBILITY_FOCUSED_EVENT},
     {"accessibilityFocusClear", EventType::TYPE_VIEW_ACCESSIBILITY_FOCUS_CLEARED_EVENT},
@@ -16,8 +16,10 @@
 #define ACCESSIBILITY_ACCOUNT_DATA_H
 
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "accessibility_caption.h"
@@ -334,6 +336,12 @@ public:
     std::vector<uint32_t> GetNeedEvents();
     void isSendEvent(const AccessibilityEventInfo &eventInfo);
 
+    /**
+     * @brief Rebuild the event dispatch table from the connected abilities and their need events.
+     *        Called whenever the connected abilities or the need events change.
+     */
+    void RebuildEventDispatchTable();
+
     ElementOperatorManager& GetElementOperatorManager();
     AccessibleAbilityManager& GetAccessibleAbilityManager();
     AccessibilityWindowManager& GetWindowManager();
@@ -380,6 +388,20 @@ private:
     void InitScreenReaderStateObserver();
 
     void SetAccessibilityStateToTP(bool state);
+
+    /**
+     * @brief Immutable subscriber fan-out table consumed by isSendEvent. A new table is
+     *        published on each rebuild and the old one is released by its last reader.
+     */
+    struct EventDispatchTable {
+        // connections receiving every event type, used for types without a dedicated entry.
+        std::vector<sptr<AccessibleAbilityConnection>> allEventConnections;
+        // connections per configured event type, already merged with allEventConnections.
+        std::unordered_map<uint32_t, std::vector<sptr<AccessibleAbilityConnection>>> eventConnections;
+    };
+
+    // caller must hold abilityNeedEventsMutex_.
+    void RebuildEventDispatchTableLocked();
 private:
     class StateObservers {
     public:
@@ -419,6 +441,7 @@ private:
     int32_t displayId_ = 0;
     std::vector<sptr<IAccessibilityAppSeniorModeStateObserver>> seniorModeStateObservers_;
     ffrt::mutex seniorModeStateObserversMutex_;
+    std::shared_ptr<const EventDispatchTable> eventDispatchTable_ = nullptr; // accessed by std::atomic_load/store
 };
 
 class AccessibilityAccountDataMap {
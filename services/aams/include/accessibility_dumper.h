@@ -25,6 +25,7 @@ enum DumpType : uint32_t {
     DUMP_USER = 0,
     DUMP_CLIENT,
     DUMP_ACCESSIBILITY_WINDOW,
+    DUMP_STATISTICS,
     DUMP_NONE = 100,
 };
 class AccessibilityDumper : public RefBase {
@@ -37,6 +38,7 @@ private:
     int DumpAccessibilityClientInfo(std::string& dumpInfo) const;
     int DumpAccessibilityWindowInfo(std::string& dumpInfo) const;
     int DumpAccessibilityUserInfo(std::string& dumpInfo) const;
+    int DumpAccessibilityStatisticsInfo(std::string& dumpInfo) const;
     void ShowHelpInfo(std::string& dumpInfo) const;
     void ShowIllegalArgsInfo(std::string& dumpInfo) const;
 };
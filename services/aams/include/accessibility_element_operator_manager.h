@@ -19,8 +19,11 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <bitset>
+#include <tuple>
 
+#include "accessibility_request_table.h"
 #include "accessibility_window_connection.h"
 #include "iaccessibility_element_operator.h"
 #include "accessibility_ipc_types.h"
@@ -61,6 +64,7 @@ public:
         const sptr<AccessibilityWindowConnection> connection);
 
     void Clear();
+    void RevokeElementOperatorGrantsExcept(const std::set<std::string> &clientNames);
     RetError RegisterElementOperatorByWindowId(int32_t windowId,
         const sptr<IAccessibilityElementOperator> &elementOperator, uint32_t tokenId, bool isBroker,
         uint64_t displayId);
@@ -71,8 +75,11 @@ public:
     RetError SendEvent(const AccessibilityEventInfo &uiEvent, const int32_t flag, uint32_t tokenId);
 
     void AddRequestId(int32_t windowId, int32_t treeId, int32_t requestId,
-        sptr<IAccessibilityElementOperatorCallback> callback);
+        sptr<IAccessibilityElementOperatorCallback> callback,
+        AccessibilityIpcHealth::RequestKind kind = AccessibilityIpcHealth::RequestKind::NODE);
     void RemoveRequestId(int32_t requestId);
+    // fail the request if the window has not answered before its deadline
+    void OnRequestDeadline(int32_t requestId, int64_t startTime);
     void StopCallbackWait(int32_t windowId);
     void StopCallbackWait(int32_t windowId, int32_t treeId);
     bool GetParentElementRecursively(int32_t windowId, int64_t elementId, std::vector<AccessibilityElementInfo> &infos);
@@ -83,7 +90,33 @@ public:
     RetError VerifyingToKenId(const int32_t windowId, const int64_t elementId, uint32_t tokenId);
     bool CalculateClickPosition(const Rect &rect, int32_t &xPos, int32_t &yPos, int32_t &windowId);
 private:
-    bool InvalidHoverEnterEvent(AccessibilityEventInfo &event);
+    enum class HoverEnterCheckResult : uint8_t {
+        VALID = 0,
+        INVALID,
+        PENDING,
+    };
+    // windowId, treeId, elementId
+    using HoverEnterKey = std::tuple<int32_t, int32_t, int64_t>;
+    struct HoverEnterVerdict {
+        bool invalid = false;
+        bool changeToNewInfo = false;
+        AccessibilityElementInfo newElementInfo {};
+        int64_t expireTime = 0;
+    };
+    struct PendingHoverEnterEvent {
+        uint64_t sequence = 0;
+        AccessibilityEventInfo event {};
+    };
+
+    HoverEnterCheckResult CheckHoverEnterEvent(AccessibilityEventInfo &event);
+    bool GetHoverEnterVerdict(const HoverEnterKey &key, HoverEnterVerdict &verdict);
+    void OnHoverEnterSearchResult(int32_t windowId, uint64_t sequence, uint64_t contentGeneration,
+        const HoverEnterKey &key, const HoverEnterVerdict &verdict);
+    void OnHoverEnterSearchTimeout(int32_t windowId, uint64_t sequence);
+    void CancelHoverEnterTimeout(uint64_t sequence);
+    void InvalidateHoverEnterVerdicts(const AccessibilityEventInfo &event);
+    static bool ApplyHoverEnterVerdict(const HoverEnterVerdict &verdict, AccessibilityEventInfo &event);
+    void DeliverEvent(const AccessibilityEventInfo &event);
     bool InnerGetElementOperator(
         int32_t windowId, int64_t elementId, sptr<IAccessibilityElementOperator> &elementOperator);
     void OnFocusedEvent(const AccessibilityEventInfo &eventInfo);
@@ -96,6 +129,9 @@ private:
     sptr<AccessibilityWindowConnection> GetRealIdWindowConnection(
         int32_t windowId, int32_t focusType, uint64_t &displayId);
     bool GetMagnificationState();
+    void CancelRequests(const std::vector<std::pair<int32_t, AccessibilityRequestTable::Request>> &requests);
+    bool WaitForResult(const sptr<AccessibilityWindowConnection> &connection, ffrt::future<void> &future,
+        uint32_t timeout);
     bool FindFocusedElementByConnection(
         sptr<AccessibilityWindowConnection> connection, AccessibilityElementInfo &elementInfo, uint64_t displayId);
     bool GetWindowBounds(int32_t windowId, int32_t &leftTopX, int32_t &leftTopY,
@@ -107,9 +143,7 @@ private:
     int32_t accountId_ = 0;
     std::map<int32_t, sptr<AccessibilityWindowConnection>> asacConnections_;
     ffrt::mutex asacConnectionsMutex_;
-    ffrt::mutex requestIdmutex_; // current used for register state observer
-    std::map<int32_t, std::map<int32_t, std::set<int32_t>>> windowRequestIdMap_ {}; // windowId->treeId->requestId
-    std::map<int32_t, sptr<IAccessibilityElementOperatorCallback>> requestIdMap_ {}; // requestId->callback
+    AccessibilityRequestTable requestTable_ {}; // requestId->request, shared by the channel and binder threads
     wptr<AccessibilityAccountData> accountData_;
     std::atomic<int32_t> requestId_ = REQUEST_ID_MIN;
     std::atomic<int32_t> focusWindowId_ = -1;
@@ -118,6 +152,12 @@ private:
     std::bitset<TREE_ID_MAX> treeIdPool_;
     int32_t preTreeId_ = -1;
     ffrt::mutex treeIdPoolMutex_;
+
+    ffrt::mutex hoverEnterMutex_;
+    std::map<HoverEnterKey, HoverEnterVerdict> hoverEnterVerdicts_ {};
+    std::map<int32_t, PendingHoverEnterEvent> pendingHoverEnterEvents_ {}; // windowId->latest pending hover
+    std::map<int32_t, uint64_t> hoverContentGenerations_ {}; // windowId->content change count
+    uint64_t hoverEnterSequence_ = 0;
 };
 
 } // namespace Accessibility
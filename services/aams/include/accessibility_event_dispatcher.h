@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_EVENT_DISPATCHER_H
+#define ACCESSIBILITY_EVENT_DISPATCHER_H
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+
+#include "accessibility_def.h"
+#include "accessible_ability_manager_service_event_handler.h"
+#include "event_runner.h"
+#include "ffrt.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace Accessibility {
+class AccessibilityEventDispatcher {
+    DECLARE_SINGLETON(AccessibilityEventDispatcher)
+public:
+    // depth buckets: 1, 2-4, 5-16, 17-64, 65-256, >256
+    static constexpr size_t DEPTH_BUCKET_COUNT = 6;
+    // latency buckets: <1ms, <4ms, <16ms, <64ms, <256ms, >=256ms
+    static constexpr size_t LATENCY_BUCKET_COUNT = 6;
+
+    struct DispatchStats {
+        size_t depth = 0;
+        size_t peakDepth = 0;
+        uint64_t dispatchedCount = 0;
+        uint64_t droppedCount = 0;
+        uint64_t rejectedCount = 0;
+        std::array<uint64_t, DEPTH_BUCKET_COUNT> depthHistogram {};
+        std::array<uint64_t, LATENCY_BUCKET_COUNT> latencyHistogram {};
+    };
+
+    /**
+     * @brief Create the runner which sends the events.
+     * @return true if the runner is ready, otherwise false.
+     */
+    bool Init();
+
+    /**
+     * @brief Stop the runner and drop the events which are not sent yet.
+     */
+    void Clear();
+
+    /**
+     * @brief Queue an event task in the queue of its window, the tasks of a window run in FIFO order and the
+     *        windows take turns, so a flooding window only delays its own events.
+     * @param windowId The window the event belongs to.
+     * @param eventType The type of the event, decides whether it can be dropped under overload.
+     * @param task The task which sends the event.
+     * @return RET_OK if the task is queued, RET_ERR_NULLPTR if the dispatcher is not ready,
+     *         RET_ERR_FAILED if the task is dropped.
+     */
+    RetError Dispatch(int32_t windowId, EventType eventType, const std::function<void()> &task);
+
+    // the stats of all windows together
+    DispatchStats GetDispatchStats();
+
+    // windowId->stats, the windows with queued events and the latest idle ones
+    std::map<int32_t, DispatchStats> GetWindowDispatchStats();
+
+private:
+    struct PendingTask {
+        EventType eventType = TYPE_VIEW_INVALID;
+        int64_t enqueueTime = 0;
+        std::function<void()> task = nullptr;
+    };
+
+    struct WindowQueue {
+        std::deque<PendingTask> tasks {};
+        DispatchStats stats {};
+    };
+
+    static bool IsDroppableEvent(EventType eventType);
+    static size_t GetBucketIndex(uint64_t value, size_t bucketCount);
+    static int64_t GetSteadyTime();
+    static void RecordDepth(DispatchStats &stats, size_t depth);
+    bool DropDroppableTaskLocked(WindowQueue &windowQueue);
+    void RemoveIdleWindowsLocked(int32_t keptWindowId);
+    bool PopNextLocked(PendingTask &pending);
+    void Drain();
+
+    ffrt::mutex mutex_;
+    std::shared_ptr<AppExecFwk::EventRunner> runner_ = nullptr;
+    std::shared_ptr<AAMSEventHandler> handler_ = nullptr;
+    std::map<int32_t, WindowQueue> windowQueues_ {};
+    std::deque<int32_t> readyWindows_ {}; // the windows with queued tasks in the order they take turns
+    size_t depth_ = 0; // the tasks queued by all windows
+    bool isDraining_ = false;
+    DispatchStats stats_ {};
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_EVENT_DISPATCHER_H
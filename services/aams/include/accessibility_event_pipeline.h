@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_EVENT_PIPELINE_H
+#define ACCESSIBILITY_EVENT_PIPELINE_H
+
+#include <tuple>
+#include "accessibility_event_transmission.h"
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * @brief A chain of stages whose types are known at build time. Each stage is bound to the next one and
+ *        the last stage to the tail, so an event crossing the pipeline makes no virtual call and takes no
+ *        reference per hop. The pipeline is the header of the chain, DestroyEvents and OnMoveMouse still
+ *        walk it through the stage references.
+ */
+template<typename Tail, typename... Stages>
+class EventPipeline final : public EventTransmission {
+public:
+    static_assert(sizeof...(Stages) > 0, "a pipeline has at least one stage");
+    using First = typename std::tuple_element<0, std::tuple<Stages...>>::type;
+
+    EventPipeline(const sptr<Tail> &tail, const sptr<Stages> &...stages) : stages_(stages...)
+    {
+        Link<0>(tail);
+        SetNext(std::get<0>(stages_));
+    }
+    ~EventPipeline() = default;
+
+    bool OnKeyEvent(MMI::KeyEvent &event) override
+    {
+        return std::get<0>(stages_).GetRefPtr()->First::OnKeyEvent(event);
+    }
+
+    bool OnPointerEvent(MMI::PointerEvent &event) override
+    {
+        return std::get<0>(stages_).GetRefPtr()->First::OnPointerEvent(event);
+    }
+
+private:
+    template<size_t Index>
+    void Link(const sptr<Tail> &tail)
+    {
+        if constexpr (Index + 1 < sizeof...(Stages)) {
+            std::get<Index>(stages_)->BindNext(std::get<Index + 1>(stages_));
+            Link<Index + 1>(tail);
+        } else {
+            std::get<Index>(stages_)->BindNext(tail);
+        }
+    }
+
+    std::tuple<sptr<Stages>...> stages_;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_EVENT_PIPELINE_H
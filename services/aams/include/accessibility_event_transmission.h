@@ -17,6 +17,7 @@
 #define OHOS_EVENT_TRANSMISSION_H
 
 #include <cstdint>
+#include <type_traits>
 #include "accessibility_event_info.h"
 #include "key_event.h"
 #include "pointer_event.h"
@@ -34,8 +35,32 @@ public:
     void SetNext(const sptr<EventTransmission> &next);
     sptr<EventTransmission> GetNext();
     virtual void DestroyEvents();
+
+    /**
+     * @brief Link a next stage whose type is known at build time. The hop to it is a direct call of the
+     *        stage's own handler instead of a virtual call on a new reference. The stage is not relinked
+     *        after this, so its next_ keeps the next stage alive for the hop.
+     * @param next The next stage.
+     */
+    template<typename Next>
+    void BindNext(const sptr<Next> &next)
+    {
+        static_assert(std::is_base_of<EventTransmission, Next>::value, "the next stage is a transmission");
+        SetNext(next);
+        if (next == nullptr) {
+            return;
+        }
+        boundKeyHop_ = [](EventTransmission &stage, MMI::KeyEvent &event) {
+            return static_cast<Next &>(stage).Next::OnKeyEvent(event);
+        };
+        boundPointerHop_ = [](EventTransmission &stage, MMI::PointerEvent &event) {
+            return static_cast<Next &>(stage).Next::OnPointerEvent(event);
+        };
+    }
 private:
     sptr<EventTransmission> next_ = nullptr;
+    bool (*boundKeyHop_)(EventTransmission &stage, MMI::KeyEvent &event) = nullptr;
+    bool (*boundPointerHop_)(EventTransmission &stage, MMI::PointerEvent &event) = nullptr;
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -16,6 +16,7 @@
 #ifndef ACCESSIBILITY_INPUT_INTERCEPTOR_H
 #define ACCESSIBILITY_INPUT_INTERCEPTOR_H
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <vector>
@@ -116,13 +117,24 @@ public:
     }
 
 private:
+    /**
+     * @brief The transmitters of one set of features. A chain is not changed once published, the input events
+     *        run the chain they loaded without a lock.
+     */
+    struct TransmitterChain {
+        sptr<EventTransmission> pointerEventTransmitters = nullptr;
+        sptr<EventTransmission> keyEventTransmitters = nullptr;
+        sptr<EventTransmission> mouseKey = nullptr;
+    };
+
     AccessibilityInputInterceptor();
     static sptr<AccessibilityInputInterceptor> instance_;
     static ffrt::mutex instanceMutex_;
     void CreateTransmitters();
     void DestroyTransmitters();
-    void CreatePointerEventTransmitters();
-    void CreateKeyEventTransmitters();
+    void CreatePointerEventTransmitters(TransmitterChain &chain);
+    bool CreateCompiledPointerEventTransmitters(TransmitterChain &chain);
+    void CreateKeyEventTransmitters(TransmitterChain &chain);
     void SetNextEventTransmitter(sptr<EventTransmission> &header, sptr<EventTransmission> &current,
         const sptr<EventTransmission> &next);
     void UpdateInterceptor();
@@ -132,22 +144,21 @@ private:
     void ClearMagnificationGesture();
     void GetScreenShotUID();
 
-    sptr<EventTransmission> pointerEventTransmitters_ = nullptr;
-    sptr<EventTransmission> keyEventTransmitters_ = nullptr;
-    sptr<EventTransmission> mouseKey_ = nullptr;
+    std::shared_ptr<const TransmitterChain> transmitters_ = nullptr; // accessed by std::atomic_load/store
+    sptr<EventTransmission> mouseKey_ = nullptr; // kept across the chains while the feature is on
     uint32_t availableFunctions_ = 0;
     int32_t interceptorId_ = -1;
     MMI::InputManager *inputManager_ = nullptr;
     std::shared_ptr<AccessibilityInputEventConsumer> inputEventConsumer_ = nullptr;
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ = nullptr;
     std::shared_ptr<AppExecFwk::EventRunner> inputManagerRunner_;
-    ffrt::mutex mutex_;
+    ffrt::mutex mutex_; // serializes the updates of the transmitters and the interceptor
     ffrt::mutex eventHandlerMutex_;
 
     sptr<AccessibilityZoomGesture> zoomGesture_ = nullptr;
     bool needInteractMagnification_ = false;
     sptr<KeyEventFilter> keyEventFilter_ = nullptr;
-    int32_t screenShotUid_ = INVALID_UID;
+    std::atomic<int32_t> screenShotUid_ {INVALID_UID};
     sptr<AccessibilityScreenTouch> screenTouch_ = nullptr;
 };
 } // namespace Accessibility
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_IPC_HEALTH_H
+#define ACCESSIBILITY_IPC_HEALTH_H
+
+#include <array>
+#include <cstdint>
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * @brief Latency of the element operator requests sent to one window, the deadlines derived from it,
+ *        and a circuit breaker which makes the requests to an unresponsive window fail fast.
+ *        The requests which walk a subtree take far longer than the ones for a single node,
+ *        so each kind keeps its own latency and deadline.
+ */
+class AccessibilityIpcHealth {
+public:
+    enum class BreakerState : uint8_t {
+        CLOSED = 0,
+        OPEN, // requests fail fast until the cool-down ends
+        HALF_OPEN, // one probe per deadline is let through, its result closes or opens the breaker again
+    };
+
+    enum class RequestKind : uint8_t {
+        NODE = 0, // a node and its near relatives, a focus search or an action
+        TREE, // a recursive, text, specific property or batch search
+        KIND_COUNT,
+    };
+
+    struct Stats {
+        uint32_t ewmaMs = 0; // of the kind asked for
+        uint32_t p99Ms = 0;
+        uint32_t deadlineMs = 0;
+        uint64_t answeredCount = 0;
+        uint64_t timeoutCount = 0;
+        uint64_t fastFailCount = 0; // the breaker and below are shared by all kinds
+        uint32_t consecutiveTimeouts = 0;
+        BreakerState state = BreakerState::CLOSED;
+    };
+
+    static constexpr uint32_t MAX_DEADLINE_MS = 5000;
+    static constexpr uint32_t MIN_DEADLINE_MS = 500;
+    static constexpr uint32_t MIN_TREE_DEADLINE_MS = 2000;
+    static constexpr uint32_t TIMEOUT_THRESHOLD = 3; // consecutive timeouts which open the breaker
+    static constexpr int64_t DEFAULT_COOL_DOWN_MS = 10000;
+
+    explicit AccessibilityIpcHealth(int64_t coolDownMs = DEFAULT_COOL_DOWN_MS) : coolDownMs_(coolDownMs) {}
+    ~AccessibilityIpcHealth() = default;
+
+    /**
+     * @brief Check whether a request may be sent to the window.
+     * @return false while the breaker is open, the caller fails the request at once.
+     */
+    bool AllowRequest();
+
+    /**
+     * @brief Record the time the window took to answer a request, an answer closes the breaker.
+     * @param latencyMs The time from sending the request to receiving the result.
+     * @param kind The kind of the request.
+     */
+    void RecordLatency(const int64_t latencyMs, const RequestKind kind = RequestKind::NODE);
+
+    /**
+     * @brief Record a request which was not answered before the deadline of its kind.
+     *        Only the node requests count towards opening the breaker.
+     * @param kind The kind of the request.
+     */
+    void RecordTimeout(const RequestKind kind = RequestKind::NODE);
+
+    /**
+     * @brief Get how long to wait for the window, MAX_DEADLINE_MS until enough answers of the kind are recorded.
+     * @param kind The kind of the request.
+     * @return The deadline in milliseconds.
+     */
+    uint32_t GetDeadline(const RequestKind kind = RequestKind::NODE);
+
+    Stats GetStats(const RequestKind kind = RequestKind::NODE);
+    static const char *ToString(const BreakerState state);
+    static const char *ToString(const RequestKind kind);
+
+private:
+    static constexpr size_t SAMPLE_COUNT = 128;
+    static constexpr size_t MIN_SAMPLE_COUNT = 16;
+    static constexpr uint32_t EWMA_WEIGHT = 8; // the newest sample weighs 1/8
+    static constexpr uint32_t P99_FACTOR = 2;
+    static constexpr uint32_t EWMA_FACTOR = 4;
+
+    struct Latency {
+        std::array<uint32_t, SAMPLE_COUNT> samples {}; // ring of the latest latencies
+        size_t sampleCount = 0;
+        size_t nextSample = 0;
+        uint32_t ewmaMs = 0;
+        uint32_t p99Ms = 0;
+        uint32_t deadlineMs = MAX_DEADLINE_MS;
+        uint64_t answeredCount = 0;
+        uint64_t timeoutCount = 0;
+    };
+
+    Latency &GetLatency(const RequestKind kind);
+    static void AddSample(Latency &latency, const uint32_t latencyMs, const uint32_t minDeadlineMs);
+    static void UpdateDeadline(Latency &latency, const uint32_t minDeadlineMs);
+
+    int64_t coolDownMs_ = DEFAULT_COOL_DOWN_MS;
+    std::array<Latency, static_cast<size_t>(RequestKind::KIND_COUNT)> latencies_ {};
+    uint64_t fastFailCount_ = 0;
+    uint32_t consecutiveTimeouts_ = 0;
+    BreakerState state_ = BreakerState::CLOSED;
+    int64_t openUntil_ = 0;
+    int64_t probeTime_ = 0;
+    bool probeSent_ = false;
+    ffrt::mutex mutex_;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_IPC_HEALTH_H
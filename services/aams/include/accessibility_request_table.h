@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_REQUEST_TABLE_H
+#define ACCESSIBILITY_REQUEST_TABLE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "accessibility_ipc_health.h"
+#include "iaccessibility_element_operator_callback.h"
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * @brief Element operator requests waiting for the answer of a window, indexed by request id.
+ *        The slots are preallocated and claimed with a CAS on their tag. The inserts of the ids sharing a
+ *        home slot are serialized by a flag on that home slot, the lookups and removals take no lock.
+ */
+class AccessibilityRequestTable {
+public:
+    struct Request {
+        sptr<IAccessibilityElementOperatorCallback> callback = nullptr;
+        int32_t windowId = -1;
+        int32_t treeId = -1;
+        int64_t startTime = 0;
+        AccessibilityIpcHealth::RequestKind kind = AccessibilityIpcHealth::RequestKind::NODE;
+    };
+
+    static constexpr size_t SLOT_COUNT = 1024;
+    static constexpr size_t MAX_PROBE_COUNT = 64;
+    static constexpr int32_t ANY_TREE_ID = -1;
+
+    AccessibilityRequestTable() = default;
+    ~AccessibilityRequestTable() = default;
+
+    enum class InsertResult : int32_t {
+        INSERTED = 0,
+        REPLACED, // the request id was pending, the old request is removed
+        FULL,
+    };
+
+    /**
+     * @brief Add a pending request, a pending request with the same id is replaced.
+     * @param requestId The request id.
+     * @param request The request.
+     * @param replaced The replaced request, only set when REPLACED is returned.
+     * @return FULL if no free slot is found.
+     */
+    InsertResult Insert(const int32_t requestId, const Request &request, Request &replaced);
+
+    /**
+     * @brief Remove a pending request.
+     * @param requestId The request id.
+     * @param request The removed request.
+     * @param startTime Only remove the request sent at this time, 0 matches any request.
+     * @return false if no such request is pending.
+     */
+    bool Erase(const int32_t requestId, Request &request, const int64_t startTime = 0);
+
+    /**
+     * @brief Remove the pending requests sent to a window, used when the window or one of its trees dies.
+     * @param windowId The window id.
+     * @param treeId The tree id, ANY_TREE_ID removes the requests of all trees.
+     * @return The removed requests with their ids.
+     */
+    std::vector<std::pair<int32_t, Request>> EraseByWindow(const int32_t windowId,
+        const int32_t treeId = ANY_TREE_ID);
+
+    size_t GetSize() const;
+
+private:
+    enum SlotState : uint64_t {
+        FREE = 0,
+        BUSY, // claimed by one thread which writes or moves out the payload
+        READY,
+    };
+
+    // state | generation | request id, the generation changes whenever the slot is claimed again
+    static constexpr uint32_t STATE_SHIFT = 62;
+    static constexpr uint32_t GENERATION_SHIFT = 32;
+    static constexpr uint64_t GENERATION_MASK = (1ULL << (STATE_SHIFT - GENERATION_SHIFT)) - 1;
+
+    struct Slot {
+        std::atomic<uint64_t> tag {0};
+        // read before the slot is claimed, a stale value is caught by the generation in the tag
+        std::atomic<int32_t> windowId {-1};
+        std::atomic<int32_t> treeId {-1};
+        std::atomic<int64_t> startTime {0};
+        sptr<IAccessibilityElementOperatorCallback> callback = nullptr; // only touched while BUSY
+        AccessibilityIpcHealth::RequestKind kind = AccessibilityIpcHealth::RequestKind::NODE; // as callback
+    };
+
+    static uint64_t MakeTag(const uint64_t state, const uint64_t generation, const int32_t requestId)
+    {
+        return (state << STATE_SHIFT) | ((generation & GENERATION_MASK) << GENERATION_SHIFT) |
+            static_cast<uint32_t>(requestId);
+    }
+    static uint64_t GetState(const uint64_t tag)
+    {
+        return tag >> STATE_SHIFT;
+    }
+    static uint64_t GetGeneration(const uint64_t tag)
+    {
+        return (tag >> GENERATION_SHIFT) & GENERATION_MASK;
+    }
+    static int32_t GetRequestId(const uint64_t tag)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(tag));
+    }
+    static size_t GetSlotIndex(const int32_t requestId, const size_t probe)
+    {
+        return (static_cast<uint32_t>(requestId) + probe) % SLOT_COUNT;
+    }
+
+    bool ClaimFreeSlot(const int32_t requestId, const Request &request);
+    bool TakeSlot(Slot &slot, const uint64_t tag, const int32_t requestId, Request &request);
+
+    std::array<Slot, SLOT_COUNT> slots_ {};
+    // set while an id of this home slot is inserted, so an id is never pending in two slots
+    std::array<std::atomic<bool>, SLOT_COUNT> homeClaims_ {};
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_REQUEST_TABLE_H
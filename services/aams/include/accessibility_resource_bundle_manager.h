@@ -15,6 +15,11 @@
 #ifndef ACCESSIBILITY_RESOURCE_BUNDLE_MANAGER_H
 #define ACCESSIBILITY_RESOURCE_BUNDLE_MANAGER_H
 
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
 #include "singleton.h"
 #include "resource_manager.h"
 #include "res_config.h"
@@ -42,8 +47,41 @@ public:
 
     bool GetBundleNameByUid(const int uid, std::string &bundleName);
 
+    /**
+     * @brief Get a resolved resource string from the cache.
+     * @param key The key made of user id, bundle, module, resource id, locale and format params.
+     * @param value The resolved resource string.
+     * @return true if the key is cached, otherwise false.
+     */
+    bool GetCachedResourceString(const std::string &key, std::string &value);
+    void CacheResourceString(const std::string &key, const std::string &value);
+
+    /**
+     * @brief Get a resource manager from the cache.
+     * @param key The key made of user id, bundle and module.
+     * @return The cached resource manager, nullptr if not cached.
+     */
+    std::shared_ptr<Global::Resource::ResourceManager> GetCachedResourceManager(const std::string &key);
+    void CacheResourceManager(const std::string &key,
+        const std::shared_ptr<Global::Resource::ResourceManager> &resourceManager);
+
+    /**
+     * @brief Drop the cached resources of a bundle, called when the package is changed or removed.
+     * @param bundleName The bundle name of the package.
+     * @param userId The user id of the package.
+     */
+    void ClearResourceCache(const std::string &bundleName, int32_t userId);
+
+    /**
+     * @brief Drop all cached resources, called when the system locale is changed.
+     */
+    void ClearResourceCache();
+
+    void GetResourceCacheStats(uint64_t &hitCount, uint64_t &missCount);
+
 public:
     ffrt::mutex bundleMutex_;
+    ffrt::mutex resourceMutex_; // serializes string formatting on the cached resource managers
 
 private:
     class BundleManagerDeathRecipient final : public IRemoteObject::DeathRecipient {
@@ -60,6 +98,69 @@ private:
 
     sptr<AppExecFwk::IBundleMgr> bundleManager_ = nullptr;
     sptr<IRemoteObject::DeathRecipient> bundleManagerDeathRecipient_ = nullptr;
+
+    template<typename T>
+    class LruCache {
+    public:
+        explicit LruCache(size_t capacity) : capacity_(capacity) {}
+        ~LruCache() = default;
+
+        bool Get(const std::string &key, T &value)
+        {
+            auto iter = index_.find(key);
+            if (iter == index_.end()) {
+                return false;
+            }
+            entries_.splice(entries_.begin(), entries_, iter->second);
+            value = iter->second->second;
+            return true;
+        }
+
+        void Put(const std::string &key, const T &value)
+        {
+            auto iter = index_.find(key);
+            if (iter != index_.end()) {
+                iter->second->second = value;
+                entries_.splice(entries_.begin(), entries_, iter->second);
+                return;
+            }
+            entries_.emplace_front(key, value);
+            index_[key] = entries_.begin();
+            if (entries_.size() > capacity_) {
+                index_.erase(entries_.back().first);
+                entries_.pop_back();
+            }
+        }
+
+        void EraseByPrefix(const std::string &prefix)
+        {
+            for (auto iter = entries_.begin(); iter != entries_.end();) {
+                if (iter->first.compare(0, prefix.size(), prefix) == 0) {
+                    index_.erase(iter->first);
+                    iter = entries_.erase(iter);
+                } else {
+                    ++iter;
+                }
+            }
+        }
+
+        void Clear()
+        {
+            index_.clear();
+            entries_.clear();
+        }
+
+    private:
+        size_t capacity_ = 0;
+        std::list<std::pair<std::string, T>> entries_;
+        std::unordered_map<std::string, typename std::list<std::pair<std::string, T>>::iterator> index_;
+    };
+
+    LruCache<std::string> resourceStringCache_;
+    LruCache<std::shared_ptr<Global::Resource::ResourceManager>> resourceManagerCache_;
+    uint64_t resourceCacheHitCount_ = 0;
+    uint64_t resourceCacheMissCount_ = 0;
+    ffrt::mutex resourceCacheMutex_; // mutex for the resource caches and their counters
 };
 
 } // namespace Accessibility
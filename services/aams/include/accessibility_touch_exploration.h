@@ -16,11 +16,14 @@
 #ifndef ACCESSIBILITY_TOUCH_EXPLORATION_H
 #define ACCESSIBILITY_TOUCH_EXPLORATION_H
 
+#include <array>
 #include <string>
 #include <cmath>
+#include <list>
 #include <vector>
 #include <map>
 #include <functional>
+#include <initializer_list>
 #include "accessibility_element_info.h"
 #include "accessibility_event_transmission.h"
 #include "accessibility_def.h"
@@ -140,6 +143,210 @@ struct Pointer {
     float py_;
 };
 
+/**
+ * @brief The fields of a pointer event read by the gesture recognizers.
+ */
+struct PointerSample {
+    int32_t pointerId = -1;
+    int32_t pointerAction = MMI::PointerEvent::POINTER_ACTION_UNKNOWN;
+    int32_t displayX = 0;
+    int32_t displayY = 0;
+    int32_t rawDisplayX = 0;
+    int32_t rawDisplayY = 0;
+    int64_t actionTime = 0;
+};
+
+/**
+ * @brief The pointer events received since the gesture began. The recognizers only read the first and the last
+ *        event and the downs of each pointer, these are kept as samples in preallocated storage. Whole events are
+ *        only copied while they may still be replayed to multimodal.
+ */
+class TouchPointerHistory {
+public:
+    // four fingers tapped three times, with room for the fingers lifted and put down again in between
+    static constexpr size_t DOWN_CAPACITY = 32;
+
+    void Record(const MMI::PointerEvent &event)
+    {
+        PointerSample sample = MakeSample(event);
+        if (size_ == 0) {
+            first_ = sample;
+        }
+        last_ = sample;
+        size_++;
+        if (sample.pointerAction == MMI::PointerEvent::POINTER_ACTION_DOWN) {
+            downs_[(downBegin_ + downCount_) % DOWN_CAPACITY] = sample;
+            if (downCount_ < DOWN_CAPACITY) {
+                downCount_++;
+            } else {
+                downBegin_ = (downBegin_ + 1) % DOWN_CAPACITY;
+            }
+        }
+    }
+
+    /**
+     * @brief Record an event which is sent again to multimodal if the gesture is not recognized.
+     * @param event The pointer event.
+     */
+    void RecordForReplay(const MMI::PointerEvent &event)
+    {
+        Record(event);
+        replayEvents_.push_back(event);
+    }
+
+    void Clear()
+    {
+        size_ = 0;
+        downBegin_ = 0;
+        downCount_ = 0;
+        replayEvents_.clear();
+    }
+
+    bool IsEmpty() const
+    {
+        return size_ == 0;
+    }
+
+    // only called when the history is not empty
+    const PointerSample &GetFirst() const
+    {
+        return first_;
+    }
+
+    const PointerSample &GetLast() const
+    {
+        return last_;
+    }
+
+    const PointerSample *FindFirstDown(const int32_t pointerId) const
+    {
+        for (size_t i = 0; i < downCount_; i++) {
+            const PointerSample &sample = downs_[(downBegin_ + i) % DOWN_CAPACITY];
+            if (sample.pointerId == pointerId) {
+                return &sample;
+            }
+        }
+        return nullptr;
+    }
+
+    const PointerSample *FindLastDown(const int32_t pointerId) const
+    {
+        for (size_t i = downCount_; i > 0; i--) {
+            const PointerSample &sample = downs_[(downBegin_ + i - 1) % DOWN_CAPACITY];
+            if (sample.pointerId == pointerId) {
+                return &sample;
+            }
+        }
+        return nullptr;
+    }
+
+    template<typename Visitor>
+    void ForEachDown(Visitor &&visitor) const
+    {
+        for (size_t i = 0; i < downCount_; i++) {
+            visitor(downs_[(downBegin_ + i) % DOWN_CAPACITY]);
+        }
+    }
+
+    std::list<MMI::PointerEvent> &GetReplayEvents()
+    {
+        return replayEvents_;
+    }
+
+private:
+    static PointerSample MakeSample(const MMI::PointerEvent &event)
+    {
+        PointerSample sample;
+        MMI::PointerEvent::PointerItem pointerItem {};
+        event.GetPointerItem(event.GetPointerId(), pointerItem);
+        sample.pointerId = event.GetPointerId();
+        sample.pointerAction = event.GetPointerAction();
+        sample.displayX = pointerItem.GetDisplayX();
+        sample.displayY = pointerItem.GetDisplayY();
+        sample.rawDisplayX = pointerItem.GetRawDisplayX();
+        sample.rawDisplayY = pointerItem.GetRawDisplayY();
+        sample.actionTime = event.GetActionTime();
+        return sample;
+    }
+
+    size_t size_ = 0;
+    PointerSample first_ {};
+    PointerSample last_ {};
+    std::array<PointerSample, DOWN_CAPACITY> downs_ {};
+    size_t downBegin_ = 0;
+    size_t downCount_ = 0;
+    std::list<MMI::PointerEvent> replayEvents_ {};
+};
+
+/**
+ * @brief The path of a one-finger swipe. The route is split while the points are added, at the points where
+ *        the finger turns back. Only paths of two or three points are recognized, so the points after are
+ *        only counted.
+ */
+class OneFingerSwipePath {
+public:
+    void Start(const Pointer &point)
+    {
+        Clear();
+        Add(point);
+    }
+
+    void Add(const Pointer &point);
+
+    void Clear()
+    {
+        routeSize_ = 0;
+        separationCount_ = 0;
+        xUnitVector_ = 0;
+        yUnitVector_ = 0;
+        vectorLength_ = 0;
+        numSinceFirstSep_ = 0;
+    }
+
+    // the number of points added to the route
+    size_t GetRouteSize() const
+    {
+        return routeSize_;
+    }
+
+    // the number of points of the path, the first point, the separations and the last point
+    size_t GetSize() const
+    {
+        return separationCount_ + LIMIT_SIZE_TWO;
+    }
+
+    // only called with an index below GetSize() and LIMIT_SIZE_THREE
+    const Pointer &GetPoint(const size_t index) const
+    {
+        return index + 1 == GetSize() ? lastPoint_ : points_[index];
+    }
+
+private:
+    std::array<Pointer, LIMIT_SIZE_TWO> points_ {};
+    Pointer firstSeparation_ {};
+    Pointer lastPoint_ {};
+    size_t routeSize_ = 0;
+    size_t separationCount_ = 0;
+    float xUnitVector_ = 0;
+    float yUnitVector_ = 0;
+    float vectorLength_ = 0;
+    int32_t numSinceFirstSep_ = 0;
+};
+
+/**
+ * @brief The route of one finger of a multi-finger swipe. The direction of a segment is checked when the point
+ *        is added, so the route is kept as its first and last points and its size.
+ */
+struct MultiFingerSwipeRoute {
+    int32_t pointerId = -1;
+    int32_t firstX = 0;
+    int32_t firstY = 0;
+    int32_t lastX = 0;
+    int32_t lastY = 0;
+    uint32_t pointCount = 0;
+    bool keepsDirection = true;
+};
+
 class TouchExplorationEventHandler : public AppExecFwk::EventHandler {
 public:
     TouchExplorationEventHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner,
@@ -338,7 +545,6 @@ private:
     void InitFourFingerGestureFuncMap();
     void HandlePointerEvent(MMI::PointerEvent &event);
     void AddOneFingerSwipeEvent(MMI::PointerEvent &event);
-    std::vector<Pointer> GetOneFingerSwipePath();
     int32_t GetSwipeDirection(const int32_t dx, const int32_t dy);
     bool RecordFocusedLocation(MMI::PointerEvent &event);
     void OffsetEvent(MMI::PointerEvent &event, bool setZOrderFlag);
@@ -366,7 +572,7 @@ private:
     void StoreMultiFingerSwipeBaseDownPoint();
     bool GetMultiFingerSwipeBasePointerItem(MMI::PointerEvent::PointerItem &basePointerItem, int32_t pId);
     bool SaveMultiFingerSwipeGesturePointerInfo(MMI::PointerEvent &event);
-    bool RecognizeMultiFingerSwipePath(const std::vector<Pointer> &path);
+    MultiFingerSwipeRoute *FindMultiFingerSwipeRoute(int32_t pId);
     GestureType GetMultiFingerSwipeGestureId(uint32_t fingerNum);
     void HandleMultiFingersSwipeStateUp(MMI::PointerEvent &event, uint32_t fingerNum);
     std::map<TouchExplorationMsg, GestureType> GetMultiFingerMsgToGestureMap();
@@ -382,12 +588,18 @@ private:
     std::shared_ptr<AppExecFwk::EventRunner> runner_ = nullptr;
     std::shared_ptr<AppExecFwk::EventHandler> gestureHandler_ = nullptr;
     std::shared_ptr<AppExecFwk::EventRunner> gestureRunner_;
+    static constexpr int32_t TOUCH_EXPLORATION_STATE_COUNT =
+        static_cast<int32_t>(TouchExplorationState::FOUR_FINGERS_CONTINUE_DOWN) + 1;
+    // the cancel, down, move and up actions
+    static constexpr int32_t POINTER_ACTION_MAX = MMI::PointerEvent::POINTER_ACTION_UP + 1;
     using HandleEventFunc = std::function<void(MMI::PointerEvent &)>;
-    std::map<TouchExplorationState, std::map<int32_t, HandleEventFunc>> handleEventFuncMap_ {};
+    void SetHandleEventFuncs(TouchExplorationState state,
+        std::initializer_list<std::pair<int32_t, HandleEventFunc>> funcs);
+    HandleEventFunc handleEventFuncMap_[TOUCH_EXPLORATION_STATE_COUNT][POINTER_ACTION_MAX] = {};
 
     TouchExplorationState currentState_ = TouchExplorationState::TOUCH_INIT;
     std::atomic<uint64_t> currentDisplayId_ = 0;
-    std::list<MMI::PointerEvent> receivedPointerEvents_ {};
+    TouchPointerHistory receivedPointerEvents_ {};
 
     // single-finger gesture
     int32_t offsetX_ = 0;
@@ -396,8 +608,8 @@ private:
     float moveThreshold_ = 0;
     float xMinPixels_ = 0;
     float yMinPixels_ = 0;
-    std::vector<Pointer> oneFingerSwipeRoute_ {};
-    MMI::PointerEvent::PointerItem oneFingerSwipePrePointer_ {};
+    OneFingerSwipePath oneFingerSwipePath_ {};
+    PointerSample oneFingerSwipePrePointer_ {};
 
     // multi-finger gesture
     int32_t draggingPid_ = -1;
@@ -407,8 +619,8 @@ private:
     int32_t multiFingerSwipeDirection_ = -1;
     float mMinPixelsBetweenSamplesX_ = 0;
     float mMinPixelsBetweenSamplesY_ = 0;
-    std::map<int32_t, std::vector<Pointer>> multiFingerSwipeRoute_ {};
-    std::map<int32_t, std::shared_ptr<MMI::PointerEvent>> multiFingerSwipePrePoint_ {};
+    std::array<MultiFingerSwipeRoute, TouchPointerHistory::DOWN_CAPACITY> multiFingerSwipeRoutes_ {};
+    size_t multiFingerSwipeRouteCount_ = 0;
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -16,11 +16,14 @@
 #ifndef ACCESSIBILITY_WINDOW_CONNECTION_H
 #define ACCESSIBILITY_WINDOW_CONNECTION_H
 
+#include "accessibility_ipc_health.h"
 #include "iaccessibility_element_operator.h"
 #include "hilog_wrapper.h"
 #include "ffrt.h"
 #include "safe_map.h"
 #include <atomic>
+#include <map>
+#include <set>
 
 namespace OHOS {
 namespace Accessibility {
@@ -41,6 +44,7 @@ public:
     inline void SetAncoFlag(bool flag)
     {
         isAnco_ = flag;
+        MarkProxiesStale();
     }
 
     inline bool IsAnco()
@@ -51,6 +55,7 @@ public:
     inline void SetUseBrokerFlag(bool flag)
     {
         isUseBrokerProxy_.store(flag);
+        MarkProxiesStale();
     }
  
     inline bool GetUseBrokerFlag()
@@ -58,6 +63,32 @@ public:
         return isUseBrokerProxy_.load();
     }
 
+    // changed whenever a proxy or a flag choosing between the proxies changes, or the connection is unregistered
+    inline uint64_t GetProxyGeneration()
+    {
+        return proxyGeneration_.load();
+    }
+
+    // a proxy found from the connection before must not be used again, the operators granted from it are revoked
+    void MarkProxiesStale();
+
+    // an element operator of this window handed to an accessibility extension, one per extension and tree
+    void AddElementOperatorGrant(const int32_t grantId, const std::string &clientName, const int32_t treeId,
+        const sptr<IAccessibilityElementOperator> &grantor);
+
+    // returns false if the grant was revoked already
+    bool RevokeElementOperatorGrant(const int32_t grantId);
+
+    bool IsElementOperatorGranted(const int32_t grantId);
+
+    void RevokeElementOperatorGrantsExcept(const std::set<std::string> &clientNames);
+
+    // latency and circuit breaker state of the requests sent to this window
+    inline AccessibilityIpcHealth &GetIpcHealth()
+    {
+        return ipcHealth_;
+    }
+
     void SetProxy(uint64_t displayId, sptr<IAccessibilityElementOperator> proxy);
     
     void SetBrokerProxy(sptr<IAccessibilityElementOperator> proxy);
@@ -111,6 +142,15 @@ private:
         uint64_t displayId_ = 0;
     };
 
+private:
+    struct ElementOperatorGrant {
+        std::string clientName = "";
+        int32_t treeId = 0;
+        sptr<IAccessibilityElementOperator> grantor = nullptr;
+    };
+
+    static void RevokeElementOperatorGrants(const std::map<int32_t, ElementOperatorGrant> &grants);
+
 private:
     int32_t windowId_;
     int32_t accountId_;
@@ -130,6 +170,10 @@ private:
     std::unordered_map<uint64_t, std::pair<sptr<IAccessibilityElementOperator>, sptr<IRemoteObject::DeathRecipient>>>
         proxyMap_;
     SafeMap<uint32_t, bool> scbTokenMap_;
+    AccessibilityIpcHealth ipcHealth_;
+    std::atomic<uint64_t> proxyGeneration_ = 0;
+    ffrt::mutex grantsMutex_;
+    std::map<int32_t, ElementOperatorGrant> grants_; // grantId -> the grant
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -0,0 +1,319 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_WINDOW_INDEX_H
+#define ACCESSIBILITY_WINDOW_INDEX_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * @brief The scene board sub windows and the tree id of the windows, kept in open-addressing tables.
+ *        Writers are serialized, readers take no lock and retry when a write overlaps the lookup.
+ */
+class AccessibilityWindowIndex {
+public:
+    // the initial capacities, the tables grow with the windows and the trees
+    static constexpr size_t WINDOW_CAPACITY = 512;
+    static constexpr size_t TREE_CAPACITY = 512;
+
+    AccessibilityWindowIndex() = default;
+    ~AccessibilityWindowIndex() = default;
+
+    /**
+     * @brief Mark a window as a sub window of the scene board, the lowest display id of the window is kept.
+     * @param windowId The inner window id.
+     * @param displayId The display id.
+     */
+    void InsertSubWindow(const int32_t windowId, const uint64_t displayId);
+
+    /**
+     * @brief Find a sub window of the scene board.
+     * @param windowId The inner window id.
+     * @param displayId The display id of the window.
+     * @return false if the window is not a sub window.
+     */
+    bool FindSubWindow(const int32_t windowId, uint64_t &displayId) const;
+    bool IsSubWindow(const int32_t windowId) const;
+
+    void InsertSceneBoardElementId(const int32_t windowId, const int64_t elementId);
+    bool HasSceneBoardElementId(const int32_t windowId) const;
+    bool IsSceneBoardElementId(const int64_t elementId) const;
+    std::map<int32_t, int64_t> GetSceneBoardElementIds() const;
+    void ClearSceneBoardElementIds();
+
+    /**
+     * @brief Remove a window from the sub windows and the scene board element ids.
+     * @param windowId The inner window id.
+     */
+    void RemoveWindow(const int32_t windowId);
+    void ClearSubWindows();
+    void ClearSceneBoard();
+
+    void InsertTreeId(const int32_t treeId, const int32_t windowId);
+    void RemoveTreeId(const int32_t treeId);
+
+    /**
+     * @brief Find the window of a tree.
+     * @param treeId The tree id.
+     * @return The window id, 0 when not found.
+     */
+    int32_t FindWindowIdByTreeId(const int32_t treeId) const;
+
+private:
+    struct WindowEntry {
+        uint64_t displayId = 0;
+        int64_t elementId = 0;
+        bool isSubWindow = false;
+        bool hasElementId = false;
+    };
+
+    /**
+     * @brief Linear probing table of int32_t keys. A write is bracketed by an odd sequence number, a reader
+     *        compares the sequence number before and after the lookup. Every field is an atomic word, so a
+     *        torn read is discarded instead of being a data race. The table doubles when the keys take half
+     *        of it, the replaced buffers are kept until destruction as a reader may still be probing them.
+     */
+    template<typename Value, size_t InitialCapacity>
+    class FlatTable {
+    public:
+        static_assert((InitialCapacity & (InitialCapacity - 1)) == 0, "the capacity is a power of two");
+        static_assert(std::is_trivially_copyable<Value>::value, "the value is copied word by word");
+
+        FlatTable()
+        {
+            buffers_.push_back(std::make_unique<Buffer>(InitialCapacity));
+            buffer_.store(buffers_.back().get(), std::memory_order_release);
+        }
+
+        template<typename Reader>
+        auto Read(Reader &&reader) const -> decltype(reader(*this))
+        {
+            while (true) {
+                uint64_t sequence = sequence_.load(std::memory_order_acquire);
+                if (sequence & 1) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                auto result = reader(*this);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sequence_.load(std::memory_order_relaxed) == sequence) {
+                    return result;
+                }
+            }
+        }
+
+        template<typename Writer>
+        void Write(Writer &&writer)
+        {
+            std::lock_guard<ffrt::mutex> lock(writeMutex_);
+            uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+            sequence_.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            writer(*this);
+            sequence_.store(sequence + 2, std::memory_order_release);
+        }
+
+        // the calls below are made inside Read or Write
+        bool Find(const int32_t key, Value &value) const
+        {
+            const Buffer &buffer = *buffer_.load(std::memory_order_acquire);
+            size_t index = FindIndex(buffer, key);
+            if (index == NOT_FOUND) {
+                return false;
+            }
+            value = LoadValue(buffer.slots[index]);
+            return true;
+        }
+
+        template<typename Visitor>
+        void ForEach(Visitor &&visitor) const
+        {
+            const Buffer &buffer = *buffer_.load(std::memory_order_acquire);
+            for (size_t i = 0; i < buffer.capacity; i++) {
+                int32_t key = buffer.slots[i].key.load(std::memory_order_relaxed);
+                if (key != EMPTY_KEY && key != DELETED_KEY) {
+                    visitor(key, LoadValue(buffer.slots[i]));
+                }
+            }
+        }
+
+        void Insert(const int32_t key, const Value &value)
+        {
+            Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+            size_t index = FindIndex(*buffer, key);
+            if (index == NOT_FOUND) {
+                if (usedCount_ + 1 > buffer->capacity / 4 * 3) {
+                    // reclaim the deleted slots in place while the keys fit in half of the table
+                    buffer = Rehash(keyCount_ + 1 > buffer->capacity / 2 ? buffer->capacity * 2 : buffer->capacity);
+                }
+                index = FindFreeIndex(*buffer, key);
+                if (buffer->slots[index].key.load(std::memory_order_relaxed) == EMPTY_KEY) {
+                    usedCount_++;
+                }
+                keyCount_++;
+                buffer->slots[index].key.store(key, std::memory_order_relaxed);
+            }
+            StoreValue(buffer->slots[index], value);
+        }
+
+        void Erase(const int32_t key)
+        {
+            Buffer &buffer = *buffer_.load(std::memory_order_relaxed);
+            size_t index = FindIndex(buffer, key);
+            if (index != NOT_FOUND) {
+                // the slot keeps the probe chain of the keys behind it
+                buffer.slots[index].key.store(DELETED_KEY, std::memory_order_relaxed);
+                keyCount_--;
+            }
+        }
+
+        void Clear()
+        {
+            Buffer &buffer = *buffer_.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < buffer.capacity; i++) {
+                buffer.slots[i].key.store(EMPTY_KEY, std::memory_order_relaxed);
+            }
+            usedCount_ = 0;
+            keyCount_ = 0;
+        }
+
+        size_t GetCapacity() const
+        {
+            return buffer_.load(std::memory_order_acquire)->capacity;
+        }
+
+    private:
+        // the keys are window and tree ids, the two lowest values are never used
+        static constexpr int32_t EMPTY_KEY = std::numeric_limits<int32_t>::min();
+        static constexpr int32_t DELETED_KEY = EMPTY_KEY + 1;
+        static constexpr size_t WORD_COUNT = (sizeof(Value) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+        static constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+
+        struct Slot {
+            std::atomic<int32_t> key {EMPTY_KEY};
+            std::array<std::atomic<uint64_t>, WORD_COUNT> words {};
+        };
+
+        struct Buffer {
+            explicit Buffer(const size_t size) : capacity(size), slots(std::make_unique<Slot[]>(size)) {}
+            size_t capacity;
+            std::unique_ptr<Slot[]> slots;
+        };
+
+        static size_t GetHomeIndex(const Buffer &buffer, const int32_t key)
+        {
+            // fibonacci hashing spreads the consecutive window ids
+            return static_cast<size_t>((static_cast<uint32_t>(key) * 2654435769U) >> 8) & (buffer.capacity - 1);
+        }
+
+        static Value LoadValue(const Slot &slot)
+        {
+            std::array<uint64_t, WORD_COUNT> words {};
+            for (size_t i = 0; i < WORD_COUNT; i++) {
+                words[i] = slot.words[i].load(std::memory_order_relaxed);
+            }
+            Value value;
+            std::memcpy(static_cast<void *>(&value), words.data(), sizeof(Value));
+            return value;
+        }
+
+        static void StoreValue(Slot &slot, const Value &value)
+        {
+            std::array<uint64_t, WORD_COUNT> words {};
+            std::memcpy(words.data(), &value, sizeof(Value));
+            for (size_t i = 0; i < WORD_COUNT; i++) {
+                slot.words[i].store(words[i], std::memory_order_relaxed);
+            }
+        }
+
+        static size_t FindIndex(const Buffer &buffer, const int32_t key)
+        {
+            size_t index = GetHomeIndex(buffer, key);
+            for (size_t probe = 0; probe < buffer.capacity; probe++) {
+                int32_t slotKey = buffer.slots[index].key.load(std::memory_order_relaxed);
+                if (slotKey == key) {
+                    return index;
+                }
+                if (slotKey == EMPTY_KEY) {
+                    break;
+                }
+                index = (index + 1) & (buffer.capacity - 1);
+            }
+            return NOT_FOUND;
+        }
+
+        // the load factor stays under three quarters, so a free slot always exists
+        static size_t FindFreeIndex(const Buffer &buffer, const int32_t key)
+        {
+            size_t index = GetHomeIndex(buffer, key);
+            while (true) {
+                int32_t slotKey = buffer.slots[index].key.load(std::memory_order_relaxed);
+                if (slotKey == EMPTY_KEY || slotKey == DELETED_KEY) {
+                    return index;
+                }
+                index = (index + 1) & (buffer.capacity - 1);
+            }
+        }
+
+        // drop the deleted slots, the readers retry as the table is rewritten or replaced inside one write
+        Buffer *Rehash(const size_t capacity)
+        {
+            std::vector<std::pair<int32_t, Value>> entries;
+            entries.reserve(keyCount_);
+            ForEach([&entries](int32_t key, const Value &value) { entries.emplace_back(key, value); });
+            Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+            if (capacity == buffer->capacity) {
+                Clear();
+            } else {
+                buffers_.push_back(std::make_unique<Buffer>(capacity));
+                buffer = buffers_.back().get();
+            }
+            for (auto &entry : entries) {
+                size_t index = FindFreeIndex(*buffer, entry.first);
+                buffer->slots[index].key.store(entry.first, std::memory_order_relaxed);
+                StoreValue(buffer->slots[index], entry.second);
+            }
+            usedCount_ = entries.size();
+            keyCount_ = entries.size();
+            buffer_.store(buffer, std::memory_order_release);
+            return buffer;
+        }
+
+        std::vector<std::unique_ptr<Buffer>> buffers_ {}; // only touched by the writer
+        std::atomic<Buffer *> buffer_ {nullptr};
+        size_t usedCount_ = 0; // the keys and the deleted slots, only touched by the writer
+        size_t keyCount_ = 0;
+        std::atomic<uint64_t> sequence_ {0};
+        ffrt::mutex writeMutex_;
+    };
+
+    FlatTable<WindowEntry, WINDOW_CAPACITY> windows_;
+    FlatTable<int32_t, TREE_CAPACITY> trees_;
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_WINDOW_INDEX_H
@@ -16,9 +16,12 @@
 #ifndef ACCESSIBILITY_WINDOW_MANGER_H
 #define ACCESSIBILITY_WINDOW_MANGER_H
 
+#include <deque>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
+#include "accessibility_window_index.h"
 #include "accessibility_window_info.h"
 #include "event_handler.h"
 #include "ffrt.h"
@@ -35,6 +38,27 @@ constexpr int64_t INVALID_SCENE_BOARD_ELEMENT_ID = -1; // invalid scene board el
 class AccessibilityAccountData;
 class AccessibilityWindowManager {
 public:
+    // the windows of one display in a snapshot
+    struct DisplayWindowSnapshot {
+        std::map<int32_t, AccessibilityWindowInfo> windows {};
+        int32_t activeWindowId = INVALID_WINDOW_ID;
+        int32_t a11yFocusedWindowId = INVALID_WINDOW_ID;
+        bool isMagnified = false; // a magnification window is shown on the display
+    };
+
+    // a11yWindows_ as it was after one update, never modified once published
+    struct WindowSnapshot {
+        uint64_t generation = 0; // increased by every publication, unchanged windows keep the same one
+        std::map<int32_t, AccessibilityWindowInfo> windows {};
+        std::map<uint64_t, std::shared_ptr<const DisplayWindowSnapshot>> displays {};
+    };
+
+    // one update received from the window manager
+    struct RosenWindowUpdate {
+        std::vector<sptr<Rosen::AccessibilityWindowInfo>> infos {};
+        Rosen::WindowUpdateType type = Rosen::WindowUpdateType::WINDOW_UPDATE_ALL;
+    };
+
     AccessibilityWindowManager();
     ~AccessibilityWindowManager();
     void SetAccountData(int32_t accountId, const wptr<AccessibilityAccountData>& accountData);
@@ -50,8 +74,17 @@ public:
     void DeregisterWindowListener();
     void SetActiveWindow(int32_t windowId, bool isSendEvent = true);
     int32_t GetActiveWindowId();
+    int32_t GetActiveWindowId(const uint64_t displayId);
     void SetAccessibilityFocusedWindow(int32_t windowId);
     std::vector<AccessibilityWindowInfo> GetAccessibilityWindows();
+
+    /**
+     * @brief Get the windows of one display, the windows of the other displays are not visited.
+     * @param displayId The display id.
+     * @return The windows of the display.
+     */
+    std::vector<AccessibilityWindowInfo> GetAccessibilityWindows(const uint64_t displayId);
+    bool IsDisplayMagnified(const uint64_t displayId);
     bool GetAccessibilityWindow(int32_t windowId, AccessibilityWindowInfo &window);
     void GetA11yWindowsBundleName(int32_t windowId, std::string &bundleName);
     bool GetA11yWindowById(int32_t windowId, AccessibilityWindowInfo &window);
@@ -76,8 +109,35 @@ public:
     // test for ut to resize a window
     void SetWindowSize(int32_t windowId, Rect rect);
 
+    /**
+     * @brief Get the windows without taking interfaceMutex_, the snapshot stays valid while it is held.
+     * @return The latest snapshot, nullptr before the windows are initialized or after DeInit.
+     */
+    std::shared_ptr<const WindowSnapshot> GetWindowSnapshot() const;
+
+    // the windows of one display in the latest snapshot, nullptr when the display has no window
+    std::shared_ptr<const DisplayWindowSnapshot> GetDisplayWindowSnapshot(const uint64_t displayId) const;
+
+    // publish a11yWindows_ changed by the ut without the interfaces above
+    void PublishWindowSnapshot();
+
     void OnWindowUpdate(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos, Rosen::WindowUpdateType type);
 
+    /**
+     * @brief Apply the updates received within one frame in one pass, each changed window is updated once
+     *        and gets one window event, the window focused or activated by the last of the updates stays active.
+     * @param updates The updates in the order they are received.
+     */
+    void ApplyWindowUpdates(const std::vector<RosenWindowUpdate> &updates);
+
+    /**
+     * @brief Dump the latest updates received from the window manager, one update per line as
+     *        "receivedMs type count" followed by "wid innerWid displayId windowType focused layer posX posY width
+     *        height mode uiNodeId bundleName" for each window, the replay tests read recorded traces in this format.
+     * @param dumpInfo The lines are appended to it.
+     */
+    void DumpRecordedWindowUpdates(std::string &dumpInfo);
+
     bool IsInnerWindowRootElement(int64_t elementId);
 
     void InsertTreeIdWindowIdPair(int32_t treeId, int32_t windowId);
@@ -100,23 +160,8 @@ public:
     int32_t previousActiveWindowId_ = INVALID_WINDOW_ID;
     int32_t activeWindowId_ = INVALID_WINDOW_ID;
     int32_t a11yFocusedWindowId_ = INVALID_WINDOW_ID;
-    std::set<std::pair<int32_t, uint64_t>> subWindows_ {}; // used for windowId 1, windowId-displayId
-
-    // used for arkui windowId 1 map to WMS windowId
-    class SceneBoardElementIdMap {
-    public:
-        SceneBoardElementIdMap() = default;
-        ~SceneBoardElementIdMap() = default;
-        void InsertPair(const int32_t windowId, const int64_t elementId);
-        void RemovePair(const int32_t windowId);
-        bool CheckWindowIdPair(const int32_t windowId);
-        std::map<int32_t, int64_t> GetAllPairs();
-        void Clear();
-    private:
-        std::map<int32_t, int64_t> windowElementMap_;
-        ffrt::mutex mapMutex_;
-    };
-    SceneBoardElementIdMap sceneBoardElementIdMap_ = {};
+    // sub windows of window id 1 with their display id, scene board element ids and the windows of the trees
+    AccessibilityWindowIndex windowIndex_ {};
 
 private:
     class AccessibilityWindowListener : public Rosen::IWindowUpdateListener {
@@ -144,6 +189,13 @@ private:
             Rosen::RotationChangeResult& rotationChangeResult) override;
     };
 
+    // the updates of one window within a frame, folded into the latest info
+    struct WindowDelta {
+        sptr<Rosen::AccessibilityWindowInfo> info = nullptr;
+        uint32_t rosenTypes = 0; // a bit per Rosen::WindowUpdateType received
+        bool removed = false; // set by a remove update, reset by a later add update
+    };
+
     bool CompareRect(const Rect &rectAccessibility, const Rosen::Rect &rectWindow);
     bool EqualFocus(const Accessibility::AccessibilityWindowInfo &accWindowInfo,
         const sptr<Rosen::AccessibilityWindowInfo> &windowInfo);
@@ -153,36 +205,58 @@ private:
         const sptr<Rosen::AccessibilityWindowInfo> &windowInfo);
     bool EqualLayer(const Accessibility::AccessibilityWindowInfo &accWindowInfo,
         const sptr<Rosen::AccessibilityWindowInfo> &windowInfo);
-    void WindowUpdateAdded(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos);
-    void WindowUpdateRemoved(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos);
-    void WindowUpdateBounds(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos);
-    void WindowUpdateActive(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos);
-    void WindowUpdateFocused(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos);
-    void WindowUpdateProperty(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos);
-    void WindowUpdateTypeEvent(const int32_t realWidId, std::map<int32_t,
-        AccessibilityWindowInfo> &oldA11yWindows, Accessibility::WindowUpdateType type);
-    void WindowUpdateTypeEventAdded(const int32_t realWindowId,
-        std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows);
-    void WindowUpdateTypeEventRemoved(const int32_t realWindowId,
-        std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows);
-    void WindowUpdateTypeEventBounds(const int32_t realWindowId,
-        std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows);
-    void WindowUpdateTypeEventFocused(const int32_t realWindowId,
-        std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows);
-    void WindowUpdateTypeEventProperty(const int32_t realWindowId,
-        std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows);
-    void WindowUpdateTypeEventLayer(const int32_t realWindowId,
-        std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows);
     void WindowUpdateAll(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos);
-    void WindowUpdateAllExec(std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows,
-        int32_t realWid, const sptr<Rosen::AccessibilityWindowInfo>& window);
+    void ApplyWindowDelta(const int32_t realWid, const WindowDelta &delta);
+    static std::string FormatWindowUpdate(const int64_t receivedTime, const RosenWindowUpdate &update);
+    static bool IsActivatingUpdate(const Rosen::WindowUpdateType type,
+        const sptr<Rosen::AccessibilityWindowInfo> &windowInfo);
+    void RemoveA11yWindow(const int32_t realWid);
+    uint32_t GetWindowChanges(Accessibility::AccessibilityWindowInfo &accWindowInfo,
+        const sptr<Rosen::AccessibilityWindowInfo> &windowInfo);
+    void SendWindowChangeEvent(const int32_t realWid, const uint32_t changes, const std::string &bundleName);
     void ClearOldActiveWindow();
+    void ClearOldActiveWindow(const uint64_t displayId);
+    void ClearAccessibilityFocused(const uint64_t displayId);
+    void ClearWindowAccessibilityFocused(const int32_t a11yFocusedWindowId);
+    // the window of a display in activeWindowIds_ or a11yFocusedWindowIds_, INVALID_WINDOW_ID when it has none
+    static int32_t GetDisplayWindowId(const std::map<uint64_t, int32_t> &displayWindowIds, const uint64_t displayId);
+    static void EraseDisplayWindowId(std::map<uint64_t, int32_t> &displayWindowIds, const int32_t windowId);
+    void UpdateMagnifiedDisplay(const sptr<Rosen::AccessibilityWindowInfo> &windowInfo, const bool isRemoved);
+    std::vector<AccessibilityWindowInfo> QueryAccessibilityWindows();
+
+    // declared after the lock of interfaceMutex_, the outermost update publishes a11yWindows_ when it ends
+    class WindowUpdateGuard {
+    public:
+        explicit WindowUpdateGuard(AccessibilityWindowManager &manager) : manager_(manager)
+        {
+            manager_.updateDepth_++;
+        }
+        ~WindowUpdateGuard()
+        {
+            if (--manager_.updateDepth_ == 0) {
+                manager_.PublishWindowSnapshot();
+            }
+        }
+
+    private:
+        AccessibilityWindowManager &manager_;
+    };
 
     int32_t accountId_ = -1;
     sptr<AccessibilityWindowListener> windowListener_ = nullptr;
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ = nullptr;
     ffrt::recursive_mutex interfaceMutex_; // mutex for interface to make sure AccessibilityWindowManager thread-safe
-    SafeMap<int32_t, int32_t> windowTreeIdMap_; // map for tree id to window id
+    uint32_t updateDepth_ = 0; // guarded by interfaceMutex_
+    uint64_t snapshotGeneration_ = 0; // guarded by interfaceMutex_
+    std::shared_ptr<const WindowSnapshot> windowSnapshot_ = nullptr; // accessed by std::atomic_load/store
+    ffrt::mutex pendingUpdateMutex_;
+    std::vector<RosenWindowUpdate> pendingUpdates_ {}; // guarded by pendingUpdateMutex_, applied once per frame
+    // guarded by pendingUpdateMutex_, the latest updates with the time they are received for dump
+    std::deque<std::pair<int64_t, RosenWindowUpdate>> recordedUpdates_ {};
+    std::set<uint64_t> magnifiedDisplays_ {}; // guarded by interfaceMutex_
+    // guarded by interfaceMutex_, activeWindowId_ and a11yFocusedWindowId_ are the latest of them
+    std::map<uint64_t, int32_t> activeWindowIds_ {};
+    std::map<uint64_t, int32_t> a11yFocusedWindowIds_ {};
     SafeMap<int32_t, AccessibilityEventInfo> windowFocusEventMap_ {};
     wptr<AccessibilityAccountData> accountData_;
 };
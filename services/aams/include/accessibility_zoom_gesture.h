@@ -24,8 +24,10 @@
 #include "window_magnification_manager.h"
 #include "magnification_menu_manager.h"
 #include "magnification_def.h"
+#include <memory>
 #include <unordered_map>
 #include <functional>
+#include <vector>
 
 namespace OHOS {
 namespace Accessibility {
@@ -48,6 +50,92 @@ struct ZOOM_FOCUS_COORDINATE {
     float centerY;
 };
 
+/**
+ * @brief The pointer events held while a zoom gesture is recognized, in the order they are received.
+ *        The cached events are kept after Clear and refilled in place by the next gesture, so a gesture
+ *        shaped like an earlier one caches its events without an allocation. Only the events which can not
+ *        be refilled, and the first events beyond the cached ones, are copied.
+ */
+class ZoomGestureEventCache {
+public:
+    // three fingers tapped twice, with the moves of the fingers in between
+    static constexpr size_t CAPACITY = 64;
+    // the pointer ids a touch screen event is refilled with, one per finger
+    static constexpr int32_t MAX_POINTER_ID = 10;
+
+    ZoomGestureEventCache()
+    {
+        events_.reserve(CAPACITY);
+    }
+
+    void Push(const MMI::PointerEvent &event)
+    {
+        if (size_ == events_.size()) {
+            events_.push_back(std::make_shared<MMI::PointerEvent>(event));
+        } else if (!Refill(*events_[size_], event)) {
+            events_[size_] = std::make_shared<MMI::PointerEvent>(event);
+        }
+        size_++;
+    }
+
+    template<typename Visitor>
+    void ForEach(Visitor &&visitor)
+    {
+        for (size_t i = 0; i < size_; i++) {
+            visitor(*events_[i]);
+        }
+    }
+
+    void Clear()
+    {
+        size_ = 0;
+    }
+
+private:
+    // set the fields of a touch screen event on a cached one, the pointers kept in both are updated in place
+    static bool Refill(MMI::PointerEvent &cached, const MMI::PointerEvent &event)
+    {
+        if (event.GetSourceType() != MMI::PointerEvent::SOURCE_TYPE_TOUCHSCREEN ||
+            event.GetPointerId() < 0 || event.GetPointerId() >= MAX_POINTER_ID) {
+            return false;
+        }
+        cached.SetId(event.GetId());
+        cached.SetAction(event.GetAction());
+        cached.SetActionTime(event.GetActionTime());
+        cached.SetActionStartTime(event.GetActionStartTime());
+        cached.SetDeviceId(event.GetDeviceId());
+        cached.SetTargetDisplayId(event.GetTargetDisplayId());
+        cached.SetTargetWindowId(event.GetTargetWindowId());
+        cached.SetAgentWindowId(event.GetAgentWindowId());
+        cached.ClearFlag();
+        cached.AddFlag(event.GetFlag());
+        cached.SetSourceType(event.GetSourceType());
+        cached.SetPointerAction(event.GetPointerAction());
+        cached.SetPointerId(event.GetPointerId());
+        cached.SetButtonId(event.GetButtonId());
+        cached.SetFingerCount(event.GetFingerCount());
+        cached.SetZOrder(event.GetZOrder());
+        cached.SetPressedKeys(event.GetPressedKeys());
+        cached.ClearButtonPressed();
+        for (int32_t buttonId : event.GetPressedButtons()) {
+            cached.SetButtonPressed(buttonId);
+        }
+        for (int32_t pointerId = 0; pointerId < MAX_POINTER_ID; pointerId++) {
+            MMI::PointerEvent::PointerItem pointer {};
+            if (event.GetPointerItem(pointerId, pointer)) {
+                // a pointer the cached event does not have yet is added
+                cached.UpdatePointerItem(pointerId, pointer);
+            } else if (cached.GetPointerItem(pointerId, pointer)) {
+                cached.RemovePointerItem(pointerId);
+            }
+        }
+        return true;
+    }
+
+    std::vector<std::shared_ptr<MMI::PointerEvent>> events_ {};
+    size_t size_ = 0; // the events cached by the current gesture, the others wait to be refilled
+};
+
 class AccessibilityZoomGesture : public EventTransmission {
 public:
     AccessibilityZoomGesture(std::shared_ptr<FullScreenMagnificationManager> fullScreenManager,
@@ -81,10 +169,17 @@ private:
         AccessibilityZoomGesture &zoomGesture_;
     };
 
+    // the display position of the pointer of a down or a move, kept instead of a copy of the event
+    struct GesturePoint {
+        int32_t displayX = 0;
+        int32_t displayY = 0;
+        bool isValid = false;
+    };
+
     void TransferState(int32_t state);
     void CacheEvents(MMI::PointerEvent &event);
     void SendCacheEventsToNext();
-    void SendEventToMultimodal(MMI::PointerEvent event);
+    void SendEventToMultimodal(MMI::PointerEvent &event);
     void ClearCacheEventsAndMsg();
 
     void InitGestureFuncMap();
@@ -99,14 +194,15 @@ private:
     void CalcFocusCoordinate(MMI::PointerEvent &event, ZOOM_FOCUS_COORDINATE &coordinate);
     float CalcScaleSpan(MMI::PointerEvent &event, ZOOM_FOCUS_COORDINATE coordinate);
     bool IsTapOnInputMethod(MMI::PointerEvent &event);
-    bool IsDownValid(std::shared_ptr<MMI::PointerEvent> curEvent, std::shared_ptr<MMI::PointerEvent> lastEvent);
-    bool IsMoveValid(std::shared_ptr<MMI::PointerEvent> curEvent, std::shared_ptr<MMI::PointerEvent> lastEvent);
+    bool IsDownValid(const GesturePoint &lastPoint, MMI::PointerEvent &event);
+    bool IsMoveValid(const GesturePoint &lastPoint, MMI::PointerEvent &event);
+    static GesturePoint MakeGesturePoint(MMI::PointerEvent &event);
     bool IsLongPress();
     bool IsKnuckles(MMI::PointerEvent &event);
     void OnTripleTap(MMI::PointerEvent &event);
     bool IsThreeFingerMultiTap(MMI::PointerEvent &event);
     float CalcSeparationDistance(MMI::PointerEvent &event);
-    float CalcSeparationDistance(MMI::PointerEvent &firstEvent, MMI::PointerEvent &secondEvent);
+    float CalcSeparationDistance(const GesturePoint &point, MMI::PointerEvent &event);
     void OnZoom(int32_t centerX, int32_t centerY, bool showMenu);
     void OffZoom();
     void OnScroll(float offsetX, float offsetY);
@@ -183,10 +279,10 @@ private:
     OHOS::Rosen::DisplayOrientation orientation_ =
         OHOS::Rosen::DisplayOrientation::UNKNOWN;
     ZOOM_FOCUS_COORDINATE lastCenter = {0.0f, 0.0f};
-    std::shared_ptr<MMI::PointerEvent> lastDownEvent_ = nullptr;
-    std::shared_ptr<MMI::PointerEvent> lastTripleTapEvents_[3] = {nullptr, nullptr, nullptr};
+    GesturePoint lastDownPoint_ {};
+    GesturePoint lastTripleTapPoints_[3] = {};
     std::shared_ptr<ZoomGestureEventHandler> zoomGestureEventHandler_ = nullptr;
-    std::vector<std::shared_ptr<MMI::PointerEvent>> cacheEvents_;
+    ZoomGestureEventCache cacheEvents_ {};
     std::shared_ptr<FullScreenMagnificationManager> fullScreenManager_ = nullptr;
     std::shared_ptr<WindowMagnificationManager> windowMagnificationManager_ = nullptr;
     std::shared_ptr<MagnificationMenuManager> menuManager_ = nullptr;
@@ -16,6 +16,11 @@
 #ifndef ACCESSIBLE_ABILITY_CHANNEL_H
 #define ACCESSIBLE_ABILITY_CHANNEL_H
 
+#include <atomic>
+#include <functional>
+#include <map>
+#include <tuple>
+#include "accessibility_window_connection.h"
 #include "accessible_ability_channel_stub.h"
 #include "event_handler.h"
 #include "ffrt_inner.h"
@@ -105,11 +110,48 @@ public:
     RetError RemoveAccessibilityVirtualNode(const int64_t id, const int32_t windowId,
         const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback) override;
 
+    RetError SearchElementInfosBatch(const int32_t windowId, const int32_t treeId,
+        const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter = false,
+        bool systemApi = false) override;
+
+    RetError GrantElementOperator(const int32_t windowId, const int32_t treeId,
+        sptr<IRemoteObject> &grantedOperator) override;
+
+    RetError SearchElementTreeDiff(const int32_t windowId, const int32_t treeId, const uint64_t sinceGeneration,
+        const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+
 private:
+    // an operator found by GetElementOperator, used until the proxy generation of its window connection changes
+    struct ResolvedOperator {
+        sptr<AccessibilityWindowConnection> connection = nullptr;
+        sptr<IAccessibilityElementOperator> elementOperator = nullptr;
+        int32_t realWindowId = INVALID_WINDOW_ID;
+        uint64_t proxyGeneration = 0; // the proxies, the broker flag and the registration of the connection
+    };
+    // the real window id and the display id converted from the requested window, and the treeId
+    using OperatorKey = std::tuple<int32_t, uint64_t, int32_t>;
+    static constexpr size_t OPERATOR_CACHE_SIZE = 64;
+
     sptr<AccessibleAbilityConnection> GetConnection(int32_t accountId, const std::string &clientName) const;
     RetError GetElementOperator(int32_t accountId, int32_t windowId, int32_t focusType,
         const std::string &clientName, sptr<IAccessibilityElementOperator> &elementOperator, const int32_t treeId);
+    RetError ResolveElementOperator(const sptr<AccessibilityAccountData> &accountData, const OperatorKey &key,
+        ResolvedOperator &resolved);
+    bool FindResolvedOperator(const OperatorKey &key, ResolvedOperator &resolved);
+    // the operator of the window is cached and still valid, its queries need no channel thread
+    bool IsOperatorGranted(const int32_t windowId, const int32_t treeId, const int32_t focusType);
+    // post a task to the channel thread, counted until it has run
+    void PostChannelTask(const std::function<void()> &task, const std::string &name);
+    // run a query on the calling binder thread for a granted window while no task of this channel is queued,
+    // on the channel thread otherwise. The calls of one extension thread keep their order as each call waits
+    // for its task, the calls of different threads were never ordered. The state a query reads is guarded by
+    // its owner: the operator cache, the request table, the window snapshot and the window index.
+    void PostElementQuery(const std::function<void()> &task, const int32_t windowId, const int32_t treeId,
+        const int32_t focusType, const std::string &name);
     bool CheckWinFromAwm(const int32_t windowId, const int32_t getElementOperatorResult);
+    RetError InnerGrantElementOperator(const int32_t accountId, const std::string &clientName,
+        const int32_t windowId, const int32_t treeId, sptr<IRemoteObject> &grantedOperator);
     RetError GetWindows(
         uint64_t displayId, std::vector<AccessibilityWindowInfo>& windows, bool systemApi = false) const;
     RetError TransmitActionToMmi(const int32_t action);
@@ -124,6 +166,9 @@ private:
     int32_t accountId_ = -1;
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ = nullptr;
     wptr<AccessibilityAccountData> accountData_;
+    ffrt::mutex operatorCacheMutex_;
+    std::map<OperatorKey, ResolvedOperator> operatorCache_ {}; // guarded by operatorCacheMutex_
+    std::atomic<int32_t> pendingTaskCount_ {0}; // the tasks posted to the channel thread and not run yet
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -16,6 +16,7 @@
 #ifndef ACCESSIBLE_ABILITY_CONNECTION_H
 #define ACCESSIBLE_ABILITY_CONNECTION_H
 
+#include <atomic>
 #include "ability_connect_callback_stub.h"
 #include "accessibility_ability_info.h"
 #include "accessible_ability_channel.h"
@@ -31,6 +32,13 @@ namespace Accessibility {
 
 class AccessibilityAccountData;
 
+struct EventBatchStats {
+    uint64_t receivedCount = 0;
+    uint64_t coalescedCount = 0;
+    uint64_t deliveredCount = 0;
+    uint64_t batchCount = 0;
+};
+
 class AccessibleAbilityConnection : public AAFwk::AbilityConnectionStub {
 public:
     AccessibleAbilityConnection(int32_t accountId, int32_t connectionId, AccessibilityAbilityInfo &abilityInfo,
@@ -49,6 +57,19 @@ public:
 
     bool OnKeyPressEvent(const MMI::KeyEvent &keyEvent, const int32_t sequence);
 
+    /**
+     * @brief Get the counters of events received, coalesced and delivered in batching mode.
+     * @return The event batch statistics of this connection.
+     */
+    EventBatchStats GetEventBatchStats();
+
+    /**
+     * @brief Set the interval of batched event delivery, the pending events are sent when batching is disabled.
+     *        The connection starts with the interval of persist.accessibility.event_batch_interval.
+     * @param interval The interval in ms, 0 disables batching.
+     */
+    void SetEventBatchInterval(const int32_t interval);
+
     void SetAbilityInfoTargetBundleName(const std::vector<std::string> &targetBundleNames);
 
     // Get Attribution
@@ -103,6 +124,12 @@ private:
 
     bool IsWantedEvent(int32_t eventType);
     void InitAbilityClient(const sptr<IRemoteObject> &remoteObject);
+    static bool IsCoalescibleEvent(EventType eventType);
+    void BatchAccessibilityEvent(const AccessibilityEventInfo &eventInfo);
+    void FlushPendingEvents();
+    std::vector<AccessibilityEventInfo> TakePendingEventsLocked();
+    void SendPendingEvents(const std::vector<AccessibilityEventInfo> &events);
+    bool SchedulePendingEventsFlushLocked();
 
     int32_t accountId_ = -1;
     int32_t connectionId_ = -1;
@@ -114,6 +141,12 @@ private:
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_ = nullptr;
     bool isRegisterDisconnectCallback_ = false;
     std::string connectionKey_;
+    std::atomic<int32_t> eventBatchInterval_ {0}; // ms, 0 means batching is disabled
+    bool isFlushScheduled_ = false;
+    std::vector<AccessibilityEventInfo> pendingEvents_;
+    EventBatchStats eventBatchStats_;
+    ffrt::mutex pendingEventsMutex_; // mutex for pendingEvents_, isFlushScheduled_ and eventBatchStats_
+    ffrt::mutex sendEventsMutex_; // keeps the batches in order, taken before pendingEventsMutex_
     sptr<AppExecFwk::IBundleMgr> GetBundleMgrProxy();
     sptr<AppExecFwk::IAppMgr> GetAppMgrProxy();
     wptr<AccessibilityAccountData> accountData_;
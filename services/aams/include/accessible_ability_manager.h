@@ -141,6 +141,7 @@ private:
     void DisconnectAbility(
         sptr<AccessibleAbilityConnection>& connection,
         const std::string& uri);
+    void OnConnectedAbilitiesChanged();
 
 private:
     int32_t accountId_ = 0;
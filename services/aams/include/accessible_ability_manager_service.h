@@ -170,7 +170,7 @@ public:
     ErrCode SearchNeedEvents(std::vector<uint32_t> &needEvents) override;
     ErrCode GetReadableRules(std::string &readableRules) override;
     ErrCode IsInnerWindowRootElement(int64_t elementId, bool &state) override;
-    std::vector<AccessibilityWindowInfo> GetAccessibilityWindows(int32_t userId);
+    std::vector<AccessibilityWindowInfo> GetAccessibilityWindows(int32_t userId, uint64_t displayId);
     bool InnerGetAccessibilityWindow(int32_t windowId, AccessibilityWindowInfo &window, int32_t userId);
 private:
     std::atomic<int32_t> focusWindowId_ = -1;
@@ -212,6 +212,11 @@ public:
         return channelRunner_;
     }
 
+    inline std::shared_ptr<AAMSEventHandler> &GetHoverEnterHandler()
+    {
+        return hoverEnterHandler_;
+    }
+
     sptr<AccessibilityAccountData> GetAccountData(int32_t accountId);
     sptr<AccessibilityAccountData> GetCurrentAccountData();
     std::vector<int32_t> GetAllAccountIds();
@@ -453,17 +458,12 @@ private:
     std::shared_ptr<AppExecFwk::EventRunner> actionRunner_;
     std::shared_ptr<AAMSEventHandler> actionHandler_;
 
-    std::shared_ptr<AppExecFwk::EventRunner> sendEventRunner_;
-    std::shared_ptr<AAMSEventHandler> sendEventHandler_;
-
     std::shared_ptr<AppExecFwk::EventRunner> channelRunner_;
     std::shared_ptr<AAMSEventHandler> channelHandler_;
 
     std::shared_ptr<AppExecFwk::EventRunner> hoverEnterRunner_;
     std::shared_ptr<AAMSEventHandler> hoverEnterHandler_;
 
-    int64_t ipcTimeoutNum_ = 0; // count ipc timeout number
-
     sptr<IRemoteObject::DeathRecipient> stateObserversDeathRecipient_ = nullptr;
     sptr<IRemoteObject::DeathRecipient> captionPropertyCallbackDeathRecipient_ = nullptr;
     sptr<IRemoteObject::DeathRecipient> enableAbilityListsObserverDeathRecipient_ = nullptr;
@@ -21,6 +21,7 @@
 #include <future>
 #include <chrono>
 #include <atomic>
+#include <functional>
 
 #include "accessibility_element_info.h"
 #include "accessibility_element_operator_callback_stub.h"
@@ -57,6 +58,9 @@ public:
         const int32_t requestId) override;
     virtual void SetRemoveAccessibilityVirtualNodeResult(const OperateVirtualNodeResult result,
         const int32_t requestId) override;
+    virtual void SetSearchElementInfosBatchResult(const std::vector<ElementSearchResult> &results,
+        const int32_t requestId) override;
+    virtual void SetSearchElementTreeDiffResult(const ElementTreeDiff &diff, const int32_t requestId) override;
 
     ffrt::promise<void> promise_;
     std::atomic<bool> promiseSet_ {false};
@@ -72,6 +76,8 @@ public:
     bool needTerminate_ = false;
     int32_t accountId_ = -1;
     OperateVirtualNodeResult operateVirtualNodeResult_ = OperateVirtualNodeResult::VIRTUAL_NODE_NOT_SUPPORT;
+    // invoked once when the result arrives, for callers that do not wait on promise_
+    std::function<void(ElementOperatorCallbackImpl &)> resultCallback_ = nullptr;
 
     bool ValidateElementInfos(const std::list<AccessibilityElementInfo>& infos);
     void SetPromiseValue();
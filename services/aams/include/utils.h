@@ -22,8 +22,13 @@
 #include "accessibility_event_info.h"
 #include "bundle_info.h"
 #include <atomic>
+#include <memory>
 
 namespace OHOS {
+namespace Global::Resource {
+class ResourceManager;
+} // namespace Global::Resource
+
 namespace Accessibility {
 enum class TraceTaskId : int32_t {
     ACCESSIBLE_ABILITY_CONNECT = 0,
@@ -86,12 +91,15 @@ public:
     static float StringToFloat(const std::string& value, const float& defaultValue);
     static int32_t GetTreeIdBySplitElementId(const int64_t elementId);
     static RetError GetResourceBundleInfo(AccessibilityEventInfo &eventInfo, int32_t userId);
+    static std::string GetResourceCacheKey(int32_t userId, const std::string &bundleName);
     static std::string GetSeniorModeStateKey(const std::string& bundleName, int32_t appIndex);
     static bool ParseSeniorModeStateKey(const std::string& key, std::string& bundleName, int32_t& appIndex);
 private:
     static std::string TransferUnavailableEventToString(A11yUnavailableEvent type);
     static RetError GetResourceValue(
-        AccessibilityEventInfo &eventInfo, AppExecFwk::BundleInfo bundleInfo, int32_t userId, std::string &result);
+        AccessibilityEventInfo &eventInfo, int32_t userId, const std::string &language, std::string &result);
+    static std::shared_ptr<Global::Resource::ResourceManager> CreateResourceManager(
+        AccessibilityEventInfo &eventInfo, int32_t userId, const std::string &language);
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -1200,45 +1200,77 @@ void AccessibilityAccountDataMap::Clear()
     accountDataMap_.clear();
 }
 
-// LCOV_EXCL_START
 void AccessibilityAccountData::isSendEvent(const AccessibilityEventInfo &eventInfo)
 {
-    std::map<std::string, sptr<AccessibleAbilityConnection>> abilities = GetConnectedA11yAbilities();
+    std::shared_ptr<const EventDispatchTable> table = std::atomic_load(&eventDispatchTable_);
+    if (table == nullptr) {
+        return;
+    }
+
     uint32_t eventType = eventInfo.GetEventType();
-    std::string bundleName = "";
+    auto iter = table->eventConnections.find(eventType);
+    const std::vector<sptr<AccessibleAbilityConnection>> &connections =
+        (iter != table->eventConnections.end()) ? iter->second : table->allEventConnections;
+    HILOG_DEBUG("send event type is %{public}d, connection size is %{public}zu", eventType, connections.size());
+    for (const auto &connection : connections) {
+        connection->OnAccessibilityEvent(const_cast<AccessibilityEventInfo&>(eventInfo));
+    }
+}
+
+void AccessibilityAccountData::RebuildEventDispatchTable()
+{
     std::lock_guard<ffrt::mutex> lock(abilityNeedEventsMutex_);
+    RebuildEventDispatchTableLocked();
+}
+
+void AccessibilityAccountData::RebuildEventDispatchTableLocked()
+{
+    std::map<std::string, sptr<AccessibleAbilityConnection>> abilities = GetConnectedA11yAbilities();
+    std::vector<std::pair<sptr<AccessibleAbilityConnection>, const std::vector<uint32_t>*>> subscribers;
+    std::set<uint32_t> eventTypes;
+    auto table = std::make_shared<EventDispatchTable>();
     for (auto &ability : abilities) {
+        if (ability.second == nullptr) {
+            continue;
+        }
+        std::string bundleName = "";
         size_t pos = ability.first.find('/');
         if (pos != std::string::npos) {
             bundleName = ability.first.substr(0, pos);
         }
-
-        HILOG_DEBUG("send event type is %{public}d, bundle name is %{public}s", eventType, bundleName.c_str());
         auto it = abilityNeedEvents_.find(bundleName);
-        if (it != abilityNeedEvents_.end()) {
-            uint32_t needEventSize = it->second.size();
-            if (needEventSize == 0) { // default
-                ability.second->OnAccessibilityEvent(const_cast<AccessibilityEventInfo&>(eventInfo));
-            } else {
-                uint32_t event = it->second.at(0);
-                if (event == TYPES_ALL_MASK) {  // all event
-                    ability.second->OnAccessibilityEvent(const_cast<AccessibilityEventInfo&>(eventInfo));
-                    continue;
-                }
-
-                if (event == TYPE_VIEW_INVALID) {  // none event
-                    continue;
-                }
-
-                auto isEvent = std::find(it->second.begin(), it->second.end(), eventType);
-                if (isEvent != it->second.end()) {
-                    ability.second->OnAccessibilityEvent(const_cast<AccessibilityEventInfo&>(eventInfo));
-                }
+        if (it == abilityNeedEvents_.end()) {
+            continue;
+        }
+
+        const std::vector<uint32_t> &events = it->second;
+        if (events.empty() || events.at(0) == TYPES_ALL_MASK) { // default or all event
+            subscribers.emplace_back(ability.second, nullptr);
+            table->allEventConnections.push_back(ability.second);
+            continue;
+        }
+        if (events.at(0) == TYPE_VIEW_INVALID) { // none event
+            continue;
+        }
+        subscribers.emplace_back(ability.second, &events);
+        eventTypes.insert(events.begin(), events.end());
+    }
+
+    // keep the connected abilities order for every event type.
+    for (uint32_t eventType : eventTypes) {
+        std::vector<sptr<AccessibleAbilityConnection>> &connections = table->eventConnections[eventType];
+        for (auto &subscriber : subscribers) {
+            if (subscriber.second == nullptr ||
+                std::find(subscriber.second->begin(), subscriber.second->end(), eventType) !=
+                subscriber.second->end()) {
+                connections.push_back(subscriber.first);
             }
         }
     }
+    HILOG_DEBUG("all event connection size is %{public}zu, event type size is %{public}zu",
+        table->allEventConnections.size(), table->eventConnections.size());
+    std::atomic_store(&eventDispatchTable_, std::shared_ptr<const EventDispatchTable>(table));
 }
-// LCOV_EXCL_STOP
 
 void AccessibilityAccountData::UpdateAbilityNeedEvent(const std::string &name, std::vector<uint32_t> needEvents)
 {
@@ -1262,6 +1294,7 @@ void AccessibilityAccountData::UpdateAbilityNeedEvent(const std::string &name, s
     HILOG_DEBUG("abilityNeedEvents_ size is %{public}zu, needEvent size is %{public}zu",
         abilityNeedEvents_.size(), abilityNeedEvents_[name].size());
     UpdateNeedEvents();
+    RebuildEventDispatchTableLocked();
 }
 
 void AccessibilityAccountData::RemoveNeedEvent(const std::string &name)
@@ -1274,6 +1307,7 @@ void AccessibilityAccountData::RemoveNeedEvent(const std::string &name)
             bundleName.c_str(), abilityNeedEvents_.size());
         abilityNeedEvents_.erase(bundleName);
         UpdateNeedEvents();
+        RebuildEventDispatchTableLocked();
     }
 }
 
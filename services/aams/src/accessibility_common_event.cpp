@@ -16,6 +16,7 @@
 #include "accessibility_common_event.h"
 #include <unistd.h>
 #include "accessible_ability_manager_service.h"
+#include "accessibility_resource_bundle_manager.h"
 #include "common_event_manager.h"
 #include "common_event_support.h"
 #include "hilog_wrapper.h"
@@ -171,6 +172,7 @@ void AccessibilityCommonEvent::HandlePackageRemoved(const EventFwk::CommonEventD
     std::string bundleName = data.GetWant().GetBundle();
     int userId = data.GetWant().GetIntParam(KEY_USER_ID, 0);
     HILOG_INFO("bundleName is %{public}s", bundleName.c_str());
+    Singleton<AccessibilityResourceBundleManager>::GetInstance().ClearResourceCache(bundleName, userId);
     Singleton<AccessibleAbilityManagerService>::GetInstance().PackageRemoved(bundleName, userId);
 }
 
@@ -187,6 +189,7 @@ void AccessibilityCommonEvent::HandlePackageChanged(const EventFwk::CommonEventD
     std::string bundleName = data.GetWant().GetBundle();
     int userId = data.GetWant().GetIntParam(KEY_USER_ID, 0);
     HILOG_INFO("bundleName is %{public}s", bundleName.c_str());
+    Singleton<AccessibilityResourceBundleManager>::GetInstance().ClearResourceCache(bundleName, userId);
     Singleton<AccessibleAbilityManagerService>::GetInstance().PackageChanged(bundleName, userId);
 }
 
@@ -226,6 +229,7 @@ void AccessibilityCommonEvent::HandlePowerOnEvent(const EventFwk::CommonEventDat
 void AccessibilityCommonEvent::HandleLocalChangedEvent(const EventFwk::CommonEventData &data) const
 {
     HILOG_DEBUG("reInit Resource.");
+    Singleton<AccessibilityResourceBundleManager>::GetInstance().ClearResourceCache();
     Singleton<AccessibleAbilityManagerService>::GetInstance().InitResource(true);
 }
 // LCOV_EXCL_STOP
@@ -22,6 +22,8 @@
 #include <sstream>
 
 #include "accessibility_account_data.h"
+#include "accessibility_event_dispatcher.h"
+#include "accessibility_resource_bundle_manager.h"
 #include "accessibility_window_manager.h"
 #include "accessible_ability_manager_service.h"
 #include "hilog_wrapper.h"
@@ -35,6 +37,7 @@ const std::string ARG_DUMP_HELP = "-h";
 const std::string ARG_DUMP_USER = "-u";
 const std::string ARG_DUMP_CLIENT = "-c";
 const std::string ARG_DUMP_ACCESSIBILITY_WINDOW = "-w";
+const std::string ARG_DUMP_STATISTICS = "-s";
 
 // Helper: dump capabilities and various settings from AccessibilitySettingsConfig
 void AppendCapabilitiesAndSettings(std::ostringstream& oss, const AccessibilitySettingsConfig& config)
@@ -135,8 +138,27 @@ int AccessibilityDumper::DumpAccessibilityWindowInfo(std::string& dumpInfo) cons
         }
     }
 
+    oss << std::endl;
+    for (const auto &iter : connectedWindowList) {
+        if (iter.second == nullptr) {
+            continue;
+        }
+        AccessibilityIpcHealth &ipcHealth = iter.second->GetIpcHealth();
+        AccessibilityIpcHealth::Stats stats = ipcHealth.GetStats();
+        oss << "    window " << iter.first << ": fastFail " << stats.fastFailCount << ", breaker "
+            << AccessibilityIpcHealth::ToString(stats.state) << std::endl;
+        for (auto kind : { AccessibilityIpcHealth::RequestKind::NODE, AccessibilityIpcHealth::RequestKind::TREE }) {
+            stats = ipcHealth.GetStats(kind);
+            oss << "        " << AccessibilityIpcHealth::ToString(kind) << ": ewmaMs " << stats.ewmaMs << ", p99Ms "
+                << stats.p99Ms << ", deadlineMs " << stats.deadlineMs << ", answered " << stats.answeredCount
+                << ", timeout " << stats.timeoutCount << std::endl;
+        }
+    }
+
     index = 0;
     dumpInfo.append(oss.str());
+    dumpInfo.append("recorded window updates:\n");
+    currentAccount->GetWindowManager().DumpRecordedWindowUpdates(dumpInfo);
     return 0;
 }
 
@@ -280,6 +302,11 @@ int AccessibilityDumper::DumpAccessibilityClientInfo(std::string& dumpInfo) cons
             }
         }
 
+        EventBatchStats eventBatchStats = iter.second->GetEventBatchStats();
+        oss << "    batchedEvents: received " << eventBatchStats.receivedCount << ", coalesced " <<
+            eventBatchStats.coalescedCount << ", delivered " << eventBatchStats.deliveredCount << ", batches " <<
+            eventBatchStats.batchCount << std::endl;
+
         if (index != connectedAbilities.size()) {
             oss << std::endl << "    -------------------------------" << std::endl << std::endl;
         }
@@ -312,6 +339,44 @@ int AccessibilityDumper::DumpAccessibilityUserInfo(std::string& dumpInfo) const
     return 0;
 }
 
+int AccessibilityDumper::DumpAccessibilityStatisticsInfo(std::string& dumpInfo) const
+{
+    HILOG_INFO();
+    std::ostringstream oss;
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    Singleton<AccessibilityResourceBundleManager>::GetInstance().GetResourceCacheStats(hitCount, missCount);
+    oss << "resourceCache: hit " << hitCount << ", miss " << missCount << std::endl;
+
+    AccessibilityEventDispatcher::DispatchStats stats =
+        Singleton<AccessibilityEventDispatcher>::GetInstance().GetDispatchStats();
+    oss << "sendEvent: depth " << stats.depth << ", peakDepth " << stats.peakDepth
+        << ", dispatched " << stats.dispatchedCount << ", dropped " << stats.droppedCount
+        << ", rejected " << stats.rejectedCount << std::endl;
+    oss << "    depth[1, 2-4, 5-16, 17-64, 65-256, >256]:";
+    for (auto count : stats.depthHistogram) {
+        oss << " " << count;
+    }
+    oss << std::endl << "    latencyMs[<1, <4, <16, <64, <256, >=256]:";
+    for (auto count : stats.latencyHistogram) {
+        oss << " " << count;
+    }
+    oss << std::endl;
+    std::map<int32_t, AccessibilityEventDispatcher::DispatchStats> windowStats =
+        Singleton<AccessibilityEventDispatcher>::GetInstance().GetWindowDispatchStats();
+    for (auto &window : windowStats) {
+        oss << "    window " << window.first << ": depth " << window.second.depth << ", peakDepth "
+            << window.second.peakDepth << ", dispatched " << window.second.dispatchedCount << ", dropped "
+            << window.second.droppedCount << ", rejected " << window.second.rejectedCount << ", latencyMs:";
+        for (auto count : window.second.latencyHistogram) {
+            oss << " " << count;
+        }
+        oss << std::endl;
+    }
+    dumpInfo.append(oss.str());
+    return 0;
+}
+
 int AccessibilityDumper::DumpAccessibilityInfo(const std::vector<std::string>& args, std::string& dumpInfo) const
 {
     if (args.empty()) {
@@ -324,6 +389,8 @@ int AccessibilityDumper::DumpAccessibilityInfo(const std::vector<std::string>& a
         dumpType = DumpType::DUMP_CLIENT;
     } else if (args[0] == ARG_DUMP_ACCESSIBILITY_WINDOW) {
         dumpType = DumpType::DUMP_ACCESSIBILITY_WINDOW;
+    } else if (args[0] == ARG_DUMP_STATISTICS) {
+        dumpType = DumpType::DUMP_STATISTICS;
     }
     int ret = 0;
     switch (dumpType) {
@@ -336,6 +403,9 @@ int AccessibilityDumper::DumpAccessibilityInfo(const std::vector<std::string>& a
         case DumpType::DUMP_ACCESSIBILITY_WINDOW:
             ret = DumpAccessibilityWindowInfo(dumpInfo);
             break;
+        case DumpType::DUMP_STATISTICS:
+            ret = DumpAccessibilityStatisticsInfo(dumpInfo);
+            break;
         default:
             ret = -1;
             break;
@@ -358,7 +428,9 @@ void AccessibilityDumper::ShowHelpInfo(std::string& dumpInfo) const
         .append(" -c                    ")
         .append("|dump accessibility client in the system\n")
         .append(" -w                    ")
-        .append("|dump accessibility window info in the system\n");
+        .append("|dump accessibility window info in the system\n")
+        .append(" -s                    ")
+        .append("|dump accessibility service statistics in the system\n");
 }
 } // namespace Accessibility
 } // OHOS
\ No newline at end of file
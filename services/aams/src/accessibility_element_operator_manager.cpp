@@ -18,6 +18,7 @@
 #include "utils.h"
 #include "hilog_wrapper.h"
 #include "accessibility_account_data.h"
+#include "accessible_ability_manager_service.h"
 #include "element_operator_callback_impl.h"
 #include "accessible_extend_manager_service_proxy.h"
 #include "accessibility_window_manager.h"
@@ -32,6 +33,9 @@ namespace {
     constexpr int64_t ELEMENT_ID_INVALID = -1;
     constexpr int32_t WINDOW_ID_INVALID = -1;
     constexpr uint32_t TIME_OUT_OPERATOR = 5000;
+    constexpr int64_t HOVER_ENTER_VERDICT_TTL = 1000; // ms
+    constexpr size_t HOVER_ENTER_VERDICT_CACHE_MAX = 128;
+    const std::string HOVER_ENTER_TIMEOUT_TASK = "TASK_HOVER_ENTER_TIMEOUT_";
 }
 ElementOperatorManager::~ElementOperatorManager()
 {
@@ -46,12 +50,14 @@ void ElementOperatorManager::SetAccountData(int32_t accountId, const wptr<Access
  
 int32_t ElementOperatorManager::GenerateRequestId()
 {
-    int32_t requestId = requestId_.fetch_add(1, std::memory_order_relaxed);
-    if (requestId == REQUEST_ID_MAX) {
-        requestId_ = REQUEST_ID_MIN;
-        requestId = requestId_.fetch_add(1, std::memory_order_relaxed);
-    }
-    return requestId;
+    // wrap around in the same CAS, a separate reset could hand out the same id twice
+    int32_t requestId = requestId_.load(std::memory_order_relaxed);
+    int32_t nextId = 0;
+    do {
+        nextId = static_cast<int32_t>(static_cast<uint32_t>(requestId) + 1);
+        nextId = (nextId == REQUEST_ID_MAX) ? REQUEST_ID_MIN : nextId;
+    } while (!requestId_.compare_exchange_weak(requestId, nextId, std::memory_order_relaxed));
+    return nextId;
 }
  
 int32_t ElementOperatorManager::ApplyTreeId()
@@ -86,6 +92,10 @@ void ElementOperatorManager::AddAccessibilityWindowConnection(
 {
     HILOG_INFO("windowId(%{public}d)", windowId);
     std::lock_guard lock(asacConnectionsMutex_);
+    auto iter = asacConnections_.find(windowId);
+    if (iter != asacConnections_.end() && iter->second != nullptr && iter->second != interactionConnection) {
+        iter->second->MarkProxiesStale();
+    }
     asacConnections_[windowId] = interactionConnection;
 }
 
@@ -95,8 +105,18 @@ void ElementOperatorManager::RemoveAccessibilityWindowConnection(const int32_t w
     std::lock_guard lock(asacConnectionsMutex_);
     std::map<int32_t, sptr<AccessibilityWindowConnection>>::iterator it = asacConnections_.find(windowId);
     if (it != asacConnections_.end()) {
+        if (it->second != nullptr) {
+            it->second->MarkProxiesStale();
+        }
         asacConnections_.erase(it);
     }
+
+    std::lock_guard<ffrt::mutex> hoverLock(hoverEnterMutex_);
+    pendingHoverEnterEvents_.erase(windowId);
+    hoverContentGenerations_.erase(windowId);
+    for (auto iter = hoverEnterVerdicts_.begin(); iter != hoverEnterVerdicts_.end();) {
+        iter = std::get<0>(iter->first) == windowId ? hoverEnterVerdicts_.erase(iter) : std::next(iter);
+    }
 }
 
 sptr<AccessibilityWindowConnection> ElementOperatorManager::GetAccessibilityWindowConnection(const int32_t windowId)
@@ -164,7 +184,31 @@ void ElementOperatorManager::RemoveTreeDeathRecipient(int32_t windowId, int32_t
 void ElementOperatorManager::Clear()
 {
     std::lock_guard lock(asacConnectionsMutex_);
+    for (auto &iter : asacConnections_) {
+        if (iter.second != nullptr) {
+            iter.second->MarkProxiesStale();
+        }
+    }
     asacConnections_.clear();
+
+    std::lock_guard<ffrt::mutex> hoverLock(hoverEnterMutex_);
+    pendingHoverEnterEvents_.clear();
+    hoverEnterVerdicts_.clear();
+    hoverContentGenerations_.clear();
+}
+
+void ElementOperatorManager::RevokeElementOperatorGrantsExcept(const std::set<std::string> &clientNames)
+{
+    std::map<int32_t, sptr<AccessibilityWindowConnection>> connections;
+    {
+        std::lock_guard lock(asacConnectionsMutex_);
+        connections = asacConnections_;
+    }
+    for (auto &[windowId, connection] : connections) {
+        if (connection != nullptr) {
+            connection->RevokeElementOperatorGrantsExcept(clientNames);
+        }
+    }
 }
 
 RetError ElementOperatorManager::RegisterElementOperatorByWindowId(int32_t windowId,
@@ -302,79 +346,87 @@ RetError ElementOperatorManager::DeregisterElementOperatorByWindowIdAndTreeId(
     return RET_OK;
 }
  
-void ElementOperatorManager::AddRequestId(
-    int32_t windowId, int32_t treeId, int32_t requestId, sptr<IAccessibilityElementOperatorCallback> callback)
+void ElementOperatorManager::AddRequestId(int32_t windowId, int32_t treeId, int32_t requestId,
+    sptr<IAccessibilityElementOperatorCallback> callback, AccessibilityIpcHealth::RequestKind kind)
 {
-    std::lock_guard<ffrt::mutex> lock(requestIdmutex_);
     HILOG_DEBUG("Add windowId: %{public}d treeId: %{public}d requestId: %{public}d", windowId, treeId, requestId);
-    if (!windowRequestIdMap_.count(windowId)) {
-        windowRequestIdMap_[windowId] = {};
+    int64_t startTime = Utils::GetSystemTime();
+    AccessibilityRequestTable::Request replaced;
+    AccessibilityRequestTable::InsertResult result =
+        requestTable_.Insert(requestId, { callback, windowId, treeId, startTime, kind }, replaced);
+    if (result == AccessibilityRequestTable::InsertResult::FULL) {
+        return;
     }
-    if (!windowRequestIdMap_[windowId].count(treeId)) {
-        windowRequestIdMap_[windowId][treeId] = {};
+    if (result == AccessibilityRequestTable::InsertResult::REPLACED) {
+        // the id was used again before its answer, the new request takes it over as the map used to do
+        HILOG_WARN("requestId: %{public}d of windowId: %{public}d is replaced", requestId, replaced.windowId);
     }
-    if (!windowRequestIdMap_[windowId][treeId].count(requestId)) {
-        windowRequestIdMap_[windowId][treeId].insert(requestId);
-        requestIdMap_[requestId] = callback;
+    sptr<AccessibilityWindowConnection> connection = GetAccessibilityWindowConnection(windowId);
+    std::shared_ptr<AAMSEventHandler> handler =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainHandler();
+    if (connection == nullptr || handler == nullptr) {
+        return;
     }
+    wptr<AccessibilityAccountData> weakAccountData = accountData_;
+    handler->PostTask([weakAccountData, requestId, startTime]() {
+        sptr<AccessibilityAccountData> accountData = weakAccountData.promote();
+        if (accountData) {
+            accountData->GetElementOperatorManager().OnRequestDeadline(requestId, startTime);
+        }
+    }, "TASK_REQUEST_DEADLINE", connection->GetIpcHealth().GetDeadline(kind));
 }
 
 void ElementOperatorManager::RemoveRequestId(int32_t requestId)
 {
-    std::lock_guard<ffrt::mutex> lock(requestIdmutex_);
     HILOG_DEBUG("RemoveRequestId requestId: %{public}d", requestId);
-    for (auto &window : windowRequestIdMap_) {
-        for (auto &tree : window.second) {
-            auto it = tree.second.find(requestId);
-            if (it != tree.second.end()) {
-                HILOG_DEBUG("tree.second.erase requestId:%{public}d", requestId);
-                tree.second.erase(it);
-            }
-            auto ite = requestIdMap_.find(requestId);
-            if (ite != requestIdMap_.end()) {
-                HILOG_DEBUG("requestIdMap_.erase requestId:%{public}d", requestId);
-                requestIdMap_.erase(ite);
-            }
-        }
+    AccessibilityRequestTable::Request request;
+    if (!requestTable_.Erase(requestId, request)) {
+        return;
+    }
+    sptr<AccessibilityWindowConnection> connection = GetAccessibilityWindowConnection(request.windowId);
+    if (connection != nullptr) {
+        connection->GetIpcHealth().RecordLatency(Utils::GetSystemTime() - request.startTime, request.kind);
     }
 }
 
-void ElementOperatorManager::StopCallbackWait(int32_t windowId)
+void ElementOperatorManager::OnRequestDeadline(int32_t requestId, int64_t startTime)
 {
-    HILOG_INFO("StopCallbackWait start windowId: %{public}d", windowId);
-    if (!windowRequestIdMap_.count(windowId)) {
-        HILOG_DEBUG("windowId not exists");
+    AccessibilityRequestTable::Request request;
+    // the id may be answered and used again by another request meanwhile
+    if (!requestTable_.Erase(requestId, request, startTime)) {
         return;
     }
-    for (auto iter = windowRequestIdMap_[windowId].begin(); iter != windowRequestIdMap_[windowId].end(); ++iter) {
-        HILOG_DEBUG("stop callback wait windowId: %{public}d, treeId: %{public}d", windowId, iter->first);
-        StopCallbackWait(windowId, iter->first);
+    HILOG_WARN("windowId: %{public}d does not answer requestId: %{public}d", request.windowId, requestId);
+    sptr<AccessibilityWindowConnection> connection = GetAccessibilityWindowConnection(request.windowId);
+    if (connection != nullptr) {
+        connection->GetIpcHealth().RecordTimeout(request.kind);
+    }
+    if (request.callback != nullptr) {
+        request.callback->SetExecuteActionResult(false, requestId);
     }
 }
- 
+
+void ElementOperatorManager::StopCallbackWait(int32_t windowId)
+{
+    HILOG_INFO("StopCallbackWait start windowId: %{public}d", windowId);
+    CancelRequests(requestTable_.EraseByWindow(windowId));
+}
+
 void ElementOperatorManager::StopCallbackWait(int32_t windowId, int32_t treeId)
 {
-    std::lock_guard<ffrt::mutex> lock(requestIdmutex_);
     HILOG_DEBUG("StopCallbackWait start windowId: %{public}d treeId: %{public}d", windowId, treeId);
-    if (!windowRequestIdMap_.count(windowId)) {
-        return;
-    }
-    if (!windowRequestIdMap_[windowId].count(treeId)) {
-        return;
-    }
-    auto requestIds = windowRequestIdMap_[windowId][treeId];
-    for (auto requestId = requestIds.begin(); requestId != requestIds.end();) {
-        HILOG_DEBUG("stop callback wait windowId: %{public}d, requestId: %{public}d", windowId, *requestId);
-        auto iter = requestIdMap_.find(*requestId);
-        if (iter != requestIdMap_.end()) {
-            HILOG_DEBUG("requestIdMap_ set callback and erase requestId:%{public}d", *requestId);
-            sptr<IAccessibilityElementOperatorCallback> callback = requestIdMap_[*requestId];
-            if (callback != nullptr) {
-                callback->SetExecuteActionResult(false, *requestId);
-            }
-            requestIdMap_.erase(iter);
+    CancelRequests(requestTable_.EraseByWindow(windowId, treeId));
+}
+
+void ElementOperatorManager::CancelRequests(
+    const std::vector<std::pair<int32_t, AccessibilityRequestTable::Request>> &requests)
+{
+    for (auto &request : requests) {
+        HILOG_DEBUG("stop callback wait windowId: %{public}d, treeId: %{public}d, requestId: %{public}d",
+            request.second.windowId, request.second.treeId, request.first);
+        if (request.second.callback != nullptr) {
+            request.second.callback->SetExecuteActionResult(false, request.first);
         }
-        requestId = requestIds.erase(requestId);
     }
 }
 
@@ -399,6 +451,10 @@ bool ElementOperatorManager::GetParentElementRecursively(
             elementId, windowId, treeId);
         return false;
     }
+    if (!connection->GetIpcHealth().AllowRequest()) {
+        HILOG_ERROR("windowId: %{public}d does not answer, fail fast", windowId);
+        return false;
+    }
     sptr<ElementOperatorCallbackImpl> callBack = new(std::nothrow) ElementOperatorCallbackImpl(accountId_);
     if (callBack == nullptr) {
         HILOG_ERROR("Failed to create callBack.");
@@ -506,37 +562,57 @@ bool ElementOperatorManager::GetMagnificationState()
     return false;
 }
  
-bool ElementOperatorManager::InvalidHoverEnterEvent(AccessibilityEventInfo &event)
+ElementOperatorManager::HoverEnterCheckResult ElementOperatorManager::CheckHoverEnterEvent(
+    AccessibilityEventInfo &event)
 {
     if (event.GetEventType() != TYPE_VIEW_HOVER_ENTER_EVENT) {
-        return false;
+        return HoverEnterCheckResult::VALID;
     }
     std::string readableRules;
     sptr<AccessibilityAccountData> accountData = accountData_.promote();
     if (!accountData || accountData->GetAccessibleAbilityManager().GetReadableRules(readableRules) != RET_OK ||
         readableRules.empty()) {
         HILOG_INFO("no readablerules");
-        return false;
+        return HoverEnterCheckResult::VALID;
     }
     auto& originElementInfo = event.GetElementInfo();
     int32_t treeId = originElementInfo.GetBelongTreeId();
     if (treeId <= 0) {
-        return false;
+        return HoverEnterCheckResult::VALID;
     }
     auto actionList = originElementInfo.GetActionList();
     for (const auto& action : actionList) {
         if (action.GetActionType() == ActionType::ACCESSIBILITY_ACTION_NEXT_HTML_ITEM ||
             action.GetActionType() == ActionType::ACCESSIBILITY_ACTION_PREVIOUS_HTML_ITEM) {
             HILOG_DEBUG("isWebNode");
-            return false;
+            return HoverEnterCheckResult::VALID;
         }
     }
     auto windowId = event.GetWindowId();
+    HoverEnterKey key = std::make_tuple(windowId, treeId, originElementInfo.GetAccessibilityId());
+    HoverEnterVerdict verdict;
+    if (GetHoverEnterVerdict(key, verdict)) {
+        return ApplyHoverEnterVerdict(verdict, event) ? HoverEnterCheckResult::INVALID : HoverEnterCheckResult::VALID;
+    }
+
     int64_t parentId = -1;
     GetRootParentId(windowId, treeId, parentId);
     sptr<IAccessibilityElementOperator> elementOperator = nullptr;
     if (!InnerGetElementOperator(windowId, parentId, elementOperator)) {
-        return false;
+        return HoverEnterCheckResult::VALID;
+    }
+    uint64_t displayId = 0;
+    sptr<AccessibilityWindowConnection> connection = GetRealIdWindowConnection(windowId, FOCUS_TYPE_INVALID, displayId);
+    if (connection == nullptr || !connection->GetIpcHealth().AllowRequest()) {
+        HILOG_DEBUG("windowId: %{public}d does not answer, deliver the hover enter unchecked", windowId);
+        return HoverEnterCheckResult::VALID;
+    }
+    uint32_t deadline = connection->GetIpcHealth().GetDeadline();
+    std::shared_ptr<AAMSEventHandler> handler =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetHoverEnterHandler();
+    if (handler == nullptr) {
+        HILOG_ERROR("hover enter handler is nullptr");
+        return HoverEnterCheckResult::VALID;
     }
  
     AccessibilityFocusMoveParam param = {
@@ -549,30 +625,171 @@ bool ElementOperatorManager::InvalidHoverEnterEvent(AccessibilityEventInfo &even
     sptr<ElementOperatorCallbackImpl> callBack = new(std::nothrow) ElementOperatorCallbackImpl(accountId_);
     if (callBack == nullptr) {
         HILOG_ERROR("Failed to create callBack.");
-        return false;
+        return HoverEnterCheckResult::VALID;
     }
-    ffrt::future<void> promiseFuture = callBack->promise_.get_future();
+
+    uint64_t sequence = 0;
+    uint64_t contentGeneration = 0;
+    {
+        // a newer hover on the same window supersedes the one still waiting for its result
+        std::lock_guard<ffrt::mutex> lock(hoverEnterMutex_);
+        sequence = ++hoverEnterSequence_;
+        auto generation = hoverContentGenerations_.find(windowId);
+        contentGeneration = generation == hoverContentGenerations_.end() ? 0 : generation->second;
+        pendingHoverEnterEvents_[windowId] = { sequence, event };
+    }
+    wptr<AccessibilityAccountData> weakAccountData = accountData_;
+    callBack->resultCallback_ = [weakAccountData, handler, windowId, sequence, contentGeneration, key](
+        ElementOperatorCallbackImpl &result) {
+        HoverEnterVerdict verdict;
+        if (result.elementInfosResult_.size() > 0) {
+            if (result.focusMoveResult_ != FocusMoveResultType::SEARCH_SUCCESS) {
+                verdict.invalid = true;
+            } else if (result.changeToNewInfo_) {
+                verdict.changeToNewInfo = true;
+                verdict.newElementInfo = result.elementInfosResult_[0];
+            }
+        }
+        handler->PostTask([weakAccountData, windowId, sequence, contentGeneration, key, verdict]() {
+            sptr<AccessibilityAccountData> accountData = weakAccountData.promote();
+            if (accountData) {
+                accountData->GetElementOperatorManager().OnHoverEnterSearchResult(windowId, sequence,
+                    contentGeneration, key, verdict);
+            }
+        }, "TASK_HOVER_ENTER_RESULT");
+    };
+    handler->PostTask([weakAccountData, windowId, sequence]() {
+        sptr<AccessibilityAccountData> accountData = weakAccountData.promote();
+        if (accountData) {
+            accountData->GetElementOperatorManager().OnHoverEnterSearchTimeout(windowId, sequence);
+        }
+    }, HOVER_ENTER_TIMEOUT_TASK + std::to_string(sequence), deadline);
     elementOperator->FocusMoveSearchWithCondition(originElementInfo, param, requestId, callBack);
-    ffrt::future_status waitFocus = promiseFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (waitFocus != ffrt::future_status::ready) {
-        HILOG_ERROR("Failed to wait result, requestId: %{public}d", requestId);
-        return false;
+    return HoverEnterCheckResult::PENDING;
+}
+
+bool ElementOperatorManager::GetHoverEnterVerdict(const HoverEnterKey &key, HoverEnterVerdict &verdict)
+{
+    uint64_t supersededSequence = 0;
+    bool found = false;
+    {
+        std::lock_guard<ffrt::mutex> lock(hoverEnterMutex_);
+        // this hover supersedes an older one still waiting on the window
+        auto pending = pendingHoverEnterEvents_.find(std::get<0>(key));
+        if (pending != pendingHoverEnterEvents_.end()) {
+            supersededSequence = pending->second.sequence;
+            pendingHoverEnterEvents_.erase(pending);
+        }
+        auto iter = hoverEnterVerdicts_.find(key);
+        if (iter != hoverEnterVerdicts_.end() && iter->second.expireTime < Utils::GetSystemTime()) {
+            hoverEnterVerdicts_.erase(iter);
+        } else if (iter != hoverEnterVerdicts_.end()) {
+            verdict = iter->second;
+            found = true;
+        }
     }
-    if (callBack->elementInfosResult_.size() <= 0) {
-        HILOG_INFO("result size is 0");
-        return false;
+    if (supersededSequence != 0) {
+        CancelHoverEnterTimeout(supersededSequence);
     }
-    if (callBack->focusMoveResult_ == FocusMoveResultType::SEARCH_SUCCESS) {
-        if (callBack->changeToNewInfo_ && callBack->elementInfosResult_.size() > 0) {
-            auto newElement = callBack->elementInfosResult_[0];
-            event.SetElementInfo(newElement);
-            event.SetSource(newElement.GetAccessibilityId());
-            return false;
+    return found;
+}
+
+void ElementOperatorManager::CancelHoverEnterTimeout(uint64_t sequence)
+{
+    std::shared_ptr<AAMSEventHandler> handler =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetHoverEnterHandler();
+    if (handler == nullptr) {
+        return;
+    }
+    handler->RemoveTask(HOVER_ENTER_TIMEOUT_TASK + std::to_string(sequence));
+}
+
+void ElementOperatorManager::OnHoverEnterSearchResult(int32_t windowId, uint64_t sequence,
+    uint64_t contentGeneration, const HoverEnterKey &key, const HoverEnterVerdict &verdict)
+{
+    // the verdict arrived, the timeout of this query is not needed any more
+    CancelHoverEnterTimeout(sequence);
+    AccessibilityEventInfo event;
+    {
+        std::lock_guard<ffrt::mutex> lock(hoverEnterMutex_);
+        int64_t now = Utils::GetSystemTime();
+        auto generation = hoverContentGenerations_.find(windowId);
+        uint64_t currentGeneration = generation == hoverContentGenerations_.end() ? 0 : generation->second;
+        if (currentGeneration == contentGeneration) {
+            if (hoverEnterVerdicts_.size() >= HOVER_ENTER_VERDICT_CACHE_MAX) {
+                for (auto iter = hoverEnterVerdicts_.begin(); iter != hoverEnterVerdicts_.end();) {
+                    iter = iter->second.expireTime < now ? hoverEnterVerdicts_.erase(iter) : std::next(iter);
+                }
+            }
+            if (hoverEnterVerdicts_.size() < HOVER_ENTER_VERDICT_CACHE_MAX) {
+                HoverEnterVerdict &cached = hoverEnterVerdicts_[key];
+                cached = verdict;
+                cached.expireTime = now + HOVER_ENTER_VERDICT_TTL;
+            }
         }
-    } else {
+        auto iter = pendingHoverEnterEvents_.find(windowId);
+        if (iter == pendingHoverEnterEvents_.end() || iter->second.sequence != sequence) {
+            HILOG_DEBUG("hover enter result is superseded, windowId: %{public}d", windowId);
+            return;
+        }
+        event = iter->second.event;
+        pendingHoverEnterEvents_.erase(iter);
+    }
+    if (ApplyHoverEnterVerdict(verdict, event)) {
         HILOG_INFO("hover enter event is invilid");
+        return;
+    }
+    DeliverEvent(event);
+}
+
+void ElementOperatorManager::OnHoverEnterSearchTimeout(int32_t windowId, uint64_t sequence)
+{
+    AccessibilityEventInfo event;
+    {
+        std::lock_guard<ffrt::mutex> lock(hoverEnterMutex_);
+        auto iter = pendingHoverEnterEvents_.find(windowId);
+        if (iter == pendingHoverEnterEvents_.end() || iter->second.sequence != sequence) {
+            return;
+        }
+        event = iter->second.event;
+        pendingHoverEnterEvents_.erase(iter);
+    }
+    HILOG_ERROR("Failed to wait hover enter result, windowId: %{public}d", windowId);
+    DeliverEvent(event);
+}
+
+void ElementOperatorManager::InvalidateHoverEnterVerdicts(const AccessibilityEventInfo &event)
+{
+    switch (event.GetEventType()) {
+        case TYPE_VIEW_TEXT_UPDATE_EVENT:
+        case TYPE_PAGE_STATE_UPDATE:
+        case TYPE_PAGE_CONTENT_UPDATE:
+        case TYPE_VIEW_SCROLLED_EVENT:
+        case TYPE_WINDOW_UPDATE:
+        case TYPE_PAGE_CLOSE:
+        case TYPE_PAGE_OPEN:
+        case TYPE_ELEMENT_INFO_CHANGE:
+            break;
+        default:
+            return;
+    }
+    int32_t windowId = event.GetWindowId();
+    std::lock_guard<ffrt::mutex> lock(hoverEnterMutex_);
+    hoverContentGenerations_[windowId]++;
+    for (auto iter = hoverEnterVerdicts_.begin(); iter != hoverEnterVerdicts_.end();) {
+        iter = std::get<0>(iter->first) == windowId ? hoverEnterVerdicts_.erase(iter) : std::next(iter);
+    }
+}
+
+bool ElementOperatorManager::ApplyHoverEnterVerdict(const HoverEnterVerdict &verdict, AccessibilityEventInfo &event)
+{
+    if (verdict.invalid) {
         return true;
     }
+    if (verdict.changeToNewInfo) {
+        event.SetElementInfo(verdict.newElementInfo);
+        event.SetSource(verdict.newElementInfo.GetAccessibilityId());
+    }
     return false;
 }
 
@@ -583,7 +800,7 @@ void ElementOperatorManager::FindInnerWindowId(const AccessibilityEventInfo &eve
     if (!accountData) {
         return;
     }
-    auto mapTable = accountData->GetWindowManager().sceneBoardElementIdMap_.GetAllPairs();
+    auto mapTable = accountData->GetWindowManager().windowIndex_.GetSceneBoardElementIds();
     int64_t elementId = event.GetAccessibilityId();
     int tmpWindowId =
         accountData->GetWindowManager().FindTreeIdWindowIdPair(Utils::GetTreeIdBySplitElementId(elementId));
@@ -622,7 +839,7 @@ void ElementOperatorManager::FindInnerWindowId(const AccessibilityEventInfo &eve
                 break;
             }
         } else {
-            // keep find its parent node, until it's a root node or find its elementId in sceneBoardElementIdMap_
+            // keep find its parent node, until it's a root node or find its elementId in the scene board element ids
             // which saves mapping of windowId&root-elementId of the window.
             std::vector<AccessibilityElementInfo> infos = {};
             if (GetParentElementRecursively(event.GetWindowId(), elementId, infos) == false || infos.size() == 0) {
@@ -672,8 +889,8 @@ void ElementOperatorManager::UpdateAccessibilityWindowStateByEvent(const Accessi
         case TYPE_VIEW_HOVER_ENTER_EVENT:
             accountData->GetWindowManager().SetAccessibilityFocusedWindow(windowId);
             if (scbWindowFlag) {
-                HILOG_INFO("windowId set to subWindows_ is %{public}d", windowId);
-                accountData->GetWindowManager().subWindows_.insert({windowId, 0});
+                HILOG_INFO("windowId set to sub windows is %{public}d", windowId);
+                accountData->GetWindowManager().windowIndex_.InsertSubWindow(windowId, 0);
             }
             break;
         case TYPE_VIEW_ACCESSIBILITY_FOCUSED_EVENT:
@@ -711,18 +928,44 @@ RetError ElementOperatorManager::SendEvent(const AccessibilityEventInfo &uiEvent
         HILOG_ERROR("VerifyingToKenId failed");
         return RET_ERR_TOKEN_ID;
     }
-    if (isAncoFlag != "true" && InvalidHoverEnterEvent(const_cast<AccessibilityEventInfo&>(uiEvent))) {
-        HILOG_ERROR("CheckNodeIsReadableOverChildTree failed");
-        return RET_ERR_INVALID_PARAM;
+    InvalidateHoverEnterVerdicts(uiEvent);
+    if (isAncoFlag != "true") {
+        HoverEnterCheckResult checkResult = CheckHoverEnterEvent(const_cast<AccessibilityEventInfo&>(uiEvent));
+        if (checkResult == HoverEnterCheckResult::INVALID) {
+            HILOG_ERROR("CheckNodeIsReadableOverChildTree failed");
+            return RET_ERR_INVALID_PARAM;
+        } else if (checkResult == HoverEnterCheckResult::PENDING) {
+            return RET_OK;
+        }
     }
-    OnFocusedEvent(uiEvent);
-    UpdateAccessibilityWindowStateByEvent(uiEvent);
-    const_cast<AccessibilityEventInfo&>(uiEvent).SetTimeStamp(Utils::GetSystemTime());
+    DeliverEvent(uiEvent);
+    return RET_OK;
+}
+
+void ElementOperatorManager::DeliverEvent(const AccessibilityEventInfo &event)
+{
+    OnFocusedEvent(event);
+    UpdateAccessibilityWindowStateByEvent(event);
+    const_cast<AccessibilityEventInfo&>(event).SetTimeStamp(Utils::GetSystemTime());
     sptr<AccessibilityAccountData> accountData = accountData_.promote();
     if (accountData) {
-        accountData->isSendEvent(uiEvent);
+        accountData->isSendEvent(event);
     }
-    return RET_OK;
+}
+
+bool ElementOperatorManager::WaitForResult(const sptr<AccessibilityWindowConnection> &connection,
+    ffrt::future<void> &future, uint32_t timeout)
+{
+    AccessibilityIpcHealth &ipcHealth = connection->GetIpcHealth();
+    int64_t startTime = Utils::GetSystemTime();
+    timeout = std::min(timeout, ipcHealth.GetDeadline());
+    if (future.wait_for(std::chrono::milliseconds(timeout)) != ffrt::future_status::ready) {
+        HILOG_ERROR("Failed to wait result in %{public}u ms", timeout);
+        ipcHealth.RecordTimeout();
+        return false;
+    }
+    ipcHealth.RecordLatency(Utils::GetSystemTime() - startTime);
+    return true;
 }
 
 bool ElementOperatorManager::FindFocusedElementByConnection(sptr<AccessibilityWindowConnection> connection,
@@ -735,6 +978,10 @@ bool ElementOperatorManager::FindFocusedElementByConnection(sptr<AccessibilityWi
         HILOG_ERROR("GetAccessibilityWindowConnection failed");
         return false;
     }
+    if (!connection->GetIpcHealth().AllowRequest()) {
+        HILOG_ERROR("the focused window does not answer, fail fast");
+        return false;
+    }
  
     sptr<ElementOperatorCallbackImpl> focusCallback = new(std::nothrow) ElementOperatorCallbackImpl(accountId_);
     if (!focusCallback) {
@@ -743,8 +990,7 @@ bool ElementOperatorManager::FindFocusedElementByConnection(sptr<AccessibilityWi
     }
     ffrt::future<void> focusFuture = focusCallback->promise_.get_future();
     connection->GetProxy(displayId)->FindFocusedElementInfo(elementId, focusType, GenerateRequestId(), focusCallback);
-    ffrt::future_status waitFocus = focusFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (waitFocus != ffrt::future_status::ready) {
+    if (!WaitForResult(connection, focusFuture, TIME_OUT_OPERATOR)) {
         HILOG_ERROR("FindFocusedElementInfo Failed to wait result");
         return false;
     }
@@ -774,14 +1020,17 @@ bool ElementOperatorManager::FindFocusedElement(AccessibilityElementInfo &elemen
     connection = GetRealIdWindowConnection(windowId, FOCUS_TYPE_INVALID, displayId);
     HILOG_DEBUG("windowId[%{public}d], elementId[%{public}" PRId64 "]", windowId, elementId);
     RETURN_FALSE_IF_NULL(connection);
+    if (!connection->GetIpcHealth().AllowRequest()) {
+        HILOG_ERROR("windowId: %{public}d does not answer, fail fast", windowId);
+        return false;
+    }
     sptr<ElementOperatorCallbackImpl> callBack = new(std::nothrow) ElementOperatorCallbackImpl(accountId_);
     RETURN_FALSE_IF_NULL(callBack);
     ffrt::future<void> promiseFuture = callBack->promise_.get_future();
     GetElementOperatorConnection(connection, elementId, elementOperator, displayId);
     RETURN_FALSE_IF_NULL(elementOperator);
     elementOperator->SearchElementInfoByAccessibilityId(elementId, GenerateRequestId(), callBack, 0);
-    ffrt::future_status waitFocus = promiseFuture.wait_for(std::chrono::milliseconds(timeout));
-    if (waitFocus != ffrt::future_status::ready) {
+    if (!WaitForResult(connection, promiseFuture, timeout)) {
         return false;
     }
  
@@ -949,9 +1198,12 @@ bool ElementOperatorManager::ExecuteActionOnAccessibilityFocused(ActionType acti
     sptr<IAccessibilityElementOperator> elementOperator = nullptr;
     GetElementOperatorConnection(connection, elementId, elementOperator, displayId);
     RETURN_FALSE_IF_NULL(elementOperator);
+    if (!connection->GetIpcHealth().AllowRequest()) {
+        HILOG_ERROR("windowId: %{public}d does not answer, fail fast", windowId);
+        return false;
+    }
     elementOperator->ExecuteAction(elementId, action, actionArguments, GenerateRequestId(), actionCallback);
-    ffrt::future_status waitAction = actionFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
-    if (waitAction != ffrt::future_status::ready) {
+    if (!WaitForResult(connection, actionFuture, TIME_OUT_OPERATOR)) {
         HILOG_ERROR("ExecuteAction Failed to wait result");
         return false;
     }
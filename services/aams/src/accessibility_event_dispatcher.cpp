@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_event_dispatcher.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    const std::string AAMS_SEND_EVENT_RUNNER_NAME = "AamsSendEventRunner";
+    // a window over this size drops its own droppable events
+    constexpr size_t MAX_WINDOW_QUEUE_SIZE = 64;
+    // events which may not be dropped are still bounded, a window flooding them is rejected
+    constexpr size_t MAX_WINDOW_QUEUE_HARD_LIMIT = 256;
+    constexpr size_t MAX_QUEUE_HARD_LIMIT = 1024;
+    // the stats of idle windows are kept until there are more windows than this
+    constexpr size_t MAX_WINDOW_STATS_COUNT = 64;
+    constexpr size_t MAX_DRAIN_BATCH_SIZE = 16;
+    constexpr uint64_t HISTOGRAM_BUCKET_SHIFT = 2; // each bucket is four times wider than the previous one
+}
+
+AccessibilityEventDispatcher::AccessibilityEventDispatcher()
+{
+}
+
+AccessibilityEventDispatcher::~AccessibilityEventDispatcher()
+{
+}
+
+bool AccessibilityEventDispatcher::Init()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (handler_ != nullptr) {
+        return true;
+    }
+    runner_ = AppExecFwk::EventRunner::Create(AAMS_SEND_EVENT_RUNNER_NAME, AppExecFwk::ThreadMode::FFRT);
+    if (!runner_) {
+        HILOG_ERROR("create AAMS sendEvent runner failed");
+        return false;
+    }
+    handler_ = std::make_shared<AAMSEventHandler>(runner_);
+    if (!handler_) {
+        HILOG_ERROR("create AAMS sendEvent handler failed");
+        runner_.reset();
+        return false;
+    }
+    return true;
+}
+
+void AccessibilityEventDispatcher::Clear()
+{
+    std::shared_ptr<AppExecFwk::EventRunner> runner = nullptr;
+    std::shared_ptr<AAMSEventHandler> handler = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        runner.swap(runner_);
+        handler.swap(handler_);
+        windowQueues_.clear();
+        readyWindows_.clear();
+        depth_ = 0;
+        isDraining_ = false;
+    }
+    // the queued drain task only captures the dispatcher, removing it releases the handler and the runner.
+    if (handler != nullptr) {
+        handler->RemoveAllEvents();
+    }
+}
+
+bool AccessibilityEventDispatcher::IsDroppableEvent(EventType eventType)
+{
+    // only events whose newer copy carries the same information may be dropped,
+    // focus, click and announce events are always delivered.
+    switch (eventType) {
+        case TYPE_VIEW_SCROLLED_EVENT:
+        case TYPE_VIEW_SCROLLING_EVENT:
+        case TYPE_VIEW_TEXT_UPDATE_EVENT:
+        case TYPE_PAGE_CONTENT_UPDATE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+size_t AccessibilityEventDispatcher::GetBucketIndex(uint64_t value, size_t bucketCount)
+{
+    size_t index = 0;
+    uint64_t bound = 1;
+    while (index + 1 < bucketCount && value >= bound) {
+        bound <<= HISTOGRAM_BUCKET_SHIFT;
+        index++;
+    }
+    return index;
+}
+
+int64_t AccessibilityEventDispatcher::GetSteadyTime()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void AccessibilityEventDispatcher::RecordDepth(DispatchStats &stats, size_t depth)
+{
+    stats.peakDepth = std::max(stats.peakDepth, depth);
+    stats.depthHistogram[GetBucketIndex(depth - 1, DEPTH_BUCKET_COUNT)]++;
+}
+
+bool AccessibilityEventDispatcher::DropDroppableTaskLocked(WindowQueue &windowQueue)
+{
+    // a full window pays for its own overload, the queues of the other windows are not touched.
+    auto droppable = std::find_if(windowQueue.tasks.begin(), windowQueue.tasks.end(),
+        [](const PendingTask &pending) { return IsDroppableEvent(pending.eventType); });
+    if (droppable == windowQueue.tasks.end()) {
+        return false;
+    }
+    windowQueue.tasks.erase(droppable);
+    depth_--;
+    windowQueue.stats.droppedCount++;
+    stats_.droppedCount++;
+    return true;
+}
+
+void AccessibilityEventDispatcher::RemoveIdleWindowsLocked(int32_t keptWindowId)
+{
+    for (auto iter = windowQueues_.begin();
+        iter != windowQueues_.end() && windowQueues_.size() > MAX_WINDOW_STATS_COUNT;) {
+        if (iter->first != keptWindowId && iter->second.tasks.empty()) {
+            iter = windowQueues_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+RetError AccessibilityEventDispatcher::Dispatch(int32_t windowId, EventType eventType,
+    const std::function<void()> &task)
+{
+    std::shared_ptr<AAMSEventHandler> handler = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        if (handler_ == nullptr) {
+            HILOG_ERROR("dispatcher is not ready");
+            return RET_ERR_NULLPTR;
+        }
+        auto result = windowQueues_.try_emplace(windowId);
+        if (result.second) {
+            RemoveIdleWindowsLocked(windowId);
+        }
+        WindowQueue &windowQueue = result.first->second;
+        if (windowQueue.tasks.size() >= MAX_WINDOW_QUEUE_SIZE && !DropDroppableTaskLocked(windowQueue)) {
+            if (IsDroppableEvent(eventType)) {
+                windowQueue.stats.droppedCount++;
+                stats_.droppedCount++;
+                HILOG_WARN("queue is full, drop event type %{public}d of window %{public}d", eventType, windowId);
+                return RET_ERR_FAILED;
+            }
+            if (windowQueue.tasks.size() >= MAX_WINDOW_QUEUE_HARD_LIMIT) {
+                windowQueue.stats.rejectedCount++;
+                stats_.rejectedCount++;
+                HILOG_ERROR("queue is full, reject event type %{public}d of window %{public}d", eventType, windowId);
+                return RET_ERR_FAILED;
+            }
+        }
+        if (depth_ >= MAX_QUEUE_HARD_LIMIT) {
+            windowQueue.stats.rejectedCount++;
+            stats_.rejectedCount++;
+            HILOG_ERROR("queues are full, reject event type %{public}d of window %{public}d", eventType, windowId);
+            return RET_ERR_FAILED;
+        }
+        if (windowQueue.tasks.empty()) {
+            readyWindows_.push_back(windowId);
+        }
+        windowQueue.tasks.push_back({ eventType, GetSteadyTime(), task });
+        depth_++;
+        RecordDepth(windowQueue.stats, windowQueue.tasks.size());
+        RecordDepth(stats_, depth_);
+        if (!isDraining_) {
+            isDraining_ = true;
+            handler = handler_;
+        }
+    }
+    if (handler != nullptr) {
+        handler->PostTask([this]() { Drain(); }, "TASK_SEND_EVENT");
+    }
+    return RET_OK;
+}
+
+bool AccessibilityEventDispatcher::PopNextLocked(PendingTask &pending)
+{
+    while (!readyWindows_.empty()) {
+        int32_t windowId = readyWindows_.front();
+        readyWindows_.pop_front();
+        auto iter = windowQueues_.find(windowId);
+        if (iter == windowQueues_.end() || iter->second.tasks.empty()) {
+            continue;
+        }
+        WindowQueue &windowQueue = iter->second;
+        pending = std::move(windowQueue.tasks.front());
+        windowQueue.tasks.pop_front();
+        depth_--;
+        // the window takes its next turn after the other waiting windows
+        if (!windowQueue.tasks.empty()) {
+            readyWindows_.push_back(windowId);
+        }
+        int64_t latency = std::max<int64_t>(GetSteadyTime() - pending.enqueueTime, 0);
+        size_t latencyIndex = GetBucketIndex(static_cast<uint64_t>(latency), LATENCY_BUCKET_COUNT);
+        windowQueue.stats.latencyHistogram[latencyIndex]++;
+        windowQueue.stats.dispatchedCount++;
+        stats_.latencyHistogram[latencyIndex]++;
+        stats_.dispatchedCount++;
+        return true;
+    }
+    return false;
+}
+
+void AccessibilityEventDispatcher::Drain()
+{
+    // a single runner sends the events one by one, so SendEvent never runs concurrently with itself.
+    for (size_t count = 0; count < MAX_DRAIN_BATCH_SIZE; count++) {
+        PendingTask pending;
+        {
+            std::lock_guard<ffrt::mutex> lock(mutex_);
+            if (!PopNextLocked(pending)) {
+                isDraining_ = false;
+                return;
+            }
+        }
+        if (pending.task) {
+            pending.task();
+        }
+    }
+    // yield the runner between batches, the events of each window keep their order.
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (handler_ == nullptr) {
+        return;
+    }
+    handler_->PostTask([this]() { Drain(); }, "TASK_SEND_EVENT");
+}
+
+AccessibilityEventDispatcher::DispatchStats AccessibilityEventDispatcher::GetDispatchStats()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    DispatchStats stats = stats_;
+    stats.depth = depth_;
+    return stats;
+}
+
+std::map<int32_t, AccessibilityEventDispatcher::DispatchStats> AccessibilityEventDispatcher::GetWindowDispatchStats()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    std::map<int32_t, DispatchStats> windowStats;
+    for (auto &windowQueue : windowQueues_) {
+        DispatchStats &stats = windowStats[windowQueue.first];
+        stats = windowQueue.second.stats;
+        stats.depth = windowQueue.second.tasks.size();
+    }
+    return windowStats;
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_ipc_health.h"
+
+#include <algorithm>
+#include <limits>
+#include "hilog_wrapper.h"
+#include "utils.h"
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    uint32_t GetMinDeadline(const AccessibilityIpcHealth::RequestKind kind)
+    {
+        return (kind == AccessibilityIpcHealth::RequestKind::TREE) ? AccessibilityIpcHealth::MIN_TREE_DEADLINE_MS :
+            AccessibilityIpcHealth::MIN_DEADLINE_MS;
+    }
+} // namespace
+
+bool AccessibilityIpcHealth::AllowRequest()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (state_ == BreakerState::CLOSED) {
+        return true;
+    }
+    int64_t now = Utils::GetSystemTime();
+    if (state_ == BreakerState::OPEN) {
+        if (now < openUntil_) {
+            fastFailCount_++;
+            return false;
+        }
+        HILOG_INFO("cool-down ends, probe the window");
+        state_ = BreakerState::HALF_OPEN;
+        probeSent_ = false;
+    }
+    // the probe may never be answered, another one is let through after a deadline
+    if (probeSent_ && now - probeTime_ < static_cast<int64_t>(GetLatency(RequestKind::NODE).deadlineMs)) {
+        fastFailCount_++;
+        return false;
+    }
+    probeSent_ = true;
+    probeTime_ = now;
+    return true;
+}
+
+void AccessibilityIpcHealth::RecordLatency(const int64_t latencyMs, const RequestKind kind)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    Latency &latency = GetLatency(kind);
+    latency.answeredCount++;
+    consecutiveTimeouts_ = 0;
+    AddSample(latency, static_cast<uint32_t>(std::clamp<int64_t>(latencyMs, 0, std::numeric_limits<uint32_t>::max())),
+        GetMinDeadline(kind));
+    if (state_ != BreakerState::CLOSED) {
+        HILOG_INFO("the window answers again, latency %{public}u ms", static_cast<uint32_t>(latencyMs));
+        state_ = BreakerState::CLOSED;
+    }
+}
+
+void AccessibilityIpcHealth::RecordTimeout(const RequestKind kind)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    Latency &latency = GetLatency(kind);
+    latency.timeoutCount++;
+    // the request took at least the deadline, a slow window gets a longer one
+    AddSample(latency, latency.deadlineMs, GetMinDeadline(kind));
+    if (kind != RequestKind::NODE) {
+        // a large subtree may legitimately outlast its deadline, it says nothing about the window being stuck
+        return;
+    }
+    consecutiveTimeouts_++;
+    if (state_ == BreakerState::HALF_OPEN || consecutiveTimeouts_ >= TIMEOUT_THRESHOLD) {
+        if (state_ != BreakerState::OPEN) {
+            HILOG_WARN("%{public}u consecutive timeouts, fail fast for %{public}d ms", consecutiveTimeouts_,
+                static_cast<int32_t>(coolDownMs_));
+        }
+        state_ = BreakerState::OPEN;
+        openUntil_ = Utils::GetSystemTime() + coolDownMs_;
+    }
+}
+
+uint32_t AccessibilityIpcHealth::GetDeadline(const RequestKind kind)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    return GetLatency(kind).deadlineMs;
+}
+
+AccessibilityIpcHealth::Stats AccessibilityIpcHealth::GetStats(const RequestKind kind)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    const Latency &latency = GetLatency(kind);
+    Stats stats;
+    stats.ewmaMs = latency.ewmaMs;
+    stats.p99Ms = latency.p99Ms;
+    stats.deadlineMs = latency.deadlineMs;
+    stats.answeredCount = latency.answeredCount;
+    stats.timeoutCount = latency.timeoutCount;
+    stats.fastFailCount = fastFailCount_;
+    stats.consecutiveTimeouts = consecutiveTimeouts_;
+    stats.state = state_;
+    return stats;
+}
+
+const char *AccessibilityIpcHealth::ToString(const BreakerState state)
+{
+    switch (state) {
+        case BreakerState::CLOSED:
+            return "closed";
+        case BreakerState::OPEN:
+            return "open";
+        case BreakerState::HALF_OPEN:
+            return "half-open";
+        default:
+            return "unknown";
+    }
+}
+
+const char *AccessibilityIpcHealth::ToString(const RequestKind kind)
+{
+    switch (kind) {
+        case RequestKind::NODE:
+            return "node";
+        case RequestKind::TREE:
+            return "tree";
+        default:
+            return "unknown";
+    }
+}
+
+AccessibilityIpcHealth::Latency &AccessibilityIpcHealth::GetLatency(const RequestKind kind)
+{
+    size_t index = static_cast<size_t>(kind);
+    return latencies_[index < latencies_.size() ? index : 0];
+}
+
+void AccessibilityIpcHealth::AddSample(Latency &latency, const uint32_t latencyMs, const uint32_t minDeadlineMs)
+{
+    latency.samples[latency.nextSample] = latencyMs;
+    latency.nextSample = (latency.nextSample + 1) % SAMPLE_COUNT;
+    if (latency.sampleCount < SAMPLE_COUNT) {
+        latency.sampleCount++;
+    }
+    if (latency.sampleCount == 1) {
+        latency.ewmaMs = latencyMs;
+    } else {
+        latency.ewmaMs = static_cast<uint32_t>((static_cast<uint64_t>(latency.ewmaMs) * (EWMA_WEIGHT - 1) +
+            latencyMs) / EWMA_WEIGHT);
+    }
+    UpdateDeadline(latency, minDeadlineMs);
+}
+
+void AccessibilityIpcHealth::UpdateDeadline(Latency &latency, const uint32_t minDeadlineMs)
+{
+    std::array<uint32_t, SAMPLE_COUNT> sorted = latency.samples;
+    // ceil(0.99 * n) - 1 is the index of the 99th percentile in the sorted samples
+    size_t p99Index = (latency.sampleCount * 99 + 99) / 100 - 1;
+    std::nth_element(sorted.begin(), sorted.begin() + p99Index, sorted.begin() + latency.sampleCount);
+    latency.p99Ms = sorted[p99Index];
+    if (latency.sampleCount < MIN_SAMPLE_COUNT) {
+        latency.deadlineMs = MAX_DEADLINE_MS;
+        return;
+    }
+    uint64_t deadline = std::max(static_cast<uint64_t>(latency.p99Ms) * P99_FACTOR,
+        static_cast<uint64_t>(latency.ewmaMs) * EWMA_FACTOR);
+    latency.deadlineMs = static_cast<uint32_t>(std::clamp<uint64_t>(deadline, minDeadlineMs, MAX_DEADLINE_MS));
+}
+} // namespace Accessibility
+} // namespace OHOS
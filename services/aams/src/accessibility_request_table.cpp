@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_request_table.h"
+
+#include <thread>
+#include "hilog_wrapper.h"
+
+namespace OHOS {
+namespace Accessibility {
+AccessibilityRequestTable::InsertResult AccessibilityRequestTable::Insert(const int32_t requestId,
+    const Request &request, Request &replaced)
+{
+    // the check of the pending id and the claim of a slot are one step for the inserts of this id
+    std::atomic<bool> &homeClaim = homeClaims_[GetSlotIndex(requestId, 0)];
+    bool expected = false;
+    while (!homeClaim.compare_exchange_weak(expected, true, std::memory_order_acquire)) {
+        expected = false;
+        std::this_thread::yield();
+    }
+    InsertResult result = Erase(requestId, replaced) ? InsertResult::REPLACED : InsertResult::INSERTED;
+    if (!ClaimFreeSlot(requestId, request)) {
+        HILOG_ERROR("no free slot for requestId: %{public}d", requestId);
+        result = InsertResult::FULL;
+    }
+    homeClaim.store(false, std::memory_order_release);
+    return result;
+}
+
+bool AccessibilityRequestTable::Erase(const int32_t requestId, Request &request, const int64_t startTime)
+{
+    for (size_t probe = 0; probe < MAX_PROBE_COUNT; probe++) {
+        Slot &slot = slots_[GetSlotIndex(requestId, probe)];
+        while (true) {
+            uint64_t tag = slot.tag.load(std::memory_order_acquire);
+            if (GetState(tag) == FREE || GetRequestId(tag) != requestId) {
+                break;
+            }
+            if (GetState(tag) == BUSY) {
+                // the request is being added or removed by another thread, wait for the result
+                std::this_thread::yield();
+                continue;
+            }
+            if (startTime != 0 && slot.startTime.load(std::memory_order_relaxed) != startTime) {
+                break;
+            }
+            if (TakeSlot(slot, tag, requestId, request)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+std::vector<std::pair<int32_t, AccessibilityRequestTable::Request>> AccessibilityRequestTable::EraseByWindow(
+    const int32_t windowId, const int32_t treeId)
+{
+    std::vector<std::pair<int32_t, Request>> requests;
+    for (Slot &slot : slots_) {
+        uint64_t tag = slot.tag.load(std::memory_order_acquire);
+        if (GetState(tag) != READY || slot.windowId.load(std::memory_order_relaxed) != windowId) {
+            continue;
+        }
+        if (treeId != ANY_TREE_ID && slot.treeId.load(std::memory_order_relaxed) != treeId) {
+            continue;
+        }
+        Request request;
+        if (TakeSlot(slot, tag, GetRequestId(tag), request)) {
+            requests.emplace_back(GetRequestId(tag), request);
+        }
+    }
+    return requests;
+}
+
+size_t AccessibilityRequestTable::GetSize() const
+{
+    size_t size = 0;
+    for (const Slot &slot : slots_) {
+        if (GetState(slot.tag.load(std::memory_order_acquire)) == READY) {
+            size++;
+        }
+    }
+    return size;
+}
+
+bool AccessibilityRequestTable::ClaimFreeSlot(const int32_t requestId, const Request &request)
+{
+    for (size_t probe = 0; probe < MAX_PROBE_COUNT; probe++) {
+        Slot &slot = slots_[GetSlotIndex(requestId, probe)];
+        uint64_t tag = slot.tag.load(std::memory_order_acquire);
+        if (GetState(tag) != FREE) {
+            continue;
+        }
+        uint64_t generation = GetGeneration(tag) + 1;
+        if (!slot.tag.compare_exchange_strong(tag, MakeTag(BUSY, generation, requestId),
+            std::memory_order_acq_rel)) {
+            continue;
+        }
+        slot.windowId.store(request.windowId, std::memory_order_relaxed);
+        slot.treeId.store(request.treeId, std::memory_order_relaxed);
+        slot.startTime.store(request.startTime, std::memory_order_relaxed);
+        slot.callback = request.callback;
+        slot.kind = request.kind;
+        slot.tag.store(MakeTag(READY, generation, requestId), std::memory_order_release);
+        return true;
+    }
+    return false;
+}
+
+bool AccessibilityRequestTable::TakeSlot(Slot &slot, const uint64_t tag, const int32_t requestId, Request &request)
+{
+    // a failed CAS means the slot was taken or claimed again since the tag was read
+    uint64_t expected = tag;
+    if (!slot.tag.compare_exchange_strong(expected, MakeTag(BUSY, GetGeneration(tag), requestId),
+        std::memory_order_acq_rel)) {
+        return false;
+    }
+    request.callback = slot.callback;
+    request.windowId = slot.windowId.load(std::memory_order_relaxed);
+    request.treeId = slot.treeId.load(std::memory_order_relaxed);
+    request.startTime = slot.startTime.load(std::memory_order_relaxed);
+    request.kind = slot.kind;
+    slot.callback = nullptr;
+    slot.tag.store(MakeTag(FREE, GetGeneration(tag), requestId), std::memory_order_release);
+    return true;
+}
+} // namespace Accessibility
+} // namespace OHOS
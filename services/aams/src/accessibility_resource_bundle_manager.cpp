@@ -25,7 +25,13 @@
  
 namespace OHOS {
 namespace Accessibility {
+namespace {
+    constexpr size_t RESOURCE_STRING_CACHE_CAPACITY = 256;
+    constexpr size_t RESOURCE_MANAGER_CACHE_CAPACITY = 8;
+}
+
 AccessibilityResourceBundleManager::AccessibilityResourceBundleManager()
+    : resourceStringCache_(RESOURCE_STRING_CACHE_CAPACITY), resourceManagerCache_(RESOURCE_MANAGER_CACHE_CAPACITY)
 {
 }
  
@@ -166,6 +172,63 @@ bool AccessibilityResourceBundleManager::QueryExtensionAbilityInfos(
     return result;
 }
  
+bool AccessibilityResourceBundleManager::GetCachedResourceString(const std::string &key, std::string &value)
+{
+    std::lock_guard<ffrt::mutex> lock(resourceCacheMutex_);
+    if (resourceStringCache_.Get(key, value)) {
+        resourceCacheHitCount_++;
+        return true;
+    }
+    resourceCacheMissCount_++;
+    return false;
+}
+
+void AccessibilityResourceBundleManager::CacheResourceString(const std::string &key, const std::string &value)
+{
+    std::lock_guard<ffrt::mutex> lock(resourceCacheMutex_);
+    resourceStringCache_.Put(key, value);
+}
+
+std::shared_ptr<Global::Resource::ResourceManager> AccessibilityResourceBundleManager::GetCachedResourceManager(
+    const std::string &key)
+{
+    std::lock_guard<ffrt::mutex> lock(resourceCacheMutex_);
+    std::shared_ptr<Global::Resource::ResourceManager> resourceManager = nullptr;
+    resourceManagerCache_.Get(key, resourceManager);
+    return resourceManager;
+}
+
+void AccessibilityResourceBundleManager::CacheResourceManager(const std::string &key,
+    const std::shared_ptr<Global::Resource::ResourceManager> &resourceManager)
+{
+    std::lock_guard<ffrt::mutex> lock(resourceCacheMutex_);
+    resourceManagerCache_.Put(key, resourceManager);
+}
+
+void AccessibilityResourceBundleManager::ClearResourceCache(const std::string &bundleName, int32_t userId)
+{
+    HILOG_DEBUG("bundleName is %{public}s, userId is %{public}d", bundleName.c_str(), userId);
+    std::string prefix = Utils::GetResourceCacheKey(userId, bundleName);
+    std::lock_guard<ffrt::mutex> lock(resourceCacheMutex_);
+    resourceStringCache_.EraseByPrefix(prefix);
+    resourceManagerCache_.EraseByPrefix(prefix);
+}
+
+void AccessibilityResourceBundleManager::ClearResourceCache()
+{
+    HILOG_DEBUG();
+    std::lock_guard<ffrt::mutex> lock(resourceCacheMutex_);
+    resourceStringCache_.Clear();
+    resourceManagerCache_.Clear();
+}
+
+void AccessibilityResourceBundleManager::GetResourceCacheStats(uint64_t &hitCount, uint64_t &missCount)
+{
+    std::lock_guard<ffrt::mutex> lock(resourceCacheMutex_);
+    hitCount = resourceCacheHitCount_;
+    missCount = resourceCacheMissCount_;
+}
+
 void AccessibilityResourceBundleManager::BundleManagerDeathRecipient::OnRemoteDied(
     const wptr<IRemoteObject> &remote)
 {
@@ -77,6 +77,7 @@ RetError AccessibilityWindowConnection::SetCardProxy(const int32_t treeId,
         return RET_ERR_FAILED;
     }
     cardProxy_.EnsureInsert(treeId, operation);
+    MarkProxiesStale();
     return RET_OK;
 }
 
@@ -137,6 +138,7 @@ void AccessibilityWindowConnection::EraseProxy(const int32_t treeId)
     bool ret = cardProxy_.Find(treeId, connection);
     if (ret) {
         cardProxy_.Erase(treeId);
+        MarkProxiesStale();
     }
 }
 
@@ -164,33 +166,42 @@ void AccessibilityWindowConnection::AddDeathRecipient(
         return;
     }
     if (elementOperator->AsObject()->AddDeathRecipient(deathRecipient)) {
-        std::lock_guard<ffrt::mutex> lock(proxyMutex_);
-        if (isBroker) {
-            brokerProxy_ = elementOperator;
-            brokerProxyDeathRecipient_ = deathRecipient;
-        } else {
-            proxyMap_.insert({displayId, {elementOperator, deathRecipient}});
+        {
+            std::lock_guard<ffrt::mutex> lock(proxyMutex_);
+            if (isBroker) {
+                brokerProxy_ = elementOperator;
+                brokerProxyDeathRecipient_ = deathRecipient;
+            } else {
+                proxyMap_.insert({displayId, {elementOperator, deathRecipient}});
+            }
         }
+        MarkProxiesStale();
     }
 }
 
 void AccessibilityWindowConnection::ResetProxy()
 {
-    std::lock_guard<ffrt::mutex> lock(proxyMutex_);
-    for (const auto &[displayId, value] : proxyMap_) {
-        if (value.first && value.first->AsObject() && value.second) {
-            value.first->AsObject()->RemoveDeathRecipient(value.second);
+    {
+        std::lock_guard<ffrt::mutex> lock(proxyMutex_);
+        for (const auto &[displayId, value] : proxyMap_) {
+            if (value.first && value.first->AsObject() && value.second) {
+                value.first->AsObject()->RemoveDeathRecipient(value.second);
+            }
         }
     }
+    MarkProxiesStale();
 }
 
 void AccessibilityWindowConnection::ResetBrokerProxy()
 {
-    std::lock_guard<ffrt::mutex> lock(proxyMutex_);
-    if (brokerProxy_ && brokerProxy_->AsObject() && brokerProxyDeathRecipient_) {
-        brokerProxy_->AsObject()->RemoveDeathRecipient(brokerProxyDeathRecipient_);
+    {
+        std::lock_guard<ffrt::mutex> lock(proxyMutex_);
+        if (brokerProxy_ && brokerProxy_->AsObject() && brokerProxyDeathRecipient_) {
+            brokerProxy_->AsObject()->RemoveDeathRecipient(brokerProxyDeathRecipient_);
+        }
+        brokerProxy_ = nullptr;
     }
-    brokerProxy_ = nullptr;
+    MarkProxiesStale();
 }
 
 void AccessibilityWindowConnection::AddTreeDeathRecipient(
@@ -261,5 +272,85 @@ void AccessibilityWindowConnection::OutsideTouch()
     }
 }
 // LCOV_EXCL_STOP
+
+void AccessibilityWindowConnection::MarkProxiesStale()
+{
+    proxyGeneration_++;
+    std::map<int32_t, ElementOperatorGrant> grants;
+    {
+        std::lock_guard<ffrt::mutex> lock(grantsMutex_);
+        grants.swap(grants_);
+    }
+    RevokeElementOperatorGrants(grants);
+}
+
+void AccessibilityWindowConnection::AddElementOperatorGrant(const int32_t grantId, const std::string &clientName,
+    const int32_t treeId, const sptr<IAccessibilityElementOperator> &grantor)
+{
+    std::map<int32_t, ElementOperatorGrant> replaced;
+    {
+        std::lock_guard<ffrt::mutex> lock(grantsMutex_);
+        for (auto iter = grants_.begin(); iter != grants_.end();) {
+            if (iter->second.clientName == clientName && iter->second.treeId == treeId) {
+                replaced.insert(*iter);
+                iter = grants_.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+        grants_[grantId] = {clientName, treeId, grantor};
+    }
+    RevokeElementOperatorGrants(replaced);
+}
+
+bool AccessibilityWindowConnection::RevokeElementOperatorGrant(const int32_t grantId)
+{
+    std::map<int32_t, ElementOperatorGrant> revoked;
+    {
+        std::lock_guard<ffrt::mutex> lock(grantsMutex_);
+        auto iter = grants_.find(grantId);
+        if (iter == grants_.end()) {
+            return false;
+        }
+        revoked.insert(*iter);
+        grants_.erase(iter);
+    }
+    RevokeElementOperatorGrants(revoked);
+    return true;
+}
+
+bool AccessibilityWindowConnection::IsElementOperatorGranted(const int32_t grantId)
+{
+    std::lock_guard<ffrt::mutex> lock(grantsMutex_);
+    return grants_.count(grantId) > 0;
+}
+
+void AccessibilityWindowConnection::RevokeElementOperatorGrantsExcept(const std::set<std::string> &clientNames)
+{
+    std::map<int32_t, ElementOperatorGrant> revoked;
+    {
+        std::lock_guard<ffrt::mutex> lock(grantsMutex_);
+        for (auto iter = grants_.begin(); iter != grants_.end();) {
+            if (clientNames.count(iter->second.clientName) == 0) {
+                revoked.insert(*iter);
+                iter = grants_.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+    RevokeElementOperatorGrants(revoked);
+}
+
+void AccessibilityWindowConnection::RevokeElementOperatorGrants(
+    const std::map<int32_t, ElementOperatorGrant> &grants)
+{
+    for (const auto &[grantId, grant] : grants) {
+        HILOG_INFO("revoke grant[%{public}d] of %{public}s", grantId, grant.clientName.c_str());
+        if (grant.grantor != nullptr) {
+            grant.grantor->RevokeElementOperator(grantId);
+        }
+    }
+}
 } // namespace Accessibility
 } // namespace OHOS
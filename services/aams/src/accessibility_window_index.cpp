@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "accessibility_window_index.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace Accessibility {
+void AccessibilityWindowIndex::InsertSubWindow(const int32_t windowId, const uint64_t displayId)
+{
+    windows_.Write([windowId, displayId](auto &table) {
+        WindowEntry entry;
+        if (table.Find(windowId, entry) && entry.isSubWindow) {
+            entry.displayId = std::min(entry.displayId, displayId);
+        } else {
+            entry.displayId = displayId;
+        }
+        entry.isSubWindow = true;
+        table.Insert(windowId, entry);
+    });
+}
+
+bool AccessibilityWindowIndex::FindSubWindow(const int32_t windowId, uint64_t &displayId) const
+{
+    WindowEntry entry = windows_.Read([windowId](const auto &table) {
+        WindowEntry result;
+        table.Find(windowId, result);
+        return result;
+    });
+    if (!entry.isSubWindow) {
+        return false;
+    }
+    displayId = entry.displayId;
+    return true;
+}
+
+bool AccessibilityWindowIndex::IsSubWindow(const int32_t windowId) const
+{
+    uint64_t displayId = 0;
+    return FindSubWindow(windowId, displayId);
+}
+
+void AccessibilityWindowIndex::InsertSceneBoardElementId(const int32_t windowId, const int64_t elementId)
+{
+    windows_.Write([windowId, elementId](auto &table) {
+        WindowEntry entry;
+        table.Find(windowId, entry);
+        entry.elementId = elementId;
+        entry.hasElementId = true;
+        table.Insert(windowId, entry);
+    });
+}
+
+bool AccessibilityWindowIndex::HasSceneBoardElementId(const int32_t windowId) const
+{
+    return windows_.Read([windowId](const auto &table) {
+        WindowEntry entry;
+        return table.Find(windowId, entry) && entry.hasElementId;
+    });
+}
+
+bool AccessibilityWindowIndex::IsSceneBoardElementId(const int64_t elementId) const
+{
+    return windows_.Read([elementId](const auto &table) {
+        bool found = false;
+        table.ForEach([elementId, &found](int32_t, const WindowEntry &entry) {
+            found = found || (entry.hasElementId && entry.elementId == elementId);
+        });
+        return found;
+    });
+}
+
+std::map<int32_t, int64_t> AccessibilityWindowIndex::GetSceneBoardElementIds() const
+{
+    return windows_.Read([](const auto &table) {
+        std::map<int32_t, int64_t> elementIds;
+        table.ForEach([&elementIds](int32_t windowId, const WindowEntry &entry) {
+            if (entry.hasElementId) {
+                elementIds[windowId] = entry.elementId;
+            }
+        });
+        return elementIds;
+    });
+}
+
+void AccessibilityWindowIndex::ClearSceneBoardElementIds()
+{
+    windows_.Write([](auto &table) {
+        std::vector<std::pair<int32_t, WindowEntry>> entries;
+        table.ForEach([&entries](int32_t windowId, const WindowEntry &entry) {
+            entries.emplace_back(windowId, entry);
+        });
+        for (auto &[windowId, entry] : entries) {
+            if (!entry.hasElementId) {
+                continue;
+            }
+            if (entry.isSubWindow) {
+                entry.hasElementId = false;
+                table.Insert(windowId, entry);
+            } else {
+                table.Erase(windowId);
+            }
+        }
+    });
+}
+
+void AccessibilityWindowIndex::RemoveWindow(const int32_t windowId)
+{
+    windows_.Write([windowId](auto &table) {
+        table.Erase(windowId);
+    });
+}
+
+void AccessibilityWindowIndex::ClearSubWindows()
+{
+    windows_.Write([](auto &table) {
+        std::vector<std::pair<int32_t, WindowEntry>> entries;
+        table.ForEach([&entries](int32_t windowId, const WindowEntry &entry) {
+            entries.emplace_back(windowId, entry);
+        });
+        for (auto &[windowId, entry] : entries) {
+            if (!entry.isSubWindow) {
+                continue;
+            }
+            if (entry.hasElementId) {
+                entry.isSubWindow = false;
+                table.Insert(windowId, entry);
+            } else {
+                table.Erase(windowId);
+            }
+        }
+    });
+}
+
+void AccessibilityWindowIndex::ClearSceneBoard()
+{
+    windows_.Write([](auto &table) {
+        table.Clear();
+    });
+}
+
+void AccessibilityWindowIndex::InsertTreeId(const int32_t treeId, const int32_t windowId)
+{
+    trees_.Write([treeId, windowId](auto &table) {
+        table.Insert(treeId, windowId);
+    });
+}
+
+void AccessibilityWindowIndex::RemoveTreeId(const int32_t treeId)
+{
+    trees_.Write([treeId](auto &table) {
+        table.Erase(treeId);
+    });
+}
+
+int32_t AccessibilityWindowIndex::FindWindowIdByTreeId(const int32_t treeId) const
+{
+    return trees_.Read([treeId](const auto &table) {
+        int32_t windowId = 0;
+        table.Find(treeId, windowId);
+        return windowId;
+    });
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -15,6 +15,8 @@
 
 #include "accessibility_window_manager.h"
 
+#include <sstream>
+
 #ifdef OHOS_BUILD_ENABLE_HITRACE
 #include <hitrace_meter.h>
 #endif // OHOS_BUILD_ENABLE_HITRACE
@@ -37,6 +39,31 @@ namespace {
         "SCBVolumePanel"
     };
     constexpr int32_t WMS_TIMEOUT = 10; // s
+    constexpr int64_t WINDOW_UPDATE_FRAME_TIME = 16; // ms, the updates within a frame are applied in one pass
+    constexpr size_t MAX_RECORDED_WINDOW_UPDATES = 512;
+    const std::vector<WindowUpdateType> WINDOW_CHANGE_PRIORITY = {
+        WINDOW_UPDATE_REMOVED,
+        WINDOW_UPDATE_ADDED,
+        WINDOW_UPDATE_FOCUSED,
+        WINDOW_UPDATE_BOUNDS,
+        WINDOW_UPDATE_PROPERTY,
+        WINDOW_UPDATE_LAYER
+    };
+
+    uint32_t GetRosenTypeMask(Rosen::WindowUpdateType type)
+    {
+        switch (type) {
+            case Rosen::WindowUpdateType::WINDOW_UPDATE_ADDED:
+            case Rosen::WindowUpdateType::WINDOW_UPDATE_REMOVED:
+            case Rosen::WindowUpdateType::WINDOW_UPDATE_FOCUSED:
+            case Rosen::WindowUpdateType::WINDOW_UPDATE_BOUNDS:
+            case Rosen::WindowUpdateType::WINDOW_UPDATE_ACTIVE:
+            case Rosen::WindowUpdateType::WINDOW_UPDATE_PROPERTY:
+                return 1U << static_cast<uint32_t>(type);
+            default:
+                return 0;
+        }
+    }
 }
 
 AccessibilityWindowManager::AccessibilityWindowManager()
@@ -58,6 +85,7 @@ bool AccessibilityWindowManager::Init()
         return false;
     }
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
+    WindowUpdateGuard guard(*this);
     HILOG_DEBUG("windowInfos size is %{public}zu", windowInfos.size());
     for (auto &window : windowInfos) {
         if (!window) {
@@ -72,8 +100,8 @@ bool AccessibilityWindowManager::Init()
         }
 
         if (IsSceneBoard(window)) {
-            subWindows_.insert({realWid, window->displayId_});
-            sceneBoardElementIdMap_.InsertPair(realWid, window->uiNodeId_);
+            windowIndex_.InsertSubWindow(realWid, window->displayId_);
+            windowIndex_.InsertSceneBoardElementId(realWid, window->uiNodeId_);
         }
 
         if (a11yWindows_[realWid].IsFocused()) {
@@ -88,19 +116,26 @@ void AccessibilityWindowManager::DeInit()
     HILOG_DEBUG();
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
     a11yWindows_.clear();
-    subWindows_.clear();
-    sceneBoardElementIdMap_.Clear();
+    windowIndex_.ClearSceneBoard();
     activeWindowId_ = INVALID_WINDOW_ID;
     a11yFocusedWindowId_ = INVALID_WINDOW_ID;
+    activeWindowIds_.clear();
+    a11yFocusedWindowIds_.clear();
+    magnifiedDisplays_.clear();
+    // windows are asked from wms again until the next Init
+    std::atomic_store(&windowSnapshot_, std::shared_ptr<const WindowSnapshot>(nullptr));
 }
 
 void AccessibilityWindowManager::WinDeInit()
 {
     HILOG_DEBUG();
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
+    WindowUpdateGuard guard(*this);
     a11yWindows_.clear();
-    sceneBoardElementIdMap_.Clear();
+    windowIndex_.ClearSceneBoardElementIds();
     activeWindowId_ = INVALID_WINDOW_ID;
+    activeWindowIds_.clear();
+    magnifiedDisplays_.clear();
 }
 
 AccessibilityWindowManager::~AccessibilityWindowManager()
@@ -147,6 +182,9 @@ void AccessibilityWindowManager::DeregisterWindowListener()
         windowListener_ = nullptr;
         eventHandler_ = nullptr;
     }
+    // the task of the pending updates may never run, the next update posts a new one
+    std::lock_guard<ffrt::mutex> lock(pendingUpdateMutex_);
+    pendingUpdates_.clear();
 }
 
 void AccessibilityWindowManager::OnWindowUpdate(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos,
@@ -161,48 +199,40 @@ void AccessibilityWindowManager::OnWindowUpdate(const std::vector<sptr<Rosen::Ac
         HILOG_ERROR("window info is err");
         return;
     }
+    {
+        std::lock_guard<ffrt::mutex> lock(pendingUpdateMutex_);
+        pendingUpdates_.push_back({infos, type});
+        recordedUpdates_.emplace_back(Utils::GetSystemTime(), pendingUpdates_.back());
+        if (recordedUpdates_.size() > MAX_RECORDED_WINDOW_UPDATES) {
+            recordedUpdates_.pop_front();
+        }
+        if (pendingUpdates_.size() > 1) {
+            // the task of this frame is posted already
+            return;
+        }
+    }
     eventHandler_->PostTask([=]() {
-        switch (type) {
-            case Rosen::WindowUpdateType::WINDOW_UPDATE_ADDED: // 1
-                WindowUpdateAdded(infos);
-                break;
-            case Rosen::WindowUpdateType::WINDOW_UPDATE_REMOVED: // 2
-                WindowUpdateRemoved(infos);
-                break;
-            case Rosen::WindowUpdateType::WINDOW_UPDATE_BOUNDS: // 4
-                WindowUpdateBounds(infos);
-                break;
-            case Rosen::WindowUpdateType::WINDOW_UPDATE_ACTIVE: // 5
-                WindowUpdateActive(infos);
-                break;
-            case Rosen::WindowUpdateType::WINDOW_UPDATE_FOCUSED: // 3
-                WindowUpdateFocused(infos);
-                break;
-            case Rosen::WindowUpdateType::WINDOW_UPDATE_PROPERTY: // 6
-                WindowUpdateProperty(infos);
-                break;
-            case Rosen::WindowUpdateType::WINDOW_UPDATE_ALL:
-                WindowUpdateAll(infos);
-                break;
-            default:
-                break;
+        std::vector<RosenWindowUpdate> updates;
+        {
+            std::lock_guard<ffrt::mutex> lock(pendingUpdateMutex_);
+            updates.swap(pendingUpdates_);
         }
+        ApplyWindowUpdates(updates);
         HILOG_DEBUG("a11yWindows[%{public}zu]", a11yWindows_.size());
-        }, "TASK_ON_WINDOW_UPDATE");
+        }, "TASK_ON_WINDOW_UPDATE", WINDOW_UPDATE_FRAME_TIME);
 }
 
 std::pair<int32_t, uint64_t> AccessibilityWindowManager::ConvertToRealWindowId(int32_t windowId, int32_t focusType)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
     int32_t winId = windowId;
     HILOG_DEBUG("ConvertToRealWindowId called, windowId[%{public}d], focusType[%{public}d]", windowId, focusType);
-    if (windowId == ACTIVE_WINDOW_ID) {
-        HILOG_DEBUG("After convert active windowId[%{public}d]", activeWindowId_);
-        winId = activeWindowId_;
-    }
-
-    if (windowId == ANY_WINDOW_ID) {
-        if (focusType == FOCUS_TYPE_ACCESSIBILITY) {
+    if (windowId == ACTIVE_WINDOW_ID || windowId == ANY_WINDOW_ID) {
+        // only the virtual window ids read the active and focused windows, the other ids take no lock
+        std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
+        if (windowId == ACTIVE_WINDOW_ID) {
+            HILOG_DEBUG("After convert active windowId[%{public}d]", activeWindowId_);
+            winId = activeWindowId_;
+        } else if (focusType == FOCUS_TYPE_ACCESSIBILITY) {
             HILOG_DEBUG("After convert a11yFocused windowId[%{public}d] by accessibility type", a11yFocusedWindowId_);
             winId = a11yFocusedWindowId_;
         } else if (focusType == FOCUS_TYPE_INPUT) {
@@ -211,13 +241,12 @@ std::pair<int32_t, uint64_t> AccessibilityWindowManager::ConvertToRealWindowId(i
         }
     }
 
-    auto iter = std::find_if(
-        subWindows_.begin(), subWindows_.end(), [winId](const auto &window) { return window.first == winId; });
-    if (iter != subWindows_.end()) {
+    uint64_t displayId = 0;
+    if (windowIndex_.FindSubWindow(winId, displayId)) {
         HILOG_DEBUG("After convert normal windowId[%{public}d]", SCENE_BOARD_WINDOW_ID);
-        return {SCENE_BOARD_WINDOW_ID, iter->second};
+        return {SCENE_BOARD_WINDOW_ID, displayId};
     }
-    HILOG_DEBUG("After convert windowId[%{public}d] and activeId[%{public}d]", winId, activeWindowId_);
+    HILOG_DEBUG("After convert windowId[%{public}d]", winId);
     return { winId, 0 };
 }
 
@@ -407,6 +436,7 @@ void AccessibilityWindowManager::SetActiveWindow(int32_t windowId, bool isSendEv
 {
     HILOG_INFO("windowId is %{public}d, activeWindowId_: %{public}d", windowId, activeWindowId_);
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
+    WindowUpdateGuard guard(*this);
     if (windowId == INVALID_WINDOW_ID) {
         ClearOldActiveWindow();
         activeWindowId_ = INVALID_WINDOW_ID;
@@ -424,9 +454,12 @@ void AccessibilityWindowManager::SetActiveWindow(int32_t windowId, bool isSendEv
         isSendEvent = false;
     }
 
-    if (activeWindowId_ != windowId) {
-        ClearOldActiveWindow();
+    // the window may be the active window of its display while the latest active window is on another one
+    uint64_t displayId = a11yWindows_[windowId].GetDisplayId();
+    if (activeWindowId_ != windowId || GetDisplayWindowId(activeWindowIds_, displayId) != windowId) {
+        ClearOldActiveWindow(displayId);
         activeWindowId_ = windowId;
+        activeWindowIds_[displayId] = windowId;
         a11yWindows_[activeWindowId_].SetActive(true);
         if (!isSendEvent) {
             HILOG_DEBUG("not send event, activeWindowId is %{public}d", activeWindowId_);
@@ -436,7 +469,7 @@ void AccessibilityWindowManager::SetActiveWindow(int32_t windowId, bool isSendEv
         AccessibilityEventInfo evtInf(activeWindowId_, WINDOW_UPDATE_ACTIVE);
         AccessibilityEventInfoParcel evtInfParcel(evtInf);
         int32_t winId = windowId;
-        if (sceneBoardElementIdMap_.CheckWindowIdPair(windowId)) {
+        if (windowIndex_.HasSceneBoardElementId(windowId)) {
             winId = SCENE_BOARD_WINDOW_ID;
         }
         SetEventInfoBundleName(evtInfParcel);
@@ -468,10 +501,21 @@ int32_t AccessibilityWindowManager::GetActiveWindowId()
     return activeWindowId_;
 }
 
+int32_t AccessibilityWindowManager::GetActiveWindowId(const uint64_t displayId)
+{
+    std::shared_ptr<const DisplayWindowSnapshot> display = GetDisplayWindowSnapshot(displayId);
+    if (display == nullptr) {
+        HILOG_DEBUG("no window on display[%{public}" PRIu64 "]", displayId);
+        return INVALID_WINDOW_ID;
+    }
+    return display->activeWindowId;
+}
+
 void AccessibilityWindowManager::SetAccessibilityFocusedWindow(int32_t windowId)
 {
     HILOG_DEBUG("windowId is %{public}d", windowId);
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
+    WindowUpdateGuard guard(*this);
     if (windowId == INVALID_WINDOW_ID) {
         ClearAccessibilityFocused();
         a11yFocusedWindowId_ = INVALID_WINDOW_ID;
@@ -483,15 +527,62 @@ void AccessibilityWindowManager::SetAccessibilityFocusedWindow(int32_t windowId)
         return;
     }
 
-    if (a11yFocusedWindowId_ != windowId) {
-        ClearAccessibilityFocused();
+    uint64_t displayId = a11yWindows_[windowId].GetDisplayId();
+    if (a11yFocusedWindowId_ != windowId || GetDisplayWindowId(a11yFocusedWindowIds_, displayId) != windowId) {
+        ClearAccessibilityFocused(displayId);
         a11yFocusedWindowId_ = windowId;
+        a11yFocusedWindowIds_[displayId] = windowId;
         a11yWindows_[a11yFocusedWindowId_].SetAccessibilityFocused(true);
     }
     HILOG_DEBUG("a11yFocusedWindowId_ is %{public}d", a11yFocusedWindowId_);
 }
 
 std::vector<AccessibilityWindowInfo> AccessibilityWindowManager::GetAccessibilityWindows()
+{
+    std::shared_ptr<const WindowSnapshot> snapshot = GetWindowSnapshot();
+    if (snapshot == nullptr) {
+        return QueryAccessibilityWindows();
+    }
+    HILOG_DEBUG("snapshot generation[%{public}" PRIu64 "], size[%{public}zu]", snapshot->generation,
+        snapshot->windows.size());
+    std::vector<AccessibilityWindowInfo> windows;
+    windows.reserve(snapshot->windows.size());
+    for (auto &window : snapshot->windows) {
+        windows.push_back(window.second);
+    }
+    return windows;
+}
+
+std::vector<AccessibilityWindowInfo> AccessibilityWindowManager::GetAccessibilityWindows(const uint64_t displayId)
+{
+    std::vector<AccessibilityWindowInfo> windows;
+    if (GetWindowSnapshot() == nullptr) {
+        for (auto &window : QueryAccessibilityWindows()) {
+            if (window.GetDisplayId() == displayId) {
+                windows.push_back(window);
+            }
+        }
+        return windows;
+    }
+    std::shared_ptr<const DisplayWindowSnapshot> display = GetDisplayWindowSnapshot(displayId);
+    if (display == nullptr) {
+        HILOG_DEBUG("no window on display[%{public}" PRIu64 "]", displayId);
+        return windows;
+    }
+    windows.reserve(display->windows.size());
+    for (auto &window : display->windows) {
+        windows.push_back(window.second);
+    }
+    return windows;
+}
+
+bool AccessibilityWindowManager::IsDisplayMagnified(const uint64_t displayId)
+{
+    std::shared_ptr<const DisplayWindowSnapshot> display = GetDisplayWindowSnapshot(displayId);
+    return display != nullptr && display->isMagnified;
+}
+
+std::vector<AccessibilityWindowInfo> AccessibilityWindowManager::QueryAccessibilityWindows()
 {
     XCollieHelper timer(TIMER_GET_ACCESSIBILITY_WINDOWS, WMS_TIMEOUT);
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
@@ -522,8 +613,13 @@ std::vector<AccessibilityWindowInfo> AccessibilityWindowManager::GetAccessibilit
 bool AccessibilityWindowManager::GetAccessibilityWindow(int32_t windowId, AccessibilityWindowInfo &window)
 {
     HILOG_DEBUG("start windowId(%{public}d)", windowId);
+    if (GetA11yWindowById(windowId, window)) {
+        return true;
+    }
+    // the window may be added before its update is handled, ask wms
     XCollieHelper timer(TIMER_GET_ACCESSIBILITY_WINDOWS, WMS_TIMEOUT);
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
+    WindowUpdateGuard guard(*this);
     std::vector<sptr<Rosen::AccessibilityWindowInfo>> windowInfos;
     Rosen::WMError err = OHOS::Rosen::WindowManager::GetInstance(accountId_).GetAccessibilityWindowInfo(windowInfos);
     if (err != Rosen::WMError::WM_OK) {
@@ -555,21 +651,15 @@ bool AccessibilityWindowManager::GetAccessibilityWindow(int32_t windowId, Access
 bool AccessibilityWindowManager::IsValidWindow(int32_t windowId)
 {
     HILOG_DEBUG("start windowId(%{public}d)", windowId);
-    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    auto it = std::find_if(a11yWindows_.begin(), a11yWindows_.end(),
-        [windowId](const std::map<int32_t, AccessibilityWindowInfo>::value_type &window) {
-            return window.first == windowId;
-        });
-    if (it == a11yWindows_.end()) {
-        return false;
-    }
-    return true;
+    std::shared_ptr<const WindowSnapshot> snapshot = GetWindowSnapshot();
+    return snapshot != nullptr && snapshot->windows.count(windowId) != 0;
 }
 
 void AccessibilityWindowManager::SetWindowSize(int32_t windowId, Rect rect)
 {
     HILOG_DEBUG("start windowId(%{public}d)", windowId);
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
+    WindowUpdateGuard guard(*this);
     auto it = std::find_if(a11yWindows_.begin(), a11yWindows_.end(),
         [windowId](const std::map<int32_t, AccessibilityWindowInfo>::value_type &window) {
             return window.first == windowId;
@@ -693,303 +783,343 @@ bool AccessibilityWindowManager::EqualLayer(const Accessibility::AccessibilityWi
 }
 // LCOV_EXCL_STOP
 
-void AccessibilityWindowManager::WindowUpdateAdded(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos)
+void AccessibilityWindowManager::ApplyWindowUpdates(const std::vector<RosenWindowUpdate> &updates)
 {
-    HILOG_DEBUG();
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    for (auto &windowInfo : infos) {
-        if (!windowInfo) {
-            HILOG_ERROR("invalid windowInfo");
-            return;
-        }
-
-        int32_t realWidId = GetRealWindowId(windowInfo);
-        if (!a11yWindows_.count(realWidId)) {
-            auto a11yWindowInfoAdded = CreateAccessibilityWindowInfo(windowInfo);
-            a11yWindows_.emplace(realWidId, a11yWindowInfoAdded);
-        } else {
-            UpdateAccessibilityWindowInfo(a11yWindows_[realWidId], windowInfo);
-        }
-
-        if (IsSceneBoard(windowInfo)) {
-            subWindows_.insert({realWidId, windowInfo->displayId_});
-            sceneBoardElementIdMap_.InsertPair(realWidId, windowInfo->uiNodeId_);
-        }
-        bool isSendWindowEvent = CheckEvents();
-        if (isSendWindowEvent) {
-            AccessibilityEventInfo evtInfAdded(realWidId, WINDOW_UPDATE_ADDED);
-            AccessibilityEventInfoParcel evtInfParcel(evtInfAdded);
-            Singleton<AccessibleAbilityManagerService>::GetInstance().InnerSendEvent(evtInfParcel, 0, accountId_);
-        }
-        if (a11yWindows_[realWidId].IsFocused()) {
-            SetActiveWindow(realWidId);
+    WindowUpdateGuard guard(*this);
+    // an update of all windows replaces the updates received before it
+    auto begin = updates.begin();
+    for (auto iter = updates.begin(); iter != updates.end(); ++iter) {
+        if (iter->type == Rosen::WindowUpdateType::WINDOW_UPDATE_ALL) {
+            begin = iter;
         }
     }
-}
-
-void AccessibilityWindowManager::WindowUpdateRemoved(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos)
-{
-    HILOG_DEBUG();
-    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    auto &aams = Singleton<AccessibleAbilityManagerService>::GetInstance();
-    for (auto &windowInfo : infos) {
-        if (!windowInfo) {
-            HILOG_ERROR("invalid windowInfo");
-            return;
-        }
+    if (begin != updates.end() && begin->type == Rosen::WindowUpdateType::WINDOW_UPDATE_ALL) {
+        WindowUpdateAll(begin->infos);
+        ++begin;
+    }
 
-        int32_t realWidId = GetRealWindowId(windowInfo);
-        if (!a11yWindows_.count(realWidId)) {
-            return;
-        }
-        if (realWidId == activeWindowId_) {
-            SetActiveWindow(INVALID_WINDOW_ID);
+    std::vector<int32_t> windowOrder;
+    std::map<int32_t, WindowDelta> deltas;
+    for (auto iter = begin; iter != updates.end(); ++iter) {
+        uint32_t typeMask = GetRosenTypeMask(iter->type);
+        if (typeMask == 0) {
+            HILOG_WARN("unknown WindowUpdateType type[%{public}d]", iter->type);
+            continue;
         }
-        if (realWidId == a11yFocusedWindowId_) {
-            SetAccessibilityFocusedWindow(INVALID_WINDOW_ID);
+        for (auto &windowInfo : iter->infos) {
+            if (!windowInfo) {
+                HILOG_ERROR("invalid windowInfo");
+                continue;
+            }
+            int32_t realWid = GetRealWindowId(windowInfo);
+            auto result = deltas.emplace(realWid, WindowDelta());
+            if (result.second) {
+                windowOrder.push_back(realWid);
+            }
+            WindowDelta &delta = result.first->second;
+            delta.info = windowInfo;
+            delta.rosenTypes |= typeMask;
+            if (iter->type == Rosen::WindowUpdateType::WINDOW_UPDATE_REMOVED) {
+                delta.removed = true;
+            } else if (iter->type == Rosen::WindowUpdateType::WINDOW_UPDATE_ADDED) {
+                delta.removed = false;
+            }
         }
-        a11yWindows_.erase(realWidId);
-        for (auto it = subWindows_.begin(); it != subWindows_.end();) {
-            if (it->first == realWidId) {
-                it = subWindows_.erase(it);
-            } else {
-                ++it;
+    }
+    HILOG_DEBUG("%{public}zu updates change %{public}zu windows", updates.size(), windowOrder.size());
+    for (int32_t realWid : windowOrder) {
+        ApplyWindowDelta(realWid, deltas[realWid]);
+    }
+    // the windows are activated in the order the updates arrive, only the last one stays active
+    int32_t activeWid = INVALID_WINDOW_ID;
+    std::optional<uint64_t> clearedDisplayId;
+    for (auto iter = begin; iter != updates.end(); ++iter) {
+        for (auto &windowInfo : iter->infos) {
+            if (windowInfo == nullptr) {
+                continue;
+            }
+            if (IsActivatingUpdate(iter->type, windowInfo)) {
+                activeWid = GetRealWindowId(windowInfo);
+                clearedDisplayId.reset();
+            } else if (iter->type == Rosen::WindowUpdateType::WINDOW_UPDATE_REMOVED &&
+                GetRealWindowId(windowInfo) == activeWid) {
+                // the window activated and then removed within the frame leaves its display without one
+                activeWid = INVALID_WINDOW_ID;
+                clearedDisplayId = windowInfo->displayId_;
             }
         }
-        sceneBoardElementIdMap_.RemovePair(realWidId);
-        bool isSendWindowEvent = CheckEvents();
-        if (isSendWindowEvent) {
-            AccessibilityEventInfo evtInfRemoved(realWidId, WINDOW_UPDATE_REMOVED);
-            AccessibilityEventInfoParcel evtInfParcel(evtInfRemoved);
-            aams.InnerSendEvent(evtInfParcel, 0, accountId_);
+    }
+    if (activeWid != INVALID_WINDOW_ID && a11yWindows_.count(activeWid)) {
+        SetActiveWindow(activeWid);
+    } else if (clearedDisplayId.has_value()) {
+        auto activeIter = a11yWindows_.find(activeWindowId_);
+        bool isLatestCleared = activeIter == a11yWindows_.end() ||
+            activeIter->second.GetDisplayId() == clearedDisplayId.value();
+        ClearOldActiveWindow(clearedDisplayId.value());
+        if (isLatestCleared) {
+            activeWindowId_ = INVALID_WINDOW_ID;
         }
     }
 }
 
-void AccessibilityWindowManager::WindowUpdateFocused(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos)
+void AccessibilityWindowManager::DumpRecordedWindowUpdates(std::string &dumpInfo)
 {
-    HILOG_DEBUG();
-    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    auto &aams = Singleton<AccessibleAbilityManagerService>::GetInstance();
-    for (auto &windowInfo : infos) {
-        if (!windowInfo) {
-            HILOG_ERROR("invalid windowInfo");
-            return;
-        }
-
-        int32_t realWidId = GetRealWindowId(windowInfo);
-        if (!a11yWindows_.count(realWidId)) {
-            HILOG_DEBUG("window not created");
-            auto a11yWindowInfoFocused = CreateAccessibilityWindowInfo(windowInfo);
-            a11yWindows_.emplace(realWidId, a11yWindowInfoFocused);
-        }
-
-        if (IsSceneBoard(windowInfo)) {
-            subWindows_.insert({realWidId, windowInfo->displayId_});
-            sceneBoardElementIdMap_.InsertPair(realWidId, windowInfo->uiNodeId_);
-        }
-        SetActiveWindow(realWidId);
-        bool isSendWindowEvent = CheckEvents();
-        if (isSendWindowEvent) {
-            AccessibilityEventInfo evtInfFocused(realWidId, WINDOW_UPDATE_FOCUSED);
-            AccessibilityEventInfoParcel evtInfParcel(evtInfFocused);
-            aams.InnerSendEvent(evtInfParcel, 0, accountId_);
-        }
+    std::deque<std::pair<int64_t, RosenWindowUpdate>> updates;
+    {
+        std::lock_guard<ffrt::mutex> lock(pendingUpdateMutex_);
+        updates = recordedUpdates_;
+    }
+    for (auto &update : updates) {
+        dumpInfo.append(FormatWindowUpdate(update.first, update.second)).append("\n");
     }
 }
 
-void AccessibilityWindowManager::WindowUpdateBounds(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos)
+std::string AccessibilityWindowManager::FormatWindowUpdate(const int64_t receivedTime,
+    const RosenWindowUpdate &update)
 {
-    HILOG_DEBUG();
-    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    auto &aams = Singleton<AccessibleAbilityManagerService>::GetInstance();
-    for (auto &windowInfo : infos) {
-        if (!windowInfo) {
-            HILOG_ERROR("invalid windowInfo");
-            return;
-        }
-
-        int32_t realWidId = GetRealWindowId(windowInfo);
-        if (a11yWindows_.count(realWidId)) {
-            UpdateAccessibilityWindowInfo(a11yWindows_[realWidId], windowInfo);
-        }
-
-        bool isSendWindowEvent = CheckEvents();
-        if (isSendWindowEvent) {
-            AccessibilityEventInfo evtInfBounds(realWidId, WINDOW_UPDATE_BOUNDS);
-            AccessibilityEventInfoParcel evtInfParcel(evtInfBounds);
-            aams.InnerSendEvent(evtInfParcel, 0, accountId_);
+    std::ostringstream oss;
+    auto count = std::count_if(update.infos.begin(), update.infos.end(),
+        [](const sptr<Rosen::AccessibilityWindowInfo> &info) { return info != nullptr; });
+    oss << receivedTime << " " << static_cast<int32_t>(update.type) << " " << count;
+    for (auto &info : update.infos) {
+        if (info == nullptr) {
+            continue;
         }
+        oss << " " << info->wid_ << " " << info->innerWid_ << " " << info->displayId_ << " " <<
+            static_cast<uint32_t>(info->type_) << " " << info->focused_ << " " << info->layer_ << " " <<
+            info->windowRect_.posX_ << " " << info->windowRect_.posY_ << " " << info->windowRect_.width_ << " " <<
+            info->windowRect_.height_ << " " << static_cast<uint32_t>(info->mode_) << " " << info->uiNodeId_ <<
+            " " << (info->bundleName_.empty() ? "-" : info->bundleName_);
     }
+    return oss.str();
 }
 
-void AccessibilityWindowManager::WindowUpdateActive(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos)
+bool AccessibilityWindowManager::IsActivatingUpdate(const Rosen::WindowUpdateType type,
+    const sptr<Rosen::AccessibilityWindowInfo> &windowInfo)
 {
-    HILOG_DEBUG();
-    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    for (auto &windowInfo : infos) {
-        if (!windowInfo) {
-            HILOG_ERROR("invalid windowInfo");
-            return;
-        }
-
-        int32_t realWidId = GetRealWindowId(windowInfo);
-        if (!a11yWindows_.count(realWidId)) {
-            auto a11yWindowInfoActive = CreateAccessibilityWindowInfo(windowInfo);
-            a11yWindows_.emplace(realWidId, a11yWindowInfoActive);
-        }
-
-        if (IsSceneBoard(windowInfo)) {
-            subWindows_.insert({realWidId, windowInfo->displayId_});
-            sceneBoardElementIdMap_.InsertPair(realWidId, windowInfo->uiNodeId_);
-        }
-        SetActiveWindow(realWidId);
+    switch (type) {
+        case Rosen::WindowUpdateType::WINDOW_UPDATE_FOCUSED:
+        case Rosen::WindowUpdateType::WINDOW_UPDATE_ACTIVE:
+            return true;
+        case Rosen::WindowUpdateType::WINDOW_UPDATE_ADDED:
+            return windowInfo->focused_;
+        default:
+            return false;
     }
 }
 
-void AccessibilityWindowManager::WindowUpdateProperty(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos)
+void AccessibilityWindowManager::ApplyWindowDelta(const int32_t realWid, const WindowDelta &delta)
 {
-    HILOG_DEBUG();
-    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    auto &aams = Singleton<AccessibleAbilityManagerService>::GetInstance();
-    for (auto &windowInfo : infos) {
-        if (!windowInfo) {
-            HILOG_ERROR("invalid windowInfo");
-            return;
-        }
+    UpdateMagnifiedDisplay(delta.info, delta.removed);
+    if (delta.removed) {
+        RemoveA11yWindow(realWid);
+        return;
+    }
 
-        int32_t realWidId = GetRealWindowId(windowInfo);
-        if (a11yWindows_.count(realWidId)) {
-            UpdateAccessibilityWindowInfo(a11yWindows_[realWidId], windowInfo);
-        }
-        bool isSendWindowEvent = CheckEvents();
-        if (isSendWindowEvent) {
-            AccessibilityEventInfo evtInfProperty(realWidId, WINDOW_UPDATE_PROPERTY);
-            AccessibilityEventInfoParcel evtInfParcel(evtInfProperty);
-            aams.InnerSendEvent(evtInfParcel, 0, accountId_);
+    const sptr<Rosen::AccessibilityWindowInfo> &windowInfo = delta.info;
+    bool isAdded = delta.rosenTypes & GetRosenTypeMask(Rosen::WindowUpdateType::WINDOW_UPDATE_ADDED);
+    bool isFocused = delta.rosenTypes & GetRosenTypeMask(Rosen::WindowUpdateType::WINDOW_UPDATE_FOCUSED);
+    bool isActive = delta.rosenTypes & GetRosenTypeMask(Rosen::WindowUpdateType::WINDOW_UPDATE_ACTIVE);
+    // a bounds or property update is sent even when nothing compared by GetWindowChanges differs
+    uint32_t changes = 0;
+    if (delta.rosenTypes & GetRosenTypeMask(Rosen::WindowUpdateType::WINDOW_UPDATE_BOUNDS)) {
+        changes |= WINDOW_UPDATE_BOUNDS;
+    }
+    if (delta.rosenTypes & GetRosenTypeMask(Rosen::WindowUpdateType::WINDOW_UPDATE_PROPERTY)) {
+        changes |= WINDOW_UPDATE_PROPERTY;
+    }
+    auto iter = a11yWindows_.find(realWid);
+    if (iter == a11yWindows_.end()) {
+        if (!isAdded && !isFocused && !isActive) {
+            HILOG_DEBUG("window[%{public}d] not created", realWid);
+            SendWindowChangeEvent(realWid, changes, "");
+            return;
         }
+        iter = a11yWindows_.emplace(realWid, CreateAccessibilityWindowInfo(windowInfo)).first;
+    } else {
+        changes |= GetWindowChanges(iter->second, windowInfo);
+        UpdateAccessibilityWindowInfo(iter->second, windowInfo);
     }
-}
-
-void AccessibilityWindowManager::WindowUpdateTypeEventAdded(const int32_t realWindowId,
-    std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows)
-{
-    AccessibilityEventInfo evtInfAdded(realWindowId, WINDOW_UPDATE_ADDED);
-    SetEventInfoBundleNameOld(evtInfAdded, realWindowId, oldA11yWindows);
-    AccessibilityEventInfoParcel evtInfParcel(evtInfAdded);
-    bool isSendWindowEvent = CheckEvents();
-    if (isSendWindowEvent) {
-        Singleton<AccessibleAbilityManagerService>::GetInstance().InnerSendEvent(evtInfParcel, 0, accountId_);
+    if (isAdded) {
+        changes |= WINDOW_UPDATE_ADDED;
+    }
+    if (isFocused) {
+        changes |= WINDOW_UPDATE_FOCUSED;
     }
-    if (a11yWindows_[realWindowId].IsFocused()) {
-        SetActiveWindow(realWindowId);
+
+    if ((isAdded || isFocused || isActive) && IsSceneBoard(windowInfo)) {
+        windowIndex_.InsertSubWindow(realWid, windowInfo->displayId_);
+        windowIndex_.InsertSceneBoardElementId(realWid, windowInfo->uiNodeId_);
     }
+    SendWindowChangeEvent(realWid, changes, iter->second.GetBundleName());
 }
 
-// LCOV_EXCL_START
-void AccessibilityWindowManager::WindowUpdateTypeEventRemoved(const int32_t realWindowId,
-    std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows)
+void AccessibilityWindowManager::RemoveA11yWindow(const int32_t realWid)
 {
-    if (realWindowId == activeWindowId_) {
+    auto iter = a11yWindows_.find(realWid);
+    if (iter == a11yWindows_.end()) {
+        return;
+    }
+    std::string bundleName = iter->second.GetBundleName();
+    if (realWid == activeWindowId_) {
         SetActiveWindow(INVALID_WINDOW_ID);
     }
-    if (realWindowId == a11yFocusedWindowId_) {
+    if (realWid == a11yFocusedWindowId_) {
         SetAccessibilityFocusedWindow(INVALID_WINDOW_ID);
     }
-
-    AccessibilityEventInfo evtInfRemoved(realWindowId, WINDOW_UPDATE_REMOVED);
-    SetEventInfoBundleNameOld(evtInfRemoved, realWindowId, oldA11yWindows);
-    AccessibilityEventInfoParcel evtInfParcel(evtInfRemoved);
-    bool isSendWindowEvent = CheckEvents();
-    if (isSendWindowEvent) {
-        Singleton<AccessibleAbilityManagerService>::GetInstance().InnerSendEvent(evtInfParcel, 0, accountId_);
+    EraseDisplayWindowId(activeWindowIds_, realWid);
+    EraseDisplayWindowId(a11yFocusedWindowIds_, realWid);
+    a11yWindows_.erase(realWid);
+    windowIndex_.RemoveWindow(realWid);
+    // the element operators granted for a removed window stop working even if the app keeps its operator
+    sptr<AccessibilityAccountData> accountData = accountData_.promote();
+    if (accountData != nullptr) {
+        sptr<AccessibilityWindowConnection> connection =
+            accountData->GetElementOperatorManager().GetAccessibilityWindowConnection(realWid);
+        if (connection != nullptr) {
+            connection->MarkProxiesStale();
+        }
     }
+    SendWindowChangeEvent(realWid, WINDOW_UPDATE_REMOVED, bundleName);
 }
 
-void AccessibilityWindowManager::WindowUpdateTypeEventBounds(const int32_t realWindowId,
-    std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows)
+uint32_t AccessibilityWindowManager::GetWindowChanges(Accessibility::AccessibilityWindowInfo &accWindowInfo,
+    const sptr<Rosen::AccessibilityWindowInfo> &windowInfo)
 {
-    AccessibilityEventInfo evtInfBounds(realWindowId, WINDOW_UPDATE_BOUNDS);
-    SetEventInfoBundleNameOld(evtInfBounds, realWindowId, oldA11yWindows);
-    AccessibilityEventInfoParcel evtInfParcel(evtInfBounds);
-    bool isSendWindowEvent = CheckEvents();
-    if (isSendWindowEvent) {
-        Singleton<AccessibleAbilityManagerService>::GetInstance().InnerSendEvent(evtInfParcel, 0, accountId_);
+    uint32_t changes = 0;
+    if (EqualFocus(accWindowInfo, windowInfo)) {
+        changes |= WINDOW_UPDATE_FOCUSED;
     }
-}
-
-void AccessibilityWindowManager::WindowUpdateTypeEventFocused(const int32_t realWindowId,
-    std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows)
-{
-    SetActiveWindow(realWindowId);
-    AccessibilityEventInfo evtInfFocused(realWindowId, WINDOW_UPDATE_FOCUSED);
-    SetEventInfoBundleNameOld(evtInfFocused, realWindowId, oldA11yWindows);
-    AccessibilityEventInfoParcel evtInfParcel(evtInfFocused);
-    bool isSendWindowEvent = CheckEvents();
-    if (isSendWindowEvent) {
-        Singleton<AccessibleAbilityManagerService>::GetInstance().InnerSendEvent(evtInfParcel, 0, accountId_);
+    if (EqualBound(accWindowInfo, windowInfo)) {
+        changes |= WINDOW_UPDATE_BOUNDS;
     }
-}
-
-void AccessibilityWindowManager::WindowUpdateTypeEventProperty(const int32_t realWindowId,
-    std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows)
-{
-    AccessibilityEventInfo evtInfProperty(realWindowId, WINDOW_UPDATE_PROPERTY);
-    SetEventInfoBundleNameOld(evtInfProperty, realWindowId, oldA11yWindows);
-    AccessibilityEventInfoParcel evtInfParcel(evtInfProperty);
-    bool isSendWindowEvent = CheckEvents();
-    if (isSendWindowEvent) {
-        Singleton<AccessibleAbilityManagerService>::GetInstance().InnerSendEvent(evtInfParcel, 0, accountId_);
+    if (EqualProperty(accWindowInfo, windowInfo)) {
+        changes |= WINDOW_UPDATE_PROPERTY;
+    }
+    if (EqualLayer(accWindowInfo, windowInfo)) {
+        changes |= WINDOW_UPDATE_LAYER;
     }
+    return changes;
 }
 
-void AccessibilityWindowManager::WindowUpdateTypeEventLayer(const int32_t realWindowId,
-    std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows)
+void AccessibilityWindowManager::SendWindowChangeEvent(const int32_t realWid, const uint32_t changes,
+    const std::string &bundleName)
 {
-    AccessibilityEventInfo evtInfLayer(realWindowId, WINDOW_UPDATE_LAYER);
-    SetEventInfoBundleNameOld(evtInfLayer, realWindowId, oldA11yWindows);
-    AccessibilityEventInfoParcel evtInfParcel(evtInfLayer);
-    bool isSendWindowEvent = CheckEvents();
-    if (isSendWindowEvent) {
-        Singleton<AccessibleAbilityManagerService>::GetInstance().InnerSendEvent(evtInfParcel, 0, accountId_);
+    if (changes == 0 || !CheckEvents()) {
+        return;
     }
+    // the listeners take one change type per event, the most significant change stands for the others
+    auto iter = std::find_if(WINDOW_CHANGE_PRIORITY.begin(), WINDOW_CHANGE_PRIORITY.end(),
+        [changes](WindowUpdateType type) { return (changes & type) != 0; });
+    if (iter == WINDOW_CHANGE_PRIORITY.end()) {
+        return;
+    }
+    HILOG_DEBUG("window[%{public}d] changes[0x%{public}x] send type[0x%{public}x]", realWid, changes, *iter);
+    AccessibilityEventInfo evtInf(realWid, *iter);
+    if (!bundleName.empty()) {
+        evtInf.SetBundleName(bundleName);
+    }
+    AccessibilityEventInfoParcel evtInfParcel(evtInf);
+    Singleton<AccessibleAbilityManagerService>::GetInstance().InnerSendEvent(evtInfParcel, 0, accountId_);
 }
-// LCOV_EXCL_STOP
 
-void AccessibilityWindowManager::WindowUpdateTypeEvent(const int32_t realWidId,
-    std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows, Accessibility::WindowUpdateType type)
+void AccessibilityWindowManager::WindowUpdateAll(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos)
 {
-    HILOG_DEBUG();
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    HILOG_DEBUG("WindowUpdateType type[%{public}d]", type);
-    switch (type) {
-        case WindowUpdateType::WINDOW_UPDATE_ADDED: {
-            WindowUpdateTypeEventAdded(realWidId, oldA11yWindows);
-            break;
-            }
-        case WindowUpdateType::WINDOW_UPDATE_REMOVED: {
-            WindowUpdateTypeEventRemoved(realWidId, oldA11yWindows);
-            break;
-            }
-        case WindowUpdateType::WINDOW_UPDATE_BOUNDS: {
-            WindowUpdateTypeEventBounds(realWidId, oldA11yWindows);
-            break;
-            }
-        case WindowUpdateType::WINDOW_UPDATE_FOCUSED: {
-            WindowUpdateTypeEventFocused(realWidId, oldA11yWindows);
-            break;
-            }
-        case WindowUpdateType::WINDOW_UPDATE_PROPERTY: {
-            WindowUpdateTypeEventProperty(realWidId, oldA11yWindows);
-            break;
+    WindowUpdateGuard guard(*this);
+    previousActiveWindowId_ = activeWindowId_;
+    magnifiedDisplays_.clear();
+    std::vector<int32_t> windowOrder;
+    std::map<int32_t, sptr<Rosen::AccessibilityWindowInfo>> latestWindows;
+    for (auto &window : infos) {
+        if (window == nullptr) {
+            HILOG_ERROR("window is nullptr");
+            continue;
+        }
+        if (IsMagnificationWindow(window)) {
+            UpdateMagnifiedDisplay(window, false);
+            continue;
+        }
+        int32_t realWid = GetRealWindowId(window);
+        HILOG_DEBUG("windowInfo wid: %{public}d, innerWid: %{public}d, focused: %{public}d",
+            window->wid_, window->innerWid_, window->focused_);
+        if (latestWindows.emplace(realWid, window).second) {
+            windowOrder.push_back(realWid);
+        }
+    }
+
+    // the windows are diffed in place, only the changed ones are updated
+    bool hasFocusedWindow = false;
+    std::set<uint64_t> focusedDisplays;
+    for (int32_t realWid : windowOrder) {
+        const sptr<Rosen::AccessibilityWindowInfo> &window = latestWindows[realWid];
+        uint32_t changes = 0;
+        auto iter = a11yWindows_.find(realWid);
+        if (iter == a11yWindows_.end()) {
+            iter = a11yWindows_.emplace(realWid, CreateAccessibilityWindowInfo(window)).first;
+            HILOG_DEBUG("a11yWindowInfo bundleName(%{public}s)", iter->second.GetBundleName().c_str());
+            changes = WINDOW_UPDATE_ADDED;
+        } else {
+            changes = GetWindowChanges(iter->second, window);
+            if (changes != 0 || iter->second.IsFocused() != window->focused_ ||
+                iter->second.GetBundleName() != window->bundleName_) {
+                UpdateAccessibilityWindowInfo(iter->second, window);
             }
-        case WindowUpdateType::WINDOW_UPDATE_LAYER: {
-            WindowUpdateTypeEventLayer(realWidId, oldA11yWindows);
-            break;
         }
-        default:
-            break;
+        if (IsSceneBoard(window)) {
+            windowIndex_.InsertSubWindow(realWid, window->displayId_);
+            windowIndex_.InsertSceneBoardElementId(realWid, window->uiNodeId_);
+        }
+        SendWindowChangeEvent(realWid, changes, iter->second.GetBundleName());
+        if (!window->focused_ && !IsScenePanel(window) && !IsKeyboardDialog(window)) {
+            continue;
         }
+
+        hasFocusedWindow = true;
+        focusedDisplays.insert(window->displayId_);
+        if (previousActiveWindowId_ != realWid) {
+            SetActiveWindow(realWid);
+        } else {
+            activeWindowId_ = previousActiveWindowId_;
+            activeWindowIds_[window->displayId_] = activeWindowId_;
+            a11yWindows_[activeWindowId_].SetActive(true);
+        }
+    }
+
+    std::vector<int32_t> removedWindows;
+    for (auto &window : a11yWindows_) {
+        if (!latestWindows.count(window.first)) {
+            removedWindows.push_back(window.first);
+        }
+    }
+    for (int32_t realWid : removedWindows) {
+        RemoveA11yWindow(realWid);
+    }
+    // a display without a focused window has no active window, activeWindowId_ is handled below
+    for (auto &window : a11yWindows_) {
+        if (window.second.IsActive() && window.first != activeWindowId_ &&
+            !focusedDisplays.count(window.second.GetDisplayId())) {
+            window.second.SetActive(false);
+        }
+    }
+    for (auto iter = activeWindowIds_.begin(); iter != activeWindowIds_.end();) {
+        if (!focusedDisplays.count(iter->first) && iter->second != activeWindowId_) {
+            iter = activeWindowIds_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    if (!hasFocusedWindow) {
+        if (a11yWindows_.count(activeWindowId_)) {
+            a11yWindows_[activeWindowId_].SetActive(false);
+        }
+        activeWindowId_ = INVALID_WINDOW_ID;
+        activeWindowIds_.clear();
+        SetAccessibilityFocusedWindow();
+    }
+    HILOG_INFO("start activeWindowId_: %{public}d, end activeWindowId_: %{public}d",
+        previousActiveWindowId_, activeWindowId_);
 }
 
 bool AccessibilityWindowManager::IsMagnificationWindow(const sptr<Rosen::AccessibilityWindowInfo>& window)
@@ -1001,10 +1131,27 @@ bool AccessibilityWindowManager::IsMagnificationWindow(const sptr<Rosen::Accessi
     return false;
 }
 
+void AccessibilityWindowManager::UpdateMagnifiedDisplay(const sptr<Rosen::AccessibilityWindowInfo> &windowInfo,
+    const bool isRemoved)
+{
+    // the menu comes and goes with the magnification window
+    if (windowInfo->type_ != Rosen::WindowType::WINDOW_TYPE_MAGNIFICATION) {
+        return;
+    }
+    HILOG_DEBUG("display[%{public}" PRIu64 "] magnified: %{public}d", windowInfo->displayId_, !isRemoved);
+    if (isRemoved) {
+        magnifiedDisplays_.erase(windowInfo->displayId_);
+    } else {
+        magnifiedDisplays_.insert(windowInfo->displayId_);
+    }
+}
+
 // LCOV_EXCL_START
 void AccessibilityWindowManager::SetAccessibilityFocusedWindow()
 {
-    std::vector<AccessibilityWindowInfo> windows = GetAccessibilityWindows();
+    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
+    WindowUpdateGuard guard(*this);
+    std::vector<AccessibilityWindowInfo> windows = QueryAccessibilityWindows();
     if (windows.empty()) {
         HILOG_DEBUG("GetAccessibilityWindows is empty");
         return;
@@ -1015,8 +1162,8 @@ void AccessibilityWindowManager::SetAccessibilityFocusedWindow()
         const std::string bundleName = window.GetBundleName();
         const bool IsFocused = window.IsFocused();
         if (window.IsSceneBoard()) {
-            subWindows_.insert({windowId, window.GetDisplayId()});
-            sceneBoardElementIdMap_.InsertPair(windowId, window.GetUiNodeId());
+            windowIndex_.InsertSubWindow(windowId, window.GetDisplayId());
+            windowIndex_.InsertSceneBoardElementId(windowId, window.GetUiNodeId());
         }
         if (!IsFocused) {
             continue;
@@ -1056,90 +1203,11 @@ bool AccessibilityWindowManager::NeedSetActive(const int32_t windowId)
     }
 }
 
-void AccessibilityWindowManager::WindowUpdateAll(const std::vector<sptr<Rosen::AccessibilityWindowInfo>>& infos)
-{
-    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    auto oldA11yWindows_ = a11yWindows_;
-    
-    previousActiveWindowId_  = activeWindowId_;
-    bool hasFocusedWindow = false;
-    WinDeInit();
-    for (auto &window : infos) {
-        if (window == nullptr) {
-            HILOG_ERROR("window is nullptr");
-            continue;
-        }
-        if (IsMagnificationWindow(window)) {
-            continue;
-        }
-
-        int32_t realWid = GetRealWindowId(window);
-        HILOG_DEBUG("windowInfo wid: %{public}d, innerWid: %{public}d, focused: %{public}d",
-            window->wid_, window->innerWid_, window->focused_);
-        if (!a11yWindows_.count(realWid)) {
-            auto a11yWindowInfo = CreateAccessibilityWindowInfo(window);
-            a11yWindows_.emplace(realWid, a11yWindowInfo);
-            HILOG_DEBUG("a11yWindowInfo bundleName(%{public}s)", a11yWindowInfo.GetBundleName().c_str());
-        }
-        if (IsSceneBoard(window)) {
-            subWindows_.insert({realWid, window->displayId_});
-            sceneBoardElementIdMap_.InsertPair(realWid, window->uiNodeId_);
-        }
-        if (!window->focused_ && !IsScenePanel(window) && !IsKeyboardDialog(window)) {
-            WindowUpdateAllExec(oldA11yWindows_, realWid, window);
-            continue;
-        }
-
-        hasFocusedWindow = true;
-        if (previousActiveWindowId_  != realWid) {
-            SetActiveWindow(realWid);
-        } else {
-            activeWindowId_ = previousActiveWindowId_;
-            a11yWindows_[activeWindowId_].SetActive(true);
-        }
-
-        WindowUpdateAllExec(oldA11yWindows_, realWid, window);
-    }
-
-    for (auto it = oldA11yWindows_.begin(); it != oldA11yWindows_.end(); ++it) {
-        WindowUpdateTypeEvent(it->first, oldA11yWindows_, WINDOW_UPDATE_REMOVED);
-    }
-    if (!hasFocusedWindow) {
-        SetAccessibilityFocusedWindow();
-    }
-    HILOG_INFO("start activeWindowId_: %{public}d, end activeWindowId_: %{public}d",
-        previousActiveWindowId_, activeWindowId_);
-}
-
-void AccessibilityWindowManager::WindowUpdateAllExec(std::map<int32_t, AccessibilityWindowInfo> &oldA11yWindows,
-    int32_t realWid, const sptr<Rosen::AccessibilityWindowInfo> &window)
-{
-    if (!oldA11yWindows.count(realWid)) {
-        WindowUpdateTypeEvent(realWid, oldA11yWindows, WINDOW_UPDATE_ADDED);
-    } else {
-        if (EqualFocus(oldA11yWindows[realWid], window)) {
-            WindowUpdateTypeEvent(realWid, oldA11yWindows, WINDOW_UPDATE_FOCUSED);
-        }
-        if (EqualBound(oldA11yWindows[realWid], window)) {
-            WindowUpdateTypeEvent(realWid, oldA11yWindows, WINDOW_UPDATE_BOUNDS);
-        }
-        if (EqualProperty(oldA11yWindows[realWid], window)) {
-            WindowUpdateTypeEvent(realWid, oldA11yWindows, WINDOW_UPDATE_PROPERTY);
-        }
-        if (EqualLayer(oldA11yWindows[realWid], window)) {
-            WindowUpdateTypeEvent(realWid, oldA11yWindows, WINDOW_UPDATE_LAYER);
-        }
-        auto itr = oldA11yWindows.find(realWid);
-        if (itr != oldA11yWindows.end()) {
-            oldA11yWindows.erase(itr);
-        }
-    }
-}
-
 void AccessibilityWindowManager::ClearOldActiveWindow()
 {
     HILOG_DEBUG("active window id is %{public}d", activeWindowId_);
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
+    WindowUpdateGuard guard(*this);
     if (activeWindowId_ == INVALID_WINDOW_ID) {
         HILOG_DEBUG("active window id is invalid");
         return;
@@ -1148,33 +1216,78 @@ void AccessibilityWindowManager::ClearOldActiveWindow()
     if (a11yWindows_.count(activeWindowId_)) {
         a11yWindows_[activeWindowId_].SetActive(false);
     }
+    EraseDisplayWindowId(activeWindowIds_, activeWindowId_);
     if (activeWindowId_ == a11yFocusedWindowId_) {
         HILOG_DEBUG("Old active window is a11yFocused window.");
         SetAccessibilityFocusedWindow(INVALID_WINDOW_ID);
     }
 }
 
+void AccessibilityWindowManager::ClearOldActiveWindow(const uint64_t displayId)
+{
+    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
+    WindowUpdateGuard guard(*this);
+    // the active window of another display stays active
+    auto iter = a11yWindows_.find(activeWindowId_);
+    if (iter == a11yWindows_.end() || iter->second.GetDisplayId() == displayId) {
+        ClearOldActiveWindow();
+    }
+    activeWindowIds_.erase(displayId);
+    for (auto &window : a11yWindows_) {
+        if (window.second.IsActive() && window.second.GetDisplayId() == displayId) {
+            HILOG_DEBUG("clear active window[%{public}d] of display[%{public}" PRIu64 "]", window.first, displayId);
+            window.second.SetActive(false);
+        }
+    }
+}
+
 void AccessibilityWindowManager::ClearAccessibilityFocused()
 {
     HILOG_DEBUG("a11yFocused window id is %{public}d", a11yFocusedWindowId_);
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    if (a11yFocusedWindowId_ == INVALID_WINDOW_ID) {
+    EraseDisplayWindowId(a11yFocusedWindowIds_, a11yFocusedWindowId_);
+    ClearWindowAccessibilityFocused(a11yFocusedWindowId_);
+}
+
+void AccessibilityWindowManager::ClearAccessibilityFocused(const uint64_t displayId)
+{
+    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
+    // the accessibility focused window of another display keeps the focus
+    auto iter = a11yWindows_.find(a11yFocusedWindowId_);
+    if (iter == a11yWindows_.end() || iter->second.GetDisplayId() == displayId) {
+        ClearAccessibilityFocused();
+    }
+    a11yFocusedWindowIds_.erase(displayId);
+    std::vector<int32_t> focusedWindows;
+    for (auto &window : a11yWindows_) {
+        if (window.second.IsAccessibilityFocused() && window.second.GetDisplayId() == displayId) {
+            focusedWindows.push_back(window.first);
+        }
+    }
+    for (int32_t windowId : focusedWindows) {
+        ClearWindowAccessibilityFocused(windowId);
+    }
+}
+
+void AccessibilityWindowManager::ClearWindowAccessibilityFocused(const int32_t a11yFocusedWindowId)
+{
+    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
+    WindowUpdateGuard guard(*this);
+    if (a11yFocusedWindowId == INVALID_WINDOW_ID) {
         HILOG_DEBUG("a11yFocused window id is invalid");
         return;
     }
 
-    if (a11yWindows_.count(a11yFocusedWindowId_)) {
-        a11yWindows_[a11yFocusedWindowId_].SetAccessibilityFocused(false);
+    if (a11yWindows_.count(a11yFocusedWindowId)) {
+        a11yWindows_[a11yFocusedWindowId].SetAccessibilityFocused(false);
     }
-    int32_t windowId = a11yFocusedWindowId_;
-    int32_t subWindowsCount = std::count_if(subWindows_.begin(), subWindows_.end(),
-        [this] (const auto &window) { return window.first == a11yFocusedWindowId_; });
-    if (subWindowsCount) {
+    int32_t windowId = a11yFocusedWindowId;
+    if (windowIndex_.IsSubWindow(a11yFocusedWindowId)) {
         windowId = SCENE_BOARD_WINDOW_ID;
     }
     // Send event
     AccessibilityEventInfo eventInfo(TYPE_VIEW_ACCESSIBILITY_FOCUS_CLEARED_EVENT);
-    eventInfo.SetWindowId(a11yFocusedWindowId_);
+    eventInfo.SetWindowId(a11yFocusedWindowId);
     AccessibilityEventInfoParcel eventInfoParcel(eventInfo);
     bool isSendWindowEvent = CheckEvents();
     if (isSendWindowEvent) {
@@ -1182,85 +1295,139 @@ void AccessibilityWindowManager::ClearAccessibilityFocused()
     }
 }
 
+int32_t AccessibilityWindowManager::GetDisplayWindowId(const std::map<uint64_t, int32_t> &displayWindowIds,
+    const uint64_t displayId)
+{
+    auto iter = displayWindowIds.find(displayId);
+    return iter == displayWindowIds.end() ? INVALID_WINDOW_ID : iter->second;
+}
+
+void AccessibilityWindowManager::EraseDisplayWindowId(std::map<uint64_t, int32_t> &displayWindowIds,
+    const int32_t windowId)
+{
+    for (auto iter = displayWindowIds.begin(); iter != displayWindowIds.end(); ++iter) {
+        if (iter->second == windowId) {
+            displayWindowIds.erase(iter);
+            return;
+        }
+    }
+}
+
 int64_t AccessibilityWindowManager::GetSceneBoardElementId(const int32_t windowId, const int64_t elementId)
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
     if (elementId != INVALID_SCENE_BOARD_ELEMENT_ID) {
         return elementId;
     }
-    int32_t subWindowsCount = std::count_if(
-        subWindows_.begin(), subWindows_.end(), [windowId](const auto &window) { return window.first == windowId; });
-    if (subWindowsCount) {
-        auto iter = a11yWindows_.find(windowId);
-        if (iter != a11yWindows_.end()) {
-            HILOG_DEBUG("GetSceneBoardElementId [%{public}" PRId64 "]", iter->second.GetUiNodeId());
-            return iter->second.GetUiNodeId();
+    if (windowIndex_.IsSubWindow(windowId)) {
+        AccessibilityWindowInfo window;
+        if (GetA11yWindowById(windowId, window)) {
+            HILOG_DEBUG("GetSceneBoardElementId [%{public}" PRId64 "]", window.GetUiNodeId());
+            return window.GetUiNodeId();
         }
     }
     return elementId;
 }
 
-void AccessibilityWindowManager::SceneBoardElementIdMap::InsertPair(const int32_t windowId, const int64_t elementId)
-{
-    std::lock_guard<ffrt::mutex> lock(mapMutex_);
-    windowElementMap_[windowId] = elementId;
-}
-
-void AccessibilityWindowManager::SceneBoardElementIdMap::RemovePair(const int32_t windowId)
-{
-    std::lock_guard<ffrt::mutex> lock(mapMutex_);
-    windowElementMap_.erase(windowId);
-}
-
-bool AccessibilityWindowManager::SceneBoardElementIdMap::CheckWindowIdPair(const int32_t windowId)
+void AccessibilityWindowManager::GetA11yWindowsBundleName(int32_t windowId, std::string &bundleName)
 {
-    std::lock_guard<ffrt::mutex> lock(mapMutex_);
-    return windowElementMap_.count(windowId);
+    std::shared_ptr<const WindowSnapshot> snapshot = GetWindowSnapshot();
+    if (snapshot == nullptr) {
+        return;
+    }
+    auto iter = snapshot->windows.find(windowId);
+    if (iter != snapshot->windows.end()) {
+        bundleName = iter->second.GetBundleName();
+        HILOG_DEBUG("GetA11yWindowsBundleName windowId:[%{public}d], BundleName:[%{public}s]",
+            windowId, bundleName.c_str());
+    }
 }
 
-void AccessibilityWindowManager::SceneBoardElementIdMap::Clear()
+bool AccessibilityWindowManager::GetA11yWindowById(int32_t windowId, AccessibilityWindowInfo &window)
 {
-    std::lock_guard<ffrt::mutex> lock(mapMutex_);
-    windowElementMap_.clear();
+    std::shared_ptr<const WindowSnapshot> snapshot = GetWindowSnapshot();
+    if (snapshot == nullptr) {
+        return false;
+    }
+    auto iter = snapshot->windows.find(windowId);
+    if (iter == snapshot->windows.end()) {
+        return false;
+    }
+    window = iter->second;
+    return true;
 }
 
-std::map<int32_t, int64_t> AccessibilityWindowManager::SceneBoardElementIdMap::GetAllPairs()
+std::shared_ptr<const AccessibilityWindowManager::WindowSnapshot>
+    AccessibilityWindowManager::GetWindowSnapshot() const
 {
-    std::lock_guard<ffrt::mutex> lock(mapMutex_);
-    return windowElementMap_;
+    return std::atomic_load(&windowSnapshot_);
 }
 
-void AccessibilityWindowManager::GetA11yWindowsBundleName(int32_t windowId, std::string &bundleName)
+std::shared_ptr<const AccessibilityWindowManager::DisplayWindowSnapshot>
+    AccessibilityWindowManager::GetDisplayWindowSnapshot(const uint64_t displayId) const
 {
-    std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    if (a11yWindows_.count(windowId)) {
-        bundleName = a11yWindows_[windowId].GetBundleName();
-        HILOG_DEBUG("GetA11yWindowsBundleName windowId:[%{public}d], BundleName:[%{public}s]",
-            windowId, bundleName.c_str());
+    std::shared_ptr<const WindowSnapshot> snapshot = GetWindowSnapshot();
+    if (snapshot == nullptr) {
+        return nullptr;
     }
+    auto iter = snapshot->displays.find(displayId);
+    return iter == snapshot->displays.end() ? nullptr : iter->second;
 }
 
-bool AccessibilityWindowManager::GetA11yWindowById(int32_t windowId, AccessibilityWindowInfo &window)
+void AccessibilityWindowManager::PublishWindowSnapshot()
 {
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    if (a11yWindows_.count(windowId)) {
-        window = a11yWindows_[windowId];
-        return true;
+    auto snapshot = std::make_shared<WindowSnapshot>();
+    snapshot->generation = ++snapshotGeneration_;
+    snapshot->windows = a11yWindows_;
+    std::map<uint64_t, std::shared_ptr<DisplayWindowSnapshot>> displays;
+    for (auto &window : a11yWindows_) {
+        std::shared_ptr<DisplayWindowSnapshot> &display = displays[window.second.GetDisplayId()];
+        if (display == nullptr) {
+            display = std::make_shared<DisplayWindowSnapshot>();
+        }
+        display->windows.emplace_hint(display->windows.end(), window.first, window.second);
+        // the windows flagged without SetActiveWindow stand in for a display missing in activeWindowIds_
+        if (window.second.IsActive() && display->activeWindowId == INVALID_WINDOW_ID) {
+            display->activeWindowId = window.first;
+        }
+        if (window.second.IsAccessibilityFocused() && display->a11yFocusedWindowId == INVALID_WINDOW_ID) {
+            display->a11yFocusedWindowId = window.first;
+        }
     }
-    return false;
+    for (auto &display : displays) {
+        int32_t activeWindowId = GetDisplayWindowId(activeWindowIds_, display.first);
+        if (display.second->windows.count(activeWindowId)) {
+            display.second->activeWindowId = activeWindowId;
+        }
+        int32_t a11yFocusedWindowId = GetDisplayWindowId(a11yFocusedWindowIds_, display.first);
+        if (display.second->windows.count(a11yFocusedWindowId)) {
+            display.second->a11yFocusedWindowId = a11yFocusedWindowId;
+        }
+    }
+    for (uint64_t displayId : magnifiedDisplays_) {
+        std::shared_ptr<DisplayWindowSnapshot> &display = displays[displayId];
+        if (display == nullptr) {
+            display = std::make_shared<DisplayWindowSnapshot>();
+        }
+        display->isMagnified = true;
+    }
+    for (auto &display : displays) {
+        snapshot->displays.emplace_hint(snapshot->displays.end(), display.first, std::move(display.second));
+    }
+    std::atomic_store(&windowSnapshot_, std::shared_ptr<const WindowSnapshot>(snapshot));
 }
 
 void AccessibilityWindowManager::SetEventInfoBundleName(AccessibilityEventInfo &uiEvent)
 {
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    std::string windowsBundleNameCache = "";
-    GetA11yWindowsBundleName(uiEvent.GetWindowId(), windowsBundleNameCache);
-    if (!windowsBundleNameCache.empty()) {
-        uiEvent.SetBundleName(windowsBundleNameCache);
+    // called while a11yWindows_ is updated, the snapshot may not contain the window yet
+    auto iter = a11yWindows_.find(uiEvent.GetWindowId());
+    if (iter != a11yWindows_.end() && !iter->second.GetBundleName().empty()) {
+        uiEvent.SetBundleName(iter->second.GetBundleName());
         return;
     }
 
-    std::vector<AccessibilityWindowInfo> windowsInfo = GetAccessibilityWindows();
+    std::vector<AccessibilityWindowInfo> windowsInfo = QueryAccessibilityWindows();
     if (windowsInfo.empty()) {
         HILOG_DEBUG("GetAccessibilityWindows is empty");
         return;
@@ -1311,13 +1478,7 @@ RetError AccessibilityWindowManager::GetFocusedWindowId(int32_t &focusedWindowId
 bool AccessibilityWindowManager::IsInnerWindowRootElement(int64_t elementId)
 {
     HILOG_DEBUG("IsInnerWindowRootElement elementId: %{public}" PRId64 "", elementId);
-    auto mapTable = sceneBoardElementIdMap_.GetAllPairs();
-    for (auto iter = mapTable.begin(); iter != mapTable.end(); iter++) {
-        if (elementId == iter->second) {
-            return true;
-        }
-    }
-    return false;
+    return windowIndex_.IsSceneBoardElementId(elementId);
 }
 
 void AccessibilityWindowManager::InsertTreeIdWindowIdPair(int32_t treeId, int32_t windowId)
@@ -1325,31 +1486,30 @@ void AccessibilityWindowManager::InsertTreeIdWindowIdPair(int32_t treeId, int32_
     if (windowId == 1) {
         return;
     }
-    windowTreeIdMap_.EnsureInsert(treeId, windowId);
+    windowIndex_.InsertTreeId(treeId, windowId);
 }
 
 void AccessibilityWindowManager::RemoveTreeIdWindowIdPair(int32_t treeId)
 {
-    windowTreeIdMap_.Erase(treeId);
+    windowIndex_.RemoveTreeId(treeId);
 }
 
 int32_t AccessibilityWindowManager::FindTreeIdWindowIdPair(int32_t treeId)
 {
-    return windowTreeIdMap_.ReadVal(treeId);
+    return windowIndex_.FindWindowIdByTreeId(treeId);
 }
 
 void AccessibilityWindowManager::ClearSceneBoard()
 {
     HILOG_INFO();
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
-    subWindows_.clear();
-    sceneBoardElementIdMap_.Clear();
+    windowIndex_.ClearSceneBoard();
 }
 
 void AccessibilityWindowManager::InitSceneBoard()
 {
     HILOG_INFO();
-    std::vector<AccessibilityWindowInfo> windows = GetAccessibilityWindows();
+    std::vector<AccessibilityWindowInfo> windows = QueryAccessibilityWindows();
     if (windows.empty()) {
         HILOG_WARN("GetAccessibilityWindows is empty");
         return;
@@ -1357,8 +1517,8 @@ void AccessibilityWindowManager::InitSceneBoard()
     std::lock_guard<ffrt::recursive_mutex> lock(interfaceMutex_);
     for (auto& window : windows) {
         if (window.IsSceneBoard()) {
-            subWindows_.insert({window.GetWindowId(), window.GetDisplayId()});
-            sceneBoardElementIdMap_.InsertPair(window.GetWindowId(), window.GetUiNodeId());
+            windowIndex_.InsertSubWindow(window.GetWindowId(), window.GetDisplayId());
+            windowIndex_.InsertSceneBoardElementId(window.GetWindowId(), window.GetUiNodeId());
         }
     }
 }
@@ -15,6 +15,7 @@
 
 #include "accessible_ability_channel.h"
 #include "accessible_ability_manager_service.h"
+#include "accessibility_constants.h"
 #include "accessibility_window_connection.h"
 #include "accessibility_window_manager.h"
 #include "accessible_ability_connection.h"
@@ -32,6 +33,8 @@ namespace Accessibility {
 namespace {
     constexpr int32_t WINDOW_ID_INVALID = -1;
     constexpr int64_t ELEMENT_ID_INVALID = -1;
+    constexpr uint32_t GRANT_ID_MASK = 0x7FFFFFFF;
+    std::atomic<uint32_t> g_grantId {0};
     const int32_t LONG_PRESS_EVENT_INTERVAL = 550;
     const int32_t DOUBLE_CLICK_EVENT_INTERVAL = 100;
     MMI::InputManager* inputManager_ = MMI::InputManager::GetInstance();
@@ -100,7 +103,7 @@ RetError AccessibleAbilityChannel::SearchElementInfoByAccessibilityId(const Elem
     std::string clientName = clientName_;
     std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
     ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, accountId, clientName, syncPromise, windowId, elementId, treeId, requestId,
+    auto task = [this, accountId, clientName, syncPromise, windowId, elementId, treeId, requestId,
         callback, mode, isFilter]() {
         HILOG_DEBUG("search element accountId[%{public}d], name[%{public}s]", accountId, clientName.c_str());
         sptr<IAccessibilityElementOperator> elementOperator = nullptr;
@@ -117,10 +120,16 @@ RetError AccessibleAbilityChannel::SearchElementInfoByAccessibilityId(const Elem
         sptr<AccessibilityAccountData> accountData = accountData_.promote();
         if (!accountData) {
             HILOG_ERROR("accountData is nullptr");
+            std::vector<AccessibilityElementInfo> infos = {};
+            callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
+            syncPromise->set_value(RET_ERR_NULLPTR);
             return;
         }
         int64_t realElementId = accountData->GetWindowManager().GetSceneBoardElementId(windowId, elementId);
-        accountData->GetElementOperatorManager().AddRequestId(windowId, treeId, requestId, callback);
+        // a recursive search walks the whole subtree, it is timed apart from the node searches
+        AccessibilityIpcHealth::RequestKind kind = (mode == PREFETCH_RECURSIVE_CHILDREN) ?
+            AccessibilityIpcHealth::RequestKind::TREE : AccessibilityIpcHealth::RequestKind::NODE;
+        accountData->GetElementOperatorManager().AddRequestId(windowId, treeId, requestId, callback, kind);
         ret = elementOperator->SearchElementInfoByAccessibilityId(realElementId, requestId,
             callback, mode, isFilter);
         if (ret != RET_OK) {
@@ -132,7 +141,8 @@ RetError AccessibleAbilityChannel::SearchElementInfoByAccessibilityId(const Elem
         }
         HILOG_DEBUG("AccessibleAbilityChannel::SearchElementInfoByAccessibilityId successfully");
         syncPromise->set_value(RET_OK);
-        }, "SearchElementInfoByAccessibilityId");
+    };
+    PostElementQuery(task, windowId, treeId, FOCUS_TYPE_INVALID, "SearchElementInfoByAccessibilityId");
 
     ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
     if (wait != ffrt::future_status::ready) {
@@ -162,7 +172,7 @@ RetError AccessibleAbilityChannel::SearchDefaultFocusedByWindowId(const ElementB
     std::string clientName = clientName_;
     std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
     ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, accountId, clientName, syncPromise, windowId, elementId, treeId, requestId,
+    PostChannelTask([this, accountId, clientName, syncPromise, windowId, elementId, treeId, requestId,
         callback, mode, isFilter]() {
         HILOG_DEBUG("search element accountId[%{public}d], name[%{public}s]", accountId, clientName.c_str());
         sptr<IAccessibilityElementOperator> elementOperator = nullptr;
@@ -221,7 +231,7 @@ RetError AccessibleAbilityChannel::SearchElementInfosByText(const int32_t access
     std::string clientName = clientName_;
     std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
     ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, accountId, clientName, syncPromise, accessibilityWindowId, elementId, treeId, text,
+    auto task = [this, accountId, clientName, syncPromise, accessibilityWindowId, elementId, treeId, text,
         requestId, callback]() {
         HILOG_DEBUG("accountId[%{public}d], name[%{public}s]", accountId, clientName.c_str());
         sptr<IAccessibilityElementOperator> elementOperator = nullptr;
@@ -236,15 +246,20 @@ RetError AccessibleAbilityChannel::SearchElementInfosByText(const int32_t access
         }
         sptr<AccessibilityAccountData> accountData = accountData_.promote();
         if (!accountData) {
+            HILOG_ERROR("accountData is nullptr");
+            std::vector<AccessibilityElementInfo> infos = {};
+            callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
             syncPromise->set_value(RET_ERR_FAILED);
             return;
         }
         int64_t realElementId =
             accountData->GetWindowManager().GetSceneBoardElementId(accessibilityWindowId, elementId);
-        accountData->GetElementOperatorManager().AddRequestId(accessibilityWindowId, treeId, requestId, callback);
+        accountData->GetElementOperatorManager().AddRequestId(accessibilityWindowId, treeId, requestId, callback,
+            AccessibilityIpcHealth::RequestKind::TREE);
         elementOperator->SearchElementInfosByText(realElementId, text, requestId, callback);
         syncPromise->set_value(RET_OK);
-        }, "SearchElementInfosByText");
+    };
+    PostElementQuery(task, accessibilityWindowId, treeId, FOCUS_TYPE_INVALID, "SearchElementInfosByText");
     ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
     if (wait != ffrt::future_status::ready) {
         HILOG_ERROR("Failed to wait SearchElementInfosByText result");
@@ -274,7 +289,7 @@ RetError AccessibleAbilityChannel::FindFocusedElementInfo(const int32_t accessib
     HILOG_DEBUG("FindFocusedElementInfo :channel FindFocusedElementInfo treeId: %{public}d", treeId);
     int32_t accountId = accountId_;
     std::string clientName = clientName_;
-    eventHandler_->PostTask([this, accountId, clientName, syncPromise, accessibilityWindowId, elementId, treeId,
+    auto task = [this, accountId, clientName, syncPromise, accessibilityWindowId, elementId, treeId,
         focusType, requestId, callback]() {
         HILOG_DEBUG("accountId[%{public}d], name[%{public}s]", accountId, clientName.c_str());
         sptr<IAccessibilityElementOperator> elementOperator = nullptr;
@@ -290,6 +305,8 @@ RetError AccessibleAbilityChannel::FindFocusedElementInfo(const int32_t accessib
         sptr<AccessibilityAccountData> accountData = accountData_.promote();
         if (!accountData) {
             HILOG_ERROR("accountData is nullptr");
+            std::vector<AccessibilityElementInfo> infos = {};
+            callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
             syncPromise->set_value(RET_ERR_FAILED);
             return;
         }
@@ -300,7 +317,8 @@ RetError AccessibleAbilityChannel::FindFocusedElementInfo(const int32_t accessib
         accountData->GetElementOperatorManager().AddRequestId(accessibilityWindowId, treeId, requestId, callback);
         elementOperator->FindFocusedElementInfo(realElementId, focusType, requestId, callback);
         syncPromise->set_value(RET_OK);
-        }, "FindFocusedElementInfo");
+    };
+    PostElementQuery(task, accessibilityWindowId, treeId, focusType, "FindFocusedElementInfo");
     ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
     if (wait != ffrt::future_status::ready) {
         HILOG_ERROR("Failed to wait FindFocusedElementInfo result");
@@ -330,7 +348,7 @@ RetError AccessibleAbilityChannel::FocusMoveSearch(const int32_t accessibilityWi
     HILOG_DEBUG("FocusMoveSearch :channel FocusMoveSearch treeId: %{public}d", treeId);
     int32_t accountId = accountId_;
     std::string clientName = clientName_;
-    eventHandler_->PostTask([this, accountId, clientName, syncPromise, accessibilityWindowId,
+    auto task = [this, accountId, clientName, syncPromise, accessibilityWindowId,
         elementId, treeId, direction, requestId, callback]() {
         HILOG_DEBUG("accountId[%{public}d], name[%{public}s]", accountId, clientName.c_str());
         sptr<IAccessibilityElementOperator> elementOperator = nullptr;
@@ -345,8 +363,10 @@ RetError AccessibleAbilityChannel::FocusMoveSearch(const int32_t accessibilityWi
         }
         sptr<AccessibilityAccountData> accountData = accountData_.promote();
         if (!accountData) {
-            syncPromise->set_value(RET_ERR_FAILED);
             HILOG_ERROR("accountData is nullptr");
+            std::vector<AccessibilityElementInfo> infos = {};
+            callback->SetSearchElementInfoByAccessibilityIdResult(infos, requestId);
+            syncPromise->set_value(RET_ERR_FAILED);
             return;
         }
         int64_t realElementId =
@@ -354,7 +374,8 @@ RetError AccessibleAbilityChannel::FocusMoveSearch(const int32_t accessibilityWi
         accountData->GetElementOperatorManager().AddRequestId(accessibilityWindowId, treeId, requestId, callback);
         elementOperator->FocusMoveSearch(realElementId, direction, requestId, callback);
         syncPromise->set_value(RET_OK);
-        }, "FocusMoveSearch");
+    };
+    PostElementQuery(task, accessibilityWindowId, treeId, FOCUS_TYPE_INVALID, "FocusMoveSearch");
     ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
     if (wait != ffrt::future_status::ready) {
         HILOG_ERROR("Failed to wait FocusMoveSearch result");
@@ -604,7 +625,7 @@ RetError AccessibleAbilityChannel::ExecuteActionAsync(const int32_t accessibilit
     int32_t treeId = Utils::GetTreeIdBySplitElementId(elementId);
     int32_t accountId = accountId_;
     std::string clientName = clientName_;
-    eventHandler_->PostTask([this, accountId, clientName, syncPromise, accessibilityWindowId, elementId, treeId, action,
+    PostChannelTask([this, accountId, clientName, syncPromise, accessibilityWindowId, elementId, treeId, action,
         actionArguments, requestId, callback]() {
         sptr<IAccessibilityElementOperator> elementOperator = nullptr;
         RetError ret = GetElementOperator(accountId, accessibilityWindowId, FOCUS_TYPE_INVALID, clientName,
@@ -667,7 +688,7 @@ RetError AccessibleAbilityChannel::GetWindow(const int32_t windowId, Accessibili
     std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
     std::shared_ptr<AccessibilityWindowInfo> tmpWindowInfo = std::make_shared<AccessibilityWindowInfo>(windowInfo);
     ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, accountId, clientName, windowId, tmpWindowInfo, syncPromise]() {
+    PostChannelTask([this, accountId, clientName, windowId, tmpWindowInfo, syncPromise]() {
         HILOG_DEBUG("windowId:%{public}d", windowId);
         sptr<AccessibleAbilityConnection> clientConnection = GetConnection(accountId, clientName);
         if (!clientConnection) {
@@ -735,7 +756,7 @@ RetError AccessibleAbilityChannel::GetWindows(uint64_t displayId, std::vector<Ac
     int32_t accountId = accountId_;
     std::string clientName = clientName_;
     ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, accountId, clientName, displayId, tmpWindows, syncPromise]() {
+    PostChannelTask([this, accountId, clientName, displayId, tmpWindows, syncPromise]() {
         HILOG_DEBUG();
         sptr<AccessibleAbilityConnection> clientConnection = GetConnection(accountId, clientName);
         if (!clientConnection) {
@@ -753,18 +774,15 @@ RetError AccessibleAbilityChannel::GetWindows(uint64_t displayId, std::vector<Ac
             syncPromise->set_value(RET_ERR_FAILED);
             return;
         }
-        std::vector<AccessibilityWindowInfo> windowInfos = accountData->GetWindowManager().GetAccessibilityWindows();
 #ifdef OHOS_BUILD_ENABLE_DISPLAY_MANAGER
-        for (auto &window : windowInfos) {
-            if (window.GetDisplayId() == displayId) {
-                tmpWindows->emplace_back(window);
-            }
-        }
+        std::vector<AccessibilityWindowInfo> windowInfos =
+            accountData->GetWindowManager().GetAccessibilityWindows(displayId);
 #else
+        std::vector<AccessibilityWindowInfo> windowInfos = accountData->GetWindowManager().GetAccessibilityWindows();
+#endif
         for (auto &window : windowInfos) {
             tmpWindows->emplace_back(window);
         }
-#endif
         syncPromise->set_value(RET_OK);
         }, "GetWindows");
     ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
@@ -787,7 +805,7 @@ void AccessibleAbilityChannel::SetOnKeyPressEventResult(const bool handled, cons
 
     int32_t accountId = accountId_;
     std::string clientName = clientName_;
-    eventHandler_->PostTask([this, accountId, clientName, handled, sequence]() {
+    PostChannelTask([this, accountId, clientName, handled, sequence]() {
         sptr<AccessibleAbilityConnection> clientConnection = GetConnection(accountId, clientName);
         if (!clientConnection) {
             HILOG_ERROR("There is no client connection");
@@ -814,7 +832,7 @@ RetError AccessibleAbilityChannel::GetCursorPosition(const int32_t accessibility
     HILOG_DEBUG("GetCursorPosition :channel GetCursorPosition treeId: %{public}d", treeId);
     int32_t accountId = accountId_;
     std::string clientName = clientName_;
-    eventHandler_->PostTask([this, accountId, clientName, syncPromise, accessibilityWindowId, elementId, treeId,
+    PostChannelTask([this, accountId, clientName, syncPromise, accessibilityWindowId, elementId, treeId,
         requestId, callback]() {
         HILOG_DEBUG("accountId[%{public}d], name[%{public}s]", accountId, clientName.c_str());
         sptr<IAccessibilityElementOperator> elementOperator = nullptr;
@@ -859,7 +877,7 @@ RetError AccessibleAbilityChannel::SendSimulateGesture(
     std::string clientName = clientName_;
     std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
     ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, accountId, clientName, gesturePath, syncPromise]() {
+    PostChannelTask([this, accountId, clientName, gesturePath, syncPromise]() {
         HILOG_DEBUG();
         sptr<AccessibleAbilityConnection> clientConnection = GetConnection(accountId, clientName);
         if (!clientConnection) {
@@ -905,7 +923,7 @@ RetError AccessibleAbilityChannel::SetTargetBundleName(const std::vector<std::st
     std::string clientName = clientName_;
     std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
     ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, accountId, clientName, targetBundleNames, syncPromise]() {
+    PostChannelTask([this, accountId, clientName, targetBundleNames, syncPromise]() {
         HILOG_DEBUG();
         sptr<AccessibleAbilityConnection> clientConnection = GetConnection(accountId, clientName);
         if (!clientConnection) {
@@ -962,30 +980,119 @@ RetError AccessibleAbilityChannel::GetElementOperator(
         return RET_ERR_NULLPTR;
     }
     auto [realId, displayId] = accountData->GetWindowManager().ConvertToRealWindowId(windowId, focusType);
+    OperatorKey key(realId, displayId, treeId);
+    ResolvedOperator resolved;
+    if (!FindResolvedOperator(key, resolved)) {
+        RetError ret = ResolveElementOperator(accountData, key, resolved);
+        if (ret != RET_OK) {
+            return ret;
+        }
+    }
+    if (!resolved.connection->GetIpcHealth().AllowRequest()) {
+        HILOG_ERROR("windowId[%{public}d] does not answer, fail fast", resolved.realWindowId);
+        return RET_ERR_TIME_OUT;
+    }
+    if (!resolved.elementOperator) {
+        HILOG_ERROR("The proxy of window connection is nullptr");
+        return RET_ERR_NULLPTR;
+    }
+    elementOperator = resolved.elementOperator;
+    return RET_OK;
+}
+
+bool AccessibleAbilityChannel::IsOperatorGranted(const int32_t windowId, const int32_t treeId,
+    const int32_t focusType)
+{
+    sptr<AccessibilityAccountData> accountData = accountData_.promote();
+    if (!accountData) {
+        return false;
+    }
+    auto [realId, displayId] = accountData->GetWindowManager().ConvertToRealWindowId(windowId, focusType);
+    ResolvedOperator resolved;
+    return FindResolvedOperator(OperatorKey(realId, displayId, treeId), resolved);
+}
+
+void AccessibleAbilityChannel::PostChannelTask(const std::function<void()> &task, const std::string &name)
+{
+    pendingTaskCount_++;
+    // the reference keeps the count alive for a task run after the caller stopped waiting
+    sptr<AccessibleAbilityChannel> channel = this;
+    bool posted = eventHandler_->PostTask([channel, task]() {
+        task();
+        channel->pendingTaskCount_--;
+    }, name);
+    if (!posted) {
+        HILOG_ERROR("post %{public}s failed", name.c_str());
+        pendingTaskCount_--;
+    }
+}
+
+void AccessibleAbilityChannel::PostElementQuery(const std::function<void()> &task, const int32_t windowId,
+    const int32_t treeId, const int32_t focusType, const std::string &name)
+{
+    // a query must not overtake a task of this channel still queued on the channel thread,
+    // such as an action whose wait timed out, so it runs in place only when none is left
+    if (pendingTaskCount_.load() == 0 && IsOperatorGranted(windowId, treeId, focusType)) {
+        HILOG_DEBUG("%{public}s to the granted window %{public}d", name.c_str(), windowId);
+        task();
+        return;
+    }
+    PostChannelTask(task, name);
+}
+
+bool AccessibleAbilityChannel::FindResolvedOperator(const OperatorKey &key, ResolvedOperator &resolved)
+{
+    std::lock_guard<ffrt::mutex> lock(operatorCacheMutex_);
+    auto iter = operatorCache_.find(key);
+    if (iter == operatorCache_.end()) {
+        return false;
+    }
+    // only a change of this window's connection makes the operator stale, updates of other windows do not
+    if (iter->second.connection->GetProxyGeneration() != iter->second.proxyGeneration) {
+        operatorCache_.erase(iter);
+        return false;
+    }
+    resolved = iter->second;
+    return true;
+}
+
+RetError AccessibleAbilityChannel::ResolveElementOperator(const sptr<AccessibilityAccountData> &accountData,
+    const OperatorKey &key, ResolvedOperator &resolved)
+{
+    auto [realId, displayId, treeId] = key;
     sptr<AccessibilityWindowConnection> connection =  accountData->GetAccessibilityWindowConnection(realId);
     if (connection == nullptr) {
         HILOG_ERROR("windowId[%{public}d] has no connection", realId);
         return RET_ERR_NO_WINDOW_CONNECTION;
     }
+    resolved.connection = connection;
+    resolved.realWindowId = realId;
+    // read before the proxy is chosen, so a change made meanwhile makes the entry stale at once
+    resolved.proxyGeneration = connection->GetProxyGeneration();
 
     bool isAnco = connection->IsAnco();
     bool useBroker = connection->GetUseBrokerFlag();
     bool hasMultipleProxies = (connection->GetCardProxySize() > 0);
     
     if (!useBroker && treeId > 0) {
-        elementOperator = connection->GetCardProxy(treeId);
+        resolved.elementOperator = connection->GetCardProxy(treeId);
     } else if (isAnco && useBroker && treeId > 0
         && connection->GetCardProxy(treeId)) {
-        elementOperator = connection->GetCardProxy(treeId);
+        resolved.elementOperator = connection->GetCardProxy(treeId);
     } else if (isAnco && useBroker && treeId == 0 && hasMultipleProxies) {
-        elementOperator = connection->GetRawProxy(displayId);
+        resolved.elementOperator = connection->GetRawProxy(displayId);
     } else {
-        elementOperator = connection->GetProxy(displayId);
+        resolved.elementOperator = connection->GetProxy(displayId);
     }
-    if (!elementOperator) {
-        HILOG_ERROR("The proxy of window connection is nullptr");
-        return RET_ERR_NULLPTR;
+    // a connection unregistered before its generation was read is not marked stale any more
+    if (resolved.elementOperator == nullptr || accountData->GetAccessibilityWindowConnection(realId) != connection) {
+        return RET_OK;
+    }
+    std::lock_guard<ffrt::mutex> lock(operatorCacheMutex_);
+    if (operatorCache_.size() >= OPERATOR_CACHE_SIZE) {
+        operatorCache_.clear();
     }
+    operatorCache_[key] = resolved;
     return RET_OK;
 }
 
@@ -999,6 +1106,9 @@ bool AccessibleAbilityChannel::CheckWinFromAwm(const int32_t windowId, const int
     if (!accountData) {
         return false;
     }
+    if (accountData->GetWindowManager().GetWindowSnapshot() != nullptr) {
+        return accountData->GetWindowManager().IsValidWindow(windowId);
+    }
     std::vector<AccessibilityWindowInfo> windows = accountData->GetWindowManager().GetAccessibilityWindows();
     if (!windows.empty()) {
         for (const auto& window: windows) {
@@ -1068,7 +1178,7 @@ void AccessibleAbilityChannel::SearchElementInfoBySpecificProperty(const Element
     std::string clientName = clientName_;
     std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
     ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, accountId, clientName, syncPromise, windowId, elementId, treeId, requestId,
+    PostChannelTask([this, accountId, clientName, syncPromise, windowId, elementId, treeId, requestId,
         callback, param]() {
         HILOG_DEBUG("search element accountId[%{public}d], name[%{public}s]", accountId, clientName.c_str());
         sptr<IAccessibilityElementOperator> elementOperator = nullptr;
@@ -1095,7 +1205,8 @@ void AccessibleAbilityChannel::SearchElementInfoBySpecificProperty(const Element
             HILOG_DEBUG("IsInnerWindowRootElement elementId: %{public}" PRId64 "", elementId);
         } else {
             int64_t realElementId = accountData->GetWindowManager().GetSceneBoardElementId(windowId, elementId);
-            accountData->GetElementOperatorManager().AddRequestId(windowId, treeId, requestId, callback);
+            accountData->GetElementOperatorManager().AddRequestId(windowId, treeId, requestId, callback,
+                AccessibilityIpcHealth::RequestKind::TREE);
             elementOperator->SearchElementInfoBySpecificProperty(realElementId, param, requestId, callback);
             HILOG_DEBUG("AccessibleAbilityChannel::SearchElementInfosBySpecificProperty successfully");
         }
@@ -1151,7 +1262,7 @@ RetError AccessibleAbilityChannel::FocusMoveSearchWithCondition(const Accessibil
     std::string clientName = clientName_;
     std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
     ffrt::future syncFuture = syncPromise->get_future();
-    eventHandler_->PostTask([this, accountId, clientName, syncPromise, windowId, elementInfo,
+    PostChannelTask([this, accountId, clientName, syncPromise, windowId, elementInfo,
         requestId, callback, param]() {
         sptr<IAccessibilityElementOperator> elementOperator = nullptr;
         int32_t treeId = elementInfo.GetBelongTreeId();
@@ -1207,7 +1318,7 @@ RetError AccessibleAbilityChannel::UpdateCustomAccessibilityProperty(const int64
     std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
     ffrt::future syncFuture = syncPromise->get_future();
     int32_t tree = Utils::GetTreeIdBySplitElementId(elementId);
-    eventHandler_->PostTask([accountId, clientName, syncPromise, windowId, elementId, tree,
+    PostChannelTask([accountId, clientName, syncPromise, windowId, elementId, tree,
         accessibilityVirtualNode, requestId, callback, this]() {
         sptr<IAccessibilityElementOperator> elementOperator = nullptr;
         RetError ret = GetElementOperator(accountId, windowId, FOCUS_TYPE_INVALID,
@@ -1254,7 +1365,7 @@ RetError AccessibleAbilityChannel::AddAccessibilityVirtualNode(const int64_t roo
     std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
     ffrt::future syncFuture = syncPromise->get_future();
     int32_t tree = Utils::GetTreeIdBySplitElementId(rootId);
-    eventHandler_->PostTask([accountId, clientName, syncPromise, windowId, rootId, tree,
+    PostChannelTask([accountId, clientName, syncPromise, windowId, rootId, tree,
         nodes, requestId, callback, this]() {
         sptr<IAccessibilityElementOperator> elementOperator = nullptr;
         RetError ret = GetElementOperator(accountId, windowId, FOCUS_TYPE_INVALID,
@@ -1300,7 +1411,7 @@ RetError AccessibleAbilityChannel::RemoveAccessibilityVirtualNode(const int64_t
     std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
     ffrt::future syncFuture = syncPromise->get_future();
     int32_t tree = Utils::GetTreeIdBySplitElementId(id);
-    eventHandler_->PostTask([accountId, clientName, syncPromise, windowId, id, tree,
+    PostChannelTask([accountId, clientName, syncPromise, windowId, id, tree,
         requestId, callback, this]() {
         sptr<IAccessibilityElementOperator> elementOperator = nullptr;
         RetError ret = GetElementOperator(accountId, windowId, FOCUS_TYPE_INVALID,
@@ -1328,6 +1439,202 @@ RetError AccessibleAbilityChannel::RemoveAccessibilityVirtualNode(const int64_t
     }
     return syncFuture.get();
 }
+
+RetError AccessibleAbilityChannel::SearchElementInfosBatch(const int32_t windowId, const int32_t treeId,
+    const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+    const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter, bool systemApi)
+{
+    HILOG_DEBUG("winId: %{public}d treeId: %{public}d query count: %{public}zu", windowId, treeId, queries.size());
+    if (systemApi && !Singleton<AccessibleAbilityManagerService>::GetInstance().CheckPermission(
+        OHOS_PERMISSION_ACCESSIBILITY_EXTENSION_ABILITY)) {
+        HILOG_WARN("SearchElementInfosBatch permission denied.");
+        return RET_ERR_NO_PERMISSION;
+    }
+    Singleton<AccessibleAbilityManagerService>::GetInstance().PostDelayUnloadTask();
+
+    if (eventHandler_ == nullptr || callback == nullptr) {
+        HILOG_ERROR("eventHandler_ exist: %{public}d, callback exist: %{public}d.", eventHandler_ != nullptr,
+            callback != nullptr);
+        return RET_ERR_NULLPTR;
+    }
+
+    int32_t accountId = accountId_;
+    std::string clientName = clientName_;
+    std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
+    ffrt::future syncFuture = syncPromise->get_future();
+    PostChannelTask([this, accountId, clientName, syncPromise, windowId, treeId, queries, requestId,
+        callback, isFilter]() {
+        sptr<IAccessibilityElementOperator> elementOperator = nullptr;
+        RetError ret = GetElementOperator(accountId, windowId, FOCUS_TYPE_INVALID, clientName,
+            elementOperator, treeId);
+        if (ret != RET_OK || !CheckWinFromAwm(windowId, ret)) {
+            HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", windowId);
+            std::vector<ElementSearchResult> results(queries.size(), ElementSearchResult { ret });
+            callback->SetSearchElementInfosBatchResult(results, requestId);
+            syncPromise->set_value(ret);
+            return;
+        }
+
+        sptr<AccessibilityAccountData> accountData = accountData_.promote();
+        if (!accountData) {
+            HILOG_ERROR("accountData is nullptr");
+            syncPromise->set_value(RET_ERR_NULLPTR);
+            return;
+        }
+        std::vector<ElementSearchQuery> realQueries = queries;
+        for (auto &query : realQueries) {
+            query.elementId = accountData->GetWindowManager().GetSceneBoardElementId(windowId, query.elementId);
+        }
+        accountData->GetElementOperatorManager().AddRequestId(windowId, treeId, requestId, callback,
+            AccessibilityIpcHealth::RequestKind::TREE);
+        elementOperator->SearchElementInfosBatch(realQueries, requestId, callback, isFilter);
+        syncPromise->set_value(RET_OK);
+        }, "SearchElementInfosBatch");
+
+    ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
+    if (wait != ffrt::future_status::ready) {
+        HILOG_ERROR("Failed to wait SearchElementInfosBatch result");
+        return RET_ERR_TIME_OUT;
+    }
+    return syncFuture.get();
+}
+
+RetError AccessibleAbilityChannel::SearchElementTreeDiff(const int32_t windowId, const int32_t treeId,
+    const uint64_t sinceGeneration, const int32_t requestId,
+    const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    HILOG_DEBUG("winId: %{public}d treeId: %{public}d", windowId, treeId);
+    Singleton<AccessibleAbilityManagerService>::GetInstance().PostDelayUnloadTask();
+
+    if (eventHandler_ == nullptr || callback == nullptr) {
+        HILOG_ERROR("eventHandler_ exist: %{public}d, callback exist: %{public}d.", eventHandler_ != nullptr,
+            callback != nullptr);
+        return RET_ERR_NULLPTR;
+    }
+
+    int32_t accountId = accountId_;
+    std::string clientName = clientName_;
+    std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
+    ffrt::future syncFuture = syncPromise->get_future();
+    PostChannelTask([this, accountId, clientName, syncPromise, windowId, treeId, sinceGeneration, requestId,
+        callback]() {
+        sptr<IAccessibilityElementOperator> elementOperator = nullptr;
+        RetError ret = GetElementOperator(accountId, windowId, FOCUS_TYPE_INVALID, clientName,
+            elementOperator, treeId);
+        if (ret != RET_OK || !CheckWinFromAwm(windowId, ret)) {
+            HILOG_ERROR("Get elementOperator failed! accessibilityWindowId[%{public}d]", windowId);
+            callback->SetSearchElementTreeDiffResult(ElementTreeDiff(), requestId);
+            syncPromise->set_value(ret);
+            return;
+        }
+
+        sptr<AccessibilityAccountData> accountData = accountData_.promote();
+        if (!accountData) {
+            HILOG_ERROR("accountData is nullptr");
+            syncPromise->set_value(RET_ERR_NULLPTR);
+            return;
+        }
+        accountData->GetElementOperatorManager().AddRequestId(windowId, treeId, requestId, callback,
+            AccessibilityIpcHealth::RequestKind::TREE);
+        elementOperator->SearchElementTreeDiff(sinceGeneration, requestId, callback);
+        syncPromise->set_value(RET_OK);
+        }, "SearchElementTreeDiff");
+
+    ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
+    if (wait != ffrt::future_status::ready) {
+        HILOG_ERROR("Failed to wait SearchElementTreeDiff result");
+        return RET_ERR_TIME_OUT;
+    }
+    return syncFuture.get();
+}
+
+RetError AccessibleAbilityChannel::GrantElementOperator(const int32_t windowId, const int32_t treeId,
+    sptr<IRemoteObject> &grantedOperator)
+{
+    HILOG_DEBUG("windowId: %{public}d treeId: %{public}d", windowId, treeId);
+    Singleton<AccessibleAbilityManagerService>::GetInstance().PostDelayUnloadTask();
+    if (eventHandler_ == nullptr) {
+        HILOG_ERROR("eventHandler_ is nullptr.");
+        return RET_ERR_NULLPTR;
+    }
+
+    int32_t accountId = accountId_;
+    std::string clientName = clientName_;
+    std::shared_ptr<ffrt::promise<RetError>> syncPromise = std::make_shared<ffrt::promise<RetError>>();
+    std::shared_ptr<sptr<IRemoteObject>> granted = std::make_shared<sptr<IRemoteObject>>(nullptr);
+    ffrt::future syncFuture = syncPromise->get_future();
+    PostChannelTask([this, accountId, clientName, windowId, treeId, granted, syncPromise]() {
+        syncPromise->set_value(InnerGrantElementOperator(accountId, clientName, windowId, treeId, *granted));
+        }, "GrantElementOperator");
+
+    ffrt::future_status wait = syncFuture.wait_for(std::chrono::milliseconds(TIME_OUT_OPERATOR));
+    if (wait != ffrt::future_status::ready) {
+        // a grant made after the wait is left to the revocation of the window or the ability
+        HILOG_ERROR("Failed to wait GrantElementOperator result");
+        return RET_ERR_TIME_OUT;
+    }
+    RetError ret = syncFuture.get();
+    if (ret == RET_OK) {
+        grantedOperator = *granted;
+    }
+    return ret;
+}
+
+RetError AccessibleAbilityChannel::InnerGrantElementOperator(const int32_t accountId, const std::string &clientName,
+    const int32_t windowId, const int32_t treeId, sptr<IRemoteObject> &grantedOperator)
+{
+    sptr<AccessibilityAccountData> accountData = accountData_.promote();
+    if (!accountData) {
+        HILOG_ERROR("accountData is nullptr");
+        return RET_ERR_NULLPTR;
+    }
+    // the element ids of the scene board, its inner windows and the broker are translated on each query
+    auto [realId, displayId] = accountData->GetWindowManager().ConvertToRealWindowId(windowId, FOCUS_TYPE_INVALID);
+    sptr<AccessibilityWindowConnection> connection = accountData->GetAccessibilityWindowConnection(realId);
+    if (connection == nullptr) {
+        HILOG_ERROR("windowId[%{public}d] has no connection", realId);
+        return RET_ERR_NO_WINDOW_CONNECTION;
+    }
+    if (realId != windowId || windowId == SCENE_BOARD_WINDOW_ID || connection->IsAnco() ||
+        connection->GetUseBrokerFlag()) {
+        HILOG_DEBUG("windowId[%{public}d] is searched through the service only", windowId);
+        return RET_ERR_INVALID_PARAM;
+    }
+    // a change made after this is seen below, a revocation made after the grant is recorded reaches the grant
+    uint64_t proxyGeneration = connection->GetProxyGeneration();
+    sptr<IAccessibilityElementOperator> elementOperator = nullptr;
+    RetError ret = GetElementOperator(accountId, windowId, FOCUS_TYPE_INVALID, clientName, elementOperator, treeId);
+    if (ret != RET_OK) {
+        return ret;
+    }
+    if (!CheckWinFromAwm(windowId, ret)) {
+        HILOG_ERROR("windowId[%{public}d] is not a window of AWM", windowId);
+        return RET_ERR_NO_WINDOW_CONNECTION;
+    }
+
+    int32_t grantId = static_cast<int32_t>(++g_grantId & GRANT_ID_MASK);
+    connection->AddElementOperatorGrant(grantId, clientName, treeId, elementOperator);
+    ret = elementOperator->GrantElementOperator(grantId, grantedOperator);
+    if (ret != RET_OK) {
+        HILOG_ERROR("windowId[%{public}d] grant failed: %{public}d", windowId, ret);
+        connection->RevokeElementOperatorGrant(grantId);
+        grantedOperator = nullptr;
+        return ret;
+    }
+    if (connection->GetProxyGeneration() != proxyGeneration || !GetConnection(accountId, clientName) ||
+        !connection->IsElementOperatorGranted(grantId)) {
+        HILOG_WARN("windowId[%{public}d] changed while granting", windowId);
+        if (!connection->RevokeElementOperatorGrant(grantId)) {
+            // the revocation may have reached the app before the grant did
+            elementOperator->RevokeElementOperator(grantId);
+        }
+        grantedOperator = nullptr;
+        return RET_ERR_NO_WINDOW_CONNECTION;
+    }
+    HILOG_INFO("windowId[%{public}d] treeId[%{public}d] granted to %{public}s, grant[%{public}d]", windowId, treeId,
+        clientName.c_str(), grantId);
+    return RET_OK;
+}
 } // namespace Accessibility
 } // namespace OHOS
 // LCOV_EXCL_STOP
\ No newline at end of file
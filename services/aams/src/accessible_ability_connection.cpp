@@ -31,16 +31,26 @@
 #include "iservice_registry.h"
 #include "bundle_info.h"
 #include "accessible_app_state_observer.h"
+#include "parameters.h"
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 
 namespace OHOS {
 namespace Accessibility {
+namespace {
+    const std::string EVENT_BATCH_INTERVAL_PARAM = "persist.accessibility.event_batch_interval";
+    constexpr int32_t EVENT_BATCH_INTERVAL_MAX = 100; // ms
+}
+
 AccessibleAbilityConnection::AccessibleAbilityConnection(int32_t accountId, int32_t connectionId,
     AccessibilityAbilityInfo &abilityInfo, const wptr<AccessibilityAccountData> &accountData)
     : accountId_(accountId), connectionId_(connectionId), abilityInfo_(abilityInfo), accountData_(accountData)
 {
     eventHandler_ = std::make_shared<AppExecFwk::EventHandler>(
         Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainRunner());
+    eventBatchInterval_ = std::clamp(system::GetIntParameter(EVENT_BATCH_INTERVAL_PARAM, 0),
+        0, EVENT_BATCH_INTERVAL_MAX);
 }
 
 AccessibleAbilityConnection::~AccessibleAbilityConnection()
@@ -307,6 +317,10 @@ void AccessibleAbilityConnection::OnAccessibilityEvent(AccessibilityEventInfo &e
     std::vector<std::string> filterBundleNames = abilityInfo_.GetFilterBundleNames();
     if (IsWantedEvent(eventInfo.GetEventType()) && (filterBundleNames.empty() || find(filterBundleNames.begin(),
         filterBundleNames.end(), eventInfo.GetBundleName()) != filterBundleNames.end())) {
+        if (eventBatchInterval_ > 0) {
+            BatchAccessibilityEvent(eventInfo);
+            return;
+        }
         abilityClient_->OnAccessibilityEvent(eventInfo);
         HILOG_DEBUG("windowId[%{public}d] evtType[%{public}d] windowChangeType[%{public}d] GestureId[%{public}d]",
             eventInfo.GetWindowId(), eventInfo.GetEventType(), eventInfo.GetWindowChangeTypes(),
@@ -314,6 +328,140 @@ void AccessibleAbilityConnection::OnAccessibilityEvent(AccessibilityEventInfo &e
     }
 }
 
+bool AccessibleAbilityConnection::IsCoalescibleEvent(EventType eventType)
+{
+    switch (eventType) {
+        case TYPE_VIEW_SCROLLED_EVENT:
+        case TYPE_VIEW_SCROLLING_EVENT:
+        case TYPE_VIEW_TEXT_UPDATE_EVENT:
+        case TYPE_PAGE_CONTENT_UPDATE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void AccessibleAbilityConnection::BatchAccessibilityEvent(const AccessibilityEventInfo &eventInfo)
+{
+    // the batches are sent in the order they are taken, the pending events are not locked during the IPC
+    std::lock_guard<ffrt::mutex> sendLock(sendEventsMutex_);
+    std::vector<AccessibilityEventInfo> events;
+    EventType eventType = eventInfo.GetEventType();
+    bool isCoalescible = IsCoalescibleEvent(eventType);
+    {
+        std::lock_guard<ffrt::mutex> lock(pendingEventsMutex_);
+        eventBatchStats_.receivedCount++;
+        if (!isCoalescible) {
+            // keep the order: everything pending goes out before this event.
+            events = TakePendingEventsLocked();
+            eventBatchStats_.deliveredCount++;
+        } else {
+            // the newest event replaces the pending one and takes its place at the end of the batch
+            auto iter = std::find_if(pendingEvents_.begin(), pendingEvents_.end(),
+                [&eventInfo, eventType](const AccessibilityEventInfo &pendingEvent) {
+                    return pendingEvent.GetEventType() == eventType &&
+                        pendingEvent.GetWindowId() == eventInfo.GetWindowId() &&
+                        pendingEvent.GetAccessibilityId() == eventInfo.GetAccessibilityId();
+                });
+            if (iter != pendingEvents_.end()) {
+                pendingEvents_.erase(iter);
+                eventBatchStats_.coalescedCount++;
+            }
+            pendingEvents_.push_back(eventInfo);
+            if (pendingEvents_.size() >= MAX_EVENT_BATCH_SIZE || !SchedulePendingEventsFlushLocked()) {
+                events = TakePendingEventsLocked();
+            }
+        }
+    }
+    SendPendingEvents(events);
+    if (!isCoalescible) {
+        abilityClient_->OnAccessibilityEvent(eventInfo);
+    }
+}
+
+bool AccessibleAbilityConnection::SchedulePendingEventsFlushLocked()
+{
+    if (isFlushScheduled_) {
+        return true;
+    }
+    if (!eventHandler_) {
+        HILOG_ERROR("eventHandler_ is nullptr");
+        return false;
+    }
+
+    // align the flush to the next batch interval boundary so that all connections flush together.
+    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t interval = eventBatchInterval_.load();
+    if (interval <= 0) {
+        return false;
+    }
+    int64_t delayTime = interval - now % interval;
+    wptr<AccessibleAbilityConnection> weakThis = this;
+    isFlushScheduled_ = eventHandler_->PostTask([weakThis]() {
+        sptr<AccessibleAbilityConnection> connection = weakThis.promote();
+        if (connection != nullptr) {
+            connection->FlushPendingEvents();
+        }
+        }, "FLUSH_EVENTS_" + elementName_.GetBundleName(), delayTime);
+    return isFlushScheduled_;
+}
+
+void AccessibleAbilityConnection::FlushPendingEvents()
+{
+    std::lock_guard<ffrt::mutex> sendLock(sendEventsMutex_);
+    std::vector<AccessibilityEventInfo> events;
+    {
+        std::lock_guard<ffrt::mutex> lock(pendingEventsMutex_);
+        events = TakePendingEventsLocked();
+    }
+    SendPendingEvents(events);
+}
+
+std::vector<AccessibilityEventInfo> AccessibleAbilityConnection::TakePendingEventsLocked()
+{
+    isFlushScheduled_ = false;
+    std::vector<AccessibilityEventInfo> events;
+    events.swap(pendingEvents_);
+    if (abilityClient_ && !events.empty()) {
+        eventBatchStats_.deliveredCount += events.size();
+        eventBatchStats_.batchCount++;
+    }
+    return events;
+}
+
+void AccessibleAbilityConnection::SendPendingEvents(const std::vector<AccessibilityEventInfo> &events)
+{
+    if (events.empty() || !abilityClient_) {
+        return;
+    }
+    if (events.size() == 1) {
+        abilityClient_->OnAccessibilityEvent(events.front());
+    } else {
+        abilityClient_->OnAccessibilityEvents(events);
+    }
+}
+
+EventBatchStats AccessibleAbilityConnection::GetEventBatchStats()
+{
+    std::lock_guard<ffrt::mutex> lock(pendingEventsMutex_);
+    return eventBatchStats_;
+}
+
+void AccessibleAbilityConnection::SetEventBatchInterval(const int32_t interval)
+{
+    std::lock_guard<ffrt::mutex> sendLock(sendEventsMutex_);
+    std::vector<AccessibilityEventInfo> events;
+    {
+        std::lock_guard<ffrt::mutex> lock(pendingEventsMutex_);
+        eventBatchInterval_ = std::clamp(interval, 0, EVENT_BATCH_INTERVAL_MAX);
+        if (eventBatchInterval_ == 0) {
+            events = TakePendingEventsLocked();
+        }
+    }
+    SendPendingEvents(events);
+}
+
 bool AccessibleAbilityConnection::OnKeyPressEvent(const MMI::KeyEvent &keyEvent, const int32_t sequence)
 {
     if (!abilityClient_) {
@@ -366,6 +514,10 @@ void AccessibleAbilityConnection::Disconnect()
         HILOG_ERROR("abilityClient is nullptr");
         return;
     }
+    {
+        std::lock_guard<ffrt::mutex> lock(pendingEventsMutex_);
+        pendingEvents_.clear();
+    }
     abilityClient_->Disconnect(connectionId_);
 
     if (isRegisterDisconnectCallback_) {
@@ -44,6 +44,8 @@ void AccessibleAbilityManager::Clear()
 {
     connectedA11yAbilities_.Clear();
     enabledAbilities_.clear();
+    // the dispatch table holds the connections of the account switched out
+    OnConnectedAbilitiesChanged();
 }
 
 void AccessibleAbilityManager::AddConnectedAbility(sptr<AccessibleAbilityConnection>& connection)
@@ -55,21 +57,43 @@ void AccessibleAbilityManager::AddConnectedAbility(sptr<AccessibleAbilityConnect
 
     std::string uri = Utils::GetUri(connection->GetElementName());
     connectedA11yAbilities_.AddAccessibilityAbility(uri, connection);
+    OnConnectedAbilitiesChanged();
 }
 
 void AccessibleAbilityManager::RemoveConnectedAbility(const AppExecFwk::ElementName &element)
 {
     connectedA11yAbilities_.RemoveAccessibilityAbilityByUri(Utils::GetUri(element));
+    OnConnectedAbilitiesChanged();
 }
 
 void AccessibleAbilityManager::RemoveConnectedAbilityByUri(const std::string &uri)
 {
     connectedA11yAbilities_.RemoveAccessibilityAbilityByUri(uri);
+    OnConnectedAbilitiesChanged();
 }
 
 void AccessibleAbilityManager::RemoveConnectedAbilityByName(const std::string &bundleName, bool& result)
 {
     connectedA11yAbilities_.RemoveAccessibilityAbilityByName(bundleName, result);
+    OnConnectedAbilitiesChanged();
+}
+
+void AccessibleAbilityManager::OnConnectedAbilitiesChanged()
+{
+    sptr<AccessibilityAccountData> accountData = accountData_.promote();
+    if (accountData == nullptr) {
+        return;
+    }
+    accountData->RebuildEventDispatchTable();
+
+    // the element operators granted to an ability stop working once it is disconnected
+    std::map<std::string, sptr<AccessibleAbilityConnection>> connectionMap;
+    connectedA11yAbilities_.GetAccessibilityAbilitiesMap(connectionMap);
+    std::set<std::string> clientNames;
+    for (const auto &[clientName, connection] : connectionMap) {
+        clientNames.insert(clientName);
+    }
+    accountData->GetElementOperatorManager().RevokeElementOperatorGrantsExcept(clientNames);
 }
 
 sptr<AccessibleAbilityConnection> AccessibleAbilityManager::GetConnectedAbilityByName(const std::string &elementName)
@@ -96,6 +120,7 @@ void AccessibleAbilityManager::GetConnectedAbilitiesMap(
 void AccessibleAbilityManager::ClearConnectedAbilities()
 {
     connectedA11yAbilities_.Clear();
+    OnConnectedAbilitiesChanged();
 }
 
 size_t AccessibleAbilityManager::GetConnectedAbilitiesSize()
@@ -28,6 +28,7 @@
 #endif // OHOS_BUILD_ENABLE_HITRACE
 
 #include "ability_info.h"
+#include "accessibility_event_dispatcher.h"
 #include "accessibility_event_info.h"
 #ifdef OHOS_BUILD_ENABLE_POWER_MANAGER
 #include "accessibility_power_manager.h"
@@ -73,7 +74,6 @@ namespace Accessibility {
 namespace {
     const char* AAMS_SERVICE_NAME = "AccessibleAbilityManagerService";
     const char* AAMS_ACTION_RUNNER_NAME = "AamsActionRunner";
-    const char* AAMS_SEND_EVENT_RUNNER_NAME = "AamsSendEventRunner";
     const char* AAMS_CHANNEL_RUNNER_NAME = "AamsChannelRunner";
     const char* AAMS_HOVER_ENTER_RUNNER_NAME = "AamsHoverEnterRunner";
     const char* SYSTEM_PARAMETER_AAMS_NAME = "accessibility.config.ready";
@@ -234,20 +234,8 @@ void AccessibleAbilityManagerService::InitActionHandler()
 
 void AccessibleAbilityManagerService::InitSendEventHandler()
 {
-    if (!sendEventRunner_) {
-        sendEventRunner_ = AppExecFwk::EventRunner::Create(AAMS_SEND_EVENT_RUNNER_NAME, AppExecFwk::ThreadMode::FFRT);
-        if (!sendEventRunner_) {
-            HILOG_ERROR("AccessibleAbilityManagerService::OnStart failed:create AAMS sendEvent runner failed");
-            return;
-        }
-    }
-
-    if (!sendEventHandler_) {
-        sendEventHandler_ = std::make_shared<AAMSEventHandler>(sendEventRunner_);
-        if (!sendEventHandler_) {
-            HILOG_ERROR("AccessibleAbilityManagerService::OnStart failed:create AAMS sendEvent handler failed");
-            return;
-        }
+    if (!Singleton<AccessibilityEventDispatcher>::GetInstance().Init()) {
+        HILOG_ERROR("AccessibleAbilityManagerService::OnStart failed:create AAMS sendEvent dispatcher failed");
     }
 }
 
@@ -566,7 +554,7 @@ ErrCode AccessibleAbilityManagerService::SendEvent(
 ErrCode AccessibleAbilityManagerService::InnerSendEvent(
     const AccessibilityEventInfoParcel &eventInfoParcel, int32_t flag, int32_t userId)
 {
-    if (!sendEventHandler_ || !hoverEnterHandler_) {
+    if (!hoverEnterHandler_) {
         HILOG_ERROR("Parameters check failed!");
         return RET_ERR_NULLPTR;
     }
@@ -585,11 +573,10 @@ ErrCode AccessibleAbilityManagerService::InnerSendEvent(
 
     if (eventType == TYPE_VIEW_HOVER_ENTER_EVENT) {
         hoverEnterHandler_->PostTask(sendEventTask, "TASK_SEND_EVENT");
-    } else {
-        sendEventHandler_->PostTask(sendEventTask, "TASK_SEND_EVENT");
+        return RET_OK;
     }
-
-    return RET_OK;
+    return Singleton<AccessibilityEventDispatcher>::GetInstance().Dispatch(uiEvent.GetWindowId(), eventType,
+        sendEventTask);
 }
 
 ErrCode AccessibleAbilityManagerService::RegisterStateObserver(
@@ -3034,14 +3021,15 @@ ErrCode AccessibleAbilityManagerService::GetFocusedWindowId(int32_t &focusedWind
     return InnerGetFocusedWindowId(focusedWindowId, GetCurrentAccountId());
 }
 
-std::vector<AccessibilityWindowInfo> AccessibleAbilityManagerService::GetAccessibilityWindows(int32_t uesrId)
+std::vector<AccessibilityWindowInfo> AccessibleAbilityManagerService::GetAccessibilityWindows(int32_t uesrId,
+    uint64_t displayId)
 {
     sptr<AccessibilityAccountData> accountData = GetAccountData(uesrId);
     if (!accountData) {
         HILOG_ERROR("accountData is nullptr.");
         return std::vector<AccessibilityWindowInfo>();
     }
-    return accountData->GetWindowManager().GetAccessibilityWindows();
+    return accountData->GetWindowManager().GetAccessibilityWindows(displayId);
 }
  
 ErrCode AccessibleAbilityManagerService::InnerGetFocusedWindowId(int32_t &focusedWindowId, int32_t userId)
@@ -3841,8 +3829,7 @@ void AccessibleAbilityManagerService::RecycleEventHandler()
     handler_.reset();
     actionRunner_.reset();
     actionHandler_.reset();
-    sendEventRunner_.reset();
-    sendEventHandler_.reset();
+    Singleton<AccessibilityEventDispatcher>::GetInstance().Clear();
     channelRunner_.reset();
     channelHandler_.reset();
     hoverEnterRunner_.reset();
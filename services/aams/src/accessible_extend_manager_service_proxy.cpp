@@ -1325,7 +1325,7 @@ bool ExtendManagerServiceProxy::SetMagnificationScaleCallback() {
 
 static std::vector<AccessibilityWindowInfo> GetAccessibilityWindowsCallback(uint64_t displayId) {
     int userId = Singleton<AccessibleAbilityManagerService>::GetInstance().GetUserIdByDisplayId(displayId);
-    return Singleton<AccessibleAbilityManagerService>::GetInstance().GetAccessibilityWindows(userId);
+    return Singleton<AccessibleAbilityManagerService>::GetInstance().GetAccessibilityWindows(userId, displayId);
 }
 
 bool ExtendManagerServiceProxy::ExtendGetAccessibilityWindowsCallback() {
@@ -29,6 +29,9 @@ void ElementOperatorCallbackImpl::SetPromiseValue()
     bool expected = false;
     if (promiseSet_.compare_exchange_strong(expected, true)) {
         promise_.set_value();
+        if (resultCallback_) {
+            resultCallback_(*this);
+        }
     }
 }
 
@@ -211,6 +214,26 @@ void ElementOperatorCallbackImpl::SetRemoveAccessibilityVirtualNodeResult(
     operateVirtualNodeResult_ = result;
     SetPromiseValue();
 }
+
+void ElementOperatorCallbackImpl::SetSearchElementInfosBatchResult(
+    const std::vector<ElementSearchResult> &results, const int32_t requestId)
+{
+    HILOG_DEBUG("Response [requestId:%{public}d], results size[%{public}zu]", requestId, results.size());
+    elementInfosResult_.clear();
+    for (auto &result : results) {
+        elementInfosResult_.insert(elementInfosResult_.end(), result.infos.begin(), result.infos.end());
+    }
+    SetPromiseValue();
+}
+
+void ElementOperatorCallbackImpl::SetSearchElementTreeDiffResult(const ElementTreeDiff &diff, const int32_t requestId)
+{
+    HILOG_DEBUG("Response [requestId:%{public}d], added[%{public}zu], changed[%{public}zu]", requestId,
+        diff.addedNodes.size(), diff.changedNodes.size());
+    elementInfosResult_ = diff.addedNodes;
+    elementInfosResult_.insert(elementInfosResult_.end(), diff.changedNodes.begin(), diff.changedNodes.end());
+    SetPromiseValue();
+}
 } // namespace Accessibility
 } // namespace OHOS
 // LCOV_EXCL_STOP
\ No newline at end of file
@@ -659,38 +659,58 @@ RetError Utils::GetResourceBundleInfo(AccessibilityEventInfo &eventInfo, int32_t
         eventInfo.GetResourceBundleName().c_str(), eventInfo.GetResourceModuleName().c_str(),
         eventInfo.GetResourceId());
     if (eventInfo.GetResourceId() > 0) {
-        AppExecFwk::BundleInfo bundleInfo;
-        ErrCode ret = Singleton<AccessibilityResourceBundleManager>::GetInstance().GetBundleInfoV9(
-            eventInfo.GetResourceBundleName(),
-            static_cast<int32_t>(AppExecFwk::GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_HAP_MODULE),
-            bundleInfo, userId);
-        if (ret != ERR_OK) {
-            HILOG_ERROR("get BundleInfo failed!");
-            return RET_ERR_FAILED;
+        std::string language = Global::I18n::LocaleConfig::GetSystemLanguage();
+        std::string stringKey = GetResourceCacheKey(userId, eventInfo.GetResourceBundleName()) +
+            eventInfo.GetResourceModuleName() + "/" + std::to_string(eventInfo.GetResourceId()) + "/" + language;
+        for (auto &param : eventInfo.GetResourceParams()) {
+            stringKey += "/" + std::to_string(std::get<0>(param)) + ":" + std::get<1>(param);
         }
- 
+
         std::string resourceValue;
-        RetError res = GetResourceValue(eventInfo, bundleInfo, userId, resourceValue);
+        AccessibilityResourceBundleManager &resourceBundleManager =
+            Singleton<AccessibilityResourceBundleManager>::GetInstance();
+        if (resourceBundleManager.GetCachedResourceString(stringKey, resourceValue)) {
+            eventInfo.SetTextAnnouncedForAccessibility(resourceValue);
+            return RET_OK;
+        }
+
+        RetError res = GetResourceValue(eventInfo, userId, language, resourceValue);
         if (res != RET_OK) {
             HILOG_ERROR("Get Resource Value failed");
             return res;
         }
         HILOG_DEBUG("resource value is %{public}s", resourceValue.c_str());
+        resourceBundleManager.CacheResourceString(stringKey, resourceValue);
         eventInfo.SetTextAnnouncedForAccessibility(resourceValue);
     }
     return RET_OK;
 }
- 
-RetError Utils::GetResourceValue(AccessibilityEventInfo &eventInfo,
-    AppExecFwk::BundleInfo bundleInfo, int32_t userId, std::string &result)
+
+std::string Utils::GetResourceCacheKey(int32_t userId, const std::string &bundleName)
+{
+    return std::to_string(userId) + "/" + bundleName + "/";
+}
+
+std::shared_ptr<Global::Resource::ResourceManager> Utils::CreateResourceManager(
+    AccessibilityEventInfo &eventInfo, int32_t userId, const std::string &language)
 {
+    AppExecFwk::BundleInfo bundleInfo;
+    ErrCode ret = Singleton<AccessibilityResourceBundleManager>::GetInstance().GetBundleInfoV9(
+        eventInfo.GetResourceBundleName(),
+        static_cast<int32_t>(AppExecFwk::GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_HAP_MODULE),
+        bundleInfo, userId);
+    if (ret != ERR_OK) {
+        HILOG_ERROR("get BundleInfo failed!");
+        return nullptr;
+    }
+
     std::unique_ptr<Global::Resource::ResConfig> resConfig(Global::Resource::CreateResConfig());
     if (resConfig == nullptr) {
         HILOG_ERROR("create resConfig failed");
-        return RET_ERR_NULLPTR;
+        return nullptr;
     }
     UErrorCode status = U_ZERO_ERROR;
-    icu::Locale locale = icu::Locale::forLanguageTag(Global::I18n::LocaleConfig::GetSystemLanguage(), status);
+    icu::Locale locale = icu::Locale::forLanguageTag(language, status);
     resConfig->SetLocaleInfo(locale.getLanguage(), locale.getScript(), locale.getCountry());
  
     std::string hapPath;
@@ -701,13 +721,13 @@ RetError Utils::GetResourceValue(AccessibilityEventInfo &eventInfo,
         appType, userId));
     if (resourceManager == nullptr) {
         HILOG_ERROR("create Resource manager failed");
-        return RET_ERR_NULLPTR;
+        return nullptr;
     }
  
     Global::Resource::RState state = resourceManager->UpdateResConfig(*resConfig);
     if (state != Global::Resource::RState::SUCCESS) {
         HILOG_ERROR("UpdateResConfig failed! errCode: %{public}d", state);
-        return RET_ERR_FAILED;
+        return nullptr;
     }
  
     for (const auto &hapModuleInfo : bundleInfo.hapModuleInfos) {
@@ -721,6 +741,25 @@ RetError Utils::GetResourceValue(AccessibilityEventInfo &eventInfo,
             HILOG_ERROR("AddResource is failed");
         }
     }
+    return resourceManager;
+}
+
+RetError Utils::GetResourceValue(AccessibilityEventInfo &eventInfo, int32_t userId, const std::string &language,
+    std::string &result)
+{
+    AccessibilityResourceBundleManager &resourceBundleManager =
+        Singleton<AccessibilityResourceBundleManager>::GetInstance();
+    std::string managerKey = GetResourceCacheKey(userId, eventInfo.GetResourceBundleName()) +
+        eventInfo.GetResourceModuleName() + "/" + language;
+    std::shared_ptr<Global::Resource::ResourceManager> resourceManager =
+        resourceBundleManager.GetCachedResourceManager(managerKey);
+    if (resourceManager == nullptr) {
+        resourceManager = CreateResourceManager(eventInfo, userId, language);
+        if (resourceManager == nullptr) {
+            return RET_ERR_FAILED;
+        }
+        resourceBundleManager.CacheResourceManager(managerKey, resourceManager);
+    }
  
     std::vector<std::tuple<Global::Resource::ResourceManager::NapiValueType, std::string>> arg;
     for (auto &param : eventInfo.GetResourceParams()) {
@@ -733,6 +772,7 @@ RetError Utils::GetResourceValue(AccessibilityEventInfo &eventInfo,
             arg.emplace_back(std::make_tuple(Global::Resource::ResourceManager::NapiValueType::NAPI_STRING,
                 std::get<1>(param)));
     }
+    std::lock_guard<ffrt::mutex> lock(resourceBundleManager.resourceMutex_);
     Global::Resource::RState res = resourceManager->GetStringFormatById(eventInfo.GetResourceId(), result, arg);
     if (res != Global::Resource::RState::SUCCESS) {
         HILOG_ERROR("get resource value failed");
@@ -68,6 +68,12 @@ public:
         const sptr<IAccessibilityElementOperatorCallback> &callback));
     MOCK_METHOD3(RemoveAccessibilityVirtualNode, void(const int64_t id, const int32_t requestId,
         const sptr<IAccessibilityElementOperatorCallback> &callback));
+    MOCK_METHOD4(SearchElementInfosBatch, void(const std::vector<ElementSearchQuery> &queries,
+        const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter));
+    MOCK_METHOD2(GrantElementOperator, RetError(const int32_t grantId, sptr<IRemoteObject> &grantedOperator));
+    MOCK_METHOD1(RevokeElementOperator, void(const int32_t grantId));
+    MOCK_METHOD3(SearchElementTreeDiff, void(const uint64_t sinceGeneration, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback));
 };
 } // namespace Accessibility
 } // namespace OHOS
@@ -528,6 +528,10 @@ void AccessibilityAccountData::isSendEvent(const AccessibilityEventInfo &eventIn
     (void)eventInfo;
 }
 
+void AccessibilityAccountData::RebuildEventDispatchTable()
+{
+}
+
 void AccountSubscriber::OnStateChanged(const AccountSA::OsAccountStateData &data)
 {
     (void)data;
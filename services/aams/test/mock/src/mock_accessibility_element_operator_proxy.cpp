@@ -148,5 +148,35 @@ void AccessibilityElementOperatorProxy::SearchElementInfoBySpecificProperty(cons
     (void)requestId;
     (void)callback;
 }
+
+void AccessibilityElementOperatorProxy::SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter)
+{
+    (void)queries;
+    (void)requestId;
+    (void)callback;
+    (void)isFilter;
+}
+
+RetError AccessibilityElementOperatorProxy::GrantElementOperator(const int32_t grantId,
+    sptr<IRemoteObject> &grantedOperator)
+{
+    (void)grantId;
+    (void)grantedOperator;
+    return RET_OK;
+}
+
+void AccessibilityElementOperatorProxy::RevokeElementOperator(const int32_t grantId)
+{
+    (void)grantId;
+}
+
+void AccessibilityElementOperatorProxy::SearchElementTreeDiff(const uint64_t sinceGeneration, const int32_t requestId,
+    const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    (void)sinceGeneration;
+    (void)requestId;
+    (void)callback;
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -45,6 +45,7 @@ void AccessibilityWindowManager::DeInit()
     a11yWindows_.clear();
     activeWindowId_ = INVALID_WINDOW_ID;
     a11yFocusedWindowId_ = INVALID_WINDOW_ID;
+    std::atomic_store(&windowSnapshot_, std::shared_ptr<const WindowSnapshot>(nullptr));
 }
 
 void AccessibilityWindowManager::RegisterWindowListener(const std::shared_ptr<AppExecFwk::EventHandler> &handler)
@@ -64,6 +65,11 @@ void AccessibilityWindowManager::OnWindowUpdate(const std::vector<sptr<Rosen::Ac
     (void)type;
 }
 
+void AccessibilityWindowManager::DumpRecordedWindowUpdates(std::string &dumpInfo)
+{
+    (void)dumpInfo;
+}
+
 std::pair<int32_t, uint64_t> AccessibilityWindowManager::ConvertToRealWindowId(int32_t windowId, int32_t focusType)
 {
     (void)windowId;
@@ -122,6 +128,26 @@ std::vector<AccessibilityWindowInfo> AccessibilityWindowManager::GetAccessibilit
     return windows;
 }
 
+std::vector<AccessibilityWindowInfo> AccessibilityWindowManager::GetAccessibilityWindows(const uint64_t displayId)
+{
+    (void)displayId;
+    std::vector<AccessibilityWindowInfo> windows;
+    return windows;
+}
+
+std::shared_ptr<const AccessibilityWindowManager::WindowSnapshot> AccessibilityWindowManager::GetWindowSnapshot() const
+{
+    return std::atomic_load(&windowSnapshot_);
+}
+
+void AccessibilityWindowManager::PublishWindowSnapshot()
+{
+    auto snapshot = std::make_shared<WindowSnapshot>();
+    snapshot->generation = ++snapshotGeneration_;
+    snapshot->windows = a11yWindows_;
+    std::atomic_store(&windowSnapshot_, std::shared_ptr<const WindowSnapshot>(snapshot));
+}
+
 bool AccessibilityWindowManager::GetAccessibilityWindow(int32_t windowId, AccessibilityWindowInfo& window)
 {
     HILOG_DEBUG("start windowId(%{public}d)", windowId);
@@ -166,23 +192,6 @@ int64_t AccessibilityWindowManager::GetSceneBoardElementId(const int32_t windowI
     return elementId;
 }
 
-void AccessibilityWindowManager::SceneBoardElementIdMap::InsertPair(const int32_t windowId, const int64_t elementId)
-{
-}
-
-void AccessibilityWindowManager::SceneBoardElementIdMap::RemovePair(const int32_t windowId)
-{
-}
-
-void AccessibilityWindowManager::SceneBoardElementIdMap::Clear()
-{
-}
-
-std::map<int32_t, int64_t> AccessibilityWindowManager::SceneBoardElementIdMap::GetAllPairs()
-{
-    return std::map<int32_t, int64_t>();
-}
-
 RetError AccessibilityWindowManager::GetFocusedWindowId(int32_t &focusedWindowId)
 {
     focusedWindowId = 1;
@@ -200,6 +209,12 @@ int32_t AccessibilityWindowManager::GetActiveWindowId()
     return activeWindowId_;
 }
 
+int32_t AccessibilityWindowManager::GetActiveWindowId(const uint64_t displayId)
+{
+    (void)displayId;
+    return activeWindowId_;
+}
+
 void AccessibilityWindowManager::InsertTreeIdWindowIdPair(int32_t treeId, int32_t windowId)
 {
     (void)treeId;
@@ -59,6 +59,13 @@ void AccessibleAbilityClientProxy::OnAccessibilityEvent(const AccessibilityEvent
                      << (int32_t)eventInfo.GetEventType();
 }
 
+void AccessibleAbilityClientProxy::OnAccessibilityEvents(const std::vector<AccessibilityEventInfo>& eventInfos)
+{
+    for (const auto& eventInfo : eventInfos) {
+        OnAccessibilityEvent(eventInfo);
+    }
+}
+
 void AccessibleAbilityClientProxy::OnKeyPressEvent(const MMI::KeyEvent& keyEvent, const int32_t sequence)
 {
     (void)keyEvent;
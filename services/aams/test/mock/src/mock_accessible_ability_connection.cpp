@@ -300,7 +300,17 @@ void AccessibleAbilityConnection::AccessibleAbilityConnectionDeathRecipient::OnR
 
 void AccessibleAbilityConnection::OnAccessibilityEvent(AccessibilityEventInfo &eventInfo)
 {
-    (void)eventInfo;
+    AccessibilityAbilityHelper::GetInstance().SetEventTypeVector(eventInfo.GetEventType());
+}
+
+EventBatchStats AccessibleAbilityConnection::GetEventBatchStats()
+{
+    return {};
+}
+
+void AccessibleAbilityConnection::SetEventBatchInterval(const int32_t interval)
+{
+    (void)interval;
 }
 
 void AccessibleAbilityConnection::OnAbilityConnectDoneSync(const AppExecFwk::ElementName &element,
@@ -433,5 +443,25 @@ RetError AccessibleAbilityChannel::RemoveAccessibilityVirtualNode(const int64_t
 {
     return RET_OK;
 }
+
+RetError AccessibleAbilityChannel::SearchElementInfosBatch(const int32_t windowId, const int32_t treeId,
+    const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+    const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter, bool systemApi)
+{
+    return RET_OK;
+}
+
+RetError AccessibleAbilityChannel::GrantElementOperator(const int32_t windowId, const int32_t treeId,
+    sptr<IRemoteObject> &grantedOperator)
+{
+    return RET_ERR_FAILED;
+}
+
+RetError AccessibleAbilityChannel::SearchElementTreeDiff(const int32_t windowId, const int32_t treeId,
+    const uint64_t sinceGeneration, const int32_t requestId,
+    const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    return RET_OK;
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -863,7 +863,8 @@ ErrCode AccessibleAbilityManagerService::InnerGetActiveWindow(int32_t &windowId,
 {
     return RET_OK;
 }
-std::vector<AccessibilityWindowInfo> AccessibleAbilityManagerService::GetAccessibilityWindows(int32_t userId)
+std::vector<AccessibilityWindowInfo> AccessibleAbilityManagerService::GetAccessibilityWindows(int32_t userId,
+    uint64_t displayId)
 {
     return std::vector<AccessibilityWindowInfo>();
 }
@@ -15,7 +15,6 @@
 
 #include <gtest/gtest.h>
 #include "accessibility_ability_info.h"
-#include "accessibility_account_data.h"
 #include "accessibility_common_helper.h"
 #include "accessibility_constants.h"
 #include "accessibility_element_operator_proxy.h"
@@ -23,6 +22,7 @@
 #include "accessibility_ut_helper.h"
 #define private public
 #define protected public
+#include "accessibility_account_data.h"
 #include "accessible_ability_manager_service.h"
 #undef private
 #undef protected
@@ -45,6 +45,32 @@ namespace Accessibility {
 namespace {
     constexpr uint32_t SLEEP_TIME_1 = 1;
     constexpr size_t IMPORTANT_ABILITIES_SIZE = 0;
+    constexpr int32_t HOVER_WINDOW_ID = 2;
+    constexpr int32_t HOVER_TREE_ID = 1;
+    constexpr int64_t HOVER_ELEMENT_ID = 10;
+
+    sptr<AccessibilityAccountData> CreateHoverEnterAccountData(int32_t accountId)
+    {
+        AccessibilityAbilityInitParams initParams;
+        AccessibilityAbilityInfo abilityInfo(initParams);
+        sptr<AccessibilityAccountData> accountData = new AccessibilityAccountData(accountId);
+        sptr<AccessibleAbilityConnection> connection =
+            new MockAccessibleAbilityConnection(accountId, 0, abilityInfo, accountData);
+        accountData->AddConnectedAbility(connection);
+        const std::string uri = Utils::GetUri(connection->GetElementName());
+        std::vector<uint32_t> needEvents = {TYPE_VIEW_HOVER_ENTER_EVENT};
+        accountData->UpdateAbilityNeedEvent(uri.substr(0, uri.find('/')), needEvents);
+        return accountData;
+    }
+
+    AccessibilityEventInfo CreateHoverEnterEvent()
+    {
+        AccessibilityEventInfo eventInfo;
+        eventInfo.SetEventType(TYPE_VIEW_HOVER_ENTER_EVENT);
+        eventInfo.SetWindowId(HOVER_WINDOW_ID);
+        eventInfo.SetSource(HOVER_ELEMENT_ID);
+        return eventInfo;
+    }
 } // namespace
 
 class AccessibilityAccountDataTest : public testing::Test {
@@ -874,6 +900,58 @@ HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_RemoveA
     GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_RemoveAccessibilityWindowConnection001 end";
 }
 
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_ElementOperatorGrant001
+ * @tc.name: MarkProxiesStale
+ * @tc.desc: Check the grants of a window are revoked when its proxies change.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_ElementOperatorGrant001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_ElementOperatorGrant001 start";
+    const int32_t accountId = 1;
+    const int32_t windowId = 1;
+    const int32_t treeId = 0;
+    const int32_t grantId = 1;
+    sptr<MockAccessibilityElementOperatorStub> stub = new MockAccessibilityElementOperatorStub();
+    sptr<AccessibilityWindowConnection> connection = new AccessibilityWindowConnection(windowId, accountId);
+    connection->AddElementOperatorGrant(grantId, "client", treeId, stub);
+    EXPECT_TRUE(connection->IsElementOperatorGranted(grantId));
+    EXPECT_CALL(*stub, RevokeElementOperator(grantId)).Times(1);
+    connection->ResetProxy();
+    EXPECT_FALSE(connection->IsElementOperatorGranted(grantId));
+
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_ElementOperatorGrant001 end";
+}
+
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_ElementOperatorGrant002
+ * @tc.name: RevokeElementOperatorGrantsExcept
+ * @tc.desc: Check only the grants of the disconnected extensions are revoked.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_ElementOperatorGrant002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_ElementOperatorGrant002 start";
+    const int32_t accountId = 1;
+    const int32_t windowId = 1;
+    const int32_t treeId = 0;
+    const int32_t grantId = 1;
+    const int32_t otherGrantId = 2;
+    sptr<AccessibilityAccountData> accountData = new AccessibilityAccountData(accountId);
+    sptr<MockAccessibilityElementOperatorStub> stub = new MockAccessibilityElementOperatorStub();
+    sptr<AccessibilityWindowConnection> connection = new AccessibilityWindowConnection(windowId, accountId);
+    accountData->AddAccessibilityWindowConnection(windowId, connection);
+    connection->AddElementOperatorGrant(grantId, "client", treeId, stub);
+    connection->AddElementOperatorGrant(otherGrantId, "other", treeId, stub);
+    EXPECT_CALL(*stub, RevokeElementOperator(grantId)).Times(1);
+    // the grant of the connected extension is revoked only with the account data
+    EXPECT_CALL(*stub, RevokeElementOperator(otherGrantId)).Times(1);
+    accountData->GetElementOperatorManager().RevokeElementOperatorGrantsExcept({ "other" });
+    EXPECT_FALSE(connection->IsElementOperatorGranted(grantId));
+    EXPECT_TRUE(connection->IsElementOperatorGranted(otherGrantId));
+
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_ElementOperatorGrant002 end";
+}
+
 HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_SetCaptionState, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_SetCaptionState start";
@@ -1884,5 +1962,204 @@ HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_StringT
     EXPECT_TRUE(!enabledAccessibilityServices.empty());
     GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_StringToVector001 end";
 }
+
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_isSendEvent001
+ * @tc.name: isSendEvent
+ * @tc.desc: Check the event dispatch table follows need events and connected abilities.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_isSendEvent001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_isSendEvent001 start";
+    const int32_t accountId = 1;
+    int32_t connectCounter = 0;
+    AccessibilityAbilityInitParams initParams;
+    std::shared_ptr<AccessibilityAbilityInfo> abilityInfo = std::make_shared<AccessibilityAbilityInfo>(initParams);
+    sptr<AccessibilityAccountData> accountData = new AccessibilityAccountData(accountId);
+    sptr<AccessibleAbilityConnection> connection =
+        new MockAccessibleAbilityConnection(accountId, connectCounter++, *abilityInfo, accountData);
+    AccessibilityEventInfo eventInfo;
+    eventInfo.SetEventType(TYPE_VIEW_CLICKED_EVENT);
+    AccessibilityAbilityHelper::GetInstance().ClearEventTypeActionVector();
+    accountData->isSendEvent(eventInfo);
+    // no ability is connected
+    EXPECT_TRUE(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().empty());
+
+    accountData->AddConnectedAbility(connection);
+    const std::string uri = Utils::GetUri(connection->GetElementName());
+    const std::string bundleName = uri.substr(0, uri.find('/'));
+    std::vector<uint32_t> needEvents = {TYPE_VIEW_CLICKED_EVENT, TYPE_VIEW_SCROLLED_EVENT};
+    accountData->UpdateAbilityNeedEvent(bundleName, needEvents);
+    accountData->isSendEvent(eventInfo);
+    // the hover enter event is not needed by the ability
+    eventInfo.SetEventType(TYPE_VIEW_HOVER_ENTER_EVENT);
+    accountData->isSendEvent(eventInfo);
+    eventInfo.SetEventType(TYPE_VIEW_SCROLLED_EVENT);
+    accountData->isSendEvent(eventInfo);
+    EXPECT_EQ(needEvents.size(), accountData->GetNeedEvents().size());
+    std::vector<EventType> receivedEvents = AccessibilityAbilityHelper::GetInstance().GetEventTypeVector();
+    ASSERT_EQ(receivedEvents.size(), 2U);
+    EXPECT_EQ(receivedEvents[0], TYPE_VIEW_CLICKED_EVENT);
+    EXPECT_EQ(receivedEvents[1], TYPE_VIEW_SCROLLED_EVENT);
+
+    accountData->RemoveConnectedAbility(connection->GetElementName());
+    AccessibilityAbilityHelper::GetInstance().ClearEventTypeActionVector();
+    accountData->isSendEvent(eventInfo);
+    EXPECT_EQ(0, (int)accountData->GetConnectedA11yAbilities().size());
+    EXPECT_TRUE(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().empty());
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_isSendEvent001 end";
+}
+
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_isSendEvent002
+ * @tc.name: isSendEvent
+ * @tc.desc: Check no event is sent to the abilities of an account switched out.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_isSendEvent002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_isSendEvent002 start";
+    const int32_t accountId = 1;
+    int32_t connectCounter = 0;
+    AccessibilityAbilityInitParams initParams;
+    std::shared_ptr<AccessibilityAbilityInfo> abilityInfo = std::make_shared<AccessibilityAbilityInfo>(initParams);
+    sptr<AccessibilityAccountData> accountData = new AccessibilityAccountData(accountId);
+    sptr<AccessibleAbilityConnection> connection =
+        new MockAccessibleAbilityConnection(accountId, connectCounter++, *abilityInfo, accountData);
+    accountData->AddConnectedAbility(connection);
+    const std::string uri = Utils::GetUri(connection->GetElementName());
+    const std::string bundleName = uri.substr(0, uri.find('/'));
+    std::vector<uint32_t> needEvents = {TYPE_VIEW_CLICKED_EVENT};
+    accountData->UpdateAbilityNeedEvent(bundleName, needEvents);
+
+    AccessibilityEventInfo eventInfo;
+    eventInfo.SetEventType(TYPE_VIEW_CLICKED_EVENT);
+    AccessibilityAbilityHelper::GetInstance().ClearEventTypeActionVector();
+    accountData->isSendEvent(eventInfo);
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().size(), 1U);
+
+    accountData->OnAccountSwitched();
+    AccessibilityAbilityHelper::GetInstance().ClearEventTypeActionVector();
+    accountData->isSendEvent(eventInfo);
+    EXPECT_EQ(0, (int)accountData->GetConnectedA11yAbilities().size());
+    EXPECT_TRUE(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().empty());
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_isSendEvent002 end";
+}
+
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_HoverEnter001
+ * @tc.name: OnHoverEnterSearchResult
+ * @tc.desc: Check the pending hover enter is delivered once when its result arrives and the verdict is cached.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_HoverEnter001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_HoverEnter001 start";
+    sptr<AccessibilityAccountData> accountData = CreateHoverEnterAccountData(1);
+    ElementOperatorManager &manager = accountData->GetElementOperatorManager();
+    ElementOperatorManager::HoverEnterKey key = std::make_tuple(HOVER_WINDOW_ID, HOVER_TREE_ID, HOVER_ELEMENT_ID);
+    const uint64_t sequence = 1;
+    manager.pendingHoverEnterEvents_[HOVER_WINDOW_ID] = { sequence, CreateHoverEnterEvent() };
+    AccessibilityAbilityHelper::GetInstance().ClearEventTypeActionVector();
+
+    ElementOperatorManager::HoverEnterVerdict verdict;
+    manager.OnHoverEnterSearchResult(HOVER_WINDOW_ID, sequence, 0, key, verdict);
+    std::vector<EventType> receivedEvents = AccessibilityAbilityHelper::GetInstance().GetEventTypeVector();
+    ASSERT_EQ(receivedEvents.size(), 1U);
+    EXPECT_EQ(receivedEvents[0], TYPE_VIEW_HOVER_ENTER_EVENT);
+    // the timeout of an answered query has nothing left to deliver
+    manager.OnHoverEnterSearchTimeout(HOVER_WINDOW_ID, sequence);
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().size(), 1U);
+
+    ElementOperatorManager::HoverEnterVerdict cached;
+    EXPECT_TRUE(manager.GetHoverEnterVerdict(key, cached));
+    EXPECT_FALSE(cached.invalid);
+    // looking up the content generation does not create an entry for the window
+    EXPECT_TRUE(manager.hoverContentGenerations_.empty());
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_HoverEnter001 end";
+}
+
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_HoverEnter002
+ * @tc.name: OnHoverEnterSearchResult
+ * @tc.desc: Check a superseded hover enter is not delivered and an invalid verdict drops the event.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_HoverEnter002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_HoverEnter002 start";
+    sptr<AccessibilityAccountData> accountData = CreateHoverEnterAccountData(1);
+    ElementOperatorManager &manager = accountData->GetElementOperatorManager();
+    ElementOperatorManager::HoverEnterKey key = std::make_tuple(HOVER_WINDOW_ID, HOVER_TREE_ID, HOVER_ELEMENT_ID);
+    const uint64_t oldSequence = 1;
+    const uint64_t newSequence = 2;
+    manager.pendingHoverEnterEvents_[HOVER_WINDOW_ID] = { newSequence, CreateHoverEnterEvent() };
+    AccessibilityAbilityHelper::GetInstance().ClearEventTypeActionVector();
+
+    ElementOperatorManager::HoverEnterVerdict verdict;
+    manager.OnHoverEnterSearchResult(HOVER_WINDOW_ID, oldSequence, 0, key, verdict);
+    manager.OnHoverEnterSearchTimeout(HOVER_WINDOW_ID, oldSequence);
+    EXPECT_TRUE(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().empty());
+    EXPECT_EQ(manager.pendingHoverEnterEvents_.size(), 1U);
+
+    verdict.invalid = true;
+    manager.OnHoverEnterSearchResult(HOVER_WINDOW_ID, newSequence, 0, key, verdict);
+    EXPECT_TRUE(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().empty());
+    EXPECT_TRUE(manager.pendingHoverEnterEvents_.empty());
+    ElementOperatorManager::HoverEnterVerdict cached;
+    EXPECT_TRUE(manager.GetHoverEnterVerdict(key, cached));
+    EXPECT_TRUE(cached.invalid);
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_HoverEnter002 end";
+}
+
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_HoverEnter003
+ * @tc.name: InvalidateHoverEnterVerdicts
+ * @tc.desc: Check a result issued before a content change is delivered but not cached.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_HoverEnter003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_HoverEnter003 start";
+    sptr<AccessibilityAccountData> accountData = CreateHoverEnterAccountData(1);
+    ElementOperatorManager &manager = accountData->GetElementOperatorManager();
+    ElementOperatorManager::HoverEnterKey key = std::make_tuple(HOVER_WINDOW_ID, HOVER_TREE_ID, HOVER_ELEMENT_ID);
+    const uint64_t sequence = 1;
+    manager.pendingHoverEnterEvents_[HOVER_WINDOW_ID] = { sequence, CreateHoverEnterEvent() };
+    AccessibilityAbilityHelper::GetInstance().ClearEventTypeActionVector();
+
+    AccessibilityEventInfo scrollEvent;
+    scrollEvent.SetEventType(TYPE_VIEW_SCROLLED_EVENT);
+    scrollEvent.SetWindowId(HOVER_WINDOW_ID);
+    manager.InvalidateHoverEnterVerdicts(scrollEvent);
+    ElementOperatorManager::HoverEnterVerdict verdict;
+    manager.OnHoverEnterSearchResult(HOVER_WINDOW_ID, sequence, 0, key, verdict);
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().size(), 1U);
+    ElementOperatorManager::HoverEnterVerdict cached;
+    EXPECT_FALSE(manager.GetHoverEnterVerdict(key, cached));
+
+    manager.RemoveAccessibilityWindowConnection(HOVER_WINDOW_ID);
+    EXPECT_TRUE(manager.hoverContentGenerations_.empty());
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_HoverEnter003 end";
+}
+
+/**
+ * @tc.number: AccessibilityAccountData_Unittest_HoverEnter004
+ * @tc.name: GetHoverEnterVerdict
+ * @tc.desc: Check a new hover enter on the window supersedes the one still waiting for its result.
+ */
+HWTEST_F(AccessibilityAccountDataTest, AccessibilityAccountData_Unittest_HoverEnter004, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_HoverEnter004 start";
+    sptr<AccessibilityAccountData> accountData = CreateHoverEnterAccountData(1);
+    ElementOperatorManager &manager = accountData->GetElementOperatorManager();
+    ElementOperatorManager::HoverEnterKey key = std::make_tuple(HOVER_WINDOW_ID, HOVER_TREE_ID, HOVER_ELEMENT_ID);
+    const uint64_t sequence = 1;
+    manager.pendingHoverEnterEvents_[HOVER_WINDOW_ID] = { sequence, CreateHoverEnterEvent() };
+    AccessibilityAbilityHelper::GetInstance().ClearEventTypeActionVector();
+
+    ElementOperatorManager::HoverEnterVerdict cached;
+    EXPECT_FALSE(manager.GetHoverEnterVerdict(key, cached));
+    EXPECT_TRUE(manager.pendingHoverEnterEvents_.empty());
+    manager.OnHoverEnterSearchTimeout(HOVER_WINDOW_ID, sequence);
+    EXPECT_TRUE(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().empty());
+    GTEST_LOG_(INFO) << "AccessibilityAccountData_Unittest_HoverEnter004 end";
+}
 } // namespace Accessibility
 } // namespace OHOS
@@ -17,6 +17,8 @@
 #include <gtest/gtest.h>
 #include <unistd.h>
 #include "accessibility_dumper.h"
+#include "accessibility_event_dispatcher.h"
+#include "accessibility_resource_bundle_manager.h"
 #include "accessibility_ut_helper.h"
 #include "mock_accessible_ability_connection.h"
 #include "mock_accessible_ability_manager_service.h"
@@ -296,5 +298,100 @@ HWTEST_F(AccessibilityDumperUnitTest, AccessibilityDumper_Unittest_Dump_009, Tes
     }
     GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_009 end";
 }
+
+/**
+ * @tc.number: AccessibilityDumper_Unittest_Dump_010
+ * @tc.name: Dump
+ * @tc.desc: Test function Dump with the statistics option after resource cache hits and misses.
+ */
+HWTEST_F(AccessibilityDumperUnitTest, AccessibilityDumper_Unittest_Dump_010, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_010 start";
+    AccessibilityResourceBundleManager &resourceBundleManager =
+        Singleton<AccessibilityResourceBundleManager>::GetInstance();
+    resourceBundleManager.ClearResourceCache();
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    resourceBundleManager.GetResourceCacheStats(hitCount, missCount);
+
+    std::string value;
+    EXPECT_FALSE(resourceBundleManager.GetCachedResourceString("100/com.example/entry/1/zh-Hans", value));
+    resourceBundleManager.CacheResourceString("100/com.example/entry/1/zh-Hans", "test");
+    EXPECT_TRUE(resourceBundleManager.GetCachedResourceString("100/com.example/entry/1/zh-Hans", value));
+    EXPECT_EQ(value, "test");
+    resourceBundleManager.ClearResourceCache("com.example", 100);
+    EXPECT_FALSE(resourceBundleManager.GetCachedResourceString("100/com.example/entry/1/zh-Hans", value));
+
+    uint64_t newHitCount = 0;
+    uint64_t newMissCount = 0;
+    resourceBundleManager.GetResourceCacheStats(newHitCount, newMissCount);
+    EXPECT_EQ(newHitCount, hitCount + 1);
+    EXPECT_EQ(newMissCount, missCount + 2);
+
+    std::string cmdStatistics("-s");
+    std::vector<std::u16string> args;
+    args.emplace_back(Str8ToStr16(cmdStatistics));
+    int ret = dumper_->Dump(fd_, args);
+    EXPECT_EQ(0, ret);
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_010 end";
+}
+
+/**
+ * @tc.number: AccessibilityDumper_Unittest_Dump_011
+ * @tc.name: Dump
+ * @tc.desc: Test function Dump with the statistics option after an event is dispatched.
+ */
+HWTEST_F(AccessibilityDumperUnitTest, AccessibilityDumper_Unittest_Dump_011, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_011 start";
+    AccessibilityEventDispatcher &dispatcher = Singleton<AccessibilityEventDispatcher>::GetInstance();
+    EXPECT_TRUE(dispatcher.Init());
+
+    ffrt::promise<void> promise;
+    ffrt::future<void> future = promise.get_future();
+    EXPECT_EQ(dispatcher.Dispatch(1, TYPE_VIEW_CLICKED_EVENT, [&promise]() { promise.set_value(); }), RET_OK);
+    EXPECT_EQ(future.wait_for(std::chrono::milliseconds(1000)), ffrt::future_status::ready);
+    EXPECT_GE(dispatcher.GetDispatchStats().dispatchedCount, 1U);
+
+    std::string cmdStatistics("-s");
+    std::vector<std::u16string> args;
+    args.emplace_back(Str8ToStr16(cmdStatistics));
+    int ret = dumper_->Dump(fd_, args);
+    EXPECT_EQ(0, ret);
+    dispatcher.Clear();
+    EXPECT_EQ(dispatcher.Dispatch(1, TYPE_VIEW_CLICKED_EVENT, []() {}), RET_ERR_NULLPTR);
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_011 end";
+}
+
+/**
+ * @tc.number: AccessibilityDumper_Unittest_Dump_012
+ * @tc.name: Dump
+ * @tc.desc: Test function Dump with the window option after the window answers and times out.
+ */
+HWTEST_F(AccessibilityDumperUnitTest, AccessibilityDumper_Unittest_Dump_012, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_012 start";
+    const int32_t accountId = 1;
+    const int32_t windowId = 1;
+    sptr<AccessibilityAccountData> currentAccount
+        = Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
+    ASSERT_TRUE(currentAccount);
+    sptr<AccessibilityWindowConnection> operationConnection = new AccessibilityWindowConnection(windowId, accountId);
+    currentAccount->AddAccessibilityWindowConnection(windowId, operationConnection);
+    operationConnection->GetIpcHealth().RecordLatency(1);
+    operationConnection->GetIpcHealth().RecordTimeout();
+    AccessibilityIpcHealth::Stats stats = operationConnection->GetIpcHealth().GetStats();
+    EXPECT_EQ(stats.answeredCount, 1);
+    EXPECT_EQ(stats.timeoutCount, 1);
+    EXPECT_EQ(stats.state, AccessibilityIpcHealth::BreakerState::CLOSED);
+
+    std::string cmdWindow("-w");
+    std::vector<std::u16string> args;
+    args.emplace_back(Str8ToStr16(cmdWindow));
+    int ret = dumper_->Dump(fd_, args);
+    EXPECT_EQ(0, ret);
+    currentAccount->RemoveAccessibilityWindowConnection(windowId);
+    GTEST_LOG_(INFO) << "AccessibilityDumper_Unittest_Dump_012 end";
+}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <thread>
+#include <vector>
+#include "accessibility_event_dispatcher.h"
+#include "ffrt.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int32_t WINDOW_ID_1 = 1;
+    constexpr int32_t WINDOW_ID_2 = 2;
+    constexpr int32_t WINDOW_ID_3 = 3;
+    constexpr int32_t EVENT_COUNT = 100;
+    constexpr size_t MAX_WINDOW_QUEUE_SIZE = 64;
+    constexpr size_t MAX_WINDOW_QUEUE_HARD_LIMIT = 256;
+    constexpr size_t MAX_QUEUE_HARD_LIMIT = 1024;
+    constexpr int32_t WAIT_TIME = 1000; // ms
+    constexpr int32_t RETRY_INTERVAL = 10; // ms
+} // namespace
+
+class AccessibilityEventDispatcherUnitTest : public ::testing::Test {
+public:
+    AccessibilityEventDispatcherUnitTest()
+    {}
+    ~AccessibilityEventDispatcherUnitTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+
+    // block the runner until the release promise is set, the following events stay queued.
+    void BlockRunner(ffrt::promise<void> &release);
+    // wait until every event queued before is sent.
+    bool WaitForIdle();
+};
+
+void AccessibilityEventDispatcherUnitTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityEventDispatcherUnitTest Start ######################";
+}
+
+void AccessibilityEventDispatcherUnitTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityEventDispatcherUnitTest End ######################";
+}
+
+void AccessibilityEventDispatcherUnitTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    ASSERT_TRUE(Singleton<AccessibilityEventDispatcher>::GetInstance().Init());
+}
+
+void AccessibilityEventDispatcherUnitTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+    Singleton<AccessibilityEventDispatcher>::GetInstance().Clear();
+}
+
+void AccessibilityEventDispatcherUnitTest::BlockRunner(ffrt::promise<void> &release)
+{
+    std::shared_ptr<ffrt::future<void>> blocker = std::make_shared<ffrt::future<void>>(release.get_future());
+    std::shared_ptr<ffrt::promise<void>> started = std::make_shared<ffrt::promise<void>>();
+    ffrt::future<void> startedFuture = started->get_future();
+    EXPECT_EQ(Singleton<AccessibilityEventDispatcher>::GetInstance().Dispatch(WINDOW_ID_1, TYPE_VIEW_CLICKED_EVENT,
+        [blocker, started]() {
+            started->set_value();
+            blocker->wait();
+        }), RET_OK);
+    // the blocking task has left the queue once it runs
+    EXPECT_EQ(startedFuture.wait_for(std::chrono::milliseconds(WAIT_TIME)), ffrt::future_status::ready);
+}
+
+bool AccessibilityEventDispatcherUnitTest::WaitForIdle()
+{
+    AccessibilityEventDispatcher &dispatcher = Singleton<AccessibilityEventDispatcher>::GetInstance();
+    // queueing the marker on a full queue would drop an event, let the runner catch up first
+    int32_t waitTime = 0;
+    while (dispatcher.GetDispatchStats().depth > 0) {
+        if (waitTime >= WAIT_TIME) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(RETRY_INTERVAL));
+        waitTime += RETRY_INTERVAL;
+    }
+    // the marker runs after the task which was running when the queue became empty
+    ffrt::promise<void> promise;
+    ffrt::future<void> future = promise.get_future();
+    if (dispatcher.Dispatch(WINDOW_ID_2, TYPE_VIEW_CLICKED_EVENT, [&promise]() { promise.set_value(); }) != RET_OK) {
+        return false;
+    }
+    return future.wait_for(std::chrono::milliseconds(WAIT_TIME)) == ffrt::future_status::ready;
+}
+
+/**
+ * @tc.number: AccessibilityEventDispatcher_Unittest_Dispatch_001
+ * @tc.name: Dispatch
+ * @tc.desc: Test the events of each window are sent in the order they are dispatched.
+ */
+HWTEST_F(AccessibilityEventDispatcherUnitTest, AccessibilityEventDispatcher_Unittest_Dispatch_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityEventDispatcher_Unittest_Dispatch_001 start";
+    AccessibilityEventDispatcher &dispatcher = Singleton<AccessibilityEventDispatcher>::GetInstance();
+    uint64_t droppedCount = dispatcher.GetDispatchStats().droppedCount;
+    std::map<int32_t, std::vector<int32_t>> sent;
+    std::map<int32_t, std::vector<int32_t>> expected;
+    for (int32_t index = 0; index < EVENT_COUNT; index++) {
+        int32_t windowId = (index % 2 == 0) ? WINDOW_ID_1 : WINDOW_ID_2;
+        EventType eventType = (index % 3 == 0) ? TYPE_VIEW_SCROLLED_EVENT : TYPE_VIEW_CLICKED_EVENT;
+        EXPECT_EQ(dispatcher.Dispatch(windowId, eventType,
+            [&sent, windowId, index]() { sent[windowId].push_back(index); }), RET_OK);
+        expected[windowId].push_back(index);
+    }
+    EXPECT_TRUE(WaitForIdle());
+    EXPECT_EQ(sent, expected);
+    AccessibilityEventDispatcher::DispatchStats stats = dispatcher.GetDispatchStats();
+    EXPECT_EQ(droppedCount, stats.droppedCount);
+    EXPECT_EQ(0U, stats.depth);
+    GTEST_LOG_(INFO) << "AccessibilityEventDispatcher_Unittest_Dispatch_001 end";
+}
+
+/**
+ * @tc.number: AccessibilityEventDispatcher_Unittest_Dispatch_002
+ * @tc.name: Dispatch
+ * @tc.desc: Test a full window drops its own oldest droppable event and the other windows keep theirs.
+ */
+HWTEST_F(AccessibilityEventDispatcherUnitTest, AccessibilityEventDispatcher_Unittest_Dispatch_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityEventDispatcher_Unittest_Dispatch_002 start";
+    AccessibilityEventDispatcher &dispatcher = Singleton<AccessibilityEventDispatcher>::GetInstance();
+    uint64_t droppedCount = dispatcher.GetDispatchStats().droppedCount;
+    uint64_t rejectedCount = dispatcher.GetDispatchStats().rejectedCount;
+    ffrt::promise<void> release;
+    BlockRunner(release);
+
+    std::vector<int32_t> sent;
+    // window 2 queues one scroll event, window 1 floods one event more than its queue holds
+    EXPECT_EQ(dispatcher.Dispatch(WINDOW_ID_2, TYPE_VIEW_SCROLLED_EVENT, [&sent]() { sent.push_back(-1); }), RET_OK);
+    int32_t floodCount = static_cast<int32_t>(MAX_WINDOW_QUEUE_SIZE) + 1;
+    for (int32_t index = 0; index < floodCount; index++) {
+        EXPECT_EQ(dispatcher.Dispatch(WINDOW_ID_1, TYPE_VIEW_SCROLLED_EVENT,
+            [&sent, index]() { sent.push_back(index); }), RET_OK);
+    }
+    AccessibilityEventDispatcher::DispatchStats stats = dispatcher.GetDispatchStats();
+    EXPECT_EQ(MAX_WINDOW_QUEUE_SIZE + 1, stats.depth);
+    EXPECT_EQ(droppedCount + 1, stats.droppedCount);
+    EXPECT_EQ(rejectedCount, stats.rejectedCount);
+    std::map<int32_t, AccessibilityEventDispatcher::DispatchStats> windowStats = dispatcher.GetWindowDispatchStats();
+    EXPECT_EQ(MAX_WINDOW_QUEUE_SIZE, windowStats[WINDOW_ID_1].depth);
+    EXPECT_EQ(1U, windowStats[WINDOW_ID_1].droppedCount);
+    EXPECT_EQ(1U, windowStats[WINDOW_ID_2].depth);
+    EXPECT_EQ(0U, windowStats[WINDOW_ID_2].droppedCount);
+    release.set_value();
+    EXPECT_TRUE(WaitForIdle());
+
+    // the event of window 2 survives, the oldest flood event is dropped
+    ASSERT_EQ(sent.size(), MAX_WINDOW_QUEUE_SIZE + 1);
+    EXPECT_EQ(-1, sent.front());
+    EXPECT_EQ(1, sent[1]);
+    EXPECT_EQ(floodCount - 1, sent.back());
+    GTEST_LOG_(INFO) << "AccessibilityEventDispatcher_Unittest_Dispatch_002 end";
+}
+
+/**
+ * @tc.number: AccessibilityEventDispatcher_Unittest_Dispatch_003
+ * @tc.name: Dispatch
+ * @tc.desc: Test events which may not be dropped are kept until the hard limit of the window and of all windows
+ *           and rejected above it.
+ */
+HWTEST_F(AccessibilityEventDispatcherUnitTest, AccessibilityEventDispatcher_Unittest_Dispatch_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityEventDispatcher_Unittest_Dispatch_003 start";
+    AccessibilityEventDispatcher &dispatcher = Singleton<AccessibilityEventDispatcher>::GetInstance();
+    uint64_t droppedCount = dispatcher.GetDispatchStats().droppedCount;
+    uint64_t rejectedCount = dispatcher.GetDispatchStats().rejectedCount;
+    ffrt::promise<void> release;
+    BlockRunner(release);
+
+    size_t sentCount = 0;
+    for (size_t index = 0; index < MAX_WINDOW_QUEUE_HARD_LIMIT; index++) {
+        EXPECT_EQ(dispatcher.Dispatch(WINDOW_ID_1, TYPE_VIEW_CLICKED_EVENT, [&sentCount]() { sentCount++; }),
+            RET_OK);
+    }
+    // the window is full of events which may not be dropped, a droppable one is dropped
+    EXPECT_EQ(dispatcher.Dispatch(WINDOW_ID_1, TYPE_VIEW_SCROLLED_EVENT, []() {}), RET_ERR_FAILED);
+    EXPECT_EQ(dispatcher.Dispatch(WINDOW_ID_1, TYPE_VIEW_CLICKED_EVENT, []() {}), RET_ERR_FAILED);
+    // the other windows fill the rest of all queues
+    int32_t windowId = WINDOW_ID_1;
+    for (size_t index = MAX_WINDOW_QUEUE_HARD_LIMIT; index < MAX_QUEUE_HARD_LIMIT; index++) {
+        if (index % MAX_WINDOW_QUEUE_HARD_LIMIT == 0) {
+            windowId++;
+        }
+        EXPECT_EQ(dispatcher.Dispatch(windowId, TYPE_VIEW_CLICKED_EVENT, [&sentCount]() { sentCount++; }), RET_OK);
+    }
+    EXPECT_EQ(dispatcher.Dispatch(windowId + 1, TYPE_VIEW_CLICKED_EVENT, []() {}), RET_ERR_FAILED);
+    AccessibilityEventDispatcher::DispatchStats stats = dispatcher.GetDispatchStats();
+    EXPECT_EQ(droppedCount + 1, stats.droppedCount);
+    EXPECT_EQ(rejectedCount + 2, stats.rejectedCount);
+    EXPECT_EQ(1U, dispatcher.GetWindowDispatchStats()[windowId + 1].rejectedCount);
+    release.set_value();
+    EXPECT_TRUE(WaitForIdle());
+    EXPECT_EQ(MAX_QUEUE_HARD_LIMIT, sentCount);
+    GTEST_LOG_(INFO) << "AccessibilityEventDispatcher_Unittest_Dispatch_003 end";
+}
+
+/**
+ * @tc.number: AccessibilityEventDispatcher_Unittest_Dispatch_004
+ * @tc.name: Dispatch
+ * @tc.desc: Test the windows take turns, an event queued behind a flooding window is sent after one of its events.
+ */
+HWTEST_F(AccessibilityEventDispatcherUnitTest, AccessibilityEventDispatcher_Unittest_Dispatch_004, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityEventDispatcher_Unittest_Dispatch_004 start";
+    AccessibilityEventDispatcher &dispatcher = Singleton<AccessibilityEventDispatcher>::GetInstance();
+    ffrt::promise<void> release;
+    BlockRunner(release);
+
+    std::vector<int32_t> sent;
+    for (size_t index = 0; index < MAX_WINDOW_QUEUE_SIZE; index++) {
+        EXPECT_EQ(dispatcher.Dispatch(WINDOW_ID_1, TYPE_VIEW_CLICKED_EVENT,
+            [&sent]() { sent.push_back(WINDOW_ID_1); }), RET_OK);
+    }
+    EXPECT_EQ(dispatcher.Dispatch(WINDOW_ID_2, TYPE_VIEW_CLICKED_EVENT,
+        [&sent]() { sent.push_back(WINDOW_ID_2); }), RET_OK);
+    EXPECT_EQ(dispatcher.Dispatch(WINDOW_ID_3, TYPE_VIEW_CLICKED_EVENT,
+        [&sent]() { sent.push_back(WINDOW_ID_3); }), RET_OK);
+    release.set_value();
+    EXPECT_TRUE(WaitForIdle());
+
+    ASSERT_EQ(MAX_WINDOW_QUEUE_SIZE + 2, sent.size());
+    EXPECT_EQ(WINDOW_ID_1, sent[0]);
+    EXPECT_EQ(WINDOW_ID_2, sent[1]);
+    EXPECT_EQ(WINDOW_ID_3, sent[2]);
+    std::map<int32_t, AccessibilityEventDispatcher::DispatchStats> windowStats = dispatcher.GetWindowDispatchStats();
+    EXPECT_GE(windowStats[WINDOW_ID_1].dispatchedCount, MAX_WINDOW_QUEUE_SIZE);
+    EXPECT_EQ(MAX_WINDOW_QUEUE_SIZE, windowStats[WINDOW_ID_1].peakDepth);
+    EXPECT_EQ(0U, windowStats[WINDOW_ID_1].depth);
+    GTEST_LOG_(INFO) << "AccessibilityEventDispatcher_Unittest_Dispatch_004 end";
+}
+
+/**
+ * @tc.number: AccessibilityEventDispatcher_Unittest_Clear_001
+ * @tc.name: Clear
+ * @tc.desc: Test dispatching fails after the dispatcher is cleared and works again after it is initialized.
+ */
+HWTEST_F(AccessibilityEventDispatcherUnitTest, AccessibilityEventDispatcher_Unittest_Clear_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityEventDispatcher_Unittest_Clear_001 start";
+    AccessibilityEventDispatcher &dispatcher = Singleton<AccessibilityEventDispatcher>::GetInstance();
+    dispatcher.Clear();
+    EXPECT_EQ(dispatcher.Dispatch(WINDOW_ID_1, TYPE_VIEW_CLICKED_EVENT, []() {}), RET_ERR_NULLPTR);
+    EXPECT_EQ(0U, dispatcher.GetDispatchStats().depth);
+
+    EXPECT_TRUE(dispatcher.Init());
+    EXPECT_TRUE(WaitForIdle());
+    GTEST_LOG_(INFO) << "AccessibilityEventDispatcher_Unittest_Clear_001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -13,13 +13,23 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
 #include <gtest/gtest.h>
+#include <set>
+#include <sstream>
+#include <thread>
 #include "event_handler.h"
 #include "accessibility_account_data.h"
 #include "accessibility_common_helper.h"
 #include "accessibility_element_operator_proxy.h"
 #include "accessibility_ut_helper.h"
 #include "accessibility_window_manager.h"
+#define private public
+#include "accessible_ability_channel.h"
+#undef private
 #include "accessible_ability_manager_service.h"
 #include "iservice_registry.h"
 #include "mock_accessible_ability_manager_service.h"
@@ -43,6 +53,9 @@ namespace {
     constexpr int32_t INNER_WINDOW_ID = 4;
     constexpr int64_t INNER_ELEMENT_ID = 5;
     constexpr int64_t INVALID_ELEMENT_ID = -1;
+    constexpr int64_t WINDOW_UPDATE_FRAME_TIME = 16; // ms, the updates received within it are applied together
+    // the recorded window updates of hidumper -w copied to the device, the replay is skipped without it
+    const std::string RECORDED_WINDOW_UPDATES_PATH = "/data/test/accessibility_window_updates.txt";
 } // namespace
 
 class AccessibilityWindowManagerTest : public testing::Test {
@@ -101,6 +114,60 @@ sptr<Rosen::AccessibilityWindowInfo> GetRosenWindowInfo(Rosen::WindowType window
     return rosen_winInfo;
 }
 
+bool ParseRecordedWindowUpdate(const std::string &line, int64_t &receivedTime,
+    AccessibilityWindowManager::RosenWindowUpdate &update)
+{
+    std::istringstream iss(line);
+    int32_t type = 0;
+    size_t count = 0;
+    if (!(iss >> receivedTime >> type >> count) || count == 0) {
+        return false;
+    }
+    update.type = static_cast<Rosen::WindowUpdateType>(type);
+    for (size_t i = 0; i < count; i++) {
+        sptr<Rosen::AccessibilityWindowInfo> info = new(std::nothrow) Rosen::AccessibilityWindowInfo();
+        if (info == nullptr) {
+            return false;
+        }
+        uint32_t windowType = 0;
+        uint32_t mode = 0;
+        if (!(iss >> info->wid_ >> info->innerWid_ >> info->displayId_ >> windowType >> info->focused_ >>
+            info->layer_ >> info->windowRect_.posX_ >> info->windowRect_.posY_ >> info->windowRect_.width_ >>
+            info->windowRect_.height_ >> mode >> info->uiNodeId_ >> info->bundleName_)) {
+            return false;
+        }
+        info->type_ = static_cast<Rosen::WindowType>(windowType);
+        info->mode_ = static_cast<Rosen::WindowMode>(mode);
+        if (info->bundleName_ == "-") {
+            info->bundleName_.clear();
+        }
+        update.infos.push_back(info);
+    }
+    return true;
+}
+
+// the updates received within WINDOW_UPDATE_FRAME_TIME of the first one of a frame are applied together
+std::vector<std::vector<AccessibilityWindowManager::RosenWindowUpdate>> ReadRecordedFrames(const std::string &path)
+{
+    std::vector<std::vector<AccessibilityWindowManager::RosenWindowUpdate>> frames;
+    std::ifstream file(path);
+    std::string line;
+    int64_t frameTime = 0;
+    while (std::getline(file, line)) {
+        int64_t receivedTime = 0;
+        AccessibilityWindowManager::RosenWindowUpdate update;
+        if (!ParseRecordedWindowUpdate(line, receivedTime, update)) {
+            continue;
+        }
+        if (frames.empty() || receivedTime - frameTime > WINDOW_UPDATE_FRAME_TIME) {
+            frames.emplace_back();
+            frameTime = receivedTime;
+        }
+        frames.back().push_back(update);
+    }
+    return frames;
+}
+
 void AccessibilityWindowManagerTest::AddActiveWindow(AccessibilityWindowManager &windowInfoManager,
     sptr<Rosen::AccessibilityWindowInfo> rosenWinInfoFirst)
 {
@@ -211,6 +278,146 @@ HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_Con
     GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_ConvertToRealWindowId004 end";
 }
 
+/**
+ * @tc.number: AccessibilityWindowManager_Unittest_ConvertToRealWindowId005
+ * @tc.name: ConvertToRealWindowId
+ * @tc.desc: Convert the ids of 100 sub windows from several threads while sub windows are added and removed,
+ *           the throughput is compared with the locked linear search over a set
+ */
+HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_ConvertToRealWindowId005, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_ConvertToRealWindowId005 start";
+    constexpr int32_t subWindowCount = 100;
+    constexpr int32_t firstWindowId = 1000;
+    constexpr int32_t churnWindowId = 5000;
+    constexpr int32_t threadCount = 4;
+    constexpr int32_t lookupCount = 100000;
+    AccessibilityWindowManager& mgr = Singleton<AccessibilityWindowManager>::GetInstance();
+    mgr.DeInit();
+    std::set<std::pair<int32_t, uint64_t>> subWindows;
+    for (int32_t i = 0; i < subWindowCount; i++) {
+        mgr.windowIndex_.InsertSubWindow(firstWindowId + i, static_cast<uint64_t>(i));
+        subWindows.insert({firstWindowId + i, static_cast<uint64_t>(i)});
+    }
+
+    std::atomic<bool> stop = false;
+    std::thread writer([&mgr, &stop]() {
+        for (int32_t i = 0; !stop.load(); i++) {
+            mgr.windowIndex_.InsertSubWindow(churnWindowId + i % subWindowCount, 0);
+            mgr.windowIndex_.RemoveWindow(churnWindowId + i % subWindowCount);
+        }
+    });
+    std::atomic<int32_t> mismatchCount = 0;
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> readers;
+    for (int32_t t = 0; t < threadCount; t++) {
+        readers.emplace_back([&mgr, &mismatchCount]() {
+            for (int32_t i = 0; i < lookupCount; i++) {
+                int32_t offset = i % subWindowCount;
+                auto [realId, displayId] = mgr.ConvertToRealWindowId(firstWindowId + offset, FOCUS_TYPE_INVALID);
+                if (realId != SCENE_BOARD_WINDOW_ID || displayId != static_cast<uint64_t>(offset)) {
+                    mismatchCount++;
+                }
+            }
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    auto indexTime = std::chrono::steady_clock::now() - begin;
+    stop = true;
+    writer.join();
+
+    ffrt::mutex setMutex;
+    begin = std::chrono::steady_clock::now();
+    readers.clear();
+    for (int32_t t = 0; t < threadCount; t++) {
+        readers.emplace_back([&subWindows, &setMutex, &mismatchCount]() {
+            for (int32_t i = 0; i < lookupCount; i++) {
+                int32_t windowId = firstWindowId + i % subWindowCount;
+                std::lock_guard<ffrt::mutex> lock(setMutex);
+                auto iter = std::find_if(subWindows.begin(), subWindows.end(),
+                    [windowId](const auto &window) { return window.first == windowId; });
+                if (iter == subWindows.end()) {
+                    mismatchCount++;
+                }
+            }
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    auto setTime = std::chrono::steady_clock::now() - begin;
+
+    EXPECT_EQ(mismatchCount.load(), 0);
+    EXPECT_EQ(mgr.ConvertToRealWindowId(churnWindowId, FOCUS_TYPE_INVALID).first, churnWindowId);
+    int64_t totalCount = static_cast<int64_t>(threadCount) * lookupCount;
+    GTEST_LOG_(INFO) << totalCount << " conversions with " << subWindowCount << " sub windows, index: " <<
+        std::chrono::duration_cast<std::chrono::microseconds>(indexTime).count() << "us, locked set: " <<
+        std::chrono::duration_cast<std::chrono::microseconds>(setTime).count() << "us";
+    mgr.DeInit();
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_ConvertToRealWindowId005 end";
+}
+
+/**
+ * @tc.number: AccessibilityWindowManager_Unittest_WindowIndex001
+ * @tc.name: InsertTreeIdWindowIdPair
+ * @tc.desc: Every tree id up to the largest one and more sub windows than the initial capacity are kept,
+ *           then sub windows are added and removed while three quarters of the initial capacity are taken
+ */
+HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_WindowIndex001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_WindowIndex001 start";
+    constexpr int32_t maxTreeId = 0x1FFF;
+    constexpr int32_t firstWindowId = 1000;
+    constexpr int32_t subWindowCount = 2000;
+    constexpr int32_t liveWindowCount = 400;
+    constexpr int32_t churnCount = 100000;
+    AccessibilityWindowManager& mgr = Singleton<AccessibilityWindowManager>::GetInstance();
+    mgr.DeInit();
+    for (int32_t treeId = 1; treeId <= maxTreeId; treeId++) {
+        mgr.InsertTreeIdWindowIdPair(treeId, firstWindowId + treeId);
+    }
+    int32_t mismatchCount = 0;
+    for (int32_t treeId = 1; treeId <= maxTreeId; treeId++) {
+        mismatchCount += mgr.FindTreeIdWindowIdPair(treeId) != firstWindowId + treeId ? 1 : 0;
+    }
+    EXPECT_EQ(mismatchCount, 0);
+    for (int32_t treeId = 1; treeId <= maxTreeId; treeId++) {
+        mgr.RemoveTreeIdWindowIdPair(treeId);
+    }
+    EXPECT_EQ(mgr.FindTreeIdWindowIdPair(maxTreeId), 0);
+
+    for (int32_t i = 0; i < subWindowCount; i++) {
+        mgr.windowIndex_.InsertSubWindow(firstWindowId + i, static_cast<uint64_t>(i));
+    }
+    for (int32_t i = 0; i < subWindowCount; i++) {
+        uint64_t displayId = 0;
+        mismatchCount += mgr.windowIndex_.FindSubWindow(firstWindowId + i, displayId) &&
+            displayId == static_cast<uint64_t>(i) ? 0 : 1;
+    }
+    EXPECT_EQ(mismatchCount, 0);
+
+    mgr.windowIndex_.ClearSubWindows();
+    for (int32_t i = 0; i < liveWindowCount; i++) {
+        mgr.windowIndex_.InsertSubWindow(firstWindowId + i, 0);
+    }
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < churnCount; i++) {
+        int32_t windowId = firstWindowId + liveWindowCount + i;
+        mgr.windowIndex_.InsertSubWindow(windowId, 0);
+        mgr.windowIndex_.RemoveWindow(windowId);
+    }
+    auto churnTime = std::chrono::steady_clock::now() - begin;
+    EXPECT_TRUE(mgr.windowIndex_.IsSubWindow(firstWindowId));
+    EXPECT_TRUE(mgr.windowIndex_.IsSubWindow(firstWindowId + liveWindowCount - 1));
+    EXPECT_FALSE(mgr.windowIndex_.IsSubWindow(firstWindowId + liveWindowCount));
+    GTEST_LOG_(INFO) << churnCount << " sub window insertions and removals with " << liveWindowCount <<
+        " sub windows: " << std::chrono::duration_cast<std::chrono::microseconds>(churnTime).count() << "us";
+    mgr.DeInit();
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_WindowIndex001 end";
+}
+
 /**
  * @tc.number: AccessibilityWindowManager_Unittest_CreateAccessibilityWindowInfo001
  * @tc.name: CreateAccessibilityWindowInfo
@@ -1359,6 +1566,7 @@ HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_IsV
     EXPECT_EQ(0, (int)mgr.a11yWindows_.size());
     mgr.a11yWindows_.insert(std::make_pair(windowId, info));
     EXPECT_EQ(1, (int)mgr.a11yWindows_.size());
+    mgr.PublishWindowSnapshot();
 
     /* IsValidWindow */
     bool window = mgr.IsValidWindow(windowId);
@@ -1392,6 +1600,7 @@ HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_IsV
     EXPECT_EQ(0, (int)mgr.a11yWindows_.size());
     mgr.a11yWindows_.insert(std::make_pair(windowId, info));
     EXPECT_EQ(1, (int)mgr.a11yWindows_.size());
+    mgr.PublishWindowSnapshot();
 
     /* IsValidWindow */
     bool window = mgr.IsValidWindow(0);
@@ -1648,13 +1857,13 @@ HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_IsI
     int32_t windowId = INNER_WINDOW_ID;
     int64_t elementId = INVALID_ELEMENT_ID;
     AccessibilityWindowManager& mgr = Singleton<AccessibilityWindowManager>::GetInstance();
-    mgr.sceneBoardElementIdMap_.Clear();
+    mgr.windowIndex_.ClearSceneBoardElementIds();
 
     EXPECT_FALSE(mgr.IsInnerWindowRootElement(elementId));
-    mgr.sceneBoardElementIdMap_.InsertPair(windowId, elementId);
+    mgr.windowIndex_.InsertSceneBoardElementId(windowId, elementId);
 
     EXPECT_TRUE(mgr.IsInnerWindowRootElement(elementId));
-    mgr.sceneBoardElementIdMap_.Clear();
+    mgr.windowIndex_.ClearSceneBoardElementIds();
     GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_IsInnerWindowRootElement001 end";
 }
 
@@ -1669,7 +1878,7 @@ HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_Get
     int32_t windowId = ANY_WINDOW_ID;
     int32_t elementId = INVALID_ELEMENT_ID;
     AccessibilityWindowManager& mgr = Singleton<AccessibilityWindowManager>::GetInstance();
-    mgr.subWindows_.clear();
+    mgr.windowIndex_.ClearSubWindows();
     int32_t sceneBoardElementId = mgr.GetSceneBoardElementId(windowId, elementId);
     ASSERT_TRUE(sceneBoardElementId == elementId);
     GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_GetSceneBoardElementId001 end";
@@ -1686,7 +1895,7 @@ HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_Get
     int32_t windowId = ANY_WINDOW_ID;
     int32_t elementId = INVALID_SCENE_BOARD_ELEMENT_ID;
     AccessibilityWindowManager& mgr = Singleton<AccessibilityWindowManager>::GetInstance();
-    mgr.subWindows_.clear();
+    mgr.windowIndex_.ClearSubWindows();
     int32_t sceneBoardElementId = mgr.GetSceneBoardElementId(windowId, elementId);
     ASSERT_TRUE(sceneBoardElementId == elementId);
     GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_GetSceneBoardElementId002 end";
@@ -1711,5 +1920,434 @@ HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_OnW
     windowInfoManager.a11yWindows_.clear();
     GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_OnWindowUpdate001 end";
 }
+
+/**
+ * @tc.number: AccessibilityWindowManager_Unittest_GetWindowSnapshot001
+ * @tc.name: GetWindowSnapshot
+ * @tc.desc: Test a held snapshot is not changed by later updates and the generation tells them apart
+ */
+HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_GetWindowSnapshot001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_GetWindowSnapshot001 start";
+    int32_t windowId = ANY_WINDOW_ID;
+    AccessibilityWindowManager& mgr = Singleton<AccessibilityWindowManager>::GetInstance();
+    mgr.DeInit();
+    EXPECT_TRUE(mgr.GetWindowSnapshot() == nullptr);
+
+    sptr<Rosen::AccessibilityWindowInfo> rosen_winInfo = GetRosenWindowInfo(Rosen::WindowType::APP_WINDOW_BASE);
+    ASSERT_TRUE(rosen_winInfo != nullptr);
+    mgr.a11yWindows_.insert(std::make_pair(windowId, mgr.CreateAccessibilityWindowInfo(rosen_winInfo)));
+    mgr.PublishWindowSnapshot();
+    std::shared_ptr<const AccessibilityWindowManager::WindowSnapshot> first = mgr.GetWindowSnapshot();
+    ASSERT_TRUE(first != nullptr);
+    EXPECT_TRUE(mgr.IsValidWindow(windowId));
+    EXPECT_EQ(first->generation, mgr.GetWindowSnapshot()->generation);
+
+    Rect rect(0, 0, 100, 200);
+    mgr.SetWindowSize(windowId, rect);
+    std::shared_ptr<const AccessibilityWindowManager::WindowSnapshot> second = mgr.GetWindowSnapshot();
+    ASSERT_TRUE(second != nullptr);
+    EXPECT_GT(second->generation, first->generation);
+    EXPECT_NE(first->windows.at(windowId).GetRectInScreen().GetRightBottomXScreenPostion(), 100);
+    EXPECT_EQ(second->windows.at(windowId).GetRectInScreen().GetRightBottomXScreenPostion(), 100);
+
+    std::vector<AccessibilityWindowInfo> windows = mgr.GetAccessibilityWindows();
+    ASSERT_EQ(1, (int)windows.size());
+    EXPECT_EQ(windows[0].GetRectInScreen().GetRightBottomYScreenPostion(), 200);
+    mgr.DeInit();
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_GetWindowSnapshot001 end";
+}
+
+/**
+ * @tc.number: AccessibilityWindowManager_Unittest_ApplyWindowUpdates001
+ * @tc.name: ApplyWindowUpdates
+ * @tc.desc: Replay the updates wms sends for an app launch one by one and as one frame, the windows
+ *           end the same while the frame sends fewer events
+ */
+HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_ApplyWindowUpdates001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_ApplyWindowUpdates001 start";
+    constexpr int32_t appWindowId = 10;
+    constexpr int32_t splashWindowId = 11;
+    constexpr int32_t animationFrames = 30;
+    constexpr int32_t replayTimes = 20;
+    auto makeWindow = [](int32_t windowId, uint32_t size, bool focused) {
+        sptr<Rosen::AccessibilityWindowInfo> info = GetRosenWindowInfo(Rosen::WindowType::APP_WINDOW_BASE);
+        info->wid_ = windowId;
+        info->innerWid_ = windowId;
+        info->windowRect_.width_ = size;
+        info->windowRect_.height_ = size * 2;
+        info->focused_ = focused;
+        info->bundleName_ = "launch_replay";
+        return info;
+    };
+    std::vector<AccessibilityWindowManager::RosenWindowUpdate> updates;
+    updates.push_back({{makeWindow(splashWindowId, 1, false)}, Rosen::WindowUpdateType::WINDOW_UPDATE_ADDED});
+    updates.push_back({{makeWindow(appWindowId, 1, false)}, Rosen::WindowUpdateType::WINDOW_UPDATE_ADDED});
+    for (int32_t frame = 1; frame <= animationFrames; frame++) {
+        updates.push_back({{makeWindow(appWindowId, frame * 10, false)},
+            Rosen::WindowUpdateType::WINDOW_UPDATE_BOUNDS});
+        if (frame % 10 == 0) {
+            auto info = makeWindow(appWindowId, frame * 10, false);
+            info->scaleVal_ = static_cast<float>(frame);
+            updates.push_back({{info}, Rosen::WindowUpdateType::WINDOW_UPDATE_PROPERTY});
+        }
+    }
+    updates.push_back({{makeWindow(splashWindowId, 1, false)}, Rosen::WindowUpdateType::WINDOW_UPDATE_REMOVED});
+    updates.push_back({{makeWindow(appWindowId, animationFrames * 10, true)},
+        Rosen::WindowUpdateType::WINDOW_UPDATE_FOCUSED});
+
+    AccessibilityWindowManager& mgr = Singleton<AccessibilityWindowManager>::GetInstance();
+    int separateEvents = 0;
+    auto begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < replayTimes; i++) {
+        mgr.DeInit();
+        AccessibilityAbilityHelper::GetInstance().ClearSendEventTimes();
+        for (auto &update : updates) {
+            mgr.ApplyWindowUpdates({update});
+        }
+        separateEvents = AccessibilityAbilityHelper::GetInstance().GetSendEventTimes();
+    }
+    auto separateTime = std::chrono::steady_clock::now() - begin;
+    EXPECT_EQ(1, (int)mgr.a11yWindows_.size());
+
+    int frameEvents = 0;
+    begin = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < replayTimes; i++) {
+        mgr.DeInit();
+        AccessibilityAbilityHelper::GetInstance().ClearSendEventTimes();
+        mgr.ApplyWindowUpdates(updates);
+        frameEvents = AccessibilityAbilityHelper::GetInstance().GetSendEventTimes();
+    }
+    auto frameTime = std::chrono::steady_clock::now() - begin;
+
+    ASSERT_EQ(1, (int)mgr.a11yWindows_.size());
+    EXPECT_FALSE(mgr.a11yWindows_.count(splashWindowId));
+    ASSERT_TRUE(mgr.a11yWindows_.count(appWindowId));
+    EXPECT_TRUE(mgr.a11yWindows_[appWindowId].IsFocused());
+    EXPECT_EQ(mgr.a11yWindows_[appWindowId].GetRectInScreen().GetRightBottomYScreenPostion(),
+        1 + animationFrames * 10 * 2);
+    EXPECT_EQ(mgr.activeWindowId_, appWindowId);
+    EXPECT_LE(frameEvents, separateEvents);
+    GTEST_LOG_(INFO) << updates.size() << " updates one by one: " << separateEvents << " events " <<
+        std::chrono::duration_cast<std::chrono::microseconds>(separateTime).count() / replayTimes <<
+        "us, in one frame: " << frameEvents << " events " <<
+        std::chrono::duration_cast<std::chrono::microseconds>(frameTime).count() / replayTimes << "us";
+    mgr.DeInit();
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_ApplyWindowUpdates001 end";
+}
+
+/**
+ * @tc.number: AccessibilityWindowManager_Unittest_ApplyWindowUpdates002
+ * @tc.name: ApplyWindowUpdates
+ * @tc.desc: The last window focused within a frame stays active whichever window is updated first, and the
+ *           bounds and property updates send their events without any compared change
+ */
+HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_ApplyWindowUpdates002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_ApplyWindowUpdates002 start";
+    constexpr int32_t firstWindowId = 10;
+    constexpr int32_t secondWindowId = 11;
+    auto makeWindow = [](int32_t windowId, bool focused) {
+        sptr<Rosen::AccessibilityWindowInfo> info = GetRosenWindowInfo(Rosen::WindowType::APP_WINDOW_BASE);
+        info->wid_ = windowId;
+        info->innerWid_ = windowId;
+        info->focused_ = focused;
+        return info;
+    };
+    AccessibilityWindowManager& mgr = Singleton<AccessibilityWindowManager>::GetInstance();
+    mgr.DeInit();
+    mgr.ApplyWindowUpdates({{{makeWindow(firstWindowId, false), makeWindow(secondWindowId, false)},
+        Rosen::WindowUpdateType::WINDOW_UPDATE_ADDED}});
+    mgr.ApplyWindowUpdates({{{makeWindow(secondWindowId, false)}, Rosen::WindowUpdateType::WINDOW_UPDATE_BOUNDS},
+        {{makeWindow(firstWindowId, true)}, Rosen::WindowUpdateType::WINDOW_UPDATE_FOCUSED},
+        {{makeWindow(secondWindowId, true)}, Rosen::WindowUpdateType::WINDOW_UPDATE_FOCUSED}});
+    EXPECT_EQ(secondWindowId, mgr.activeWindowId_);
+    EXPECT_FALSE(mgr.a11yWindows_[firstWindowId].IsActive());
+    EXPECT_TRUE(mgr.a11yWindows_[secondWindowId].IsActive());
+
+    // the window activated and then removed within a frame leaves no active window
+    mgr.ApplyWindowUpdates({{{makeWindow(firstWindowId, true)}, Rosen::WindowUpdateType::WINDOW_UPDATE_FOCUSED},
+        {{makeWindow(firstWindowId, true)}, Rosen::WindowUpdateType::WINDOW_UPDATE_REMOVED}});
+    EXPECT_EQ(INVALID_WINDOW_ID, mgr.activeWindowId_);
+    EXPECT_FALSE(mgr.a11yWindows_[secondWindowId].IsActive());
+
+    AccessibilityAbilityHelper::GetInstance().ClearSendEventTimes();
+    mgr.ApplyWindowUpdates({{{makeWindow(secondWindowId, true)}, Rosen::WindowUpdateType::WINDOW_UPDATE_BOUNDS}});
+    EXPECT_EQ(1, AccessibilityAbilityHelper::GetInstance().GetSendEventTimes());
+    AccessibilityAbilityHelper::GetInstance().ClearSendEventTimes();
+    mgr.ApplyWindowUpdates({{{makeWindow(secondWindowId, true)}, Rosen::WindowUpdateType::WINDOW_UPDATE_PROPERTY}});
+    EXPECT_EQ(1, AccessibilityAbilityHelper::GetInstance().GetSendEventTimes());
+    mgr.DeInit();
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_ApplyWindowUpdates002 end";
+}
+
+/**
+ * @tc.number: AccessibilityWindowManager_Unittest_ApplyWindowUpdates003
+ * @tc.name: ApplyWindowUpdates
+ * @tc.desc: Replay the window updates recorded on a device one by one and frame by frame, the windows and the
+ *           active window end the same
+ */
+HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_ApplyWindowUpdates003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_ApplyWindowUpdates003 start";
+    std::vector<std::vector<AccessibilityWindowManager::RosenWindowUpdate>> frames =
+        ReadRecordedFrames(RECORDED_WINDOW_UPDATES_PATH);
+    if (frames.empty()) {
+        GTEST_LOG_(INFO) << "no window updates recorded in " << RECORDED_WINDOW_UPDATES_PATH <<
+            ", save the recorded window updates of hidumper -w there to replay them";
+        return;
+    }
+    AccessibilityWindowManager& mgr = Singleton<AccessibilityWindowManager>::GetInstance();
+    size_t updateCount = 0;
+    mgr.DeInit();
+    AccessibilityAbilityHelper::GetInstance().ClearSendEventTimes();
+    auto begin = std::chrono::steady_clock::now();
+    for (auto &frame : frames) {
+        for (auto &update : frame) {
+            mgr.ApplyWindowUpdates({update});
+            updateCount++;
+        }
+    }
+    auto separateTime = std::chrono::steady_clock::now() - begin;
+    int separateEvents = AccessibilityAbilityHelper::GetInstance().GetSendEventTimes();
+    std::map<int32_t, AccessibilityWindowInfo> separateWindows = mgr.a11yWindows_;
+    int32_t separateActiveWindowId = mgr.activeWindowId_;
+
+    mgr.DeInit();
+    AccessibilityAbilityHelper::GetInstance().ClearSendEventTimes();
+    begin = std::chrono::steady_clock::now();
+    for (auto &frame : frames) {
+        mgr.ApplyWindowUpdates(frame);
+    }
+    auto frameTime = std::chrono::steady_clock::now() - begin;
+    int frameEvents = AccessibilityAbilityHelper::GetInstance().GetSendEventTimes();
+
+    EXPECT_EQ(separateActiveWindowId, mgr.activeWindowId_);
+    ASSERT_EQ(separateWindows.size(), mgr.a11yWindows_.size());
+    for (auto &window : separateWindows) {
+        ASSERT_TRUE(mgr.a11yWindows_.count(window.first));
+        AccessibilityWindowInfo &frameWindow = mgr.a11yWindows_[window.first];
+        EXPECT_EQ(window.second.IsFocused(), frameWindow.IsFocused());
+        EXPECT_EQ(window.second.IsActive(), frameWindow.IsActive());
+        EXPECT_EQ(window.second.GetRectInScreen().GetRightBottomXScreenPostion(),
+            frameWindow.GetRectInScreen().GetRightBottomXScreenPostion());
+        EXPECT_EQ(window.second.GetRectInScreen().GetRightBottomYScreenPostion(),
+            frameWindow.GetRectInScreen().GetRightBottomYScreenPostion());
+    }
+    EXPECT_LE(frameEvents, separateEvents);
+    GTEST_LOG_(INFO) << updateCount << " recorded updates one by one: " << separateEvents << " events " <<
+        std::chrono::duration_cast<std::chrono::microseconds>(separateTime).count() << "us, in " << frames.size() <<
+        " frames: " << frameEvents << " events " <<
+        std::chrono::duration_cast<std::chrono::microseconds>(frameTime).count() << "us";
+    mgr.DeInit();
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_ApplyWindowUpdates003 end";
+}
+
+/**
+ * @tc.number: AccessibilityWindowManager_Unittest_GetAccessibilityWindows002
+ * @tc.name: GetAccessibilityWindows
+ * @tc.desc: The windows, the active and accessibility focused windows and the magnification of two displays
+ *           are kept apart
+ */
+HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_GetAccessibilityWindows002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_GetAccessibilityWindows002 start";
+    constexpr uint64_t mainDisplayId = 0;
+    constexpr uint64_t extendDisplayId = 1;
+    auto makeWindow = [](int32_t windowId, uint64_t displayId, bool focused) {
+        sptr<Rosen::AccessibilityWindowInfo> info = GetRosenWindowInfo(Rosen::WindowType::APP_WINDOW_BASE);
+        info->wid_ = windowId;
+        info->innerWid_ = windowId;
+        info->displayId_ = displayId;
+        info->focused_ = focused;
+        return info;
+    };
+    sptr<Rosen::AccessibilityWindowInfo> magnification = makeWindow(31, extendDisplayId, false);
+    magnification->type_ = Rosen::WindowType::WINDOW_TYPE_MAGNIFICATION;
+    AccessibilityWindowManager& mgr = Singleton<AccessibilityWindowManager>::GetInstance();
+    mgr.DeInit();
+    mgr.ApplyWindowUpdates({{{makeWindow(20, mainDisplayId, true), makeWindow(21, mainDisplayId, false),
+        makeWindow(30, extendDisplayId, true), magnification}, Rosen::WindowUpdateType::WINDOW_UPDATE_ALL}});
+
+    EXPECT_EQ(2, (int)mgr.GetAccessibilityWindows(mainDisplayId).size());
+    EXPECT_EQ(1, (int)mgr.GetAccessibilityWindows(extendDisplayId).size());
+    EXPECT_TRUE(mgr.GetAccessibilityWindows(extendDisplayId + 1).empty());
+    EXPECT_EQ(20, mgr.GetActiveWindowId(mainDisplayId));
+    EXPECT_EQ(30, mgr.GetActiveWindowId(extendDisplayId));
+    EXPECT_FALSE(mgr.IsDisplayMagnified(mainDisplayId));
+    EXPECT_TRUE(mgr.IsDisplayMagnified(extendDisplayId));
+
+    // the focus moves on the main display only
+    mgr.ApplyWindowUpdates({{{makeWindow(21, mainDisplayId, true)}, Rosen::WindowUpdateType::WINDOW_UPDATE_FOCUSED},
+        {{magnification}, Rosen::WindowUpdateType::WINDOW_UPDATE_REMOVED}});
+    EXPECT_EQ(21, mgr.GetActiveWindowId(mainDisplayId));
+    EXPECT_EQ(30, mgr.GetActiveWindowId(extendDisplayId));
+    EXPECT_FALSE(mgr.a11yWindows_[20].IsActive());
+    EXPECT_TRUE(mgr.a11yWindows_[30].IsActive());
+    EXPECT_FALSE(mgr.IsDisplayMagnified(extendDisplayId));
+
+    mgr.SetAccessibilityFocusedWindow(20);
+    mgr.SetAccessibilityFocusedWindow(30);
+    std::shared_ptr<const AccessibilityWindowManager::DisplayWindowSnapshot> mainDisplay =
+        mgr.GetDisplayWindowSnapshot(mainDisplayId);
+    std::shared_ptr<const AccessibilityWindowManager::DisplayWindowSnapshot> extendDisplay =
+        mgr.GetDisplayWindowSnapshot(extendDisplayId);
+    ASSERT_TRUE(mainDisplay != nullptr && extendDisplay != nullptr);
+    EXPECT_EQ(20, mainDisplay->a11yFocusedWindowId);
+    EXPECT_EQ(30, extendDisplay->a11yFocusedWindowId);
+    EXPECT_EQ(30, mgr.a11yFocusedWindowId_);
+
+    mgr.SetAccessibilityFocusedWindow(21);
+    EXPECT_FALSE(mgr.a11yWindows_[20].IsAccessibilityFocused());
+    EXPECT_TRUE(mgr.a11yWindows_[30].IsAccessibilityFocused());
+    mgr.DeInit();
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_GetAccessibilityWindows002 end";
+}
+
+/**
+ * @tc.number: AccessibilityWindowManager_Unittest_SetActiveWindow006
+ * @tc.name: SetActiveWindow
+ * @tc.desc: Clearing or removing the latest active and accessibility focused windows keeps the windows of
+ *           the other display
+ */
+HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_SetActiveWindow006, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_SetActiveWindow006 start";
+    constexpr uint64_t mainDisplayId = 0;
+    constexpr uint64_t extendDisplayId = 1;
+    auto makeWindow = [](int32_t windowId, uint64_t displayId, bool focused) {
+        sptr<Rosen::AccessibilityWindowInfo> info = GetRosenWindowInfo(Rosen::WindowType::APP_WINDOW_BASE);
+        info->wid_ = windowId;
+        info->innerWid_ = windowId;
+        info->displayId_ = displayId;
+        info->focused_ = focused;
+        return info;
+    };
+    AccessibilityWindowManager& mgr = Singleton<AccessibilityWindowManager>::GetInstance();
+    mgr.DeInit();
+    mgr.ApplyWindowUpdates({{{makeWindow(20, mainDisplayId, true), makeWindow(21, mainDisplayId, false),
+        makeWindow(30, extendDisplayId, true)}, Rosen::WindowUpdateType::WINDOW_UPDATE_ALL}});
+    mgr.SetActiveWindow(30);
+    mgr.SetAccessibilityFocusedWindow(20);
+    mgr.SetAccessibilityFocusedWindow(30);
+    EXPECT_EQ(30, mgr.activeWindowId_);
+
+    // the latest active window is cleared, the main display keeps its own
+    mgr.SetActiveWindow(INVALID_WINDOW_ID);
+    EXPECT_EQ(INVALID_WINDOW_ID, mgr.activeWindowId_);
+    EXPECT_EQ(20, mgr.GetActiveWindowId(mainDisplayId));
+    EXPECT_EQ(INVALID_WINDOW_ID, mgr.GetActiveWindowId(extendDisplayId));
+    EXPECT_TRUE(mgr.a11yWindows_[20].IsActive());
+
+    // activating the active window of the main display again makes it the latest one
+    mgr.SetActiveWindow(20);
+    EXPECT_EQ(20, mgr.activeWindowId_);
+    EXPECT_EQ(20, mgr.GetActiveWindowId(mainDisplayId));
+    EXPECT_TRUE(mgr.a11yWindows_[20].IsActive());
+
+    // the accessibility focused window of the main display stays after the one of the extend display is removed
+    mgr.ApplyWindowUpdates({{{makeWindow(30, extendDisplayId, false)},
+        Rosen::WindowUpdateType::WINDOW_UPDATE_REMOVED}});
+    EXPECT_EQ(INVALID_WINDOW_ID, mgr.a11yFocusedWindowId_);
+    std::shared_ptr<const AccessibilityWindowManager::DisplayWindowSnapshot> mainDisplay =
+        mgr.GetDisplayWindowSnapshot(mainDisplayId);
+    ASSERT_TRUE(mainDisplay != nullptr);
+    EXPECT_EQ(20, mainDisplay->a11yFocusedWindowId);
+    EXPECT_EQ(20, mainDisplay->activeWindowId);
+    EXPECT_TRUE(mgr.GetDisplayWindowSnapshot(extendDisplayId) == nullptr);
+    mgr.DeInit();
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_SetActiveWindow006 end";
+}
+
+/**
+ * @tc.number: AccessibilityWindowManager_Unittest_ResolveElementOperator001
+ * @tc.name: ResolveElementOperator
+ * @tc.desc: The element operator found for a window is reused while the windows of another display are updated,
+ *           compare the time of the lookups with finding the operator every time
+ */
+HWTEST_F(AccessibilityWindowManagerTest, AccessibilityWindowManager_Unittest_ResolveElementOperator001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_ResolveElementOperator001 start";
+    constexpr uint64_t mainDisplayId = 0;
+    constexpr uint64_t extendDisplayId = 1;
+    constexpr int32_t targetWindowId = 20;
+    constexpr int32_t treeId = 1;
+    constexpr int32_t updateCount = 1000;
+    auto makeWindow = [](int32_t windowId, uint64_t displayId, bool focused, uint32_t size) {
+        sptr<Rosen::AccessibilityWindowInfo> info = GetRosenWindowInfo(Rosen::WindowType::APP_WINDOW_BASE);
+        info->wid_ = windowId;
+        info->innerWid_ = windowId;
+        info->displayId_ = displayId;
+        info->focused_ = focused;
+        info->windowRect_.width_ = size;
+        return info;
+    };
+    sptr<AccessibilityAccountData> accountData =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
+    ASSERT_TRUE(accountData);
+    AccessibilityWindowManager &mgr = accountData->GetWindowManager();
+    mgr.DeInit();
+    mgr.ApplyWindowUpdates({{{makeWindow(targetWindowId, mainDisplayId, true, 1), makeWindow(30, extendDisplayId,
+        true, 1), makeWindow(31, extendDisplayId, false, 1)}, Rosen::WindowUpdateType::WINDOW_UPDATE_ALL}});
+    sptr<AccessibilityElementOperatorStub> stub = new MockAccessibilityElementOperatorStub();
+    sptr<AccessibilityWindowConnection> connection = new AccessibilityWindowConnection(targetWindowId, ACCOUNT_ID);
+    connection->SetCardProxy(treeId, new AccessibilityElementOperatorProxy(stub));
+    accountData->AddAccessibilityWindowConnection(targetWindowId, connection);
+    sptr<AccessibleAbilityChannel> channel =
+        new AccessibleAbilityChannel(accountData->GetAccountId(), "operatorCacheClient", accountData);
+
+    int32_t reused = 0;
+    // the key is converted on every lookup as GetElementOperator does
+    auto findOperator = [&](bool reuse) {
+        auto [realId, displayId] = mgr.ConvertToRealWindowId(targetWindowId, FOCUS_TYPE_INVALID);
+        AccessibleAbilityChannel::OperatorKey key(realId, displayId, treeId);
+        AccessibleAbilityChannel::ResolvedOperator resolved;
+        if (reuse && channel->FindResolvedOperator(key, resolved)) {
+            reused++;
+            return resolved.elementOperator;
+        }
+        channel->ResolveElementOperator(accountData, key, resolved);
+        return resolved.elementOperator;
+    };
+    // the windows of the other display move and take the focus in turn, each update publishes a snapshot
+    auto updateOtherDisplay = [&](int32_t i) {
+        int32_t windowId = (i % 2 == 0) ? 30 : 31;
+        mgr.ApplyWindowUpdates({{{makeWindow(windowId, extendDisplayId, true, static_cast<uint32_t>(i + 1))},
+            Rosen::WindowUpdateType::WINDOW_UPDATE_FOCUSED}});
+    };
+    auto measure = [&](bool reuse) {
+        std::chrono::steady_clock::duration time {};
+        for (int32_t i = 0; i < updateCount; i++) {
+            updateOtherDisplay(i);
+            auto begin = std::chrono::steady_clock::now();
+            sptr<IAccessibilityElementOperator> elementOperator = findOperator(reuse);
+            time += std::chrono::steady_clock::now() - begin;
+            EXPECT_TRUE(elementOperator != nullptr);
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+    };
+    ASSERT_TRUE(findOperator(true) != nullptr);
+    uint64_t generation = mgr.GetWindowSnapshot()->generation;
+    auto reusedTime = measure(true);
+    EXPECT_EQ(updateCount, reused);
+    EXPECT_LT(generation, mgr.GetWindowSnapshot()->generation);
+    auto foundTime = measure(false);
+    GTEST_LOG_(INFO) << updateCount << " lookups between window updates, reused operator: " << reusedTime <<
+        " us, found every time: " << foundTime << " us";
+
+    // a change of the window's own connection makes the operator stale
+    reused = 0;
+    connection->SetCardProxy(treeId, new AccessibilityElementOperatorProxy(stub));
+    EXPECT_TRUE(findOperator(true) != nullptr);
+    EXPECT_EQ(0, reused);
+    accountData->RemoveAccessibilityWindowConnection(targetWindowId);
+    EXPECT_TRUE(findOperator(true) == nullptr);
+    EXPECT_EQ(0, reused);
+    mgr.DeInit();
+    GTEST_LOG_(INFO) << "AccessibilityWindowManager_Unittest_ResolveElementOperator001 end";
+}
 } // namespace Accessibility
 } // namespace OHOS
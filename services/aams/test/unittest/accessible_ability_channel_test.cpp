@@ -14,13 +14,18 @@
  */
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <thread>
 #include "accessibility_ability_info.h"
 #include "accessibility_account_data.h"
 #include "accessibility_element_operator_proxy.h"
 #include "accessibility_ut_helper.h"
+#include "accessibility_window_manager.h"
 #include "accessible_ability_channel.h"
 #include "accessible_ability_connection.h"
 #include "accessible_ability_manager_service.h"
+#include "element_operator_callback_impl.h"
 #include "mock_accessibility_element_operator_stub.h"
 #include "mock_accessibility_setting_provider.h"
 
@@ -39,6 +44,20 @@ namespace {
     constexpr int32_t ACCOUNT_ID = 0;
 } // namespace
 
+class CountingElementOperatorCallback : public ElementOperatorCallbackImpl {
+public:
+    CountingElementOperatorCallback() : ElementOperatorCallbackImpl(ACCOUNT_ID) {}
+    ~CountingElementOperatorCallback() = default;
+
+    void SetExecuteActionResult(const bool succeeded, const int32_t requestId) override
+    {
+        resultCount_++;
+        ElementOperatorCallbackImpl::SetExecuteActionResult(succeeded, requestId);
+    }
+
+    std::atomic<int32_t> resultCount_ {0};
+};
+
 class AccessibleAbilityChannelUnitTest : public ::testing::Test {
 public:
     AccessibleAbilityChannelUnitTest()
@@ -648,5 +667,437 @@ HWTEST_F(AccessibleAbilityChannelUnitTest,
         ActionType::ACCESSIBILITY_ACTION_INJECT_ACTION, actionArguments, 0, nullptr, rect), RET_ERR_NULLPTR);
     GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_ExecuteAction_InjectAction_009 end";
 }
+
+/**
+ * @tc.number: AccessibleAbilityChannel_Unittest_IpcHealth_001
+ * @tc.name: AccessibilityIpcHealth
+ * @tc.desc: Test the breaker opens after consecutive timeouts, lets one probe through after the cool-down
+ *           and closes when the window answers again
+ */
+HWTEST_F(AccessibleAbilityChannelUnitTest, AccessibleAbilityChannel_Unittest_IpcHealth_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_IpcHealth_001 start";
+    constexpr int64_t coolDownMs = 100;
+    constexpr useconds_t waitTime = 150 * 1000; // us
+    AccessibilityIpcHealth ipcHealth(coolDownMs);
+    for (uint32_t i = 0; i + 1 < AccessibilityIpcHealth::TIMEOUT_THRESHOLD; i++) {
+        ipcHealth.RecordTimeout();
+        EXPECT_TRUE(ipcHealth.AllowRequest());
+    }
+    ipcHealth.RecordTimeout();
+    EXPECT_FALSE(ipcHealth.AllowRequest());
+    AccessibilityIpcHealth::Stats stats = ipcHealth.GetStats();
+    EXPECT_EQ(stats.state, AccessibilityIpcHealth::BreakerState::OPEN);
+    EXPECT_EQ(stats.timeoutCount, AccessibilityIpcHealth::TIMEOUT_THRESHOLD);
+    EXPECT_EQ(stats.fastFailCount, 1);
+
+    usleep(waitTime);
+    EXPECT_TRUE(ipcHealth.AllowRequest());
+    EXPECT_FALSE(ipcHealth.AllowRequest());
+    EXPECT_EQ(ipcHealth.GetStats().state, AccessibilityIpcHealth::BreakerState::HALF_OPEN);
+
+    ipcHealth.RecordLatency(1);
+    EXPECT_TRUE(ipcHealth.AllowRequest());
+    stats = ipcHealth.GetStats();
+    EXPECT_EQ(stats.state, AccessibilityIpcHealth::BreakerState::CLOSED);
+    EXPECT_EQ(stats.consecutiveTimeouts, 0);
+    EXPECT_EQ(stats.fastFailCount, 2);
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_IpcHealth_001 end";
+}
+
+/**
+ * @tc.number: AccessibleAbilityChannel_Unittest_IpcHealth_002
+ * @tc.name: AccessibilityIpcHealth
+ * @tc.desc: Test the deadline follows the recorded latency within its bounds
+ */
+HWTEST_F(AccessibleAbilityChannelUnitTest, AccessibleAbilityChannel_Unittest_IpcHealth_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_IpcHealth_002 start";
+    constexpr int64_t fastLatency = 10;
+    constexpr int64_t slowLatency = 400;
+    constexpr size_t sampleCount = 16;
+    AccessibilityIpcHealth ipcHealth;
+    for (size_t i = 0; i + 1 < sampleCount; i++) {
+        ipcHealth.RecordLatency(fastLatency);
+    }
+    // too few answers to derive a deadline
+    EXPECT_EQ(ipcHealth.GetDeadline(), AccessibilityIpcHealth::MAX_DEADLINE_MS);
+    ipcHealth.RecordLatency(fastLatency);
+    EXPECT_EQ(ipcHealth.GetDeadline(), AccessibilityIpcHealth::MIN_DEADLINE_MS);
+
+    for (size_t i = 0; i < sampleCount; i++) {
+        ipcHealth.RecordLatency(slowLatency);
+    }
+    AccessibilityIpcHealth::Stats stats = ipcHealth.GetStats();
+    EXPECT_EQ(stats.p99Ms, slowLatency);
+    EXPECT_GT(stats.ewmaMs, fastLatency);
+    EXPECT_LT(stats.ewmaMs, slowLatency);
+    EXPECT_GE(stats.deadlineMs, slowLatency * 2);
+    EXPECT_LE(stats.deadlineMs, AccessibilityIpcHealth::MAX_DEADLINE_MS);
+    EXPECT_EQ(stats.answeredCount, sampleCount * 2);
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_IpcHealth_002 end";
+}
+
+/**
+ * @tc.number: AccessibleAbilityChannel_Unittest_IpcHealth_003
+ * @tc.name: AccessibilityIpcHealth
+ * @tc.desc: Test the subtree searches keep their own deadline and their timeouts do not open the breaker
+ */
+HWTEST_F(AccessibleAbilityChannelUnitTest, AccessibleAbilityChannel_Unittest_IpcHealth_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_IpcHealth_003 start";
+    constexpr int64_t nodeLatency = 10;
+    constexpr int64_t treeLatency = 1500;
+    constexpr size_t sampleCount = 16;
+    AccessibilityIpcHealth ipcHealth;
+    for (size_t i = 0; i < sampleCount; i++) {
+        ipcHealth.RecordLatency(nodeLatency);
+        ipcHealth.RecordLatency(treeLatency, AccessibilityIpcHealth::RequestKind::TREE);
+    }
+    EXPECT_EQ(ipcHealth.GetDeadline(), AccessibilityIpcHealth::MIN_DEADLINE_MS);
+    EXPECT_GE(ipcHealth.GetDeadline(AccessibilityIpcHealth::RequestKind::TREE), treeLatency * 2);
+    AccessibilityIpcHealth::Stats stats = ipcHealth.GetStats(AccessibilityIpcHealth::RequestKind::TREE);
+    EXPECT_EQ(stats.p99Ms, treeLatency);
+    EXPECT_EQ(stats.answeredCount, sampleCount);
+
+    for (uint32_t i = 0; i < AccessibilityIpcHealth::TIMEOUT_THRESHOLD; i++) {
+        ipcHealth.RecordTimeout(AccessibilityIpcHealth::RequestKind::TREE);
+    }
+    EXPECT_TRUE(ipcHealth.AllowRequest());
+    stats = ipcHealth.GetStats();
+    EXPECT_EQ(stats.state, AccessibilityIpcHealth::BreakerState::CLOSED);
+    EXPECT_EQ(stats.consecutiveTimeouts, 0);
+    EXPECT_EQ(stats.timeoutCount, 0);
+    EXPECT_EQ(ipcHealth.GetStats(AccessibilityIpcHealth::RequestKind::TREE).timeoutCount,
+        AccessibilityIpcHealth::TIMEOUT_THRESHOLD);
+
+    // fast subtree answers do not cut the subtree deadline below its floor
+    AccessibilityIpcHealth fastHealth;
+    for (size_t i = 0; i < sampleCount; i++) {
+        fastHealth.RecordLatency(nodeLatency, AccessibilityIpcHealth::RequestKind::TREE);
+    }
+    EXPECT_EQ(fastHealth.GetDeadline(AccessibilityIpcHealth::RequestKind::TREE),
+        AccessibilityIpcHealth::MIN_TREE_DEADLINE_MS);
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_IpcHealth_003 end";
+}
+
+/**
+ * @tc.number: AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_002
+ * @tc.name: SearchElementInfoByAccessibilityId
+ * @tc.desc: Test a search to a window which keeps timing out fails fast
+ */
+HWTEST_F(AccessibleAbilityChannelUnitTest,
+    AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_002 start";
+    sptr<AccessibilityAccountData> accountData =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
+    ASSERT_TRUE(accountData);
+    sptr<AccessibilityWindowConnection> connection = accountData->GetAccessibilityWindowConnection(WINDOW_ID);
+    ASSERT_TRUE(connection);
+    AccessibilityAbilityHelper::GetInstance().SetRealId(WINDOW_ID);
+    for (uint32_t i = 0; i < AccessibilityIpcHealth::TIMEOUT_THRESHOLD; i++) {
+        connection->GetIpcHealth().RecordTimeout();
+    }
+    sptr<ElementOperatorCallbackImpl> callback = new ElementOperatorCallbackImpl(ACCOUNT_ID);
+    ElementBasicInfo elementBasicInfo;
+    elementBasicInfo.windowId = WINDOW_ID;
+    elementBasicInfo.treeId = 0;
+    elementBasicInfo.elementId = ELEMENT_ID;
+    EXPECT_EQ(channel_->SearchElementInfoByAccessibilityId(elementBasicInfo, 0, callback, 0, true),
+        RET_ERR_TIME_OUT);
+    EXPECT_EQ(connection->GetIpcHealth().GetStats().fastFailCount, 1);
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_002 end";
+}
+
+/**
+ * @tc.number: AccessibleAbilityChannel_Unittest_RequestId_001
+ * @tc.name: AddRequestId
+ * @tc.desc: Test requests added and answered from several threads while their windows come and go
+ *           are each cancelled at most once, and all unanswered ones are cancelled
+ */
+HWTEST_F(AccessibleAbilityChannelUnitTest, AccessibleAbilityChannel_Unittest_RequestId_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_RequestId_001 start";
+    constexpr int32_t requestThreadCount = 6;
+    constexpr int32_t windowThreadCount = 2;
+    constexpr int32_t requestCount = 200; // per thread
+    constexpr int32_t unansweredInterval = 4; // every fourth request is left to the window death
+    constexpr int32_t firstWindowId = 100;
+    constexpr int32_t windowCount = 4; // per window thread
+    sptr<AccessibilityAccountData> accountData =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
+    ASSERT_TRUE(accountData);
+    ElementOperatorManager &manager = accountData->GetElementOperatorManager();
+
+    std::vector<std::vector<sptr<CountingElementOperatorCallback>>> callbacks(requestThreadCount);
+    std::atomic<bool> requestsDone {false};
+    std::vector<std::thread> threads;
+    for (int32_t t = 0; t < requestThreadCount; t++) {
+        threads.emplace_back([&manager, &callbacks, t]() {
+            for (int32_t i = 0; i < requestCount; i++) {
+                sptr<CountingElementOperatorCallback> callback = new CountingElementOperatorCallback();
+                callbacks[t].push_back(callback);
+                int32_t requestId = REQUEST_ID_MIN + t * requestCount + i;
+                int32_t windowId = firstWindowId + i % (windowThreadCount * windowCount);
+                manager.AddRequestId(windowId, i % 2, requestId, callback);
+                if (i % unansweredInterval != 0) {
+                    manager.RemoveRequestId(requestId);
+                }
+            }
+        });
+    }
+    for (int32_t t = 0; t < windowThreadCount; t++) {
+        threads.emplace_back([&accountData, &manager, &requestsDone, t]() {
+            while (!requestsDone) {
+                for (int32_t i = 0; i < windowCount; i++) {
+                    int32_t windowId = firstWindowId + t * windowCount + i;
+                    accountData->AddAccessibilityWindowConnection(windowId,
+                        new AccessibilityWindowConnection(windowId, ACCOUNT_ID));
+                    manager.StopCallbackWait(windowId, i % 2);
+                    manager.StopCallbackWait(windowId);
+                    accountData->RemoveAccessibilityWindowConnection(windowId);
+                }
+            }
+        });
+    }
+    for (int32_t t = 0; t < requestThreadCount; t++) {
+        threads[t].join();
+    }
+    requestsDone = true;
+    for (int32_t t = requestThreadCount; t < requestThreadCount + windowThreadCount; t++) {
+        threads[t].join();
+    }
+    for (int32_t i = 0; i < windowThreadCount * windowCount; i++) {
+        manager.StopCallbackWait(firstWindowId + i);
+    }
+
+    for (int32_t t = 0; t < requestThreadCount; t++) {
+        ASSERT_EQ(callbacks[t].size(), static_cast<size_t>(requestCount));
+        for (int32_t i = 0; i < requestCount; i++) {
+            // an answered request is only cancelled if the window died before the answer
+            EXPECT_LE(callbacks[t][i]->resultCount_.load(), 1);
+            if (i % unansweredInterval == 0) {
+                EXPECT_EQ(callbacks[t][i]->resultCount_.load(), 1);
+            }
+        }
+    }
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_RequestId_001 end";
+}
+
+/**
+ * @tc.number: AccessibleAbilityChannel_Unittest_RequestId_002
+ * @tc.name: AddRequestId
+ * @tc.desc: Test a request id added again replaces the pending request, also when it is added from
+ *           several threads at once, so only one request of the id is cancelled by the window death
+ */
+HWTEST_F(AccessibleAbilityChannelUnitTest, AccessibleAbilityChannel_Unittest_RequestId_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_RequestId_002 start";
+    constexpr int32_t threadCount = 4;
+    constexpr int32_t addCount = 100; // per thread
+    constexpr int32_t windowId = 100;
+    constexpr int32_t treeId = 0;
+    constexpr int32_t requestId = REQUEST_ID_MIN;
+    sptr<AccessibilityAccountData> accountData =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
+    ASSERT_TRUE(accountData);
+    ElementOperatorManager &manager = accountData->GetElementOperatorManager();
+
+    sptr<CountingElementOperatorCallback> oldCallback = new CountingElementOperatorCallback();
+    sptr<CountingElementOperatorCallback> newCallback = new CountingElementOperatorCallback();
+    manager.AddRequestId(windowId, treeId, requestId, oldCallback);
+    manager.AddRequestId(windowId, treeId, requestId, newCallback);
+    manager.StopCallbackWait(windowId);
+    EXPECT_EQ(oldCallback->resultCount_.load(), 0);
+    EXPECT_EQ(newCallback->resultCount_.load(), 1);
+
+    std::vector<std::vector<sptr<CountingElementOperatorCallback>>> callbacks(threadCount);
+    std::vector<std::thread> threads;
+    for (int32_t t = 0; t < threadCount; t++) {
+        threads.emplace_back([&manager, &callbacks, t]() {
+            for (int32_t i = 0; i < addCount; i++) {
+                sptr<CountingElementOperatorCallback> callback = new CountingElementOperatorCallback();
+                callbacks[t].push_back(callback);
+                manager.AddRequestId(windowId, treeId, requestId, callback);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    manager.StopCallbackWait(windowId);
+    int32_t resultCount = 0;
+    for (auto &threadCallbacks : callbacks) {
+        for (auto &callback : threadCallbacks) {
+            resultCount += callback->resultCount_.load();
+        }
+    }
+    EXPECT_EQ(resultCount, 1);
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_RequestId_002 end";
+}
+
+/**
+ * @tc.number: AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_003
+ * @tc.name: SearchElementInfoByAccessibilityId
+ * @tc.desc: Test searches keep finding the element operator while window snapshots are published,
+ *           and find it again once its window connection changes
+ */
+HWTEST_F(AccessibleAbilityChannelUnitTest,
+    AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_003 start";
+    constexpr int32_t searchCount = 100;
+    constexpr int32_t requestId = 1;
+    constexpr int32_t treeId = 1;
+    sptr<AccessibilityAccountData> accountData =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
+    ASSERT_TRUE(accountData);
+    sptr<AccessibilityElementOperatorStub> stub = new MockAccessibilityElementOperatorStub();
+    sptr<IAccessibilityElementOperator> proxy = new AccessibilityElementOperatorProxy(stub);
+    sptr<AccessibilityWindowConnection> connection =
+        new AccessibilityWindowConnection(SCENE_BOARD_WINDOW_ID, ACCOUNT_ID);
+    connection->SetCardProxy(treeId, proxy);
+    accountData->AddAccessibilityWindowConnection(SCENE_BOARD_WINDOW_ID, connection);
+    AccessibilityAbilityHelper::GetInstance().SetRealId(SCENE_BOARD_WINDOW_ID);
+
+    sptr<ElementOperatorCallbackImpl> callback = new ElementOperatorCallbackImpl(ACCOUNT_ID);
+    ElementBasicInfo elementBasicInfo;
+    elementBasicInfo.windowId = SCENE_BOARD_WINDOW_ID;
+    elementBasicInfo.treeId = treeId;
+    elementBasicInfo.elementId = ELEMENT_ID;
+    auto search = [&]() {
+        RetError ret = channel_->SearchElementInfoByAccessibilityId(elementBasicInfo, requestId, callback, 0, true);
+        accountData->GetElementOperatorManager().RemoveRequestId(requestId);
+        return ret;
+    };
+    ASSERT_EQ(search(), RET_OK);
+    for (int32_t i = 0; i < searchCount; i++) {
+        // a snapshot is published for every window update, of any window
+        accountData->GetWindowManager().PublishWindowSnapshot();
+        ASSERT_EQ(search(), RET_OK);
+    }
+    // a changed broker flag makes the operator found before stale
+    connection->SetUseBrokerFlag(false);
+    ASSERT_EQ(search(), RET_OK);
+
+    // the operator of a window registered again or removed is not used any more
+    accountData->AddAccessibilityWindowConnection(SCENE_BOARD_WINDOW_ID,
+        new AccessibilityWindowConnection(SCENE_BOARD_WINDOW_ID, ACCOUNT_ID));
+    EXPECT_EQ(search(), RET_ERR_NULLPTR);
+    accountData->RemoveAccessibilityWindowConnection(SCENE_BOARD_WINDOW_ID);
+    EXPECT_EQ(search(), RET_ERR_NO_WINDOW_CONNECTION);
+
+    accountData->GetWindowManager().DeInit();
+    AccessibilityAbilityHelper::GetInstance().SetRealId(WINDOW_ID);
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_003 end";
+}
+
+/**
+ * @tc.number: AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_004
+ * @tc.name: SearchElementInfoByAccessibilityId
+ * @tc.desc: Test a search to a window checked before is sent while the channel thread is busy,
+ *           and a search to a removed window is checked again
+ */
+HWTEST_F(AccessibleAbilityChannelUnitTest,
+    AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_004, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_004 start";
+    constexpr int32_t requestId = 1;
+    constexpr int32_t treeId = 1;
+    sptr<AccessibilityAccountData> accountData =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
+    ASSERT_TRUE(accountData);
+    sptr<AccessibilityElementOperatorStub> stub = new MockAccessibilityElementOperatorStub();
+    sptr<AccessibilityWindowConnection> connection =
+        new AccessibilityWindowConnection(SCENE_BOARD_WINDOW_ID, ACCOUNT_ID);
+    connection->SetCardProxy(treeId, new AccessibilityElementOperatorProxy(stub));
+    accountData->AddAccessibilityWindowConnection(SCENE_BOARD_WINDOW_ID, connection);
+    AccessibilityAbilityHelper::GetInstance().SetRealId(SCENE_BOARD_WINDOW_ID);
+    accountData->GetWindowManager().PublishWindowSnapshot();
+
+    sptr<ElementOperatorCallbackImpl> callback = new ElementOperatorCallbackImpl(ACCOUNT_ID);
+    ElementBasicInfo elementBasicInfo;
+    elementBasicInfo.windowId = SCENE_BOARD_WINDOW_ID;
+    elementBasicInfo.treeId = treeId;
+    elementBasicInfo.elementId = ELEMENT_ID;
+    EXPECT_EQ(channel_->SearchElementInfoByAccessibilityId(elementBasicInfo, requestId, callback, 0, true), RET_OK);
+    accountData->GetElementOperatorManager().RemoveRequestId(requestId);
+
+    // keep the channel thread busy until the search returns
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    auto handler = std::make_shared<AppExecFwk::EventHandler>(
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetChannelRunner());
+    handler->PostTask([released]() { released.wait(); }, "BlockChannelThread");
+    EXPECT_EQ(channel_->SearchElementInfoByAccessibilityId(elementBasicInfo, requestId, callback, 0, true), RET_OK);
+    accountData->GetElementOperatorManager().RemoveRequestId(requestId);
+    release.set_value();
+
+    accountData->RemoveAccessibilityWindowConnection(SCENE_BOARD_WINDOW_ID);
+    EXPECT_EQ(channel_->SearchElementInfoByAccessibilityId(elementBasicInfo, requestId, callback, 0, true),
+        RET_ERR_NO_WINDOW_CONNECTION);
+
+    accountData->GetWindowManager().DeInit();
+    AccessibilityAbilityHelper::GetInstance().SetRealId(WINDOW_ID);
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_004 end";
+}
+
+/**
+ * @tc.number: AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_005
+ * @tc.name: SearchElementInfoByAccessibilityId
+ * @tc.desc: Test a search to a window checked before waits for a task of the channel queued before it
+ */
+HWTEST_F(AccessibleAbilityChannelUnitTest,
+    AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_005, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_005 start";
+    constexpr int32_t requestId = 1;
+    constexpr int32_t treeId = 1;
+    constexpr int32_t queueTime = 100; // ms
+    sptr<AccessibilityAccountData> accountData =
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetCurrentAccountData();
+    ASSERT_TRUE(accountData);
+    sptr<AccessibilityElementOperatorStub> stub = new MockAccessibilityElementOperatorStub();
+    sptr<AccessibilityWindowConnection> connection =
+        new AccessibilityWindowConnection(SCENE_BOARD_WINDOW_ID, ACCOUNT_ID);
+    connection->SetCardProxy(treeId, new AccessibilityElementOperatorProxy(stub));
+    accountData->AddAccessibilityWindowConnection(SCENE_BOARD_WINDOW_ID, connection);
+    AccessibilityAbilityHelper::GetInstance().SetRealId(SCENE_BOARD_WINDOW_ID);
+    accountData->GetWindowManager().PublishWindowSnapshot();
+
+    sptr<ElementOperatorCallbackImpl> callback = new ElementOperatorCallbackImpl(ACCOUNT_ID);
+    ElementBasicInfo elementBasicInfo;
+    elementBasicInfo.windowId = SCENE_BOARD_WINDOW_ID;
+    elementBasicInfo.treeId = treeId;
+    elementBasicInfo.elementId = ELEMENT_ID;
+    EXPECT_EQ(channel_->SearchElementInfoByAccessibilityId(elementBasicInfo, requestId, callback, 0, true), RET_OK);
+    accountData->GetElementOperatorManager().RemoveRequestId(requestId);
+
+    // the window query of the channel is queued behind the blocked channel thread
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    auto handler = std::make_shared<AppExecFwk::EventHandler>(
+        Singleton<AccessibleAbilityManagerService>::GetInstance().GetChannelRunner());
+    handler->PostTask([released]() { released.wait(); }, "BlockChannelThread");
+    std::thread windowQuery([this]() {
+        AccessibilityWindowInfo windowInfo;
+        channel_->GetWindow(SCENE_BOARD_WINDOW_ID, windowInfo);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(queueTime));
+    std::future<RetError> search = std::async(std::launch::async, [this, &elementBasicInfo, callback]() {
+        return channel_->SearchElementInfoByAccessibilityId(elementBasicInfo, requestId, callback, 0, true);
+    });
+    EXPECT_EQ(search.wait_for(std::chrono::milliseconds(queueTime)), std::future_status::timeout);
+    release.set_value();
+    EXPECT_EQ(search.get(), RET_OK);
+    windowQuery.join();
+    accountData->GetElementOperatorManager().RemoveRequestId(requestId);
+
+    accountData->RemoveAccessibilityWindowConnection(SCENE_BOARD_WINDOW_ID);
+    accountData->GetWindowManager().DeInit();
+    AccessibilityAbilityHelper::GetInstance().SetRealId(WINDOW_ID);
+    GTEST_LOG_(INFO) << "AccessibleAbilityChannel_Unittest_SearchElementInfoByAccessibilityId_005 end";
+}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -14,6 +14,7 @@
  */
 
 #include <cstdio>
+#include <future>
 #include <gtest/gtest.h>
 #include "accessibility_common_helper.h"
 #include "accessibility_element_operator_proxy.h"
@@ -39,6 +40,39 @@ namespace {
     constexpr uint32_t SLEEP_TIME_2 = 2;
     constexpr int32_t CHANNEL_ID = 2;
     constexpr int32_t INVALID_ACCOUNT_ID = -1;
+    constexpr int32_t EVENT_BATCH_INTERVAL = 100; // ms
+    constexpr int32_t SHORT_EVENT_BATCH_INTERVAL = 10; // ms
+    constexpr int32_t MAX_EVENT_BATCH_SIZE = 64;
+    constexpr int64_t ELEMENT_ID_1 = 1;
+    constexpr int64_t ELEMENT_ID_2 = 2;
+    constexpr int32_t WINDOW_ID = 1;
+
+    // The batch flush task is posted to the main runner, running the events there keeps it from firing in between.
+    void RunOnMainRunner(const std::function<void()> &task)
+    {
+        auto &runner = Singleton<AccessibleAbilityManagerService>::GetInstance().GetMainRunner();
+        if (!runner) {
+            task();
+            return;
+        }
+        auto handler = std::make_shared<AppExecFwk::EventHandler>(runner);
+        std::promise<void> promise;
+        std::future<void> future = promise.get_future();
+        handler->PostTask([&task, &promise]() {
+            task();
+            promise.set_value();
+            }, "RunOnMainRunner");
+        future.wait();
+    }
+
+    AccessibilityEventInfo CreateEventInfo(EventType type, int64_t elementId)
+    {
+        AccessibilityEventInfo eventInfo;
+        eventInfo.SetEventType(type);
+        eventInfo.SetWindowId(WINDOW_ID);
+        eventInfo.SetSource(elementId);
+        return eventInfo;
+    }
 } // namespace
 
 class AccessibleAbilityConnectionUnitTest : public ::testing::Test {
@@ -668,5 +702,147 @@ HWTEST_F(AccessibleAbilityConnectionUnitTest,
     }
     GTEST_LOG_(INFO) << "AccessibleAbilityConnection_Unittest_RegisterAppStateObserverToAMS_001 end";
 }
+
+/**
+ * @tc.number: AccessibleAbilityConnection_Unittest_GetEventBatchStats_001
+ * @tc.name: GetEventBatchStats
+ * @tc.desc: Test events are delivered one by one and not counted when batching is disabled.
+ */
+HWTEST_F(AccessibleAbilityConnectionUnitTest,
+    AccessibleAbilityConnection_Unittest_GetEventBatchStats_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityConnection_Unittest_GetEventBatchStats_001 start";
+    if (connection_ != nullptr) {
+        AccessibilityEventInfo eventInfo;
+        eventInfo.SetEventType(EventType::TYPE_VIEW_SCROLLED_EVENT);
+        connection_->OnAccessibilityEvent(eventInfo);
+        connection_->OnAccessibilityEvent(eventInfo);
+        EventBatchStats stats = connection_->GetEventBatchStats();
+        EXPECT_EQ(0, static_cast<int>(stats.receivedCount));
+        EXPECT_EQ(0, static_cast<int>(stats.coalescedCount));
+        EXPECT_EQ(0, static_cast<int>(stats.batchCount));
+    }
+    GTEST_LOG_(INFO) << "AccessibleAbilityConnection_Unittest_GetEventBatchStats_001 end";
+}
+
+/**
+ * @tc.number: AccessibleAbilityConnection_Unittest_EventBatch_001
+ * @tc.name: OnAccessibilityEvent
+ * @tc.desc: Test the newest coalesced event replaces the pending one at the end of the batch.
+ */
+HWTEST_F(AccessibleAbilityConnectionUnitTest, AccessibleAbilityConnection_Unittest_EventBatch_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityConnection_Unittest_EventBatch_001 start";
+    if (connection_ != nullptr) {
+        connection_->SetEventBatchInterval(EVENT_BATCH_INTERVAL);
+        AccessibilityAbilityHelper::GetInstance().ClearEventTypeActionVector();
+        RunOnMainRunner([this]() {
+            AccessibilityEventInfo scrollEvent = CreateEventInfo(EventType::TYPE_VIEW_SCROLLED_EVENT, ELEMENT_ID_1);
+            AccessibilityEventInfo textEvent = CreateEventInfo(EventType::TYPE_VIEW_TEXT_UPDATE_EVENT, ELEMENT_ID_2);
+            AccessibilityEventInfo clickEvent = CreateEventInfo(EventType::TYPE_VIEW_CLICKED_EVENT, ELEMENT_ID_2);
+            connection_->OnAccessibilityEvent(scrollEvent);
+            connection_->OnAccessibilityEvent(textEvent);
+            connection_->OnAccessibilityEvent(scrollEvent);
+            EXPECT_TRUE(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().empty());
+            // a non coalescible event flushes the batch before it is delivered
+            connection_->OnAccessibilityEvent(clickEvent);
+        });
+        std::vector<EventType> expected = {EventType::TYPE_VIEW_TEXT_UPDATE_EVENT,
+            EventType::TYPE_VIEW_SCROLLED_EVENT, EventType::TYPE_VIEW_CLICKED_EVENT};
+        EXPECT_EQ(expected, AccessibilityAbilityHelper::GetInstance().GetEventTypeVector());
+        EventBatchStats stats = connection_->GetEventBatchStats();
+        EXPECT_EQ(4, static_cast<int>(stats.receivedCount));
+        EXPECT_EQ(1, static_cast<int>(stats.coalescedCount));
+        EXPECT_EQ(3, static_cast<int>(stats.deliveredCount));
+        EXPECT_EQ(1, static_cast<int>(stats.batchCount));
+        connection_->SetEventBatchInterval(0);
+    }
+    GTEST_LOG_(INFO) << "AccessibleAbilityConnection_Unittest_EventBatch_001 end";
+}
+
+/**
+ * @tc.number: AccessibleAbilityConnection_Unittest_EventBatch_002
+ * @tc.name: OnAccessibilityEvent
+ * @tc.desc: Test the pending events are flushed when the batch interval expires.
+ */
+HWTEST_F(AccessibleAbilityConnectionUnitTest, AccessibleAbilityConnection_Unittest_EventBatch_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityConnection_Unittest_EventBatch_002 start";
+    if (connection_ != nullptr) {
+        connection_->SetEventBatchInterval(SHORT_EVENT_BATCH_INTERVAL);
+        AccessibilityAbilityHelper::GetInstance().ClearEventTypeActionVector();
+        RunOnMainRunner([this]() {
+            AccessibilityEventInfo scrollEvent = CreateEventInfo(EventType::TYPE_VIEW_SCROLLED_EVENT, ELEMENT_ID_1);
+            connection_->OnAccessibilityEvent(scrollEvent);
+        });
+        bool ret = AccessibilityCommonHelper::GetInstance().WaitForLoop(std::bind([]() -> bool {
+            return AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().size() == 1;
+            }), 1);
+        EXPECT_TRUE(ret);
+        EventBatchStats stats = connection_->GetEventBatchStats();
+        EXPECT_EQ(1, static_cast<int>(stats.deliveredCount));
+        EXPECT_EQ(1, static_cast<int>(stats.batchCount));
+        connection_->SetEventBatchInterval(0);
+    }
+    GTEST_LOG_(INFO) << "AccessibleAbilityConnection_Unittest_EventBatch_002 end";
+}
+
+/**
+ * @tc.number: AccessibleAbilityConnection_Unittest_EventBatch_003
+ * @tc.name: OnAccessibilityEvent
+ * @tc.desc: Test a full batch is flushed at once without waiting for the batch interval.
+ */
+HWTEST_F(AccessibleAbilityConnectionUnitTest, AccessibleAbilityConnection_Unittest_EventBatch_003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityConnection_Unittest_EventBatch_003 start";
+    if (connection_ != nullptr) {
+        connection_->SetEventBatchInterval(EVENT_BATCH_INTERVAL);
+        AccessibilityAbilityHelper::GetInstance().ClearEventTypeActionVector();
+        RunOnMainRunner([this]() {
+            for (int32_t i = 0; i < MAX_EVENT_BATCH_SIZE; i++) {
+                AccessibilityEventInfo scrollEvent = CreateEventInfo(EventType::TYPE_VIEW_SCROLLED_EVENT, i);
+                connection_->OnAccessibilityEvent(scrollEvent);
+            }
+            EXPECT_EQ(MAX_EVENT_BATCH_SIZE,
+                static_cast<int>(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().size()));
+        });
+        EventBatchStats stats = connection_->GetEventBatchStats();
+        EXPECT_EQ(0, static_cast<int>(stats.coalescedCount));
+        EXPECT_EQ(MAX_EVENT_BATCH_SIZE, static_cast<int>(stats.deliveredCount));
+        EXPECT_EQ(1, static_cast<int>(stats.batchCount));
+        connection_->SetEventBatchInterval(0);
+    }
+    GTEST_LOG_(INFO) << "AccessibleAbilityConnection_Unittest_EventBatch_003 end";
+}
+
+/**
+ * @tc.number: AccessibleAbilityConnection_Unittest_SetEventBatchInterval_001
+ * @tc.name: SetEventBatchInterval
+ * @tc.desc: Test the pending events are flushed when batching is disabled.
+ */
+HWTEST_F(AccessibleAbilityConnectionUnitTest,
+    AccessibleAbilityConnection_Unittest_SetEventBatchInterval_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibleAbilityConnection_Unittest_SetEventBatchInterval_001 start";
+    if (connection_ != nullptr) {
+        connection_->SetEventBatchInterval(EVENT_BATCH_INTERVAL);
+        AccessibilityAbilityHelper::GetInstance().ClearEventTypeActionVector();
+        RunOnMainRunner([this]() {
+            AccessibilityEventInfo scrollEvent = CreateEventInfo(EventType::TYPE_VIEW_SCROLLED_EVENT, ELEMENT_ID_1);
+            connection_->OnAccessibilityEvent(scrollEvent);
+            EXPECT_TRUE(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().empty());
+            connection_->SetEventBatchInterval(0);
+            EXPECT_EQ(1, static_cast<int>(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().size()));
+
+            // batching is disabled, the event is delivered directly
+            connection_->OnAccessibilityEvent(scrollEvent);
+            EXPECT_EQ(2, static_cast<int>(AccessibilityAbilityHelper::GetInstance().GetEventTypeVector().size()));
+        });
+        EventBatchStats stats = connection_->GetEventBatchStats();
+        EXPECT_EQ(1, static_cast<int>(stats.receivedCount));
+        EXPECT_EQ(1, static_cast<int>(stats.batchCount));
+    }
+    GTEST_LOG_(INFO) << "AccessibleAbilityConnection_Unittest_SetEventBatchInterval_001 end";
+}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
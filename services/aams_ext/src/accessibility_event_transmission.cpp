@@ -21,8 +21,9 @@ namespace OHOS {
 namespace Accessibility {
 bool EventTransmission::OnKeyEvent(MMI::KeyEvent &event)
 {
-    HILOG_DEBUG();
-
+    if (boundKeyHop_ != nullptr) {
+        return boundKeyHop_(*next_, event);
+    }
     auto next = GetNext();
     if (next != nullptr) {
         return next->OnKeyEvent(event);
@@ -32,8 +33,9 @@ bool EventTransmission::OnKeyEvent(MMI::KeyEvent &event)
 
 bool EventTransmission::OnPointerEvent(MMI::PointerEvent &event)
 {
-    HILOG_DEBUG();
-
+    if (boundPointerHop_ != nullptr) {
+        return boundPointerHop_(*next_, event);
+    }
     auto next = GetNext();
     if (next != nullptr) {
         return next->OnPointerEvent(event);
@@ -56,12 +58,12 @@ void EventTransmission::SetNext(const sptr<EventTransmission> &next)
     HILOG_DEBUG();
 
     next_ = next;
+    boundKeyHop_ = nullptr;
+    boundPointerHop_ = nullptr;
 }
 
 sptr<EventTransmission> EventTransmission::GetNext()
 {
-    HILOG_DEBUG();
-
     return next_;
 }
 
@@ -14,6 +14,9 @@
  */
 
 #include "accessibility_input_interceptor.h"
+
+#include <thread>
+#include "accessibility_event_pipeline.h"
 #include "accessibility_keyevent_filter.h"
 #include "accessibility_mouse_autoclick.h"
 #include "accessibility_short_key.h"
@@ -165,6 +168,7 @@ void AccessibilityInputInterceptor::SetAvailableFunctions(uint32_t availableFunc
 
 void AccessibilityInputInterceptor::CreateTransmitters()
 {
+    std::lock_guard<ffrt::mutex> lock(mutex_);
     HILOG_DEBUG("function[%{public}u].", availableFunctions_);
 
     if (!availableFunctions_) {
@@ -174,25 +178,33 @@ void AccessibilityInputInterceptor::CreateTransmitters()
     if ((availableFunctions_ & FEATURE_MOUSE_KEY) && (!mouseKey_)) {
         mouseKey_ = new(std::nothrow) AccessibilityMouseKey();
         if (mouseKey_) {
-            mouseKey_->SetNext(instance_);
+            mouseKey_->BindNext(instance_);
         }
     }
 
+    // the chain is only linked here, it is not changed after it is published
+    std::shared_ptr<TransmitterChain> chain = std::make_shared<TransmitterChain>();
+    chain->mouseKey = mouseKey_;
     if ((availableFunctions_ & FEATURE_MOUSE_AUTOCLICK) ||
         (availableFunctions_ & FEATURE_INJECT_TOUCH_EVENTS) ||
         (availableFunctions_ & FEATURE_TOUCH_EXPLORATION) ||
         (availableFunctions_ & FEATURE_SCREEN_MAGNIFICATION) ||
         (availableFunctions_ & FEATURE_SCREEN_TOUCH)) {
-        CreatePointerEventTransmitters();
+        CreatePointerEventTransmitters(*chain);
     }
     
     if (availableFunctions_ & FEATURE_FILTER_KEY_EVENTS) {
-        CreateKeyEventTransmitters();
+        CreateKeyEventTransmitters(*chain);
     }
+    std::atomic_store(&transmitters_, std::shared_ptr<const TransmitterChain>(chain));
 }
 
-void AccessibilityInputInterceptor::CreatePointerEventTransmitters()
+void AccessibilityInputInterceptor::CreatePointerEventTransmitters(TransmitterChain &chain)
 {
+    if (CreateCompiledPointerEventTransmitters(chain)) {
+        return;
+    }
+
     sptr<EventTransmission> header = nullptr;
     sptr<EventTransmission> current = nullptr;
     if (availableFunctions_& FEATURE_MOUSE_AUTOCLICK) {
@@ -236,7 +248,51 @@ void AccessibilityInputInterceptor::CreatePointerEventTransmitters()
         SetNextEventTransmitter(header, current, screenTouch_);
     }
     SetNextEventTransmitter(header, current, instance_);
-    pointerEventTransmitters_ = header;
+    chain.pointerEventTransmitters = header;
+}
+
+bool AccessibilityInputInterceptor::CreateCompiledPointerEventTransmitters(TransmitterChain &chain)
+{
+    // touch exploration turns the screen touch off, the other combinations take the dynamic chain
+    uint32_t pointerFunctions = availableFunctions_ & (FEATURE_MOUSE_AUTOCLICK | FEATURE_INJECT_TOUCH_EVENTS |
+        FEATURE_SCREEN_MAGNIFICATION | FEATURE_TOUCH_EXPLORATION);
+    if (pointerFunctions != FEATURE_TOUCH_EXPLORATION &&
+        pointerFunctions != (FEATURE_SCREEN_MAGNIFICATION | FEATURE_TOUCH_EXPLORATION)) {
+        return false;
+    }
+
+    if (pointerFunctions & FEATURE_SCREEN_MAGNIFICATION) {
+        sptr<EventTransmission> header = nullptr;
+        sptr<EventTransmission> current = nullptr;
+        CreateMagnificationGesture(header, current);
+        if (zoomGesture_ == nullptr) {
+            return false;
+        }
+    } else {
+        ClearMagnificationGesture();
+    }
+    sptr<TouchExploration> touchExploration = new(std::nothrow) TouchExploration();
+    if (!touchExploration) {
+        HILOG_ERROR("touchExploration is null");
+        return false;
+    }
+    touchExploration->StartUp();
+
+    sptr<EventTransmission> pipeline = nullptr;
+    if (zoomGesture_ != nullptr) {
+        pipeline = new(std::nothrow) EventPipeline<AccessibilityInputInterceptor, AccessibilityZoomGesture,
+            TouchExploration>(instance_, zoomGesture_, touchExploration);
+    } else {
+        pipeline = new(std::nothrow) EventPipeline<AccessibilityInputInterceptor, TouchExploration>(instance_,
+            touchExploration);
+    }
+    if (!pipeline) {
+        HILOG_ERROR("pipeline is null");
+        return false;
+    }
+    HILOG_INFO("compiled pointer pipeline, function[%{public}u].", pointerFunctions);
+    chain.pointerEventTransmitters = pipeline;
+    return true;
 }
 
 RetError AccessibilityInputInterceptor::InjectEvents(const std::shared_ptr<AccessibilityGestureInjectPath>& gesturePath)
@@ -326,7 +382,7 @@ void AccessibilityInputInterceptor::ClearMagnificationGesture()
     zoomGesture_ = nullptr;
 }
 
-void AccessibilityInputInterceptor::CreateKeyEventTransmitters()
+void AccessibilityInputInterceptor::CreateKeyEventTransmitters(TransmitterChain &chain)
 {
     HILOG_DEBUG();
 
@@ -344,7 +400,7 @@ void AccessibilityInputInterceptor::CreateKeyEventTransmitters()
     }
 
     SetNextEventTransmitter(header, current, instance_);
-    keyEventTransmitters_ = header;
+    chain.keyEventTransmitters = header;
 }
 
 void AccessibilityInputInterceptor::UpdateInterceptor()
@@ -400,23 +456,33 @@ void AccessibilityInputInterceptor::DestroyTransmitters()
     std::lock_guard<ffrt::mutex> lock(mutex_);
     HILOG_DEBUG();
 
+    // no input event loads the chain any more, the events still running it are waited for before their
+    // transmitters are destroyed
+    std::shared_ptr<const TransmitterChain> transmitters =
+        std::atomic_exchange(&transmitters_, std::shared_ptr<const TransmitterChain>(nullptr));
+    while (transmitters != nullptr && transmitters.use_count() > 1) {
+        std::this_thread::yield();
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
     if ((availableFunctions_ & FEATURE_MOUSE_KEY) != FEATURE_MOUSE_KEY) {
         if (mouseKey_) {
             mouseKey_->DestroyEvents();
             mouseKey_ = nullptr;
         }
     }
+    if (transmitters == nullptr) {
+        return;
+    }
 
-    if (pointerEventTransmitters_ != nullptr) {
-        pointerEventTransmitters_->DestroyEvents();
+    if (transmitters->pointerEventTransmitters != nullptr) {
+        transmitters->pointerEventTransmitters->DestroyEvents();
         Singleton<ExtendServiceManager>::GetInstance().SetTouchEventInjector(nullptr);
-        pointerEventTransmitters_= nullptr;
         zoomGesture_ = nullptr;
     }
-    if (keyEventTransmitters_ != nullptr) {
-        keyEventTransmitters_->DestroyEvents();
+    if (transmitters->keyEventTransmitters != nullptr) {
+        transmitters->keyEventTransmitters->DestroyEvents();
         keyEventFilter_ = nullptr;
-        keyEventTransmitters_ = nullptr;
     }
 }
 
@@ -447,11 +513,12 @@ void AccessibilityInputInterceptor::GetScreenShotUID()
 
 void AccessibilityInputInterceptor::ProcessPointerEvent(std::shared_ptr<MMI::PointerEvent> event)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
     HILOG_DEBUG();
 
-    if (mouseKey_) {
-        mouseKey_->OnPointerEvent(*event);
+    // the chain is held until the event returns, DestroyTransmitters waits for it
+    std::shared_ptr<const TransmitterChain> transmitters = std::atomic_load(&transmitters_);
+    if (transmitters != nullptr && transmitters->mouseKey) {
+        transmitters->mouseKey->OnPointerEvent(*event);
     }
     if (event->GetCallingUid() > 0) {
         if (screenShotUid_ == INVALID_UID) {
@@ -469,35 +536,35 @@ void AccessibilityInputInterceptor::ProcessPointerEvent(std::shared_ptr<MMI::Poi
         }
     }
 
-    if (!pointerEventTransmitters_) {
-        HILOG_DEBUG("pointerEventTransmitters_ is empty.");
+    if (transmitters == nullptr || !transmitters->pointerEventTransmitters) {
+        HILOG_DEBUG("pointerEventTransmitters is empty.");
         const_cast<AccessibilityInputInterceptor*>(this)->OnPointerEvent(*event);
         return;
     }
 
-    pointerEventTransmitters_->OnPointerEvent(*event);
+    transmitters->pointerEventTransmitters->OnPointerEvent(*event);
 }
 
 void AccessibilityInputInterceptor::ProcessKeyEvent(std::shared_ptr<MMI::KeyEvent> event)
 {
-    std::lock_guard<ffrt::mutex> lock(mutex_);
     HILOG_DEBUG();
 
-    if (mouseKey_) {
-        bool result = mouseKey_->OnKeyEvent(*event);
+    std::shared_ptr<const TransmitterChain> transmitters = std::atomic_load(&transmitters_);
+    if (transmitters != nullptr && transmitters->mouseKey) {
+        bool result = transmitters->mouseKey->OnKeyEvent(*event);
         if (result) {
             HILOG_DEBUG("The event is mouse key event.");
             return;
         }
     }
 
-    if (!keyEventTransmitters_) {
-        HILOG_DEBUG("keyEventTransmitters_ is empty.");
+    if (transmitters == nullptr || !transmitters->keyEventTransmitters) {
+        HILOG_DEBUG("keyEventTransmitters is empty.");
         const_cast<AccessibilityInputInterceptor*>(this)->OnKeyEvent(*event);
         return;
     }
 
-    keyEventTransmitters_->OnKeyEvent(*event);
+    transmitters->keyEventTransmitters->OnKeyEvent(*event);
 }
 
 void AccessibilityInputInterceptor::SetNextEventTransmitter(sptr<EventTransmission> &header,
@@ -134,16 +134,25 @@ void AccessibilityZoomGesture::StartMagnificationInteract()
     zoomState_ = ZOOM;
 }
 
-bool AccessibilityZoomGesture::IsDownValid(std::shared_ptr<MMI::PointerEvent> curEvent,
-    std::shared_ptr<MMI::PointerEvent> lastEvent)
+bool AccessibilityZoomGesture::IsDownValid(const GesturePoint &lastPoint, MMI::PointerEvent &event)
 {
-    return CalcSeparationDistance(*curEvent, *lastEvent) <= multiTapDistance_;
+    return CalcSeparationDistance(lastPoint, event) <= multiTapDistance_;
 }
 
-bool AccessibilityZoomGesture::IsMoveValid(std::shared_ptr<MMI::PointerEvent> curEvent,
-    std::shared_ptr<MMI::PointerEvent> lastEvent)
+bool AccessibilityZoomGesture::IsMoveValid(const GesturePoint &lastPoint, MMI::PointerEvent &event)
 {
-    return CalcSeparationDistance(*curEvent, *lastEvent) <= tapDistance_;
+    return CalcSeparationDistance(lastPoint, event) <= tapDistance_;
+}
+
+AccessibilityZoomGesture::GesturePoint AccessibilityZoomGesture::MakeGesturePoint(MMI::PointerEvent &event)
+{
+    MMI::PointerEvent::PointerItem item;
+    event.GetPointerItem(event.GetPointerId(), item);
+    GesturePoint point;
+    point.displayX = item.GetDisplayX();
+    point.displayY = item.GetDisplayY();
+    point.isValid = true;
+    return point;
 }
 
 bool AccessibilityZoomGesture::OnPointerEvent(MMI::PointerEvent &event)
@@ -388,8 +397,7 @@ void AccessibilityZoomGesture::TransferState(int32_t state)
 void AccessibilityZoomGesture::CacheEvents(MMI::PointerEvent &event)
 {
     HILOG_DEBUG();
-    std::shared_ptr<MMI::PointerEvent> pointerEvent = std::make_shared<MMI::PointerEvent>(event);
-    cacheEvents_.emplace_back(pointerEvent);
+    cacheEvents_.Push(event);
 }
 
 void AccessibilityZoomGesture::SendCacheEventsToNext()
@@ -400,68 +408,69 @@ void AccessibilityZoomGesture::SendCacheEventsToNext()
         HILOG_ERROR("fullScreenManager_ is nullptr.");
         return;
     }
-    bool isMagnificationWindowShow = fullScreenManager_->IsMagnificationWindowShow();
-    for (auto &pointerEvent : cacheEvents_) {
-        SendEventToMultimodal(*pointerEvent);
-    }
+    cacheEvents_.ForEach([this](MMI::PointerEvent &pointerEvent) { SendEventToMultimodal(pointerEvent); });
     ClearCacheEventsAndMsg();
 }
 
-void AccessibilityZoomGesture::SendEventToMultimodal(MMI::PointerEvent event)
+void AccessibilityZoomGesture::SendEventToMultimodal(MMI::PointerEvent &event)
 {
     if (fullScreenManager_ == nullptr) {
         HILOG_ERROR("fullScreenManager_ is nullptr.");
         return;
     }
-    
-    if (zoomState_ == ZOOM) {
-        if (magnificationMode_ == FULL_SCREEN_MAGNIFICATION && fullScreenManager_->IsMagnificationWindowShow()) {
-            MMI::PointerEvent::PointerItem pointer {};
-        event.GetPointerItem(event.GetPointerId(), pointer);
 
-            PointerPos coordinates = fullScreenManager_->ConvertCoordinates(pointer.GetDisplayX(),
-                pointer.GetDisplayY());
+    // the pointer is converted in place and restored after the event is sent, the sender may send it again
+    int32_t pointerId = event.GetPointerId();
+    MMI::PointerEvent::PointerItem originPointer {};
+    bool hasPointer = event.GetPointerItem(pointerId, originPointer);
+    float originZOrder = event.GetZOrder();
+    int64_t originActionTime = event.GetActionTime();
+    bool isConverted = false;
+    if (hasPointer && zoomState_ == ZOOM) {
+        PointerPos coordinates = {originPointer.GetDisplayX(), originPointer.GetDisplayY()};
+        if (magnificationMode_ == FULL_SCREEN_MAGNIFICATION && fullScreenManager_->IsMagnificationWindowShow()) {
+            coordinates = fullScreenManager_->ConvertCoordinates(coordinates.posX, coordinates.posY);
             if (gestureType_ != INVALID_GESTURE_TYPE) {
                 coordinates = fullScreenManager_->ConvertGesture(gestureType_, coordinates);
             }
+            isConverted = true;
+        }
+        if (magnificationMode_ != FULL_SCREEN_MAGNIFICATION &&
+            windowMagnificationManager_->IsMagnificationWindowShow() &&
+            windowMagnificationManager_->IsTapOnMagnificationWindow(coordinates.posX, coordinates.posY) &&
+            !windowMagnificationManager_->IsTapOnHotArea(coordinates.posX, coordinates.posY)) {
+            HILOG_ERROR("need convert pos");
+            coordinates = windowMagnificationManager_->ConvertCoordinates(coordinates.posX, coordinates.posY);
+            isConverted = true;
+        }
+        if (isConverted) {
+            MMI::PointerEvent::PointerItem pointer = originPointer;
             pointer.SetDisplayX(coordinates.posX);
             pointer.SetDisplayY(coordinates.posY);
             pointer.SetTargetWindowId(-1);
-        event.RemovePointerItem(event.GetPointerId());
-        event.AddPointerItem(pointer);
-        event.SetZOrder(10000); // magnification zlevel is 10000
-        }
-        if (magnificationMode_ != FULL_SCREEN_MAGNIFICATION &&
-            windowMagnificationManager_->IsMagnificationWindowShow()) {
-            MMI::PointerEvent::PointerItem pointer {};
-            event.GetPointerItem(event.GetPointerId(), pointer);
-            if (windowMagnificationManager_->IsTapOnMagnificationWindow(pointer.GetDisplayX(), pointer.GetDisplayY()) &&
-                !windowMagnificationManager_->IsTapOnHotArea(pointer.GetDisplayX(), pointer.GetDisplayY())) {
-                HILOG_ERROR("need convert pos");
-                PointerPos coordinates = windowMagnificationManager_->ConvertCoordinates(pointer.GetDisplayX(),
-                    pointer.GetDisplayY());
-                pointer.SetDisplayX(coordinates.posX);
-                pointer.SetDisplayY(coordinates.posY);
-                pointer.SetTargetWindowId(-1);
-                event.RemovePointerItem(event.GetPointerId());
-                event.AddPointerItem(pointer);
-                event.SetZOrder(10000); // magnification zlevel is 10000
+            event.UpdatePointerItem(pointerId, pointer);
+            event.SetZOrder(10000); // magnification zlevel is 10000
         }
     }
-}
     event.SetActionTime(ExtUtils::GetSystemTime() * US_TO_MS);
     EventTransmission::OnPointerEvent(event);
+
+    if (isConverted) {
+        event.UpdatePointerItem(pointerId, originPointer);
+        event.SetZOrder(originZOrder);
+    }
+    event.SetActionTime(originActionTime);
 }
 
 void AccessibilityZoomGesture::ClearCacheEventsAndMsg()
 {
     HILOG_DEBUG();
 
-    cacheEvents_.clear();
-    lastDownEvent_ = nullptr;
-    lastTripleTapEvents_[POINTER_ID_0] = nullptr;
-    lastTripleTapEvents_[POINTER_ID_1] = nullptr;
-    lastTripleTapEvents_[POINTER_ID_2] = nullptr;
+    cacheEvents_.Clear();
+    lastDownPoint_ = {};
+    lastTripleTapPoints_[POINTER_ID_0] = {};
+    lastTripleTapPoints_[POINTER_ID_1] = {};
+    lastTripleTapPoints_[POINTER_ID_2] = {};
     gestureType_ = INVALID_GESTURE_TYPE;
     bool isTapOnMenu_ = false;
     bool isTapOnWindowHotArea_ = false;
@@ -650,15 +659,12 @@ float AccessibilityZoomGesture::CalcSeparationDistance(MMI::PointerEvent &event)
     return distance;
 }
 
-float AccessibilityZoomGesture::CalcSeparationDistance(MMI::PointerEvent &firstEvent,
-    MMI::PointerEvent &secondEvent)
+float AccessibilityZoomGesture::CalcSeparationDistance(const GesturePoint &point, MMI::PointerEvent &event)
 {
-    MMI::PointerEvent::PointerItem firstItem;
-    MMI::PointerEvent::PointerItem secondItem;
-    firstEvent.GetPointerItem(firstEvent.GetPointerId(), firstItem);
-    secondEvent.GetPointerItem(secondEvent.GetPointerId(), secondItem);
-    int32_t durationX = secondItem.GetDisplayX() - firstItem.GetDisplayX();
-    int32_t durationY = secondItem.GetDisplayY() - firstItem.GetDisplayY();
+    MMI::PointerEvent::PointerItem item;
+    event.GetPointerItem(event.GetPointerId(), item);
+    int32_t durationX = item.GetDisplayX() - point.displayX;
+    int32_t durationY = item.GetDisplayY() - point.displayY;
     float distance = static_cast<float>(hypot(durationX, durationY));
     HILOG_DEBUG("distance:%{public}f", distance);
     return distance;
@@ -686,22 +692,16 @@ void AccessibilityZoomGesture::ZoomGestureEventHandler::ProcessEvent(const AppEx
             {
             zoomGesture_.TransferState(HOLD);
             if (zoomGesture_.gestureMode_ == SINGLE_FINGER_TRIPLE_TAP_MODE) {
-                int32_t pointerId = zoomGesture_.lastDownEvent_->GetPointerId();
-                MMI::PointerEvent::PointerItem item;
-                zoomGesture_.lastDownEvent_->GetPointerItem(pointerId, item);
-                int32_t anchorX = item.GetDisplayX();
-                int32_t anchorY = item.GetDisplayY();
+                int32_t anchorX = zoomGesture_.lastDownPoint_.displayX;
+                int32_t anchorY = zoomGesture_.lastDownPoint_.displayY;
                 HILOG_DEBUG("anchorX:%{private}d, anchorY:%{private}d.", anchorX, anchorY);
                 zoomGesture_.OnZoom(anchorX, anchorY, false);
             } else {
                 int32_t anchorX = 0;
                 int32_t anchorY = 0;
                 for (int i = 0; i < POINTER_COUNT_3; i++) {
-                    MMI::PointerEvent::PointerItem pointerItem;
-                    zoomGesture_.lastTripleTapEvents_[i]->GetPointerItem(
-                        zoomGesture_.lastTripleTapEvents_[i]->GetPointerId(), pointerItem);
-                    anchorX += pointerItem.GetDisplayX();
-                    anchorY += pointerItem.GetDisplayY();
+                    anchorX += zoomGesture_.lastTripleTapPoints_[i].displayX;
+                    anchorY += zoomGesture_.lastTripleTapPoints_[i].displayY;
                 }
                 zoomGesture_.OnZoom(anchorX / POINTER_COUNT_3, anchorY / POINTER_COUNT_3, false);
             }
@@ -731,11 +731,8 @@ void AccessibilityZoomGesture::ZoomGestureEventHandler::ProcessEvent(const AppEx
                     int32_t anchorX = 0;
                     int32_t anchorY = 0;
                     for (int i = 0; i < POINTER_COUNT_3; i++) {
-                        MMI::PointerEvent::PointerItem pointerItem;
-                        zoomGesture_.lastTripleTapEvents_[i]->GetPointerItem(
-                            zoomGesture_.lastTripleTapEvents_[i]->GetPointerId(), pointerItem);
-                        anchorX += pointerItem.GetDisplayX();
-                        anchorY += pointerItem.GetDisplayY();
+                        anchorX += zoomGesture_.lastTripleTapPoints_[i].displayX;
+                        anchorY += zoomGesture_.lastTripleTapPoints_[i].displayY;
                     }
                     zoomGesture_.OnZoom(anchorX / POINTER_COUNT_3, anchorY / POINTER_COUNT_3, true);
                 } else if (zoomGesture_.zoomState_ == ZOOM) {
@@ -926,7 +923,7 @@ void AccessibilityZoomGesture::HandleSTReadyInitStateDown(MMI::PointerEvent &eve
         return;
     }
 
-    lastDownEvent_ = std::make_shared<MMI::PointerEvent>(event);
+    lastDownPoint_ = MakeGesturePoint(event);
     singleFingerTapCount_ = 0;
     zoomGestureEventHandler_->SendEvent(MULTI_TAP_MSG, 0, MULTI_TAP_TIMER);
     TransferState(ONE_FINGER_DOWN);
@@ -966,7 +963,7 @@ void AccessibilityZoomGesture::HandleSTReadyOneFingerDownStateMove(MMI::PointerE
     CacheEvents(event);
 
     size_t pointerCount = event.GetPointerIds().size();
-    if (pointerCount != 1 || !IsMoveValid(lastDownEvent_, std::make_shared<MMI::PointerEvent>(event))) {
+    if (pointerCount != 1 || !IsMoveValid(lastDownPoint_, event)) {
         SendCacheEventsToNext();
         TransferState(INIT);
         return;
@@ -980,13 +977,13 @@ void AccessibilityZoomGesture::HandleSTReadyOneFingerTapStateDown(MMI::PointerEv
 
     zoomGestureEventHandler_->RemoveEvent(MULTI_TAP_MSG);
     size_t pointerCount = event.GetPointerIds().size();
-    if (pointerCount != 1 || !IsDownValid(lastDownEvent_, std::make_shared<MMI::PointerEvent>(event))) {
+    if (pointerCount != 1 || !IsDownValid(lastDownPoint_, event)) {
         SendCacheEventsToNext();
         TransferState(INIT);
         return;
     }
 
-    lastDownEvent_ = std::make_shared<MMI::PointerEvent>(event);
+    lastDownPoint_ = MakeGesturePoint(event);
     TransferState(ONE_FINGER_DOWN);
     if (singleFingerTapCount_ == DOUBLE_TAP_COUNT) {
         zoomGestureEventHandler_->SendEvent(HOLDING_MSG, 0, LONG_PRESS_TIMER);
@@ -1018,8 +1015,8 @@ void AccessibilityZoomGesture::HandleSTZoomInitStateDown(MMI::PointerEvent &even
     }
     isTapOnMenu_ = menuManager_->IsTapOnMenu(pointerItem.GetDisplayX(), pointerItem.GetDisplayY());
 
-    lastDownEvent_ = std::make_shared<MMI::PointerEvent>(event);
-    lastTripleTapEvents_[POINTER_ID_0] = std::make_shared<MMI::PointerEvent>(event);
+    lastDownPoint_ = MakeGesturePoint(event);
+    lastTripleTapPoints_[POINTER_ID_0] = MakeGesturePoint(event);
     singleFingerTapCount_ = 0;
     if (isTapOnWindowHotArea_) {
         zoomGestureEventHandler_->SendEvent(HOT_AREA_SLIDING_MSG, 0, MULTI_FINGER_TAP_INTERVAL_TIMER);
@@ -1057,7 +1054,7 @@ void AccessibilityZoomGesture::HandleSTZoomOneFingerDownStateDown(MMI::PointerEv
         TransferState(PASSING_THROUGH);
         return;
     }
-    lastTripleTapEvents_[POINTER_ID_1] = std::make_shared<MMI::PointerEvent>(event);
+    lastTripleTapPoints_[POINTER_ID_1] = MakeGesturePoint(event);
     if (magnificationMode_ == FULL_SCREEN_MAGNIFICATION || isTapOnWindow_) {
         zoomGestureEventHandler_->SendEvent(TWO_FINGER_SLIDING_MSG, 0, MULTI_FINGER_TAP_INTERVAL_TIMER);
         CalcFocusCoordinate(event, lastCenter);
@@ -1107,7 +1104,7 @@ void AccessibilityZoomGesture::HandleSTZoomOneFingerDownStateMove(MMI::PointerEv
     CacheEvents(event);
 
     size_t pointerCount = event.GetPointerIds().size();
-    if (pointerCount != 1 || !IsMoveValid(lastDownEvent_, std::make_shared<MMI::PointerEvent>(event))) {
+    if (pointerCount != 1 || !IsMoveValid(lastDownPoint_, event)) {
         if (isTapOnWindowHotArea_) {
             ClearCacheEventsAndMsg();
             TransferState(HOT_AREA_SLIDING);
@@ -1134,7 +1131,7 @@ void AccessibilityZoomGesture::HandleSTZoomTwoFingerDownStateMove(MMI::PointerEv
         return;
         }
     int32_t pId = event.GetPointerId();
-    if (pId > POINTER_ID_2 || IsMoveValid(lastTripleTapEvents_[pId], std::make_shared<MMI::PointerEvent>(event))) {
+    if (pId > POINTER_ID_2 || IsMoveValid(lastTripleTapPoints_[pId], event)) {
         return;
     }
     zoomGestureEventHandler_->RemoveEvent(TWO_FINGER_SLIDING_MSG);
@@ -1152,13 +1149,13 @@ void AccessibilityZoomGesture::HandleSTZoomOneFingerTapStateDown(MMI::PointerEve
     CacheEvents(event);
     zoomGestureEventHandler_->RemoveEvent(MULTI_TAP_MSG);
     size_t pointerCount = event.GetPointerIds().size();
-    if (pointerCount != 1 || !IsDownValid(lastDownEvent_, std::make_shared<MMI::PointerEvent>(event))) {
+    if (pointerCount != 1 || !IsDownValid(lastDownPoint_, event)) {
         SendCacheEventsToNext();
         TransferState(INIT);
         return;
     }
 
-    lastDownEvent_ = std::make_shared<MMI::PointerEvent>(event);
+    lastDownPoint_ = MakeGesturePoint(event);
     TransferState(ONE_FINGER_DOWN);
     zoomGestureEventHandler_->SendEvent(MULTI_TAP_MSG, 0, MULTI_TAP_TIMER);
 }
@@ -1221,7 +1218,7 @@ void AccessibilityZoomGesture::HandleTDReadyInitStateDown(MMI::PointerEvent &eve
         return;
     }
 
-    lastTripleTapEvents_[0] = std::make_shared<MMI::PointerEvent>(event);
+    lastTripleTapPoints_[0] = MakeGesturePoint(event);
     zoomGestureEventHandler_->SendEvent(WAIT_ANOTHER_FINGER_DOWN_MSG, 0, MULTI_FINGER_TAP_INTERVAL_TIMER);
     TransferState(ONE_FINGER_DOWN);
 }
@@ -1240,7 +1237,7 @@ void AccessibilityZoomGesture::HandleTDReadyOneFingerDownStateDown(MMI::PointerE
         return;
     }
 
-    lastTripleTapEvents_[POINTER_COUNT_1] = std::make_shared<MMI::PointerEvent>(event);
+    lastTripleTapPoints_[POINTER_COUNT_1] = MakeGesturePoint(event);
     zoomGestureEventHandler_->SendEvent(WAIT_ANOTHER_FINGER_DOWN_MSG, 0, MULTI_FINGER_TAP_INTERVAL_TIMER);
     TransferState(TWO_FINGER_DOWN);
 }
@@ -1250,7 +1247,7 @@ void AccessibilityZoomGesture::HandleTDReadyOneFingerDownStateMove(MMI::PointerE
     HILOG_DEBUG();
     CacheEvents(event);
     int32_t pId = event.GetPointerId();
-    if (pId > POINTER_COUNT_2 || !IsMoveValid(lastTripleTapEvents_[pId], std::make_shared<MMI::PointerEvent>(event))) {
+    if (pId > POINTER_COUNT_2 || !IsMoveValid(lastTripleTapPoints_[pId], event)) {
         TransferState(PASSING_THROUGH);
         SendCacheEventsToNext();
     }
@@ -1270,7 +1267,7 @@ void AccessibilityZoomGesture::HandleTDReadyTwoFingersDownStateDown(MMI::Pointer
         return;
     }
 
-    lastTripleTapEvents_[POINTER_COUNT_2] = std::make_shared<MMI::PointerEvent>(event);
+    lastTripleTapPoints_[POINTER_COUNT_2] = MakeGesturePoint(event);
     zoomGestureEventHandler_->SendEvent(MULTI_TAP_MSG, 0, MULTI_TAP_TIMER);
     TransferState(THREE_FINGER_DOWN);
 }
@@ -1280,7 +1277,7 @@ void AccessibilityZoomGesture::HandleTDReadyTwoFingersDownStateMove(MMI::Pointer
     HILOG_DEBUG();
     CacheEvents(event);
     int32_t pId = event.GetPointerId();
-    if (pId > POINTER_COUNT_2 || !IsMoveValid(lastTripleTapEvents_[pId], std::make_shared<MMI::PointerEvent>(event))) {
+    if (pId > POINTER_COUNT_2 || !IsMoveValid(lastTripleTapPoints_[pId], event)) {
         TransferState(PASSING_THROUGH);
         SendCacheEventsToNext();
     }
@@ -1305,7 +1302,7 @@ void AccessibilityZoomGesture::HandleTDReadyThreeFingersDownStateMove(MMI::Point
     HILOG_DEBUG();
     CacheEvents(event);
     int32_t pId = event.GetPointerId();
-    if (pId > POINTER_COUNT_2 || !IsMoveValid(lastTripleTapEvents_[pId], std::make_shared<MMI::PointerEvent>(event))) {
+    if (pId > POINTER_COUNT_2 || !IsMoveValid(lastTripleTapPoints_[pId], event)) {
         TransferState(PASSING_THROUGH);
         SendCacheEventsToNext();
     }
@@ -1318,7 +1315,7 @@ void AccessibilityZoomGesture::HandleTDReadyThreeFingersTapStateDown(MMI::Pointe
     zoomGestureEventHandler_->RemoveEvent(WAIT_ANOTHER_FINGER_DOWN_MSG);
     zoomGestureEventHandler_->RemoveEvent(MULTI_TAP_MSG);
     if (event.GetPointerId() < POINTER_COUNT_3) {
-        lastTripleTapEvents_[event.GetPointerId()] = std::make_shared<MMI::PointerEvent>(event);
+        lastTripleTapPoints_[event.GetPointerId()] = MakeGesturePoint(event);
     }
     uint32_t pointerSize = event.GetPointerIds().size();
     if (pointerSize < POINTER_COUNT_3) {
@@ -1337,7 +1334,7 @@ void AccessibilityZoomGesture::HandleTDReadyThreeFingersTapStateMove(MMI::Pointe
     HILOG_DEBUG();
     CacheEvents(event);
     int32_t pId = event.GetPointerId();
-    if (pId > POINTER_COUNT_2 || !IsMoveValid(lastTripleTapEvents_[pId], std::make_shared<MMI::PointerEvent>(event))) {
+    if (pId > POINTER_COUNT_2 || !IsMoveValid(lastTripleTapPoints_[pId], event)) {
         TransferState(PASSING_THROUGH);
         SendCacheEventsToNext();
     }
@@ -1361,10 +1358,8 @@ void AccessibilityZoomGesture::HandleTDReadyThreeFingersContinueDownStateUp(MMI:
             int32_t anchorX = 0;
             int32_t anchorY = 0;
             for (int i = 0; i < POINTER_COUNT_3; i++) {
-                MMI::PointerEvent::PointerItem pointerItem;
-                lastTripleTapEvents_[i]->GetPointerItem(lastTripleTapEvents_[i]->GetPointerId(), pointerItem);
-                anchorX += pointerItem.GetDisplayX();
-                anchorY += pointerItem.GetDisplayY();
+                anchorX += lastTripleTapPoints_[i].displayX;
+                anchorY += lastTripleTapPoints_[i].displayY;
             }
             OnZoom(anchorX / POINTER_COUNT_3, anchorY / POINTER_COUNT_3, true);
             ClearCacheEventsAndMsg();
@@ -1379,7 +1374,7 @@ void AccessibilityZoomGesture::HandleTDReadyThreeFingersContinueDownStateMove(MM
     CacheEvents(event);
     bool isMoveValid = false;
     for (int i = 0; i < POINTER_COUNT_3; i++) {
-        isMoveValid |= IsMoveValid(lastTripleTapEvents_[i], std::make_shared<MMI::PointerEvent>(event));
+        isMoveValid |= IsMoveValid(lastTripleTapPoints_[i], event);
         }
     if (event.GetPointerIds().size() > POINTER_COUNT_3 || !isMoveValid) {
         TransferState(PASSING_THROUGH);
@@ -1391,18 +1386,16 @@ void AccessibilityZoomGesture::HandleMenuSlidingStateMove(MMI::PointerEvent &eve
 {
     HILOG_DEBUG();
     if (event.GetPointerId() == 0) {
-        if (!lastDownEvent_) {
-            lastDownEvent_ = std::make_shared<MMI::PointerEvent>(event);
-    }
-        MMI::PointerEvent::PointerItem lastDownItem;
-        lastDownEvent_->GetPointerItem(lastDownEvent_->GetPointerId(), lastDownItem);
+        if (!lastDownPoint_.isValid) {
+            lastDownPoint_ = MakeGesturePoint(event);
+        }
         MMI::PointerEvent::PointerItem currentItem;
         event.GetPointerItem(event.GetPointerId(), currentItem);
-        int32_t deltaX = currentItem.GetDisplayX() - lastDownItem.GetDisplayX();
-        int32_t deltaY = currentItem.GetDisplayY() - lastDownItem.GetDisplayY();
+        int32_t deltaX = currentItem.GetDisplayX() - lastDownPoint_.displayX;
+        int32_t deltaY = currentItem.GetDisplayY() - lastDownPoint_.displayY;
         menuManager_->MoveMenuWindow(deltaX, deltaY);
 
-        lastDownEvent_ = std::make_shared<MMI::PointerEvent>(event);
+        lastDownPoint_ = MakeGesturePoint(event);
     }
 }
 
@@ -1426,18 +1419,16 @@ void AccessibilityZoomGesture::HandleHotAreaSlidingStateMove(MMI::PointerEvent &
 {
     HILOG_DEBUG();
     if (event.GetPointerId() == 0) {
-        if (!lastDownEvent_) {
-            lastDownEvent_ = std::make_shared<MMI::PointerEvent>(event);
-    }
-        MMI::PointerEvent::PointerItem lastDownItem;
-        lastDownEvent_->GetPointerItem(lastDownEvent_->GetPointerId(), lastDownItem);
+        if (!lastDownPoint_.isValid) {
+            lastDownPoint_ = MakeGesturePoint(event);
+        }
         MMI::PointerEvent::PointerItem currentItem;
         event.GetPointerItem(event.GetPointerId(), currentItem);
-        int32_t deltaX = currentItem.GetDisplayX() - lastDownItem.GetDisplayX();
-        int32_t deltaY = currentItem.GetDisplayY() - lastDownItem.GetDisplayY();
+        int32_t deltaX = currentItem.GetDisplayX() - lastDownPoint_.displayX;
+        int32_t deltaY = currentItem.GetDisplayY() - lastDownPoint_.displayY;
         windowMagnificationManager_->MoveMagnificationWindow(deltaX, deltaY);
 
-        lastDownEvent_ = std::make_shared<MMI::PointerEvent>(event);
+        lastDownPoint_ = MakeGesturePoint(event);
     }
 }
 
@@ -1505,8 +1496,8 @@ void AccessibilityZoomGesture::HandleTDZoomInitStateDown(MMI::PointerEvent &even
     }
     isTapOnMenu_ = menuManager_->IsTapOnMenu(pointerItem.GetDisplayX(), pointerItem.GetDisplayY());
 
-    lastDownEvent_ = std::make_shared<MMI::PointerEvent>(event);
-    lastTripleTapEvents_[0] = std::make_shared<MMI::PointerEvent>(event);
+    lastDownPoint_ = MakeGesturePoint(event);
+    lastTripleTapPoints_[0] = MakeGesturePoint(event);
     if (isTapOnWindowHotArea_) {
         zoomGestureEventHandler_->SendEvent(HOT_AREA_SLIDING_MSG, 0, MULTI_FINGER_TAP_INTERVAL_TIMER);
     } else if (isTapOnMenu_) {
@@ -1542,7 +1533,7 @@ void AccessibilityZoomGesture::HandleTDZoomOneFingerDownStateDown(MMI::PointerEv
     event.GetPointerItem(event.GetPointerId(), pointerItem);
     isTapOnWindow_ |= windowMagnificationManager_->IsTapOnMagnificationWindow(pointerItem.GetDisplayX(),
         pointerItem.GetDisplayY());
-    lastTripleTapEvents_[1] = std::make_shared<MMI::PointerEvent>(event);
+    lastTripleTapPoints_[1] = MakeGesturePoint(event);
     TransferState(TWO_FINGER_DOWN);
     if (magnificationMode_ != FULL_SCREEN_MAGNIFICATION && !isTapOnWindow_) {
         zoomGestureEventHandler_->SendEvent(WAIT_ANOTHER_FINGER_DOWN_MSG, 0, MULTI_FINGER_TAP_INTERVAL_TIMER);
@@ -1564,7 +1555,7 @@ void AccessibilityZoomGesture::HandleTDZoomOneFingerDownStateMove(MMI::PointerEv
         SendCacheEventsToNext();
         return;
     }
-    if (!IsMoveValid(lastTripleTapEvents_[pId], std::make_shared<MMI::PointerEvent>(event))) {
+    if (!IsMoveValid(lastTripleTapPoints_[pId], event)) {
         if (isTapOnWindowHotArea_) {
             ClearCacheEventsAndMsg();
             TransferState(HOT_AREA_SLIDING);
@@ -1620,7 +1611,7 @@ void AccessibilityZoomGesture::HandleTDZoomTwoFingersDownStateDown(MMI::PointerE
         return;
     }
 
-    lastTripleTapEvents_[POINTER_COUNT_2] = std::make_shared<MMI::PointerEvent>(event);
+    lastTripleTapPoints_[POINTER_COUNT_2] = MakeGesturePoint(event);
     zoomGestureEventHandler_->SendEvent(MULTI_TAP_MSG, 0, MULTI_TAP_TIMER);
     TransferState(THREE_FINGER_DOWN);
 }
@@ -1635,7 +1626,7 @@ void AccessibilityZoomGesture::HandleTDZoomTwoFingersDownStateMove(MMI::PointerE
         return;
     }
     int32_t pId = event.GetPointerId();
-    if (pId > POINTER_ID_2 || IsMoveValid(lastTripleTapEvents_[pId], std::make_shared<MMI::PointerEvent>(event))) {
+    if (pId > POINTER_ID_2 || IsMoveValid(lastTripleTapPoints_[pId], event)) {
         return;
     }
     zoomGestureEventHandler_->RemoveEvent(WAIT_ANOTHER_FINGER_DOWN_MSG);
@@ -1675,7 +1666,7 @@ void AccessibilityZoomGesture::HandleTDZoomThreeFingersDownStateMove(MMI::Pointe
         return;
     }
     for (int i = 0; i < POINTER_COUNT_3; i++) {
-        isMoveValid |= IsMoveValid(lastTripleTapEvents_[i], std::make_shared<MMI::PointerEvent>(event));
+        isMoveValid |= IsMoveValid(lastTripleTapPoints_[i], event);
     }
     if (!isMoveValid) {
         TransferState(PASSING_THROUGH);
@@ -1690,7 +1681,7 @@ void AccessibilityZoomGesture::HandleTDZoomThreeFingersTapStateDown(MMI::Pointer
     zoomGestureEventHandler_->RemoveEvent(WAIT_ANOTHER_FINGER_DOWN_MSG);
     zoomGestureEventHandler_->RemoveEvent(MULTI_TAP_MSG);
     if (event.GetPointerId() < POINTER_COUNT_3) {
-        lastTripleTapEvents_[event.GetPointerId()] = std::make_shared<MMI::PointerEvent>(event);
+        lastTripleTapPoints_[event.GetPointerId()] = MakeGesturePoint(event);
     }
     uint32_t pointerSize = event.GetPointerIds().size();
     if (pointerSize < POINTER_COUNT_3) {
@@ -1715,7 +1706,7 @@ void AccessibilityZoomGesture::HandleTDZoomThreeFingersTapStateMove(MMI::Pointer
         SendCacheEventsToNext();
         return;
     }
-    if (!IsMoveValid(lastTripleTapEvents_[pId], std::make_shared<MMI::PointerEvent>(event))) {
+    if (!IsMoveValid(lastTripleTapPoints_[pId], event)) {
         uint32_t pointerSize = event.GetPointerIds().size();
         if (pointerSize == POINTER_COUNT_2 && (magnificationMode_ == FULL_SCREEN_MAGNIFICATION || isTapOnWindow_)) {
             ClearCacheEventsAndMsg();
@@ -1755,7 +1746,7 @@ void AccessibilityZoomGesture::HandleTDZoomThreeFingersContinueDownStateMove(MMI
     CacheEvents(event);
     bool isMoveValid = false;
     for (int i = 0; i < POINTER_COUNT_3; i++) {
-        isMoveValid |= IsMoveValid(lastTripleTapEvents_[i], std::make_shared<MMI::PointerEvent>(event));
+        isMoveValid |= IsMoveValid(lastTripleTapPoints_[i], event);
     }
     if (event.GetPointerIds().size() > POINTER_COUNT_3 || !isMoveValid) {
         TransferState(PASSING_THROUGH);
@@ -28,104 +28,79 @@ namespace Accessibility {
 
 void TouchExploration::InitTwoFingerGestureFuncMap()
 {
-    handleEventFuncMap_.insert({
-        {TouchExplorationState::TWO_FINGERS_DOWN, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleTwoFingersDownStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleTwoFingersDownStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleTwoFingersDownStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::TWO_FINGERS_DRAG, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleTwoFingersDragStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleTwoFingersDragStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleTwoFingersDragStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::TWO_FINGERS_TAP, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleTwoFingersTapStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleMultiFingersTapStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleTwoFingersTapStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::TWO_FINGERS_CONTINUE_DOWN, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleMultiFingersContinueDownStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleTwoFingersContinueDownStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleTwoFingersContinueDownStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::TWO_FINGERS_UNKNOWN, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleTwoFingersUnknownStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleTwoFingersUnknownStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleTwoFingersUnknownStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        }
-    });
+    SetHandleEventFuncs(TouchExplorationState::TWO_FINGERS_DOWN, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleTwoFingersDownStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleTwoFingersDownStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleTwoFingersDownStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
+    SetHandleEventFuncs(TouchExplorationState::TWO_FINGERS_DRAG, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleTwoFingersDragStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleTwoFingersDragStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleTwoFingersDragStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
+    SetHandleEventFuncs(TouchExplorationState::TWO_FINGERS_TAP, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleTwoFingersTapStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleMultiFingersTapStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleTwoFingersTapStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
+    SetHandleEventFuncs(TouchExplorationState::TWO_FINGERS_CONTINUE_DOWN, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleMultiFingersContinueDownStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleTwoFingersContinueDownStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleTwoFingersContinueDownStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
+    SetHandleEventFuncs(TouchExplorationState::TWO_FINGERS_UNKNOWN, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleTwoFingersUnknownStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleTwoFingersUnknownStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleTwoFingersUnknownStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
 }
 
 void TouchExploration::InitThreeFingerGestureFuncMap()
 {
-    handleEventFuncMap_.insert({
-        {TouchExplorationState::THREE_FINGERS_DOWN, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleThreeFingersDownStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleThreeFingersDownStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleThreeFingersDownStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::THREE_FINGERS_SWIPE, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleThreeFingersSwipeStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleThreeFingersSwipeStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleThreeFingersSwipeStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::THREE_FINGERS_TAP, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleThreeFingersTapStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleMultiFingersTapStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleThreeFingersTapStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::THREE_FINGERS_CONTINUE_DOWN, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleMultiFingersContinueDownStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleThreeFingersContinueDownStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleThreeFingersContinueDownStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        }
-    });
+    SetHandleEventFuncs(TouchExplorationState::THREE_FINGERS_DOWN, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleThreeFingersDownStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleThreeFingersDownStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleThreeFingersDownStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
+    SetHandleEventFuncs(TouchExplorationState::THREE_FINGERS_SWIPE, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleThreeFingersSwipeStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleThreeFingersSwipeStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleThreeFingersSwipeStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
+    SetHandleEventFuncs(TouchExplorationState::THREE_FINGERS_TAP, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleThreeFingersTapStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleMultiFingersTapStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleThreeFingersTapStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
+    SetHandleEventFuncs(TouchExplorationState::THREE_FINGERS_CONTINUE_DOWN, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleMultiFingersContinueDownStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleThreeFingersContinueDownStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleThreeFingersContinueDownStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
 }
 
 void TouchExploration::InitFourFingerGestureFuncMap()
 {
-    handleEventFuncMap_.insert({
-        {TouchExplorationState::THREE_FINGERS_CONTINUE_DOWN, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleMultiFingersContinueDownStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleThreeFingersContinueDownStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleThreeFingersContinueDownStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::FOUR_FINGERS_DOWN, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleFourFingersDownStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleFourFingersDownStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleFourFingersDownStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::FOUR_FINGERS_SWIPE, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleFourFingersSwipeStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleFourFingersSwipeStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleFourFingersSwipeStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::FOUR_FINGERS_TAP, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleFourFingersTapStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleMultiFingersTapStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleFourFingersTapStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::FOUR_FINGERS_CONTINUE_DOWN, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleMultiFingersContinueDownStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleFourFingersContinueDownStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleFourFingersContinueDownStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        }
-    });
+    SetHandleEventFuncs(TouchExplorationState::FOUR_FINGERS_DOWN, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleFourFingersDownStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleFourFingersDownStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleFourFingersDownStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
+    SetHandleEventFuncs(TouchExplorationState::FOUR_FINGERS_SWIPE, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleFourFingersSwipeStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleFourFingersSwipeStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleFourFingersSwipeStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
+    SetHandleEventFuncs(TouchExplorationState::FOUR_FINGERS_TAP, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleFourFingersTapStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleMultiFingersTapStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleFourFingersTapStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
+    SetHandleEventFuncs(TouchExplorationState::FOUR_FINGERS_CONTINUE_DOWN, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleMultiFingersContinueDownStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleFourFingersContinueDownStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleFourFingersContinueDownStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)});
 }
 
 std::map<TouchExplorationMsg, GestureType> TouchExploration::GetMultiFingerMsgToGestureMap()
@@ -185,7 +160,7 @@ void TouchExploration::ProcessMultiFingerGesture(TouchExplorationMsg msg, uint64
         }
     } else if (gestureType == GestureType::GESTURE_INVALID) {
         if (GetCurrentState() == TouchExplorationState::TWO_FINGERS_DOWN) {
-            for (auto& event : receivedPointerEvents_) {
+            for (auto& event : receivedPointerEvents_.GetReplayEvents()) {
                 SendEventToMultimodal(event, ChangeAction::NO_CHANGE);
             }
             Clear();
@@ -205,7 +180,7 @@ void TouchExploration::ProcessMultiFingerGesture(TouchExplorationMsg msg, uint64
 
 void TouchExploration::HandleTwoFingersDownStateDown(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
     CancelPostEvent(TouchExplorationMsg::TWO_FINGER_SINGLE_TAP_MSG);
     CancelPostEvent(TouchExplorationMsg::TWO_FINGER_LONG_PRESS_MSG);
 
@@ -234,7 +209,7 @@ void TouchExploration::HandleTwoFingersDownStateDown(MMI::PointerEvent &event)
 
 void TouchExploration::HandleTwoFingersDownStateUp(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
     CancelPostEvent(TouchExplorationMsg::WAIT_ANOTHER_FINGER_DOWN_MSG);
     CancelPostEvent(TouchExplorationMsg::TWO_FINGER_LONG_PRESS_MSG);
 
@@ -251,13 +226,14 @@ void TouchExploration::HandleTwoFingersDownStateUp(MMI::PointerEvent &event)
 bool TouchExploration::GetBasePointItem(MMI::PointerEvent::PointerItem &basePointerItem, int32_t pId)
 {
     HILOG_DEBUG();
-    for (auto rIter = receivedPointerEvents_.rbegin(); rIter != receivedPointerEvents_.rend(); ++rIter) {
-        if ((rIter->GetPointerId() == pId) && (rIter->GetPointerAction() == MMI::PointerEvent::POINTER_ACTION_DOWN)) {
-            rIter->GetPointerItem(pId, basePointerItem);
-            return true;
-        }
+    const PointerSample *downSample = receivedPointerEvents_.FindLastDown(pId);
+    if (downSample == nullptr) {
+        return false;
     }
-    return false;
+    basePointerItem.SetPointerId(pId);
+    basePointerItem.SetDisplayX(downSample->displayX);
+    basePointerItem.SetDisplayY(downSample->displayY);
+    return true;
 }
 
 void TouchExploration::GetPointOffset(MMI::PointerEvent &event, std::vector<float> &firstPointOffset,
@@ -328,17 +304,12 @@ void TouchExploration::SendDragDownEventToMultimodal(MMI::PointerEvent event)
     int32_t xPointDown = 0;
     int32_t yPointDown = 0;
     int64_t actionTime = 0;
-    MMI::PointerEvent::PointerItem basePointerItem {};
-
-    for (auto &baseEvent : receivedPointerEvents_) {
-        if ((baseEvent.GetPointerId() == event.GetPointerId()) &&
-            (baseEvent.GetPointerAction() == MMI::PointerEvent::POINTER_ACTION_DOWN)) {
-            baseEvent.GetPointerItem(event.GetPointerId(), basePointerItem);
-            xPointDown = basePointerItem.GetDisplayX();
-            yPointDown = basePointerItem.GetDisplayY();
-            actionTime = baseEvent.GetActionTime();
-            break;
-        }
+
+    const PointerSample *downSample = receivedPointerEvents_.FindFirstDown(event.GetPointerId());
+    if (downSample != nullptr) {
+        xPointDown = downSample->displayX;
+        yPointDown = downSample->displayY;
+        actionTime = downSample->actionTime;
     }
 
     MMI::PointerEvent::PointerItem pointer {};
@@ -369,7 +340,7 @@ bool TouchExploration::IsRealMove(MMI::PointerEvent &event)
 
 void TouchExploration::HandleTwoFingersDownStateMove(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.RecordForReplay(event);
 
     MMI::PointerEvent::PointerItem pointerItem;
     event.GetPointerItem(event.GetPointerId(), pointerItem);
@@ -406,7 +377,7 @@ void TouchExploration::HandleTwoFingersDownStateMove(MMI::PointerEvent &event)
             Singleton<ExtendServiceManager>::GetInstance().sendTouchGuideGestureToAACallback(
                 displayId, TWO_FINGER_SWIPE_BEGIN);
         } else {
-            for (auto &receivedEvent : receivedPointerEvents_) {
+            for (auto &receivedEvent : receivedPointerEvents_.GetReplayEvents()) {
                 SendEventToMultimodal(receivedEvent, ChangeAction::NO_CHANGE);
             }
             Clear();
@@ -418,16 +389,14 @@ void TouchExploration::HandleTwoFingersDownStateMove(MMI::PointerEvent &event)
 void TouchExploration::SendUpForDragDownEvent()
 {
     HILOG_DEBUG();
-    if (receivedPointerEvents_.empty()) {
+    if (receivedPointerEvents_.IsEmpty()) {
         HILOG_ERROR("received pointer event is null!");
         return;
     }
 
-    MMI::PointerEvent lastMoveEvent = receivedPointerEvents_.back();
-    MMI::PointerEvent::PointerItem movePointerItem;
-    lastMoveEvent.GetPointerItem(lastMoveEvent.GetPointerId(), movePointerItem);
-    int32_t x = movePointerItem.GetDisplayX();
-    int32_t y = movePointerItem.GetDisplayY();
+    const PointerSample &lastMoveSample = receivedPointerEvents_.GetLast();
+    int32_t x = lastMoveSample.displayX;
+    int32_t y = lastMoveSample.displayY;
 
     if (draggingDownEvent_ == nullptr) {
         HILOG_ERROR("dragging down event is null!");
@@ -475,7 +444,7 @@ void TouchExploration::HandleTwoFingersDragStateMove(MMI::PointerEvent &event)
         return;
     }
 
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
 
 #ifdef OHOS_BUILD_ENABLE_DISPLAY_MANAGER
     // Get densityPixels from WMS
@@ -523,23 +492,17 @@ bool TouchExploration::GetPointerItemWithFingerNum(uint32_t fingerNum,
         return false;
     }
 
-    bool findPrePointer = false;
     std::vector<int32_t> pIds = event.GetPointerIds();
     for (int32_t i = 0; i < static_cast<int32_t>(fingerNum); i++) {
-        findPrePointer = false;
         event.GetPointerItem(pIds[i], curPoints[i]);
-        for (auto &preEvent : receivedPointerEvents_) {
-            if ((preEvent.GetPointerId() == pIds[i]) &&
-                (preEvent.GetPointerAction() == MMI::PointerEvent::POINTER_ACTION_DOWN)) {
-                findPrePointer = true;
-                preEvent.GetPointerItem(pIds[i], prePoints[i]);
-                break;
-            }
-        }
-        if (!findPrePointer) {
+        const PointerSample *downSample = receivedPointerEvents_.FindFirstDown(pIds[i]);
+        if (downSample == nullptr) {
             HILOG_ERROR("get prePointerItem(%{public}d) failed", i);
             return false;
         }
+        prePoints[i].SetPointerId(pIds[i]);
+        prePoints[i].SetDisplayX(downSample->displayX);
+        prePoints[i].SetDisplayY(downSample->displayY);
     }
     return true;
 }
@@ -620,7 +583,7 @@ bool TouchExploration::IsMultiFingerMultiTapGesture(MMI::PointerEvent &event, co
 
 void TouchExploration::HandleMultiFingersTapStateDown(MMI::PointerEvent &event, uint32_t fingerNum)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
     CancelMultiFingerTapEvent();
     CancelPostEvent(TouchExplorationMsg::WAIT_ANOTHER_FINGER_DOWN_MSG);
 
@@ -676,7 +639,7 @@ void TouchExploration::HandleMultiFingersTapStateMove(MMI::PointerEvent &event,
         return;
     }
 
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
 
     MMI::PointerEvent::PointerItem pointerItem;
     event.GetPointerItem(event.GetPointerId(), pointerItem);
@@ -713,7 +676,7 @@ void TouchExploration::HandleMultiFingersContinueDownStateDown(MMI::PointerEvent
 
 void TouchExploration::HandleMultiFingersContinueDownStateUp(MMI::PointerEvent &event, uint32_t fingerNum)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
     CancelMultiFingerTapAndHoldEvent();
 
     uint32_t pointerSize = event.GetPointerIds().size();
@@ -739,7 +702,7 @@ void TouchExploration::HandleTwoFingersContinueDownStateUp(MMI::PointerEvent &ev
 
 void TouchExploration::HandleMultiFingersContinueDownStateMove(MMI::PointerEvent &event, uint32_t fingerNum)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
 
     MMI::PointerEvent::PointerItem pointerItem;
     event.GetPointerItem(event.GetPointerId(), pointerItem);
@@ -770,7 +733,7 @@ void TouchExploration::HandleTwoFingersContinueDownStateMove(MMI::PointerEvent &
 void TouchExploration::HandleTwoFingersUnknownStateDown(MMI::PointerEvent &event)
 {
     if (event.GetPointerIds().size() == static_cast<uint32_t>(PointerCount::POINTER_COUNT_2)) {
-        receivedPointerEvents_.push_back(event);
+        receivedPointerEvents_.Record(event);
         return;
     }
 
@@ -780,7 +743,7 @@ void TouchExploration::HandleTwoFingersUnknownStateDown(MMI::PointerEvent &event
 
 void TouchExploration::HandleTwoFingersUnknownStateUp(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
     if (event.GetPointerIds().size() == static_cast<uint32_t>(PointerCount::POINTER_COUNT_1)) {
         Clear();
         SetCurrentState(TouchExplorationState::TOUCH_INIT);
@@ -794,7 +757,7 @@ void TouchExploration::HandleTwoFingersUnknownStateMove(MMI::PointerEvent &event
         return;
     }
 
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
 
     std::vector<int32_t> pIds = event.GetPointerIds();
     if (IsDragGestureAccept(event)) {
@@ -812,7 +775,7 @@ void TouchExploration::HandleTwoFingersUnknownStateMove(MMI::PointerEvent &event
 
 void TouchExploration::HandleThreeFingersDownStateDown(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
     CancelPostEvent(TouchExplorationMsg::THREE_FINGER_SINGLE_TAP_MSG);
     CancelPostEvent(TouchExplorationMsg::THREE_FINGER_LONG_PRESS_MSG);
 
@@ -839,7 +802,7 @@ void TouchExploration::HandleThreeFingersDownStateDown(MMI::PointerEvent &event)
 
 void TouchExploration::HandleThreeFingersDownStateUp(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
     CancelPostEvent(TouchExplorationMsg::WAIT_ANOTHER_FINGER_DOWN_MSG);
     CancelPostEvent(TouchExplorationMsg::THREE_FINGER_LONG_PRESS_MSG);
 
@@ -856,25 +819,39 @@ void TouchExploration::HandleThreeFingersDownStateUp(MMI::PointerEvent &event)
 void TouchExploration::StoreMultiFingerSwipeBaseDownPoint()
 {
     HILOG_DEBUG();
-    for (auto& event : receivedPointerEvents_) {
-        if (event.GetPointerAction() == MMI::PointerEvent::POINTER_ACTION_DOWN) {
-            Pointer mp;
-            MMI::PointerEvent::PointerItem pointerItem;
-            std::vector<Pointer> mpVec;
-            int32_t pId = event.GetPointerId();
-            event.GetPointerItem(pId, pointerItem);
-            mp.px_ = static_cast<float>(pointerItem.GetDisplayX());
-            mp.py_ = static_cast<float>(pointerItem.GetDisplayY());
-            mpVec.push_back(mp);
-            multiFingerSwipeRoute_.insert(std::make_pair(pId, mpVec));
-            multiFingerSwipePrePoint_[event.GetPointerId()] = std::make_shared<MMI::PointerEvent>(event);
+    receivedPointerEvents_.ForEachDown([this](const PointerSample &downSample) {
+        // the route starts at the first down of the finger, the next point is compared to the last one
+        MultiFingerSwipeRoute *route = FindMultiFingerSwipeRoute(downSample.pointerId);
+        if (route == nullptr) {
+            if (multiFingerSwipeRouteCount_ == multiFingerSwipeRoutes_.size()) {
+                HILOG_ERROR("too many fingers, pid = %{public}d.", downSample.pointerId);
+                return;
+            }
+            route = &multiFingerSwipeRoutes_[multiFingerSwipeRouteCount_++];
+            *route = {};
+            route->pointerId = downSample.pointerId;
+            route->firstX = downSample.displayX;
+            route->firstY = downSample.displayY;
+            route->pointCount = 1;
+        }
+        route->lastX = downSample.displayX;
+        route->lastY = downSample.displayY;
+    });
+}
+
+MultiFingerSwipeRoute *TouchExploration::FindMultiFingerSwipeRoute(int32_t pId)
+{
+    for (size_t i = 0; i < multiFingerSwipeRouteCount_; i++) {
+        if (multiFingerSwipeRoutes_[i].pointerId == pId) {
+            return &multiFingerSwipeRoutes_[i];
         }
     }
+    return nullptr;
 }
 
 void TouchExploration::HandleThreeFingersDownStateMove(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
 
     MMI::PointerEvent::PointerItem pointerItem;
     event.GetPointerItem(event.GetPointerId(), pointerItem);
@@ -915,15 +892,14 @@ void TouchExploration::HandleThreeFingersSwipeStateDown(MMI::PointerEvent &event
 bool TouchExploration::GetMultiFingerSwipeBasePointerItem(MMI::PointerEvent::PointerItem &basePointerItem, int32_t pId)
 {
     HILOG_DEBUG();
-    if (multiFingerSwipePrePoint_.count(pId) == 0 || !multiFingerSwipePrePoint_[pId]) {
+    MultiFingerSwipeRoute *route = FindMultiFingerSwipeRoute(pId);
+    if (route == nullptr) {
         HILOG_ERROR("get base pointEvent(%{public}d) failed", pId);
         return false;
     }
-    if (multiFingerSwipePrePoint_[pId] == nullptr) {
-        HILOG_ERROR("multiFingerSwipePrePoint_ get pointEvent(%{public}d) occurred null pointer.", pId);
-        return false;
-    }
-    multiFingerSwipePrePoint_[pId]->GetPointerItem(pId, basePointerItem);
+    basePointerItem.SetPointerId(pId);
+    basePointerItem.SetDisplayX(route->lastX);
+    basePointerItem.SetDisplayY(route->lastY);
     return true;
 }
 
@@ -954,31 +930,17 @@ bool TouchExploration::SaveMultiFingerSwipeGesturePointerInfo(MMI::PointerEvent
             return false;
         }
 
-        Pointer mp;
-        mp.px_ = static_cast<float>(pointerItem.GetDisplayX());
-        mp.py_ = static_cast<float>(pointerItem.GetDisplayY());
-        multiFingerSwipeRoute_[pId].push_back(mp);
-        multiFingerSwipePrePoint_[pId] = std::make_shared<MMI::PointerEvent>(event);
-    }
-
-    return true;
-}
-
-bool TouchExploration::RecognizeMultiFingerSwipePath(const std::vector<Pointer> &path)
-{
-    HILOG_DEBUG();
-    if (path.size() < MIN_MULTI_FINGER_SWIPE_POINTER_NUM) {
-        return false;
-    }
-
-    int pathSize = static_cast<int>(path.size() - 1);
-    for (int routerIndex = 0; routerIndex < pathSize; routerIndex++) {
-        int32_t dx = static_cast<int32_t>(path[routerIndex + 1].px_ - path[routerIndex].px_);
-        int32_t dy = static_cast<int32_t>(path[routerIndex + 1].py_ - path[routerIndex].py_);
-        if (GetSwipeDirection(dx, dy) != multiFingerSwipeDirection_) {
-            return false;
+        MultiFingerSwipeRoute *route = FindMultiFingerSwipeRoute(pId);
+        // the base point is the first down when the finger was down twice, check the first segment from it
+        if (route->pointCount == 1 && multiFingerSwipeDirection_ != GetSwipeDirection(
+            pointerItem.GetDisplayX() - route->firstX, pointerItem.GetDisplayY() - route->firstY)) {
+            route->keepsDirection = false;
         }
+        route->pointCount++;
+        route->lastX = pointerItem.GetDisplayX();
+        route->lastY = pointerItem.GetDisplayY();
     }
+
     return true;
 }
 
@@ -1017,7 +979,7 @@ GestureType TouchExploration::GetMultiFingerSwipeGestureId(uint32_t fingerNum)
 
 void TouchExploration::HandleMultiFingersSwipeStateUp(MMI::PointerEvent &event, uint32_t fingerNum)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
 
     if (!SaveMultiFingerSwipeGesturePointerInfo(event)) {
         return;
@@ -1028,13 +990,10 @@ void TouchExploration::HandleMultiFingersSwipeStateUp(MMI::PointerEvent &event,
             SetCurrentState(TouchExplorationState::TOUCH_INIT);
             return;
         }
-        for (auto &pair : multiFingerSwipeRoute_) {
-            if (pair.second.size() < MIN_MULTI_FINGER_SWIPE_POINTER_NUM) {
-                Clear();
-                SetCurrentState(TouchExplorationState::TOUCH_INIT);
-                return;
-            }
-            if (!RecognizeMultiFingerSwipePath(pair.second)) {
+        // the direction of every segment was checked when its point was added
+        for (size_t i = 0; i < multiFingerSwipeRouteCount_; i++) {
+            const MultiFingerSwipeRoute &route = multiFingerSwipeRoutes_[i];
+            if (route.pointCount < MIN_MULTI_FINGER_SWIPE_POINTER_NUM || !route.keepsDirection) {
                 Clear();
                 SetCurrentState(TouchExplorationState::TOUCH_INIT);
                 return;
@@ -1055,7 +1014,7 @@ void TouchExploration::HandleThreeFingersSwipeStateUp(MMI::PointerEvent &event)
 
 void TouchExploration::HandleThreeFingersSwipeStateMove(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
     SaveMultiFingerSwipeGesturePointerInfo(event);
     SendScreenWakeUpEvent();
 }
@@ -1090,7 +1049,7 @@ void TouchExploration::HandleFourFingersDownStateDown(MMI::PointerEvent &event)
 
 void TouchExploration::HandleFourFingersDownStateUp(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
     CancelPostEvent(TouchExplorationMsg::FOUR_FINGER_LONG_PRESS_MSG);
 
     uint32_t pointerSize = event.GetPointerIds().size();
@@ -1105,7 +1064,7 @@ void TouchExploration::HandleFourFingersDownStateUp(MMI::PointerEvent &event)
 
 void TouchExploration::HandleFourFingersDownStateMove(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
 
     MMI::PointerEvent::PointerItem pointerItem;
     event.GetPointerItem(event.GetPointerId(), pointerItem);
@@ -1147,7 +1106,7 @@ void TouchExploration::HandleFourFingersSwipeStateUp(MMI::PointerEvent &event)
 
 void TouchExploration::HandleFourFingersSwipeStateMove(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
     SaveMultiFingerSwipeGesturePointerInfo(event);
     SendScreenWakeUpEvent();
 }
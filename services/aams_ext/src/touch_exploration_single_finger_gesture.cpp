@@ -35,46 +35,46 @@ namespace {
     const char* AAMS_GESTURE_RUNNER_NAME = "AamsGestureRunner";
 }
 
+void TouchExploration::SetHandleEventFuncs(TouchExplorationState state,
+    std::initializer_list<std::pair<int32_t, HandleEventFunc>> funcs)
+{
+    for (auto &func : funcs) {
+        handleEventFuncMap_[static_cast<int32_t>(state)][func.first] = func.second;
+    }
+}
+
 void TouchExploration::InitOneFingerGestureFuncMap()
 {
-    handleEventFuncMap_ = {
-        {TouchExplorationState::TOUCH_INIT, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleInitStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleInitStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleInitStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)},
-            {MMI::PointerEvent::POINTER_ACTION_PULL_MOVE, BIND(HandleInitStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_PULL_UP, BIND(HandleInitStateUp)}}
-        },
-        {TouchExplorationState::ONE_FINGER_DOWN, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleOneFingerDownStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleOneFingerDownStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleOneFingerDownStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::ONE_FINGER_LONG_PRESS, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleOneFingerLongPressStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleOneFingerLongPressStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleOneFingerLongPressStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::ONE_FINGER_SWIPE, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleOneFingerSwipeStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleOneFingerSwipeStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleOneFingerSwipeStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::ONE_FINGER_SINGLE_TAP, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleOneFingerSingleTapStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        },
-        {TouchExplorationState::ONE_FINGER_SINGLE_TAP_THEN_DOWN, {
-            {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleOneFingerSingleTapThenDownStateDown)},
-            {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleOneFingerSingleTapThenDownStateUp)},
-            {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleOneFingerSingleTapThenDownStateMove)},
-            {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}}
-        }
-    };
+    SetHandleEventFuncs(TouchExplorationState::TOUCH_INIT, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleInitStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleInitStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleInitStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)},
+        {MMI::PointerEvent::POINTER_ACTION_PULL_MOVE, BIND(HandleInitStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_PULL_UP, BIND(HandleInitStateUp)}});
+    SetHandleEventFuncs(TouchExplorationState::ONE_FINGER_DOWN, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleOneFingerDownStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleOneFingerDownStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleOneFingerDownStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}});
+    SetHandleEventFuncs(TouchExplorationState::ONE_FINGER_LONG_PRESS, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleOneFingerLongPressStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleOneFingerLongPressStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleOneFingerLongPressStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}});
+    SetHandleEventFuncs(TouchExplorationState::ONE_FINGER_SWIPE, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleOneFingerSwipeStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleOneFingerSwipeStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleOneFingerSwipeStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}});
+    SetHandleEventFuncs(TouchExplorationState::ONE_FINGER_SINGLE_TAP, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleOneFingerSingleTapStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}});
+    SetHandleEventFuncs(TouchExplorationState::ONE_FINGER_SINGLE_TAP_THEN_DOWN, {
+        {MMI::PointerEvent::POINTER_ACTION_DOWN, BIND(HandleOneFingerSingleTapThenDownStateDown)},
+        {MMI::PointerEvent::POINTER_ACTION_UP, BIND(HandleOneFingerSingleTapThenDownStateUp)},
+        {MMI::PointerEvent::POINTER_ACTION_MOVE, BIND(HandleOneFingerSingleTapThenDownStateMove)},
+        {MMI::PointerEvent::POINTER_ACTION_CANCEL, BIND(HandleCancelEvent)}});
 }
 
 TouchExplorationEventHandler::TouchExplorationEventHandler(
@@ -231,13 +231,12 @@ void TouchExploration::HandlePointerEvent(MMI::PointerEvent &event)
         return;
     }
 
-    auto iter = handleEventFuncMap_.find(GetCurrentState());
-    if (iter != handleEventFuncMap_.end()) {
-        auto funcMap = iter->second.find(event.GetPointerAction());
-        if (funcMap != iter->second.end()) {
-            funcMap->second(event);
-            return;
-        }
+    int32_t state = static_cast<int32_t>(GetCurrentState());
+    int32_t action = event.GetPointerAction();
+    if (state >= 0 && state < TOUCH_EXPLORATION_STATE_COUNT && action >= 0 && action < POINTER_ACTION_MAX &&
+        handleEventFuncMap_[state][action] != nullptr) {
+        handleEventFuncMap_[state][action](event);
+        return;
     }
 
     MMI::PointerEvent::PointerItem pointerItem;
@@ -330,7 +329,7 @@ void TouchExploration::SendScreenWakeUpEvent()
 
 void TouchExploration::HoverEventRunner()
 {
-    for (auto& event : receivedPointerEvents_) {
+    for (auto& event : receivedPointerEvents_.GetReplayEvents()) {
         if (event.GetPointerAction() == MMI::PointerEvent::POINTER_ACTION_DOWN) {
             SendEventToMultimodal(event, ChangeAction::HOVER_ENTER);
         } else if (event.GetPointerAction() == MMI::PointerEvent::POINTER_ACTION_MOVE) {
@@ -344,7 +343,7 @@ void TouchExploration::HoverEventRunner()
 void TouchExploration::HandleInitStateDown(MMI::PointerEvent &event)
 {
     if (event.GetPointerIds().size() == static_cast<uint32_t>(PointerCount::POINTER_COUNT_1)) {
-        receivedPointerEvents_.push_back(event);
+        receivedPointerEvents_.RecordForReplay(event);
         SetCurrentState(TouchExplorationState::ONE_FINGER_DOWN);
         handler_->SendEvent(static_cast<uint32_t>(TouchExplorationMsg::SEND_HOVER_MSG), 0,
             static_cast<int32_t>(TimeoutDuration::DOUBLE_TAP_TIMEOUT));
@@ -425,7 +424,7 @@ void TouchExploration::HandleCancelEvent(MMI::PointerEvent &event)
 
 void TouchExploration::HandleOneFingerDownStateDown(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.RecordForReplay(event);
     CancelPostEvent(TouchExplorationMsg::SEND_HOVER_MSG);
     CancelPostEvent(TouchExplorationMsg::LONG_PRESS_MSG);
     draggingPid_ = event.GetPointerId();
@@ -448,36 +447,33 @@ void TouchExploration::HandleOneFingerDownStateUp(MMI::PointerEvent &event)
 {
     CancelPostEvent(TouchExplorationMsg::LONG_PRESS_MSG);
     CancelPostEvent(TouchExplorationMsg::WAIT_ANOTHER_FINGER_DOWN_MSG);
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.RecordForReplay(event);
     SetCurrentState(TouchExplorationState::ONE_FINGER_SINGLE_TAP);
 }
 
 void TouchExploration::HandleOneFingerDownStateMove(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.RecordForReplay(event);
 
     MMI::PointerEvent::PointerItem pointerItem;
     event.GetPointerItem(event.GetPointerId(), pointerItem);
 
-    MMI::PointerEvent startPointerEvent = receivedPointerEvents_.front();
-    MMI::PointerEvent::PointerItem startPointerItem;
-    startPointerEvent.GetPointerItem(startPointerEvent.GetPointerId(), startPointerItem);
-
-    float offsetX = startPointerItem.GetRawDisplayX() - pointerItem.GetRawDisplayX();
-    float offsetY = startPointerItem.GetRawDisplayY() - pointerItem.GetRawDisplayY();
+    const PointerSample &startSample = receivedPointerEvents_.GetFirst();
+    float offsetX = startSample.rawDisplayX - pointerItem.GetRawDisplayX();
+    float offsetY = startSample.rawDisplayY - pointerItem.GetRawDisplayY();
     double duration = hypot(offsetX, offsetY);
     if (duration > moveThreshold_) {
         CancelPostEvent(TouchExplorationMsg::SEND_HOVER_MSG);
         CancelPostEvent(TouchExplorationMsg::WAIT_ANOTHER_FINGER_DOWN_MSG);
         CancelPostEvent(TouchExplorationMsg::LONG_PRESS_MSG);
-        receivedPointerEvents_.clear();
-        receivedPointerEvents_.push_back(event);
-        oneFingerSwipePrePointer_ = startPointerItem;
+        // copied before the history starts again from this event
+        oneFingerSwipePrePointer_ = startSample;
+        receivedPointerEvents_.Clear();
+        receivedPointerEvents_.RecordForReplay(event);
         Pointer mp;
-        mp.px_ = static_cast<float>(startPointerItem.GetRawDisplayX());
-        mp.py_ = static_cast<float>(startPointerItem.GetRawDisplayY());
-        oneFingerSwipeRoute_.clear();
-        oneFingerSwipeRoute_.push_back(mp);
+        mp.px_ = static_cast<float>(oneFingerSwipePrePointer_.rawDisplayX);
+        mp.py_ = static_cast<float>(oneFingerSwipePrePointer_.rawDisplayY);
+        oneFingerSwipePath_.Start(mp);
         handler_->SendEvent(static_cast<uint32_t>(TouchExplorationMsg::SWIPE_COMPLETE_TIMEOUT_MSG), 0,
             static_cast<int32_t>(TimeoutDuration::SWIPE_COMPLETE_TIMEOUT));
         SetCurrentState(TouchExplorationState::ONE_FINGER_SWIPE);
@@ -487,7 +483,7 @@ void TouchExploration::HandleOneFingerDownStateMove(MMI::PointerEvent &event)
 
 void TouchExploration::HandleOneFingerLongPressStateDown(MMI::PointerEvent &event)
 {
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.Record(event);
     draggingPid_ = event.GetPointerId();
     SetCurrentState(TouchExplorationState::TWO_FINGERS_UNKNOWN);
 }
@@ -517,84 +513,82 @@ void TouchExploration::AddOneFingerSwipeEvent(MMI::PointerEvent &event)
     MMI::PointerEvent::PointerItem pointerItem {};
     event.GetPointerItem(event.GetPointerId(), pointerItem);
 
-    if (receivedPointerEvents_.empty()) {
+    if (receivedPointerEvents_.IsEmpty()) {
         HILOG_ERROR("received pointer event is null!");
         return;
     }
 
-    MMI::PointerEvent preMoveEvent = receivedPointerEvents_.back();
-    MMI::PointerEvent::PointerItem preMovePointerItem {};
-    preMoveEvent.GetPointerItem(preMoveEvent.GetPointerId(), preMovePointerItem);
-    float offsetX = preMovePointerItem.GetRawDisplayX() - pointerItem.GetRawDisplayX();
-    float offsetY = preMovePointerItem.GetRawDisplayY() - pointerItem.GetRawDisplayY();
+    const PointerSample &preMoveSample = receivedPointerEvents_.GetLast();
+    float offsetX = preMoveSample.rawDisplayX - pointerItem.GetRawDisplayX();
+    float offsetY = preMoveSample.rawDisplayY - pointerItem.GetRawDisplayY();
     double duration = hypot(offsetX, offsetY);
     if (duration > moveThreshold_) {
-        receivedPointerEvents_.push_back(event);
+        receivedPointerEvents_.RecordForReplay(event);
         CancelPostEvent(TouchExplorationMsg::SWIPE_COMPLETE_TIMEOUT_MSG);
         handler_->SendEvent(static_cast<uint32_t>(TouchExplorationMsg::SWIPE_COMPLETE_TIMEOUT_MSG), 0,
             static_cast<int32_t>(TimeoutDuration::SWIPE_COMPLETE_TIMEOUT));
     }
 
-    if ((abs(pointerItem.GetRawDisplayX() - oneFingerSwipePrePointer_.GetRawDisplayX())) >= xMinPixels_ ||
-        (abs(pointerItem.GetRawDisplayY() - oneFingerSwipePrePointer_.GetRawDisplayY())) >= yMinPixels_) {
+    if ((abs(pointerItem.GetRawDisplayX() - oneFingerSwipePrePointer_.rawDisplayX)) >= xMinPixels_ ||
+        (abs(pointerItem.GetRawDisplayY() - oneFingerSwipePrePointer_.rawDisplayY)) >= yMinPixels_) {
         Pointer mp;
-        oneFingerSwipePrePointer_ = pointerItem;
+        oneFingerSwipePrePointer_.rawDisplayX = pointerItem.GetRawDisplayX();
+        oneFingerSwipePrePointer_.rawDisplayY = pointerItem.GetRawDisplayY();
         mp.px_ = pointerItem.GetRawDisplayX();
         mp.py_ = pointerItem.GetRawDisplayY();
-        oneFingerSwipeRoute_.push_back(mp);
+        oneFingerSwipePath_.Add(mp);
     }
 }
 
-std::vector<Pointer> TouchExploration::GetOneFingerSwipePath()
+void OneFingerSwipePath::Add(const Pointer &point)
 {
-    HILOG_DEBUG();
-    std::vector<Pointer> pointerPath;
-    Pointer firstSeparation = oneFingerSwipeRoute_[0];
-    Pointer nextPoint;
-    Pointer newSeparation;
-    float xUnitVector = 0;
-    float yUnitVector = 0;
+    if (routeSize_ == 0) {
+        points_[0] = point;
+        firstSeparation_ = point;
+        lastPoint_ = point;
+        routeSize_ = 1;
+        return;
+    }
+
     float xVector = 0;
     float yVector = 0;
-    float vectorLength = 0;
-    int32_t numSinceFirstSep = 0;
-
-    pointerPath.push_back(firstSeparation);
-    for (size_t i = 1; i < oneFingerSwipeRoute_.size(); i++) {
-        nextPoint = oneFingerSwipeRoute_[i];
-        if (numSinceFirstSep > 0) {
-            xVector = xUnitVector / numSinceFirstSep;
-            yVector = yUnitVector / numSinceFirstSep;
-            newSeparation.px_ = vectorLength * xVector + firstSeparation.px_;
-            newSeparation.py_ = vectorLength * yVector + firstSeparation.py_;
-
-            float xNextUnitVector = nextPoint.px_ - newSeparation.px_;
-            float yNextUnitVector = nextPoint.py_ - newSeparation.py_;
-            float nextVectorLength = hypot(xNextUnitVector, yNextUnitVector);
-            if (nextVectorLength > EPSINON) {
-                xNextUnitVector /= nextVectorLength;
-                yNextUnitVector /= nextVectorLength;
-            }
+    if (numSinceFirstSep_ > 0) {
+        xVector = xUnitVector_ / numSinceFirstSep_;
+        yVector = yUnitVector_ / numSinceFirstSep_;
+        Pointer newSeparation;
+        newSeparation.px_ = vectorLength_ * xVector + firstSeparation_.px_;
+        newSeparation.py_ = vectorLength_ * yVector + firstSeparation_.py_;
+
+        float xNextUnitVector = point.px_ - newSeparation.px_;
+        float yNextUnitVector = point.py_ - newSeparation.py_;
+        float nextVectorLength = hypot(xNextUnitVector, yNextUnitVector);
+        if (nextVectorLength > EPSINON) {
+            xNextUnitVector /= nextVectorLength;
+            yNextUnitVector /= nextVectorLength;
+        }
 
-            if ((xVector * xNextUnitVector + yVector * yNextUnitVector) < DEGREES_THRESHOLD) {
-                pointerPath.push_back(newSeparation);
-                firstSeparation = newSeparation;
-                xUnitVector = 0;
-                yUnitVector = 0;
-                numSinceFirstSep = 0;
+        if ((xVector * xNextUnitVector + yVector * yNextUnitVector) < DEGREES_THRESHOLD) {
+            // the separations after the first one make a path which is not recognized
+            if (separationCount_ + 1 < points_.size()) {
+                points_[separationCount_ + 1] = newSeparation;
             }
-        }
-        xVector = nextPoint.px_ - firstSeparation.px_;
-        yVector = nextPoint.py_ - firstSeparation.py_;
-        vectorLength = hypot(xVector, yVector);
-        numSinceFirstSep += 1;
-        if (vectorLength > EPSINON) {
-            xUnitVector += xVector / vectorLength;
-            yUnitVector += yVector / vectorLength;
+            separationCount_++;
+            firstSeparation_ = newSeparation;
+            xUnitVector_ = 0;
+            yUnitVector_ = 0;
+            numSinceFirstSep_ = 0;
         }
     }
-    pointerPath.push_back(nextPoint);
-    return pointerPath;
+    xVector = point.px_ - firstSeparation_.px_;
+    yVector = point.py_ - firstSeparation_.py_;
+    vectorLength_ = hypot(xVector, yVector);
+    numSinceFirstSep_ += 1;
+    if (vectorLength_ > EPSINON) {
+        xUnitVector_ += xVector / vectorLength_;
+        yUnitVector_ += yVector / vectorLength_;
+    }
+    lastPoint_ = point;
+    routeSize_++;
 }
 
 int32_t TouchExploration::GetSwipeDirection(const int32_t dx, const int32_t dy)
@@ -611,22 +605,23 @@ void TouchExploration::HandleOneFingerSwipeStateUp(MMI::PointerEvent &event)
     AddOneFingerSwipeEvent(event);
     CancelPostEvent(TouchExplorationMsg::SWIPE_COMPLETE_TIMEOUT_MSG);
 
-    if (oneFingerSwipeRoute_.size() < LIMIT_SIZE_TWO) {
+    if (oneFingerSwipePath_.GetRouteSize() < LIMIT_SIZE_TWO) {
         Clear();
         SetCurrentState(TouchExplorationState::TOUCH_INIT);
         return;
     }
 
-    std::vector<Pointer> pointerPath = GetOneFingerSwipePath();
-    if (pointerPath.size() == LIMIT_SIZE_TWO) {
-        int32_t swipeDirection = GetSwipeDirection(pointerPath[1].px_ - pointerPath[0].px_,
-            pointerPath[1].py_ - pointerPath[0].py_);
+    // the path is split while the route grows, the points are not walked again here
+    const OneFingerSwipePath &path = oneFingerSwipePath_;
+    if (path.GetSize() == LIMIT_SIZE_TWO) {
+        int32_t swipeDirection = GetSwipeDirection(path.GetPoint(1).px_ - path.GetPoint(0).px_,
+            path.GetPoint(1).py_ - path.GetPoint(0).py_);
         SendGestureEventToAA(GESTURE_DIRECTION[swipeDirection], event.GetTargetDisplayId());
-    } else if (pointerPath.size() == LIMIT_SIZE_THREE) {
-        int32_t swipeDirectionH = GetSwipeDirection(pointerPath[1].px_ - pointerPath[0].px_,
-            pointerPath[1].py_ - pointerPath[0].py_);
-        int32_t swipeDirectionHV = GetSwipeDirection(pointerPath[2].px_ - pointerPath[1].px_,
-            pointerPath[2].py_ - pointerPath[1].py_);
+    } else if (path.GetSize() == LIMIT_SIZE_THREE) {
+        int32_t swipeDirectionH = GetSwipeDirection(path.GetPoint(1).px_ - path.GetPoint(0).px_,
+            path.GetPoint(1).py_ - path.GetPoint(0).py_);
+        int32_t swipeDirectionHV = GetSwipeDirection(path.GetPoint(2).px_ - path.GetPoint(1).px_,
+            path.GetPoint(2).py_ - path.GetPoint(1).py_);
         SendGestureEventToAA(GESTURE_DIRECTION_TO_ID[swipeDirectionH][swipeDirectionHV], event.GetTargetDisplayId());
     }
 
@@ -686,7 +681,7 @@ bool TouchExploration::RecordFocusedLocation(MMI::PointerEvent &event)
 void TouchExploration::HandleOneFingerSingleTapStateDown(MMI::PointerEvent &event)
 {
     CancelPostEvent(TouchExplorationMsg::SEND_HOVER_MSG);
-    if (receivedPointerEvents_.empty()) {
+    if (receivedPointerEvents_.IsEmpty()) {
         Clear();
         SetCurrentState(TouchExplorationState::INVALID);
         return;
@@ -694,15 +689,13 @@ void TouchExploration::HandleOneFingerSingleTapStateDown(MMI::PointerEvent &even
 
     MMI::PointerEvent::PointerItem curPointerItem;
     event.GetPointerItem(event.GetPointerId(), curPointerItem);
-    MMI::PointerEvent preDownEvent = receivedPointerEvents_.front();
-    MMI::PointerEvent::PointerItem preDownPointerItem;
-    preDownEvent.GetPointerItem(preDownEvent.GetPointerId(), preDownPointerItem);
-    int32_t durationX = preDownPointerItem.GetDisplayX() - curPointerItem.GetDisplayX();
-    int32_t durationY = preDownPointerItem.GetDisplayY() - curPointerItem.GetDisplayY();
+    const PointerSample &preDownSample = receivedPointerEvents_.GetFirst();
+    int32_t durationX = preDownSample.displayX - curPointerItem.GetDisplayX();
+    int32_t durationY = preDownSample.displayY - curPointerItem.GetDisplayY();
     if (durationX * durationX + durationY * durationY > multiTapOffsetThresh_ * multiTapOffsetThresh_) {
         HoverEventRunner();
         Clear();
-        receivedPointerEvents_.push_back(event);
+        receivedPointerEvents_.RecordForReplay(event);
         SetCurrentState(TouchExplorationState::ONE_FINGER_DOWN);
         handler_->SendEvent(static_cast<uint32_t>(TouchExplorationMsg::SEND_HOVER_MSG), 0,
             static_cast<int32_t>(TimeoutDuration::DOUBLE_TAP_TIMEOUT));
@@ -714,7 +707,7 @@ void TouchExploration::HandleOneFingerSingleTapStateDown(MMI::PointerEvent &even
     }
 
     Clear();
-    receivedPointerEvents_.push_back(event);
+    receivedPointerEvents_.RecordForReplay(event);
     handler_->SendEvent(static_cast<uint32_t>(TouchExplorationMsg::DOUBLE_TAP_AND_LONG_PRESS_MSG), 0,
         static_cast<int32_t>(TimeoutDuration::LONG_PRESS_TIMEOUT));
     SetCurrentState(TouchExplorationState::ONE_FINGER_SINGLE_TAP_THEN_DOWN);
@@ -783,15 +776,16 @@ void TouchExploration::HandleOneFingerSingleTapThenDownStateUp(MMI::PointerEvent
 
 void TouchExploration::HandleOneFingerSingleTapThenDownStateMove(MMI::PointerEvent &event)
 {
+    if (receivedPointerEvents_.IsEmpty()) {
+        return;
+    }
+
     MMI::PointerEvent::PointerItem pointerItem;
     event.GetPointerItem(event.GetPointerId(), pointerItem);
 
-    MMI::PointerEvent startPointerEvent = receivedPointerEvents_.front();
-    MMI::PointerEvent::PointerItem startPointerItem;
-    startPointerEvent.GetPointerItem(startPointerEvent.GetPointerId(), startPointerItem);
-
-    float offsetX = startPointerItem.GetDisplayX() - pointerItem.GetDisplayX();
-    float offsetY = startPointerItem.GetDisplayY() - pointerItem.GetDisplayY();
+    const PointerSample &startSample = receivedPointerEvents_.GetFirst();
+    float offsetX = startSample.displayX - pointerItem.GetDisplayX();
+    float offsetY = startSample.displayY - pointerItem.GetDisplayY();
     double duration = hypot(offsetX, offsetY);
     if (duration > moveThreshold_) {
         CancelPostEvent(TouchExplorationMsg::DOUBLE_TAP_AND_LONG_PRESS_MSG);
@@ -804,13 +798,12 @@ void TouchExploration::HandleOneFingerSingleTapThenDownStateMove(MMI::PointerEve
 void TouchExploration::OffsetEvent(MMI::PointerEvent &event, bool setZOrderFlag)
 {
     HILOG_DEBUG();
-    if (receivedPointerEvents_.empty()) {
+    if (receivedPointerEvents_.IsEmpty()) {
         HILOG_ERROR("received pointer event is null!");
         return;
     }
 
-    MMI::PointerEvent startPointerEvent = receivedPointerEvents_.front();
-    if (event.GetPointerId() != startPointerEvent.GetPointerId()) {
+    if (event.GetPointerId() != receivedPointerEvents_.GetFirst().pointerId) {
         return;
     }
 
@@ -844,16 +837,17 @@ void TouchExploration::OffsetEvent(MMI::PointerEvent &event, bool setZOrderFlag)
 
 bool TouchExploration::SendDoubleTapAndLongPressDownEvent()
 {
-    if (receivedPointerEvents_.empty()) {
+    std::list<MMI::PointerEvent> &replayEvents = receivedPointerEvents_.GetReplayEvents();
+    if (replayEvents.empty()) {
         HILOG_ERROR("receivedPointerEvents_ is empty!");
         return false;
     }
-    if (!RecordFocusedLocation(receivedPointerEvents_.front())) {
+    if (!RecordFocusedLocation(replayEvents.front())) {
         return false;
     }
-    OffsetEvent(receivedPointerEvents_.front(), true);
-    SendEventToMultimodal(receivedPointerEvents_.front(), ChangeAction::NO_CHANGE);
-    uint64_t displayId = static_cast<uint64_t>(receivedPointerEvents_.front().GetTargetDisplayId());
+    OffsetEvent(replayEvents.front(), true);
+    SendEventToMultimodal(replayEvents.front(), ChangeAction::NO_CHANGE);
+    uint64_t displayId = static_cast<uint64_t>(replayEvents.front().GetTargetDisplayId());
     Singleton<ExtendServiceManager>::GetInstance().sendTouchGuideGestureToAACallback(
         displayId, ONE_FINGER_DOUBLE_TAP_HOLD_BEGIN);
     return true;
@@ -879,17 +873,16 @@ void TouchExploration::HandleOneFingerDoubleTapAndLongPressState(MMI::PointerEve
 
 void TouchExploration::Clear()
 {
-    receivedPointerEvents_.clear();
+    receivedPointerEvents_.Clear();
     draggingDownEvent_ = nullptr;
     offsetX_ = 0;
     offsetY_ = 0;
-    oneFingerSwipeRoute_.clear();
+    oneFingerSwipePath_.Clear();
     oneFingerSwipePrePointer_ = {};
     draggingPid_ = -1;
     multiTapNum_ = 0;
     multiFingerSwipeDirection_ = -1;
-    multiFingerSwipeRoute_.clear();
-    multiFingerSwipePrePoint_.clear();
+    multiFingerSwipeRouteCount_ = 0;
 }
 
 void TouchExploration::DestroyEvents()
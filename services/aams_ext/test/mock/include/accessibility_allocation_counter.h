@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ACCESSIBILITY_ALLOCATION_COUNTER_H
+#define ACCESSIBILITY_ALLOCATION_COUNTER_H
+
+#include <cstdint>
+
+namespace OHOS {
+namespace Accessibility {
+/**
+ * @brief The allocations of the test binary, counted by the operator new of accessibility_allocation_counter.cpp.
+ *        A test reads the count before and after the events it replays.
+ */
+class AllocationCounter {
+public:
+    static uint64_t GetCount();
+
+    // the allocations made by a call, the call is made once to warm up any lazy state before it is counted
+    template<typename Func>
+    static uint64_t Count(Func &&func)
+    {
+        func();
+        uint64_t count = GetCount();
+        func();
+        return GetCount() - count;
+    }
+};
+} // namespace Accessibility
+} // namespace OHOS
+#endif // ACCESSIBILITY_ALLOCATION_COUNTER_H
@@ -15,6 +15,7 @@
 
 // LCOV_EXCL_START
 #include "extend_service_manager.h"
+#include "accessibility_ut_helper.h"
 #include "ext_utils.h"
 
 using namespace std;
@@ -43,8 +44,9 @@ static void MockSendTouchGuideGestureToAACallback(uint64_t displayId, const std:
 }
 static void MockSendAccessibilityEventToAACallback(EventType eventType, GestureType gestureId, uint64_t displayId)
 {
-    (void) eventType;
-    (void) gestureId;
+    if (eventType == EventType::TYPE_GESTURE_EVENT) {
+        AccessibilityAbilityHelper::GetInstance().SetGestureId(static_cast<int>(gestureId));
+    }
 }
 static bool MockFindFocusedElementCallback(AccessibilityElementInfo &elementInfo, uint32_t timeout, uint64_t displayId)
 {
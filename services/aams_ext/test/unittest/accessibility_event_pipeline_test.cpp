@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include "accessibility_event_pipeline.h"
+#include "accessibility_touch_exploration.h"
+#include "accessibility_ut_helper.h"
+#include "accessibility_zoom_gesture.h"
+#include "full_screen_magnification_manager.h"
+#include "magnification_menu_manager.h"
+#include "window_magnification_manager.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Accessibility {
+namespace {
+    constexpr int32_t BENCHMARK_EVENT_COUNT = 100000;
+
+    // the last stage, counts the events and the destroys which crossed the chain
+    class CountingStage : public EventTransmission {
+    public:
+        bool OnPointerEvent(MMI::PointerEvent &event) override
+        {
+            (void)event;
+            eventCount_++;
+            return true;
+        }
+        void DestroyEvents() override
+        {
+            destroyCount_++;
+        }
+        int32_t eventCount_ = 0;
+        int32_t destroyCount_ = 0;
+    };
+} // namespace
+
+class AccessibilityEventPipelineTest : public testing::Test {
+public:
+    AccessibilityEventPipelineTest()
+    {}
+    ~AccessibilityEventPipelineTest()
+    {}
+
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+    int64_t ReplayMouseMoves(const sptr<EventTransmission> &header);
+
+    sptr<TouchExploration> touchExploration_ = nullptr;
+    sptr<AccessibilityZoomGesture> zoomGesture_ = nullptr;
+    sptr<CountingStage> tail_ = nullptr;
+    std::shared_ptr<FullScreenMagnificationManager> fullScreenManager_ = nullptr;
+    std::shared_ptr<WindowMagnificationManager> windowMagnificationManager_ = nullptr;
+    std::shared_ptr<MagnificationMenuManager> menuManager_ = nullptr;
+};
+
+void AccessibilityEventPipelineTest::SetUpTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityEventPipelineTest Start ######################";
+}
+
+void AccessibilityEventPipelineTest::TearDownTestCase()
+{
+    GTEST_LOG_(INFO) << "###################### AccessibilityEventPipelineTest End ######################";
+}
+
+void AccessibilityEventPipelineTest::SetUp()
+{
+    GTEST_LOG_(INFO) << "SetUp";
+    fullScreenManager_ = std::make_shared<FullScreenMagnificationManager>();
+    windowMagnificationManager_ = std::make_shared<WindowMagnificationManager>();
+    menuManager_ = std::make_shared<MagnificationMenuManager>();
+    zoomGesture_ = new(std::nothrow) AccessibilityZoomGesture(fullScreenManager_, windowMagnificationManager_,
+        menuManager_);
+    touchExploration_ = new(std::nothrow) TouchExploration();
+    if (touchExploration_ != nullptr) {
+        touchExploration_->StartUp();
+    }
+    tail_ = new(std::nothrow) CountingStage();
+}
+
+void AccessibilityEventPipelineTest::TearDown()
+{
+    GTEST_LOG_(INFO) << "TearDown";
+    touchExploration_ = nullptr;
+    zoomGesture_ = nullptr;
+    tail_ = nullptr;
+    fullScreenManager_ = nullptr;
+    windowMagnificationManager_ = nullptr;
+    menuManager_ = nullptr;
+}
+
+// the zoom gesture and the touch exploration pass the mouse moves on, so every stage is crossed
+int64_t AccessibilityEventPipelineTest::ReplayMouseMoves(const sptr<EventTransmission> &header)
+{
+    std::shared_ptr<MMI::PointerEvent> event = MMI::PointerEvent::Create();
+    event->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+    event->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_MOVE);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < BENCHMARK_EVENT_COUNT; i++) {
+        header->OnPointerEvent(*event);
+    }
+    int64_t costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    return costNs / BENCHMARK_EVENT_COUNT;
+}
+
+/**
+ * @tc.number: AccessibilityEventPipelineTest_Unittest_OnPointerEvent001
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Report the latency per event of the touch exploration in the dynamic chain and in the pipeline.
+ */
+HWTEST_F(AccessibilityEventPipelineTest, AccessibilityEventPipelineTest_Unittest_OnPointerEvent001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityEventPipelineTest_Unittest_OnPointerEvent001 start";
+    ASSERT_TRUE(touchExploration_ != nullptr && tail_ != nullptr);
+
+    touchExploration_->SetNext(tail_);
+    int64_t dynamicNs = ReplayMouseMoves(touchExploration_);
+    EXPECT_EQ(tail_->eventCount_, BENCHMARK_EVENT_COUNT);
+
+    tail_->eventCount_ = 0;
+    sptr<EventTransmission> pipeline =
+        new(std::nothrow) EventPipeline<CountingStage, TouchExploration>(tail_, touchExploration_);
+    ASSERT_TRUE(pipeline != nullptr);
+    int64_t compiledNs = ReplayMouseMoves(pipeline);
+    EXPECT_EQ(tail_->eventCount_, BENCHMARK_EVENT_COUNT);
+    GTEST_LOG_(INFO) << "touch exploration, dynamic chain: " << dynamicNs << " ns/event, compiled pipeline: " <<
+        compiledNs << " ns/event";
+    GTEST_LOG_(INFO) << "AccessibilityEventPipelineTest_Unittest_OnPointerEvent001 end";
+}
+
+/**
+ * @tc.number: AccessibilityEventPipelineTest_Unittest_OnPointerEvent002
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Report the latency per event of the zoom gesture and the touch exploration in the dynamic chain and
+ *           in the pipeline.
+ */
+HWTEST_F(AccessibilityEventPipelineTest, AccessibilityEventPipelineTest_Unittest_OnPointerEvent002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityEventPipelineTest_Unittest_OnPointerEvent002 start";
+    ASSERT_TRUE(zoomGesture_ != nullptr && touchExploration_ != nullptr && tail_ != nullptr);
+
+    zoomGesture_->SetNext(touchExploration_);
+    touchExploration_->SetNext(tail_);
+    int64_t dynamicNs = ReplayMouseMoves(zoomGesture_);
+    EXPECT_EQ(tail_->eventCount_, BENCHMARK_EVENT_COUNT);
+
+    tail_->eventCount_ = 0;
+    sptr<EventTransmission> pipeline = new(std::nothrow) EventPipeline<CountingStage, AccessibilityZoomGesture,
+        TouchExploration>(tail_, zoomGesture_, touchExploration_);
+    ASSERT_TRUE(pipeline != nullptr);
+    int64_t compiledNs = ReplayMouseMoves(pipeline);
+    EXPECT_EQ(tail_->eventCount_, BENCHMARK_EVENT_COUNT);
+    GTEST_LOG_(INFO) << "zoom and touch exploration, dynamic chain: " << dynamicNs <<
+        " ns/event, compiled pipeline: " << compiledNs << " ns/event";
+    GTEST_LOG_(INFO) << "AccessibilityEventPipelineTest_Unittest_OnPointerEvent002 end";
+}
+
+/**
+ * @tc.number: AccessibilityEventPipelineTest_Unittest_OnPointerEvent003
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Check a stage relinked by SetNext after BindNext goes back to the dynamic hop.
+ */
+HWTEST_F(AccessibilityEventPipelineTest, AccessibilityEventPipelineTest_Unittest_OnPointerEvent003,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityEventPipelineTest_Unittest_OnPointerEvent003 start";
+    ASSERT_TRUE(touchExploration_ != nullptr && tail_ != nullptr);
+    sptr<CountingStage> otherTail = new(std::nothrow) CountingStage();
+    ASSERT_TRUE(otherTail != nullptr);
+
+    touchExploration_->BindNext(tail_);
+    touchExploration_->SetNext(otherTail);
+    std::shared_ptr<MMI::PointerEvent> event = MMI::PointerEvent::Create();
+    event->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_MOUSE);
+    event->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_MOVE);
+    touchExploration_->OnPointerEvent(*event);
+    EXPECT_EQ(tail_->eventCount_, 0);
+    EXPECT_EQ(otherTail->eventCount_, 1);
+    GTEST_LOG_(INFO) << "AccessibilityEventPipelineTest_Unittest_OnPointerEvent003 end";
+}
+
+/**
+ * @tc.number: AccessibilityEventPipelineTest_Unittest_DestroyEvents001
+ * @tc.name: DestroyEvents
+ * @tc.desc: Check the destroy of a pipeline reaches every stage and the tail.
+ */
+HWTEST_F(AccessibilityEventPipelineTest, AccessibilityEventPipelineTest_Unittest_DestroyEvents001,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityEventPipelineTest_Unittest_DestroyEvents001 start";
+    ASSERT_TRUE(zoomGesture_ != nullptr && touchExploration_ != nullptr && tail_ != nullptr);
+
+    sptr<EventTransmission> pipeline = new(std::nothrow) EventPipeline<CountingStage, AccessibilityZoomGesture,
+        TouchExploration>(tail_, zoomGesture_, touchExploration_);
+    ASSERT_TRUE(pipeline != nullptr);
+    pipeline->DestroyEvents();
+    EXPECT_EQ(tail_->destroyCount_, 1);
+    GTEST_LOG_(INFO) << "AccessibilityEventPipelineTest_Unittest_DestroyEvents001 end";
+}
+} // namespace Accessibility
+} // namespace OHOS
@@ -14,6 +14,8 @@
  */
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
 #include "accessibility_common_helper.h"
 #include "accessibility_input_interceptor.h"
 #include "accessibility_ut_helper.h"
@@ -28,6 +30,8 @@ namespace OHOS {
 namespace Accessibility {
 namespace {
     constexpr uint32_t SLEEP_TIME_3 = 3;
+    constexpr int32_t REPLAY_COUNT = 2000;
+    constexpr uint32_t SLEEP_US_100 = 100;
 } // namespace
 
 class AccessibilityInputInterceptorTest : public testing::Test {
@@ -475,5 +479,54 @@ HWTEST_F(AccessibilityInputInterceptorTest, AccessibilityInputInterceptorTest_Un
     inputInterceptor_->ProcessKeyEvent(event);
     GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_ProcessKeyEvent001 end";
 }
+
+/**
+ * @tc.number: AccessibilityInputInterceptorTest_Unittest_ProcessPointerEvent002
+ * @tc.name: ProcessPointerEvent
+ * @tc.desc: Replay touch events while the features are toggled, every event goes through one chain.
+ */
+HWTEST_F(AccessibilityInputInterceptorTest, AccessibilityInputInterceptorTest_Unittest_ProcessPointerEvent002,
+    TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_ProcessPointerEvent002 start";
+    inputInterceptor_->SetAvailableFunctions(0);
+    sleep(SLEEP_TIME_3);
+    AccessibilityAbilityHelper::GetInstance().ClearTouchEventActionVector();
+    MMI::MockInputManager::ClearTouchActions();
+
+    std::atomic<bool> isReplaying = true;
+    std::thread replayThread([this, &isReplaying] {
+        std::shared_ptr<MMI::PointerEvent> event = MMI::PointerEvent::Create();
+        MMI::PointerEvent::PointerItem item = {};
+        item.SetPointerId(1);
+        event->AddPointerItem(item);
+        event->SetPointerId(1);
+        event->SetSourceType(MMI::PointerEvent::SOURCE_TYPE_TOUCHSCREEN);
+        event->SetPointerAction(MMI::PointerEvent::POINTER_ACTION_MOVE);
+        for (int32_t i = 0; i < REPLAY_COUNT; i++) {
+            inputInterceptor_->ProcessPointerEvent(event);
+        }
+        isReplaying.store(false);
+    });
+
+    uint32_t functions[] = {AccessibilityInputInterceptor::FEATURE_MOUSE_AUTOCLICK,
+        AccessibilityInputInterceptor::FEATURE_INJECT_TOUCH_EVENTS | AccessibilityInputInterceptor::FEATURE_MOUSE_KEY};
+    uint32_t toggleCount = 0;
+    while (isReplaying.load()) {
+        inputInterceptor_->SetAvailableFunctions(functions[toggleCount % 2]);
+        toggleCount++;
+        usleep(SLEEP_US_100);
+    }
+    replayThread.join();
+    inputInterceptor_->SetAvailableFunctions(0);
+    sleep(SLEEP_TIME_3);
+    GTEST_LOG_(INFO) << "toggled the features " << toggleCount << " times";
+
+    // an event runs either the transmitters of a chain or goes straight back to the input manager
+    size_t handledCount = AccessibilityAbilityHelper::GetInstance().GetTouchEventActionVector().size() +
+        MMI::MockInputManager::GetTouchActions().size();
+    EXPECT_EQ(handledCount, static_cast<size_t>(REPLAY_COUNT));
+    GTEST_LOG_(INFO) << "AccessibilityInputInterceptorTest_Unittest_ProcessPointerEvent002 end";
+}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -14,7 +14,12 @@
  */
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include "accessibility_allocation_counter.h"
 #include "accessibility_common_helper.h"
+#ifdef OHOS_BUILD_ENABLE_DISPLAY_MANAGER
+#include "accessibility_display_manager.h"
+#endif
 #include "accessibility_element_operator_proxy.h"
 #include "accessibility_touch_exploration.h"
 #include "accessibility_ut_helper.h"
@@ -36,6 +41,26 @@ namespace {
     constexpr int32_t DISPLAY_500 = 500;
     constexpr int32_t DISPLAY_1000 = 1000;
     constexpr int32_t DISPLAY_1500 = 1500;
+    constexpr int32_t SWIPE_STEP = 300;
+    constexpr int32_t MULTI_SWIPE_STEP = 400;
+    constexpr int32_t MULTI_SWIPE_MOVE_COUNT = 4;
+    constexpr int32_t SIMULATE_POINT_ID = 10000;
+    constexpr size_t ROUTE_SIZE_3 = 3;
+    constexpr size_t ROUTE_SIZE_4 = 4;
+    constexpr int32_t TAP_TIMES_1 = 1;
+    constexpr int32_t TAP_TIMES_2 = 2;
+    constexpr int32_t TAP_TIMES_3 = 3;
+    constexpr int32_t FINGER_NUM_2 = 2;
+    constexpr int32_t FINGER_NUM_3 = 3;
+    constexpr int32_t FINGER_NUM_4 = 4;
+    constexpr uint32_t SLEEP_S_1 = 1; // longer than the double tap timeout of the multi-finger taps
+    constexpr int32_t DISPLAY_100 = 100;
+    constexpr int32_t DISPLAY_600 = 600;
+    constexpr int32_t DISPLAY_800 = 800;
+    constexpr int32_t DISPLAY_2250 = 2250;
+    constexpr int32_t DISPLAY_2500 = 2500;
+    constexpr int32_t DISPLAY_3500 = 3500;
+    constexpr int32_t DISPLAY_5000 = 5000;
 } // namespace
 
 class TouchExplorationTest : public testing::Test {
@@ -48,6 +73,8 @@ public:
     static void SetUpTestCase();
     static void TearDownTestCase();
     static void SetTouchExplorationPoint(MMI::PointerEvent::PointerItem &point, int id, int x, int y);
+    static std::vector<MMI::PointerEvent::PointerItem> CreateFingerPoints(int32_t fingerNum, int32_t firstPointerId,
+        int32_t displayX, int32_t displayY, int32_t stepX, int32_t stepY);
     void SetUp() override;
     void TearDown() override;
 
@@ -56,6 +83,14 @@ protected:
         int32_t displayY);
     std::shared_ptr<MMI::PointerEvent> CreateTouchEvent(int32_t action,
         std::vector<MMI::PointerEvent::PointerItem> &points, int32_t pointerCount);
+    // the traces below are the ones of the touch exploration module test
+    void ReplayOneFingerSwipe(const std::vector<MMI::PointerEvent::PointerItem> &route);
+    void ReplayTwoFingerTap(const std::vector<MMI::PointerEvent::PointerItem> &fingers, int32_t tapTimes,
+        bool holdFlag);
+    void ReplayMultiFingerTap(const std::vector<MMI::PointerEvent::PointerItem> &fingers, int32_t tapTimes,
+        bool holdFlag);
+    void ReplayMultiFingerSwipe(const std::vector<MMI::PointerEvent::PointerItem> &startPoints,
+        const std::vector<MMI::PointerEvent::PointerItem> &endPoints);
     std::unique_ptr<TouchExploration> touchExploration_ = nullptr;
 };
 
@@ -66,6 +101,16 @@ void TouchExplorationTest::SetTouchExplorationPoint(MMI::PointerEvent::PointerIt
     point.SetDisplayY(y);
 }
 
+std::vector<MMI::PointerEvent::PointerItem> TouchExplorationTest::CreateFingerPoints(int32_t fingerNum,
+    int32_t firstPointerId, int32_t displayX, int32_t displayY, int32_t stepX, int32_t stepY)
+{
+    std::vector<MMI::PointerEvent::PointerItem> points(fingerNum);
+    for (int32_t i = 0; i < fingerNum; i++) {
+        SetTouchExplorationPoint(points[i], firstPointerId + i, displayX + stepX * i, displayY + stepY * i);
+    }
+    return points;
+}
+
 void TouchExplorationTest::SetUpTestCase()
 {
     GTEST_LOG_(INFO) << "TouchExplorationTest SetUpTestCase";
@@ -136,6 +181,106 @@ std::shared_ptr<MMI::PointerEvent> TouchExplorationTest::CreateTouchEvent(int32_
     return pointerEvent;
 }
 
+void TouchExplorationTest::ReplayOneFingerSwipe(const std::vector<MMI::PointerEvent::PointerItem> &route)
+{
+    // the swipe path is built from the raw coordinates
+    std::vector<MMI::PointerEvent::PointerItem> points(1);
+    for (size_t i = 0; i < route.size(); i++) {
+        points[0] = route[i];
+        points[0].SetRawDisplayX(route[i].GetDisplayX());
+        points[0].SetRawDisplayY(route[i].GetDisplayY());
+        int32_t action = i == 0 ? MMI::PointerEvent::POINTER_ACTION_DOWN : MMI::PointerEvent::POINTER_ACTION_MOVE;
+        std::shared_ptr<MMI::PointerEvent> event = CreateTouchEvent(action, points, points[0].GetPointerId());
+        touchExploration_->OnPointerEvent(*event);
+    }
+
+    std::shared_ptr<MMI::PointerEvent> event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP, points,
+        points[0].GetPointerId());
+    touchExploration_->OnPointerEvent(*event);
+}
+
+void TouchExplorationTest::ReplayTwoFingerTap(const std::vector<MMI::PointerEvent::PointerItem> &fingers,
+    int32_t tapTimes, bool holdFlag)
+{
+    std::vector<MMI::PointerEvent::PointerItem> points = {};
+    std::shared_ptr<MMI::PointerEvent> event = nullptr;
+    for (int32_t tapIndex = 1; tapIndex <= tapTimes; tapIndex++) {
+        points = {fingers[0]};
+        event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_DOWN, points, fingers[0].GetPointerId());
+        touchExploration_->OnPointerEvent(*event);
+
+        points.emplace_back(fingers[1]);
+        event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_DOWN, points, fingers[1].GetPointerId());
+        touchExploration_->OnPointerEvent(*event);
+
+        event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, points, fingers[0].GetPointerId());
+        touchExploration_->OnPointerEvent(*event);
+
+        if (holdFlag && tapIndex == tapTimes) {
+            sleep(SLEEP_S_1);
+        }
+
+        event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP, points, fingers[0].GetPointerId());
+        touchExploration_->OnPointerEvent(*event);
+
+        points = {fingers[1]};
+        event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP, points, fingers[1].GetPointerId());
+        touchExploration_->OnPointerEvent(*event);
+    }
+}
+
+void TouchExplorationTest::ReplayMultiFingerTap(const std::vector<MMI::PointerEvent::PointerItem> &fingers,
+    int32_t tapTimes, bool holdFlag)
+{
+    std::vector<MMI::PointerEvent::PointerItem> points = {};
+    std::shared_ptr<MMI::PointerEvent> event = nullptr;
+    for (int32_t tapIndex = 1; tapIndex <= tapTimes; tapIndex++) {
+        points.clear();
+        for (auto &finger : fingers) {
+            points.emplace_back(finger);
+            event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_DOWN, points, finger.GetPointerId());
+            touchExploration_->OnPointerEvent(*event);
+        }
+
+        event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, points, fingers.front().GetPointerId());
+        touchExploration_->OnPointerEvent(*event);
+
+        if (holdFlag && tapIndex == tapTimes) {
+            sleep(SLEEP_S_1);
+        }
+
+        // the last finger down is lifted first
+        while (!points.empty()) {
+            event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP, points, points.back().GetPointerId());
+            points.pop_back();
+            touchExploration_->OnPointerEvent(*event);
+        }
+    }
+}
+
+void TouchExplorationTest::ReplayMultiFingerSwipe(const std::vector<MMI::PointerEvent::PointerItem> &startPoints,
+    const std::vector<MMI::PointerEvent::PointerItem> &endPoints)
+{
+    std::vector<MMI::PointerEvent::PointerItem> points = {};
+    std::shared_ptr<MMI::PointerEvent> event = nullptr;
+    for (auto &point : startPoints) {
+        points.emplace_back(point);
+        event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_DOWN, points, point.GetPointerId());
+        touchExploration_->OnPointerEvent(*event);
+    }
+
+    // every finger reaches its end point in one move
+    points = endPoints;
+    event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, points, startPoints.front().GetPointerId());
+    touchExploration_->OnPointerEvent(*event);
+
+    while (!points.empty()) {
+        event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP, points, points.back().GetPointerId());
+        points.pop_back();
+        touchExploration_->OnPointerEvent(*event);
+    }
+}
+
 /**
  * @tc.number: HandleInitStateDown001
  * @tc.name: HandleInitStateDown
@@ -2307,5 +2452,838 @@ HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_HandleThreeFingersSwipe
 
     GTEST_LOG_(INFO) << "TouchExploration_Unittest_HandleThreeFingersSwipeStateDown_001 end";
 }
+
+/**
+ * @tc.number: OnPointerEvent001
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay a recorded two-finger drag, bound the allocations and report the time per event.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_001 start";
+    constexpr int32_t moveCount = 1000;
+
+    touchExploration_->SetCurrentState(TouchExplorationState::TOUCH_INIT);
+    std::vector<MMI::PointerEvent::PointerItem> points = {};
+    MMI::PointerEvent::PointerItem firstPoint = {};
+    SetTouchExplorationPoint(firstPoint, POINT_ID_0, 0, 0);
+    points.emplace_back(firstPoint);
+    std::shared_ptr<MMI::PointerEvent> event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_DOWN, points,
+        POINT_ID_0);
+    touchExploration_->OnPointerEvent(*event);
+
+    MMI::PointerEvent::PointerItem secondPoint = {};
+    SetTouchExplorationPoint(secondPoint, POINT_ID_1, DISPLAY_10, 0);
+    points.emplace_back(secondPoint);
+    event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_DOWN, points, POINT_ID_1);
+    touchExploration_->OnPointerEvent(*event);
+
+    // the events are created before the replay, so only the work of the recognizer is measured
+    std::vector<std::shared_ptr<MMI::PointerEvent>> moveEvents;
+    for (int32_t i = 1; i <= moveCount; i++) {
+        points.clear();
+        SetTouchExplorationPoint(firstPoint, POINT_ID_0, 0, DISPLAY_500 + i);
+        SetTouchExplorationPoint(secondPoint, POINT_ID_1, DISPLAY_10, DISPLAY_500 + i);
+        points.emplace_back(firstPoint);
+        points.emplace_back(secondPoint);
+        moveEvents.push_back(CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, points, POINT_ID_1));
+    }
+    touchExploration_->OnPointerEvent(*moveEvents[0]);
+    EXPECT_EQ(touchExploration_->GetCurrentState(), TouchExplorationState::TWO_FINGERS_DRAG);
+    AccessibilityAbilityHelper::GetInstance().ClearTouchEventActionVector();
+
+    // a drag move still reads the pointer ids three times, looks up the display and copies the event it sends on,
+    // the history must not add a copy of its own
+    constexpr uint64_t pointerIdReads = 3;
+    uint64_t eventCopy = AllocationCounter::Count([&moveEvents]() { MMI::PointerEvent copy(*moveEvents[0]); });
+    uint64_t pointerIdRead = AllocationCounter::Count([&moveEvents]() { moveEvents[0]->GetPointerIds(); });
+    uint64_t displayLookup = 0;
+#ifdef OHOS_BUILD_ENABLE_DISPLAY_MANAGER
+    displayLookup = AllocationCounter::Count([]() {
+        Singleton<AccessibilityDisplayManager>::GetInstance().GetDefaultDisplay();
+    });
+#endif
+    uint64_t allocationBound = (eventCopy + pointerIdReads * pointerIdRead + displayLookup) * (moveCount - 1);
+
+    uint64_t allocationCount = AllocationCounter::GetCount();
+    auto start = std::chrono::steady_clock::now();
+    for (int32_t i = 1; i < moveCount; i++) {
+        touchExploration_->OnPointerEvent(*moveEvents[i]);
+    }
+    int64_t costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    uint64_t allocations = AllocationCounter::GetCount() - allocationCount;
+    GTEST_LOG_(INFO) << "replay " << (moveCount - 1) << " drag moves: " << (costNs / (moveCount - 1)) <<
+        " ns/event, " << (static_cast<double>(allocations) / (moveCount - 1)) << " allocations/event";
+    // the log of the forwarded actions in the mock grows a few times over the replay
+    constexpr uint64_t actionLogGrowth = 16;
+    EXPECT_LE(allocations, allocationBound + actionLogGrowth);
+    EXPECT_EQ(touchExploration_->GetCurrentState(), TouchExplorationState::TWO_FINGERS_DRAG);
+
+    event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP, points, POINT_ID_1);
+    touchExploration_->OnPointerEvent(*event);
+    points.pop_back();
+    event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP, points, POINT_ID_0);
+    touchExploration_->OnPointerEvent(*event);
+    EXPECT_EQ(touchExploration_->GetCurrentState(), TouchExplorationState::TOUCH_INIT);
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_001 end";
+}
+
+/**
+ * @tc.number: HandleOneFingerSwipeStateUp003
+ * @tc.name: HandleOneFingerSwipeStateUp
+ * @tc.desc: Replay a swipe right then left and check the recognized gesture.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_HandleOneFingerSwipeStateUp_003, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_HandleOneFingerSwipeStateUp_003 start";
+
+    touchExploration_->SetCurrentState(TouchExplorationState::TOUCH_INIT);
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<int32_t> routeX = {DISPLAY_1000, DISPLAY_1000 + SWIPE_STEP, DISPLAY_1000 + SWIPE_STEP * 2,
+        DISPLAY_1000 + SWIPE_STEP * 3, DISPLAY_1000 + SWIPE_STEP * 2, DISPLAY_1000 + SWIPE_STEP, DISPLAY_1000};
+    std::vector<MMI::PointerEvent::PointerItem> points(1);
+    for (size_t i = 0; i < routeX.size(); i++) {
+        SetTouchExplorationPoint(points[0], POINT_ID_0, routeX[i], DISPLAY_1000);
+        points[0].SetRawDisplayX(routeX[i]);
+        points[0].SetRawDisplayY(DISPLAY_1000);
+        int32_t action = i == 0 ? MMI::PointerEvent::POINTER_ACTION_DOWN : MMI::PointerEvent::POINTER_ACTION_MOVE;
+        std::shared_ptr<MMI::PointerEvent> event = CreateTouchEvent(action, points, POINT_ID_0);
+        touchExploration_->OnPointerEvent(*event);
+    }
+    EXPECT_EQ(touchExploration_->GetCurrentState(), TouchExplorationState::ONE_FINGER_SWIPE);
+
+    std::shared_ptr<MMI::PointerEvent> event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP, points,
+        POINT_ID_0);
+    touchExploration_->OnPointerEvent(*event);
+
+    EXPECT_EQ(touchExploration_->GetCurrentState(), TouchExplorationState::TOUCH_INIT);
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_SWIPE_RIGHT_THEN_LEFT));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_HandleOneFingerSwipeStateUp_003 end";
+}
+
+/**
+ * @tc.number: HandleThreeFingersSwipeStateUp001
+ * @tc.name: HandleThreeFingersSwipeStateUp
+ * @tc.desc: Replay a three-finger swipe down and check the recognized gesture.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_HandleThreeFingersSwipeStateUp_001, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_HandleThreeFingersSwipeStateUp_001 start";
+
+    touchExploration_->SetCurrentState(TouchExplorationState::TOUCH_INIT);
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<int32_t> pointerIds = {POINT_ID_0, POINT_ID_1, POINT_ID_2};
+    std::vector<MMI::PointerEvent::PointerItem> points = {};
+    std::shared_ptr<MMI::PointerEvent> event = nullptr;
+    for (size_t i = 0; i < pointerIds.size(); i++) {
+        MMI::PointerEvent::PointerItem point = {};
+        SetTouchExplorationPoint(point, pointerIds[i], DISPLAY_500 * static_cast<int32_t>(i), 0);
+        points.emplace_back(point);
+        event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_DOWN, points, pointerIds[i]);
+        touchExploration_->OnPointerEvent(*event);
+    }
+
+    // every finger moves down in turn, the first move starts the swipe
+    for (int32_t moveIndex = 1; moveIndex <= MULTI_SWIPE_MOVE_COUNT; moveIndex++) {
+        for (size_t i = 0; i < pointerIds.size(); i++) {
+            points[i].SetDisplayY(MULTI_SWIPE_STEP * moveIndex);
+            event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, points, pointerIds[i]);
+            touchExploration_->OnPointerEvent(*event);
+        }
+    }
+    EXPECT_EQ(touchExploration_->GetCurrentState(), TouchExplorationState::THREE_FINGERS_SWIPE);
+
+    for (size_t i = 0; i < pointerIds.size(); i++) {
+        event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP, points, pointerIds[i]);
+        touchExploration_->OnPointerEvent(*event);
+        points.erase(points.begin());
+    }
+
+    EXPECT_EQ(touchExploration_->GetCurrentState(), TouchExplorationState::TOUCH_INIT);
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_THREE_FINGER_SWIPE_DOWN));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_HandleThreeFingersSwipeStateUp_001 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent002
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the one-finger swipe left then right trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_002, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_002 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> route(ROUTE_SIZE_4);
+    SetTouchExplorationPoint(route[0], POINT_ID_1, DISPLAY_2500, DISPLAY_2500);
+    SetTouchExplorationPoint(route[1], POINT_ID_1, DISPLAY_1500, DISPLAY_2500);
+    SetTouchExplorationPoint(route[2], POINT_ID_1, 0, DISPLAY_2500);
+    SetTouchExplorationPoint(route[3], POINT_ID_1, DISPLAY_2500, DISPLAY_2250);
+    ReplayOneFingerSwipe(route);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_SWIPE_LEFT_THEN_RIGHT));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_002 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent003
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the one-finger swipe down then up trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_003, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_003 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> route(ROUTE_SIZE_4);
+    SetTouchExplorationPoint(route[0], POINT_ID_1, DISPLAY_2500, DISPLAY_2500);
+    SetTouchExplorationPoint(route[1], POINT_ID_1, DISPLAY_2500, DISPLAY_3500);
+    SetTouchExplorationPoint(route[2], POINT_ID_1, DISPLAY_2500, DISPLAY_5000);
+    SetTouchExplorationPoint(route[3], POINT_ID_1, DISPLAY_2250, DISPLAY_2500);
+    ReplayOneFingerSwipe(route);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_SWIPE_DOWN_THEN_UP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_003 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent004
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the one-finger swipe right then left trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_004, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_004 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> route(ROUTE_SIZE_4);
+    SetTouchExplorationPoint(route[0], POINT_ID_1, DISPLAY_2500, DISPLAY_2500);
+    SetTouchExplorationPoint(route[1], POINT_ID_1, DISPLAY_3500, DISPLAY_2500);
+    SetTouchExplorationPoint(route[2], POINT_ID_1, DISPLAY_5000, DISPLAY_2500);
+    SetTouchExplorationPoint(route[3], POINT_ID_1, DISPLAY_2500, DISPLAY_2250);
+    ReplayOneFingerSwipe(route);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_SWIPE_RIGHT_THEN_LEFT));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_004 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent005
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the one-finger swipe up then down trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_005, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_005 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> route(ROUTE_SIZE_4);
+    SetTouchExplorationPoint(route[0], POINT_ID_1, DISPLAY_2500, DISPLAY_2500);
+    SetTouchExplorationPoint(route[1], POINT_ID_1, DISPLAY_2500, DISPLAY_1500);
+    SetTouchExplorationPoint(route[2], POINT_ID_1, DISPLAY_2500, 0);
+    SetTouchExplorationPoint(route[3], POINT_ID_1, DISPLAY_2250, DISPLAY_2500);
+    ReplayOneFingerSwipe(route);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_SWIPE_UP_THEN_DOWN));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_005 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent006
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the one-finger swipe up trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_006, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_006 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> route(ROUTE_SIZE_3);
+    SetTouchExplorationPoint(route[0], POINT_ID_1, DISPLAY_2500, DISPLAY_2500);
+    SetTouchExplorationPoint(route[1], POINT_ID_1, DISPLAY_2500, DISPLAY_1500);
+    SetTouchExplorationPoint(route[2], POINT_ID_1, DISPLAY_2500, 0);
+    ReplayOneFingerSwipe(route);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_SWIPE_UP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_006 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent007
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the two-finger single tap trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_007, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_007 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_2, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayTwoFingerTap(fingers, TAP_TIMES_1, false);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_TWO_FINGER_SINGLE_TAP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_007 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent008
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the two-finger double tap trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_008, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_008 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_2, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayTwoFingerTap(fingers, TAP_TIMES_2, false);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_TWO_FINGER_DOUBLE_TAP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_008 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent009
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the two-finger triple tap trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_009, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_009 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_2, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayTwoFingerTap(fingers, TAP_TIMES_3, false);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_TWO_FINGER_TRIPLE_TAP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_009 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent010
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the two-finger double tap and hold trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_010, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_010 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_2, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayTwoFingerTap(fingers, TAP_TIMES_2, true);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_TWO_FINGER_DOUBLE_TAP_AND_HOLD));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_010 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent011
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the two-finger triple tap and hold trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_011, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_011 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_2, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayTwoFingerTap(fingers, TAP_TIMES_3, true);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_TWO_FINGER_TRIPLE_TAP_AND_HOLD));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_011 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent012
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay a one-finger tap then, after the hover, a two-finger single tap.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_012, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_012 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_2, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    std::vector<MMI::PointerEvent::PointerItem> points = {fingers[0]};
+    std::shared_ptr<MMI::PointerEvent> event =
+        CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_DOWN, points, POINT_ID_0);
+    touchExploration_->OnPointerEvent(*event);
+    event = CreateTouchEvent(MMI::PointerEvent::POINTER_ACTION_UP, points, POINT_ID_0);
+    touchExploration_->OnPointerEvent(*event);
+    sleep(SLEEP_S_1);
+    ReplayTwoFingerTap(fingers, TAP_TIMES_1, false);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_TWO_FINGER_SINGLE_TAP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_012 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent013
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the three-finger single tap trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_013, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_013 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerTap(fingers, TAP_TIMES_1, false);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_THREE_FINGER_SINGLE_TAP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_013 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent014
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the four-finger single tap trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_014, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_014 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerTap(fingers, TAP_TIMES_1, false);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_FOUR_FINGER_SINGLE_TAP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_014 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent015
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the three-finger double tap trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_015, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_015 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerTap(fingers, TAP_TIMES_2, false);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_THREE_FINGER_DOUBLE_TAP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_015 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent016
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the three-finger double tap and hold trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_016, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_016 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerTap(fingers, TAP_TIMES_2, true);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_THREE_FINGER_DOUBLE_TAP_AND_HOLD));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_016 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent017
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the three-finger triple tap trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_017, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_017 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerTap(fingers, TAP_TIMES_3, false);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_THREE_FINGER_TRIPLE_TAP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_017 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent018
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the three-finger triple tap and hold trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_018, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_018 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerTap(fingers, TAP_TIMES_3, true);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_THREE_FINGER_TRIPLE_TAP_AND_HOLD));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_018 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent019
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the four-finger double tap trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_019, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_019 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerTap(fingers, TAP_TIMES_2, false);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_FOUR_FINGER_DOUBLE_TAP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_019 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent020
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the four-finger double tap and hold trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_020, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_020 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerTap(fingers, TAP_TIMES_2, true);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_FOUR_FINGER_DOUBLE_TAP_AND_HOLD));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_020 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent021
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the four-finger triple tap trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_021, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_021 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerTap(fingers, TAP_TIMES_3, false);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_FOUR_FINGER_TRIPLE_TAP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_021 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent022
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the four-finger triple tap and hold trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_022, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_022 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerTap(fingers, TAP_TIMES_3, true);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_FOUR_FINGER_TRIPLE_TAP_AND_HOLD));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_022 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent023
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the three-finger swipe down trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_023, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_023 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> startPoints =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    std::vector<MMI::PointerEvent::PointerItem> endPoints =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_100, DISPLAY_800, DISPLAY_100, 0);
+    ReplayMultiFingerSwipe(startPoints, endPoints);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_THREE_FINGER_SWIPE_DOWN));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_023 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent024
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the four-finger swipe down trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_024, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_024 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> startPoints =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    std::vector<MMI::PointerEvent::PointerItem> endPoints =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_100, DISPLAY_800, DISPLAY_100, 0);
+    ReplayMultiFingerSwipe(startPoints, endPoints);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_FOUR_FINGER_SWIPE_DOWN));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_024 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent025
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the three-finger swipe up trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_025, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_025 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> startPoints =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_100, DISPLAY_800, DISPLAY_100, 0);
+    std::vector<MMI::PointerEvent::PointerItem> endPoints =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerSwipe(startPoints, endPoints);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_THREE_FINGER_SWIPE_UP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_025 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent026
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the three-finger swipe left trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_026, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_026 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> startPoints =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_600, DISPLAY_100, 0, DISPLAY_100);
+    std::vector<MMI::PointerEvent::PointerItem> endPoints =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_100, DISPLAY_100, 0, DISPLAY_100);
+    ReplayMultiFingerSwipe(startPoints, endPoints);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_THREE_FINGER_SWIPE_LEFT));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_026 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent027
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the three-finger swipe right trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_027, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_027 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> startPoints =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_100, DISPLAY_100, 0, DISPLAY_100);
+    std::vector<MMI::PointerEvent::PointerItem> endPoints =
+        CreateFingerPoints(FINGER_NUM_3, POINT_ID_0, DISPLAY_600, DISPLAY_100, 0, DISPLAY_100);
+    ReplayMultiFingerSwipe(startPoints, endPoints);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_THREE_FINGER_SWIPE_RIGHT));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_027 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent028
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the four-finger swipe up trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_028, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_028 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> startPoints =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_100, DISPLAY_800, DISPLAY_100, 0);
+    std::vector<MMI::PointerEvent::PointerItem> endPoints =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerSwipe(startPoints, endPoints);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_FOUR_FINGER_SWIPE_UP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_028 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent029
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the four-finger swipe left trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_029, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_029 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> startPoints =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_600, DISPLAY_100, 0, DISPLAY_100);
+    std::vector<MMI::PointerEvent::PointerItem> endPoints =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_100, DISPLAY_100, 0, DISPLAY_100);
+    ReplayMultiFingerSwipe(startPoints, endPoints);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_FOUR_FINGER_SWIPE_LEFT));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_029 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent030
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the four-finger swipe right trace.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_030, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_030 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> startPoints =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_100, DISPLAY_100, 0, DISPLAY_100);
+    std::vector<MMI::PointerEvent::PointerItem> endPoints =
+        CreateFingerPoints(FINGER_NUM_4, POINT_ID_0, DISPLAY_600, DISPLAY_100, 0, DISPLAY_100);
+    ReplayMultiFingerSwipe(startPoints, endPoints);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_FOUR_FINGER_SWIPE_RIGHT));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_030 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent031
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the three-finger swipe down trace of simulated pointers.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_031, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_031 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> startPoints =
+        CreateFingerPoints(FINGER_NUM_3, SIMULATE_POINT_ID, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    std::vector<MMI::PointerEvent::PointerItem> endPoints =
+        CreateFingerPoints(FINGER_NUM_3, SIMULATE_POINT_ID, DISPLAY_100, DISPLAY_800, DISPLAY_100, 0);
+    ReplayMultiFingerSwipe(startPoints, endPoints);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_THREE_FINGER_SWIPE_DOWN));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_031 end";
+}
+
+/**
+ * @tc.number: OnPointerEvent032
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay the three-finger double tap trace of simulated pointers.
+ */
+HWTEST_F(TouchExplorationTest, TouchExploration_Unittest_OnPointerEvent_032, TestSize.Level0)
+{
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_032 start";
+
+    AccessibilityAbilityHelper::GetInstance().SetGestureId(ACTION_INVALID);
+    std::vector<MMI::PointerEvent::PointerItem> fingers =
+        CreateFingerPoints(FINGER_NUM_3, SIMULATE_POINT_ID, DISPLAY_100, DISPLAY_100, DISPLAY_100, 0);
+    ReplayMultiFingerTap(fingers, TAP_TIMES_2, false);
+    sleep(SLEEP_S_1);
+
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetGestureId(),
+        static_cast<int>(GestureType::GESTURE_THREE_FINGER_DOUBLE_TAP));
+
+    GTEST_LOG_(INFO) << "TouchExploration_Unittest_OnPointerEvent_032 end";
+}
 } // namespace Accessibility
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 #include <map>
 #include <memory>
+#include "accessibility_allocation_counter.h"
 #include "accessibility_ut_helper.h"
 #include "accessibility_zoom_gesture.h"
 #include "full_screen_magnification_manager.h"
@@ -38,6 +39,10 @@ namespace {
     constexpr int32_t INVALID_POINTER_ACTION = -1;
     constexpr int32_t READY_STATE = 0;
     constexpr int32_t ZOOM_STATE = 1;
+    constexpr int32_t REPLAY_COUNT = 1000;
+    constexpr int32_t CACHED_MOVE_COUNT = 100;
+    constexpr int32_t DISPLAY_100 = 100;
+    constexpr int32_t DISPLAY_5000 = 5000;
 } // namespace
 class AccessibilityZoomGestureUnitTest : public ::testing::Test {
 public:
@@ -2354,5 +2359,141 @@ HWTEST_F(AccessibilityZoomGestureUnitTest, AccessibilityZoomGesture_Unittest_Han
     GTEST_LOG_(INFO) << "AccessibilityZoomGesture_Unittest_HandleTDZoomMenu_001 end";
 }
 
+/**
+ * @tc.number: AccessibilityZoomGesture_Unittest_OnPointerEvent_034
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Replay moves passed through in zoom state, no allocation is made and the events are left unchanged.
+ */
+HWTEST_F(AccessibilityZoomGestureUnitTest, AccessibilityZoomGesture_Unittest_OnPointerEvent_034, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityZoomGesture_Unittest_OnPointerEvent_034 start";
+    zoomGesture_->SetGestureMode(THREE_FINGER_DOUBLE_TAP_MODE);
+    zoomGesture_->StartMagnificationInteract();
+    AccessibilityAbilityHelper::GetInstance().SetZoomState(true);
+
+    MMI::PointerEvent::PointerItem point = {};
+    SetPointerItem(point, POINT_ID_0, DISPLAY_100, DISPLAY_100);
+    std::vector<MMI::PointerEvent::PointerItem> points = {point};
+    std::shared_ptr<MMI::PointerEvent> eventDown = CreatePointerEvent(
+        MMI::PointerEvent::POINTER_ACTION_DOWN, points, POINT_ID_0);
+    EXPECT_TRUE(eventDown != nullptr);
+    zoomGesture_->OnPointerEvent(*eventDown);
+
+    // the events are created before the replay, so only the work of the gesture is measured
+    std::vector<std::shared_ptr<MMI::PointerEvent>> moveEvents;
+    for (int32_t i = 0; i < REPLAY_COUNT; i++) {
+        SetPointerItem(point, POINT_ID_0, DISPLAY_5000 + i, DISPLAY_5000 + i);
+        points = {point};
+        moveEvents.push_back(CreatePointerEvent(MMI::PointerEvent::POINTER_ACTION_MOVE, points, POINT_ID_0));
+    }
+    // the first move passes the cached down through, the others are sent once to warm up the helper
+    for (auto &event : moveEvents) {
+        zoomGesture_->OnPointerEvent(*event);
+    }
+    AccessibilityAbilityHelper::GetInstance().ClearTouchEventActionVector();
+
+    uint64_t allocationCount = AllocationCounter::GetCount();
+    for (auto &event : moveEvents) {
+        zoomGesture_->OnPointerEvent(*event);
+    }
+    uint64_t allocations = AllocationCounter::GetCount() - allocationCount;
+    GTEST_LOG_(INFO) << "replay " << REPLAY_COUNT << " moves in zoom state: " << allocations << " allocations";
+    EXPECT_EQ(allocations, 0U);
+    EXPECT_EQ(AccessibilityAbilityHelper::GetInstance().GetTouchEventActionVector().size(),
+        static_cast<size_t>(REPLAY_COUNT));
+
+    // the coordinates are converted for the next transmitter only
+    MMI::PointerEvent::PointerItem item = {};
+    EXPECT_TRUE(moveEvents[0]->GetPointerItem(POINT_ID_0, item));
+    EXPECT_EQ(item.GetDisplayX(), DISPLAY_5000);
+    EXPECT_EQ(item.GetDisplayY(), DISPLAY_5000);
+    GTEST_LOG_(INFO) << "AccessibilityZoomGesture_Unittest_OnPointerEvent_034 end";
+}
+
+/**
+ * @tc.number: AccessibilityZoomGesture_Unittest_OnPointerEvent_035
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Cache more events than the preallocated slots, all of them are sent in order when the tap fails.
+ */
+HWTEST_F(AccessibilityZoomGestureUnitTest, AccessibilityZoomGesture_Unittest_OnPointerEvent_035, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityZoomGesture_Unittest_OnPointerEvent_035 start";
+    zoomGesture_->SetGestureMode(SINGLE_FINGER_TRIPLE_TAP_MODE);
+    AccessibilityAbilityHelper::GetInstance().ClearTouchEventActionVector();
+
+    MMI::PointerEvent::PointerItem point = {};
+    SetPointerItem(point, POINT_ID_0, DISPLAY_100, DISPLAY_100);
+    std::vector<MMI::PointerEvent::PointerItem> points = {point};
+    std::shared_ptr<MMI::PointerEvent> eventDown = CreatePointerEvent(
+        MMI::PointerEvent::POINTER_ACTION_DOWN, points, POINT_ID_0);
+    EXPECT_TRUE(eventDown != nullptr);
+    zoomGesture_->OnPointerEvent(*eventDown);
+    // the finger does not move, the moves are held until the tap is recognized
+    std::shared_ptr<MMI::PointerEvent> eventMove = CreatePointerEvent(
+        MMI::PointerEvent::POINTER_ACTION_MOVE, points, POINT_ID_0);
+    EXPECT_TRUE(eventMove != nullptr);
+    for (int32_t i = 0; i < CACHED_MOVE_COUNT; i++) {
+        zoomGesture_->OnPointerEvent(*eventMove);
+    }
+
+    SetPointerItem(point, POINT_ID_0, DISPLAY_5000, DISPLAY_5000);
+    points = {point};
+    std::shared_ptr<MMI::PointerEvent> eventFarMove = CreatePointerEvent(
+        MMI::PointerEvent::POINTER_ACTION_MOVE, points, POINT_ID_0);
+    EXPECT_TRUE(eventFarMove != nullptr);
+    zoomGesture_->OnPointerEvent(*eventFarMove);
+
+    std::vector<int32_t> touchActions = AccessibilityAbilityHelper::GetInstance().GetTouchEventActionVector();
+    EXPECT_EQ(touchActions.size(), static_cast<size_t>(CACHED_MOVE_COUNT + 2));
+    if (!touchActions.empty()) {
+        EXPECT_EQ(touchActions.front(), MMI::PointerEvent::POINTER_ACTION_DOWN);
+    }
+    for (size_t i = 1; i < touchActions.size(); i++) {
+        EXPECT_EQ(touchActions[i], MMI::PointerEvent::POINTER_ACTION_MOVE);
+    }
+    GTEST_LOG_(INFO) << "AccessibilityZoomGesture_Unittest_OnPointerEvent_035 end";
+}
+
+/**
+ * @tc.number: AccessibilityZoomGesture_Unittest_OnPointerEvent_036
+ * @tc.name: OnPointerEvent
+ * @tc.desc: Cache a gesture shaped like the one cached before it, the cached events are refilled in place and no
+ *           allocation is made.
+ */
+HWTEST_F(AccessibilityZoomGestureUnitTest, AccessibilityZoomGesture_Unittest_OnPointerEvent_036, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AccessibilityZoomGesture_Unittest_OnPointerEvent_036 start";
+    MMI::PointerEvent::PointerItem point = {};
+    SetPointerItem(point, POINT_ID_0, DISPLAY_100, DISPLAY_100);
+    std::vector<MMI::PointerEvent::PointerItem> points = {point};
+    std::shared_ptr<MMI::PointerEvent> eventDown = CreatePointerEvent(
+        MMI::PointerEvent::POINTER_ACTION_DOWN, points, POINT_ID_0);
+    EXPECT_TRUE(eventDown != nullptr);
+    std::shared_ptr<MMI::PointerEvent> eventMove = CreatePointerEvent(
+        MMI::PointerEvent::POINTER_ACTION_MOVE, points, POINT_ID_0);
+    EXPECT_TRUE(eventMove != nullptr);
+    std::shared_ptr<MMI::PointerEvent> eventUp = CreatePointerEvent(
+        MMI::PointerEvent::POINTER_ACTION_UP, points, POINT_ID_0);
+    EXPECT_TRUE(eventUp != nullptr);
+
+    ZoomGestureEventCache cache;
+    int32_t replayed = 0;
+    // the first gesture fills the cache, the counted one refills it
+    uint64_t allocations = AllocationCounter::Count([&] {
+        cache.Push(*eventDown);
+        for (int32_t i = 0; i < CACHED_MOVE_COUNT; i++) {
+            cache.Push(*eventMove);
+        }
+        cache.Push(*eventUp);
+        replayed = 0;
+        cache.ForEach([&replayed](MMI::PointerEvent &) { replayed++; });
+        cache.Clear();
+    });
+    GTEST_LOG_(INFO) << "cache " << CACHED_MOVE_COUNT << " moves: " << allocations << " allocations";
+    EXPECT_EQ(0U, allocations);
+    EXPECT_EQ(CACHED_MOVE_COUNT + 2, replayed);
+    GTEST_LOG_(INFO) << "AccessibilityZoomGesture_Unittest_OnPointerEvent_036 end";
+}
+
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
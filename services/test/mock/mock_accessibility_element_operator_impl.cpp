@@ -371,5 +371,37 @@ void MockAccessibilityElementOperatorImpl::RemoveAccessibilityVirtualNode(const
     }
     return;
 }
+
+void MockAccessibilityElementOperatorImpl::SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter)
+{
+    (void)isFilter;
+    if (callback == nullptr) {
+        return;
+    }
+    std::vector<ElementSearchResult> results(queries.size());
+    callback->SetSearchElementInfosBatchResult(results, requestId);
+}
+
+RetError MockAccessibilityElementOperatorImpl::GrantElementOperator(const int32_t grantId,
+    sptr<IRemoteObject> &grantedOperator)
+{
+    (void)grantId;
+    (void)grantedOperator;
+    return RET_ERR_FAILED;
+}
+
+void MockAccessibilityElementOperatorImpl::RevokeElementOperator(const int32_t grantId)
+{
+    (void)grantId;
+}
+
+void MockAccessibilityElementOperatorImpl::SearchElementTreeDiff(const uint64_t sinceGeneration,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    (void)sinceGeneration;
+    (void)requestId;
+    (void)callback;
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file
@@ -257,6 +257,16 @@ public:
     void RemoveAccessibilityVirtualNode(const int64_t id, const int32_t requestId,
         const sptr<IAccessibilityElementOperatorCallback> &callback) override;
 
+    void SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter = false) override;
+
+    RetError GrantElementOperator(const int32_t grantId, sptr<IRemoteObject> &grantedOperator) override;
+
+    void RevokeElementOperator(const int32_t grantId) override;
+
+    void SearchElementTreeDiff(const uint64_t sinceGeneration, const int32_t requestId,
+        const sptr<IAccessibilityElementOperatorCallback> &callback) override;
+
 private:
     int32_t AddRequest(int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback);
 
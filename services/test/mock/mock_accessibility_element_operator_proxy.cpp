@@ -202,5 +202,35 @@ void MockAccessibilityElementOperatorProxy::RemoveAccessibilityVirtualNode(const
     (void)requestId;
     (void)callback;
 }
+
+void MockAccessibilityElementOperatorProxy::SearchElementInfosBatch(const std::vector<ElementSearchQuery> &queries,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback, bool isFilter)
+{
+    (void)queries;
+    (void)requestId;
+    (void)callback;
+    (void)isFilter;
+}
+
+RetError MockAccessibilityElementOperatorProxy::GrantElementOperator(const int32_t grantId,
+    sptr<IRemoteObject> &grantedOperator)
+{
+    (void)grantId;
+    (void)grantedOperator;
+    return RET_ERR_FAILED;
+}
+
+void MockAccessibilityElementOperatorProxy::RevokeElementOperator(const int32_t grantId)
+{
+    (void)grantId;
+}
+
+void MockAccessibilityElementOperatorProxy::SearchElementTreeDiff(const uint64_t sinceGeneration,
+    const int32_t requestId, const sptr<IAccessibilityElementOperatorCallback> &callback)
+{
+    (void)sinceGeneration;
+    (void)requestId;
+    (void)callback;
+}
 } // namespace Accessibility
 } // namespace OHOS
\ No newline at end of file